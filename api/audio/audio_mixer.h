@@ -12,8 +12,10 @@
 #define API_AUDIO_AUDIO_MIXER_H_
 
 #include <memory>
+#include <optional>
 
 #include "api/audio/audio_frame.h"
+#include "api/rtp_headers.h"
 #include "rtc_base/ref_count.h"
 
 namespace webrtc {
@@ -48,6 +50,25 @@ class AudioMixer : public RefCountInterface {
     // with this sample rate or higher will not cause quality loss.
     virtual int PreferredSampleRate() const = 0;
 
+    // Optional, for mixers that only mix the loudest sources. Returns the
+    // level of the audio that is about to be played out, as far as it is
+    // known without decoding, e.g. from the RTP audio level header extension
+    // (RFC 6464) of the most recently received packet. Returns nullopt if
+    // the level is unknown.
+    virtual std::optional<AudioLevel> GetAudioLevelHint() const {
+      return std::nullopt;
+    }
+
+    // Called instead of GetAudioFrameWithInfo() when the mixer does not use
+    // the next 10 ms of audio of this source. Sources that must be pulled at
+    // a steady pace, e.g. to keep a jitter buffer running, should advance
+    // their state here as cheaply as they can. The default pulls a frame and
+    // drops it.
+    virtual void SkipAudioFrame(int sample_rate_hz) {
+      AudioFrame audio_frame;
+      GetAudioFrameWithInfo(sample_rate_hz, &audio_frame);
+    }
+
     virtual ~Source() {}
   };
 
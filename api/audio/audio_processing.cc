@@ -210,7 +210,9 @@ std::string AudioProcessing::Config::ToString() const {
           << ", max_output_noise_level_dbfs: "
           << gain_controller2.adaptive_digital.max_output_noise_level_dbfs
           << " }, input_volume_control : { enabled "
-          << gain_controller2.input_volume_controller.enabled << "}}";
+          << gain_controller2.input_volume_controller.enabled
+          << "}}, submodule_timing: { enabled: " << submodule_timing.enabled
+          << " }}";
   return builder.str();
 }
 
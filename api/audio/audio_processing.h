@@ -381,6 +381,14 @@ class RTC_EXPORT AudioProcessing : public RefCountInterface {
       } fixed_digital;
     } gain_controller2;
 
+    // Enables measuring the time spent by each submodule on the capture
+    // stream. The measurements are reported through
+    // AudioProcessingStats::submodule_timing and cost two clock reads per
+    // submodule call.
+    struct SubmoduleTiming {
+      bool enabled = false;
+    } submodule_timing;
+
     std::string ToString() const;
   };
 
@@ -13,11 +13,28 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <optional>
 
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
+
+// Processing time statistics of one submodule of the capture stream.
+struct RTC_EXPORT SubmoduleTimingStats {
+  static constexpr int kNumHistogramBuckets = 16;
+
+  // Number of capture frames that the submodule has processed.
+  int num_frames = 0;
+  // Total and maximum processing time per frame, in microseconds.
+  int64_t total_time_us = 0;
+  int64_t max_time_us = 0;
+  // Histogram of the processing time per frame. Bucket 0 counts the frames
+  // processed in less than one microsecond and bucket i > 0 those processed in
+  // [2^(i-1), 2^i) microseconds. The last bucket also counts all longer times.
+  std::array<int, kNumHistogramBuckets> histogram = {};
+};
+
 // This version of the stats uses Optionals, it will replace the regular
 // AudioProcessingStatistics struct.
 struct RTC_EXPORT AudioProcessingStats {
@@ -61,6 +78,31 @@ struct RTC_EXPORT AudioProcessingStats {
   // milliseconds and the value is the instantaneous value at the time of the
   // call to `GetStatistics()`.
   std::optional<int32_t> delay_ms;
+
+  // The time spent on the capture stream by each submodule, accumulated since
+  // AudioProcessing::Config::submodule_timing was enabled. Only reported when
+  // it is enabled, and only for the submodules that have processed any frames.
+  // A submodule called several times for a frame, e.g. for analysis and for
+  // processing, has the sum of these calls counted as the time of the frame.
+  struct SubmoduleTiming {
+    // Splitting of the capture signal into frequency bands and merging of the
+    // bands after the processing.
+    std::optional<SubmoduleTimingStats> band_splitting;
+    std::optional<SubmoduleTimingStats> capture_levels_adjuster;
+    std::optional<SubmoduleTimingStats> high_pass_filter;
+    std::optional<SubmoduleTimingStats> echo_controller;
+    std::optional<SubmoduleTimingStats> echo_control_mobile;
+    std::optional<SubmoduleTimingStats> noise_suppressor;
+    std::optional<SubmoduleTimingStats> gain_controller1;
+    std::optional<SubmoduleTimingStats> gain_controller2;
+    std::optional<SubmoduleTimingStats> echo_detector;
+    std::optional<SubmoduleTimingStats> capture_analyzer;
+    std::optional<SubmoduleTimingStats> capture_post_processor;
+    // The processing of the whole capture frame, including the work that is
+    // not attributed to any of the submodules above.
+    std::optional<SubmoduleTimingStats> total;
+  };
+  std::optional<SubmoduleTiming> submodule_timing;
 };
 
 }  // namespace webrtc
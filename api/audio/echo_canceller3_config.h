@@ -94,6 +94,10 @@ struct RTC_EXPORT EchoCanceller3Config {
     bool use_linear_filter = true;
     bool high_pass_filter_echo_reference = false;
     bool export_linear_aec_output = false;
+    // Number of worker threads, in addition to the capture thread, over which
+    // the adaptive filtering of the capture channels is spread. Zero processes
+    // all channels on the capture thread. The output does not depend on it.
+    int num_worker_threads = 0;
   } filter;
 
   struct Erle {
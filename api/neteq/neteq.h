@@ -234,6 +234,19 @@ class NetEq {
       int* current_sample_rate_hz = nullptr,
       std::optional<Operation> action_override = std::nullopt) = 0;
 
+  // Like GetAudio, but for audio that won't be played out, e.g. a stream that
+  // an audio mixer leaves out. The jitter buffer, playout timestamp and delay
+  // estimate advance as for GetAudio, but packets due for playout are not
+  // decoded: each one is replaced by silence of the same duration, and
+  // packet loss is concealed without the decoder. The decoder state is not
+  // updated, so audio decoded afterwards starts as after a packet loss.
+  // The output has speech type AudioFrame::kUndefined, and it is not counted
+  // in the statistics of the played out audio.
+  // Returns kOK on success, or kFail in case of an error.
+  virtual int GetAudioWithoutDecoding(AudioFrame* audio_frame) {
+    return GetAudio(audio_frame);
+  }
+
   // Replaces the current set of decoders with the given one.
   virtual void SetCodecs(const std::map<int, SdpAudioFormat>& codecs) = 0;
 
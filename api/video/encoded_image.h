@@ -18,6 +18,7 @@
 #include <optional>
 #include <utility>
 
+#include "api/array_view.h"
 #include "api/ref_count.h"
 #include "api/rtp_packet_infos.h"
 #include "api/scoped_refptr.h"
@@ -48,6 +49,15 @@ class EncodedImageBufferInterface : public RefCountInterface {
   virtual uint8_t* data() = 0;
   virtual size_t size() const = 0;
 
+  // Buffers that keep the data in several pieces, e.g. the payloads of the
+  // RTP packets of a received frame, return the pieces in order. Reading them
+  // avoids the copy that joins them into the contiguous data(). Returns an
+  // empty view if the data is contiguous.
+  virtual rtc::ArrayView<const rtc::ArrayView<const uint8_t>> fragments()
+      const {
+    return {};
+  }
+
   const uint8_t* begin() const { return data(); }
   const uint8_t* end() const { return data() + size(); }
 };
@@ -195,7 +205,12 @@ class RTC_EXPORT EncodedImage {
   }
 
   const uint8_t* data() const {
-    return encoded_data_ ? encoded_data_->data() : nullptr;
+    // Read through the const data(), which lets a fragmented buffer avoid
+    // making a writable copy.
+    return encoded_data_ ? static_cast<const EncodedImageBufferInterface&>(
+                               *encoded_data_)
+                               .data()
+                         : nullptr;
   }
 
   const uint8_t* begin() const { return data(); }
@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/fragmented_encoded_image_buffer.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+// static
+scoped_refptr<FragmentedEncodedImageBuffer>
+FragmentedEncodedImageBuffer::Create() {
+  return make_ref_counted<FragmentedEncodedImageBuffer>();
+}
+
+// static
+scoped_refptr<FragmentedEncodedImageBuffer>
+FragmentedEncodedImageBuffer::Create(
+    rtc::ArrayView<const rtc::CopyOnWriteBuffer> fragments) {
+  scoped_refptr<FragmentedEncodedImageBuffer> buffer = Create();
+  buffer->fragments_.reserve(fragments.size());
+  buffer->payloads_.reserve(fragments.size());
+  for (const rtc::CopyOnWriteBuffer& fragment : fragments) {
+    buffer->Append(fragment);
+  }
+  return buffer;
+}
+
+FragmentedEncodedImageBuffer::FragmentedEncodedImageBuffer() = default;
+FragmentedEncodedImageBuffer::~FragmentedEncodedImageBuffer() = default;
+
+void FragmentedEncodedImageBuffer::Append(rtc::CopyOnWriteBuffer fragment) {
+  if (fragment.size() == 0) {
+    return;
+  }
+  // The const cdata() never detaches the buffer, so the view stays valid
+  // while `payloads_` holds a reference to it.
+  AppendView(rtc::MakeArrayView(fragment.cdata(), fragment.size()));
+  payloads_.push_back(std::move(fragment));
+}
+
+void FragmentedEncodedImageBuffer::Append(
+    scoped_refptr<EncodedImageBufferInterface> buffer,
+    size_t size) {
+  if (size == 0) {
+    return;
+  }
+  RTC_DCHECK(buffer);
+  RTC_DCHECK_LE(size, buffer->size());
+  rtc::ArrayView<const rtc::ArrayView<const uint8_t>> fragments =
+      buffer->fragments();
+  if (fragments.empty()) {
+    const EncodedImageBufferInterface& const_buffer = *buffer;
+    AppendView(rtc::MakeArrayView(const_buffer.data(), size));
+  } else {
+    for (rtc::ArrayView<const uint8_t> fragment : fragments) {
+      if (size == 0) {
+        break;
+      }
+      const size_t fragment_size = std::min(fragment.size(), size);
+      AppendView(fragment.subview(0, fragment_size));
+      size -= fragment_size;
+    }
+  }
+  buffers_.push_back(std::move(buffer));
+}
+
+void FragmentedEncodedImageBuffer::AppendView(
+    rtc::ArrayView<const uint8_t> fragment) {
+  RTC_DCHECK(!flat_data_.load(std::memory_order_relaxed))
+      << "Appending to a buffer that has been read.";
+  fragments_.push_back(fragment);
+  size_ += fragment.size();
+}
+
+const uint8_t* FragmentedEncodedImageBuffer::data() const {
+  const uint8_t* flat_data = flat_data_.load(std::memory_order_acquire);
+  return flat_data ? flat_data : Flatten();
+}
+
+uint8_t* FragmentedEncodedImageBuffer::data() {
+  MutexLock lock(&flatten_lock_);
+  if (!writable_) {
+    // The const data() may point into a shared fragment. Make a private copy
+    // unless it has already joined the fragments into `flat_buffer_`.
+    if (flat_buffer_.empty()) {
+      JoinFragments();
+    }
+    writable_ = true;
+    flat_data_.store(flat_buffer_.data(), std::memory_order_release);
+  }
+  return flat_buffer_.data();
+}
+
+rtc::ArrayView<const rtc::ArrayView<const uint8_t>>
+FragmentedEncodedImageBuffer::fragments() const {
+  if (writable_) {
+    return {};
+  }
+  return fragments_;
+}
+
+bool FragmentedEncodedImageBuffer::is_flattened() const {
+  MutexLock lock(&flatten_lock_);
+  return !flat_buffer_.empty();
+}
+
+const uint8_t* FragmentedEncodedImageBuffer::Flatten() const {
+  MutexLock lock(&flatten_lock_);
+  const uint8_t* flat_data = flat_data_.load(std::memory_order_relaxed);
+  if (flat_data) {
+    return flat_data;
+  }
+  if (fragments_.size() == 1) {
+    flat_data = fragments_[0].data();
+  } else {
+    JoinFragments();
+    flat_data = flat_buffer_.data();
+  }
+  flat_data_.store(flat_data, std::memory_order_release);
+  return flat_data;
+}
+
+void FragmentedEncodedImageBuffer::JoinFragments() const {
+  flat_buffer_.SetSize(size_);
+  uint8_t* write_at = flat_buffer_.data();
+  for (rtc::ArrayView<const uint8_t> fragment : fragments_) {
+    memcpy(write_at, fragment.data(), fragment.size());
+    write_at += fragment.size();
+  }
+}
+
+}  // namespace webrtc
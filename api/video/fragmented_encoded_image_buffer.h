@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_FRAGMENTED_ENCODED_IMAGE_BUFFER_H_
+#define API_VIDEO_FRAGMENTED_ENCODED_IMAGE_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// An encoded image buffer that refers to the pieces the image was received in,
+// e.g. the payloads of its RTP packets or the buffers of its spatial layers,
+// instead of copying them into one allocation. The pieces are only joined
+// when someone asks for contiguous data:
+//  - The const data() joins them once, on first use, and keeps the result.
+//    A buffer of a single piece returns that piece without copying.
+//  - The non-const data() always returns a private copy, so that writes, e.g.
+//    inline decryption, never reach the shared pieces. fragments() is empty
+//    from then on.
+// Consumers that can take the pieces read fragments() and avoid the copy
+// altogether.
+class RTC_EXPORT FragmentedEncodedImageBuffer
+    : public EncodedImageBufferInterface {
+ public:
+  static scoped_refptr<FragmentedEncodedImageBuffer> Create();
+  static scoped_refptr<FragmentedEncodedImageBuffer> Create(
+      rtc::ArrayView<const rtc::CopyOnWriteBuffer> fragments);
+
+  // Append the pieces of the image in order. Must be called before the
+  // buffer is read or shared with another thread.
+  void Append(rtc::CopyOnWriteBuffer fragment);
+  // Appends the first `size` bytes of `buffer`. If `buffer` has fragments,
+  // they are appended instead of its data.
+  void Append(scoped_refptr<EncodedImageBufferInterface> buffer, size_t size);
+
+  const uint8_t* data() const override;
+  uint8_t* data() override;
+  size_t size() const override { return size_; }
+  rtc::ArrayView<const rtc::ArrayView<const uint8_t>> fragments()
+      const override;
+
+  // Whether data() has joined the fragments.
+  bool is_flattened() const;
+
+ protected:
+  FragmentedEncodedImageBuffer();
+  ~FragmentedEncodedImageBuffer() override;
+
+ private:
+  void AppendView(rtc::ArrayView<const uint8_t> fragment);
+  const uint8_t* Flatten() const;
+  void JoinFragments() const RTC_EXCLUSIVE_LOCKS_REQUIRED(flatten_lock_);
+
+  size_t size_ = 0;
+  std::vector<rtc::ArrayView<const uint8_t>> fragments_;
+  // Own the memory of `fragments_`.
+  std::vector<rtc::CopyOnWriteBuffer> payloads_;
+  std::vector<scoped_refptr<EncodedImageBufferInterface>> buffers_;
+
+  mutable Mutex flatten_lock_;
+  // The joined fragments, or the only fragment, once data() is called.
+  mutable std::atomic<const uint8_t*> flat_data_{nullptr};
+  mutable rtc::Buffer flat_buffer_ RTC_GUARDED_BY(flatten_lock_);
+  // Set once the non-const data() has handed out `flat_buffer_`. Like any
+  // write to the data, that must not race with readers.
+  bool writable_ = false;
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_FRAGMENTED_ENCODED_IMAGE_BUFFER_H_
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/fragmented_encoded_image_buffer.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
+using ::testing::SizeIs;
+
+std::vector<uint8_t> Contents(const EncodedImageBufferInterface& buffer) {
+  return std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+}
+
+TEST(FragmentedEncodedImageBufferTest, RefersToTheFragments) {
+  const uint8_t kFirst[] = {1, 2, 3};
+  const uint8_t kSecond[] = {4, 5};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kFirst),
+                                             rtc::CopyOnWriteBuffer(kSecond)};
+  auto buffer = FragmentedEncodedImageBuffer::Create(payloads);
+
+  EXPECT_EQ(buffer->size(), 5u);
+  ASSERT_THAT(buffer->fragments(), SizeIs(2));
+  EXPECT_EQ(buffer->fragments()[0].data(), payloads[0].cdata());
+  EXPECT_EQ(buffer->fragments()[1].data(), payloads[1].cdata());
+  EXPECT_FALSE(buffer->is_flattened());
+}
+
+TEST(FragmentedEncodedImageBufferTest, SingleFragmentIsNotCopied) {
+  const uint8_t kPayload[] = {1, 2, 3};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kPayload)};
+  auto buffer = FragmentedEncodedImageBuffer::Create(payloads);
+  const EncodedImageBufferInterface& const_buffer = *buffer;
+
+  EXPECT_EQ(const_buffer.data(), payloads[0].cdata());
+  EXPECT_FALSE(buffer->is_flattened());
+}
+
+TEST(FragmentedEncodedImageBufferTest, ConstDataJoinsTheFragmentsOnce) {
+  const uint8_t kFirst[] = {1, 2, 3};
+  const uint8_t kSecond[] = {4, 5};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kFirst),
+                                             rtc::CopyOnWriteBuffer(kSecond)};
+  auto buffer = FragmentedEncodedImageBuffer::Create(payloads);
+  const EncodedImageBufferInterface& const_buffer = *buffer;
+
+  EXPECT_THAT(Contents(const_buffer), ElementsAre(1, 2, 3, 4, 5));
+  EXPECT_TRUE(buffer->is_flattened());
+  EXPECT_EQ(const_buffer.data(), const_buffer.data());
+  // The fragments stay available to consumers that prefer them.
+  EXPECT_THAT(buffer->fragments(), SizeIs(2));
+}
+
+TEST(FragmentedEncodedImageBufferTest, WritableDataIsAPrivateCopy) {
+  const uint8_t kPayload[] = {1, 2, 3};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kPayload)};
+  auto buffer = FragmentedEncodedImageBuffer::Create(payloads);
+
+  uint8_t* data = buffer->data();
+  EXPECT_NE(data, payloads[0].cdata());
+  data[0] = 42;
+
+  EXPECT_THAT(rtc::MakeArrayView(payloads[0].cdata(), payloads[0].size()),
+              ElementsAre(1, 2, 3));
+  EXPECT_THAT(Contents(*buffer), ElementsAre(42, 2, 3));
+  EXPECT_THAT(buffer->fragments(), IsEmpty());
+}
+
+TEST(FragmentedEncodedImageBufferTest, AppendsTheFragmentsOfOtherBuffers) {
+  const uint8_t kFirst[] = {1, 2, 3};
+  const uint8_t kSecond[] = {4, 5};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kFirst),
+                                             rtc::CopyOnWriteBuffer(kSecond)};
+  const uint8_t kLayer[] = {6, 7, 8};
+
+  auto combined = FragmentedEncodedImageBuffer::Create();
+  // Only the first four bytes of the fragmented buffer belong to the image.
+  combined->Append(FragmentedEncodedImageBuffer::Create(payloads), 4);
+  combined->Append(EncodedImageBuffer::Create(kLayer, sizeof(kLayer)), 3);
+
+  EXPECT_EQ(combined->size(), 7u);
+  ASSERT_THAT(combined->fragments(), SizeIs(3));
+  EXPECT_EQ(combined->fragments()[0].data(), payloads[0].cdata());
+  EXPECT_THAT(combined->fragments()[1], ElementsAre(4));
+  EXPECT_THAT(Contents(*combined), ElementsAreArray({1, 2, 3, 4, 6, 7, 8}));
+}
+
+TEST(FragmentedEncodedImageBufferTest, EncodedImageReadsWithoutCopying) {
+  const uint8_t kPayload[] = {1, 2, 3};
+  const rtc::CopyOnWriteBuffer payloads[] = {rtc::CopyOnWriteBuffer(kPayload)};
+  EncodedImage image;
+  image.SetEncodedData(FragmentedEncodedImageBuffer::Create(payloads));
+
+  EXPECT_EQ(image.data(), payloads[0].cdata());
+}
+
+}  // namespace
+}  // namespace webrtc
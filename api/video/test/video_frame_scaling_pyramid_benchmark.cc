@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
+#include "benchmark/benchmark.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kWidth = 1920;
+constexpr int kHeight = 1080;
+// The downscaled simulcast layers, in the order SimulcastEncoderAdapter
+// encodes them without a scaling pyramid. The top layer is the input frame.
+constexpr int kLayerWidths[] = {480, 960};
+constexpr int kLayerHeights[] = {270, 540};
+
+scoped_refptr<I420Buffer> CreateInput() {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(kWidth, kHeight);
+  uint32_t seed = 1;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      seed = seed * 1664525u + 1013904223u;
+      buffer->MutableDataY()[y * buffer->StrideY() + x] = seed >> 24;
+    }
+  }
+  for (int y = 0; y < buffer->ChromaHeight(); ++y) {
+    for (int x = 0; x < buffer->ChromaWidth(); ++x) {
+      buffer->MutableDataU()[y * buffer->StrideU() + x] = x;
+      buffer->MutableDataV()[y * buffer->StrideV() + x] = y;
+    }
+  }
+  return buffer;
+}
+
+// The capture side scaling of a 1080p frame sent with three simulcast
+// layers: the simulcast encoders, and optionally corruption detection, which
+// samples every layer at its encoded resolution. Without the scaling pyramid
+// every consumer scales the full resolution frame on its own. With it, every
+// layer is scaled once, from the next larger one.
+void BM_ScaleForSimulcast(benchmark::State& state) {
+  const bool use_pyramid = state.range(0) != 0;
+  const bool corruption_detection = state.range(1) != 0;
+  const VideoFrame input_frame =
+      VideoFrame::Builder().set_video_frame_buffer(CreateInput()).build();
+  for (auto s : state) {
+    VideoFrame frame = input_frame;
+    if (use_pyramid) {
+      frame.AttachScalingPyramid();
+      for (int i = 1; i >= 0; --i) {
+        benchmark::DoNotOptimize(
+            frame.ScaledVideoFrameBuffer(kLayerWidths[i], kLayerHeights[i]));
+      }
+    }
+    for (int i = 0; i < 2; ++i) {
+      benchmark::DoNotOptimize(
+          frame.ScaledVideoFrameBuffer(kLayerWidths[i], kLayerHeights[i]));
+    }
+    if (corruption_detection) {
+      for (int i = 0; i < 2; ++i) {
+        scoped_refptr<VideoFrameBuffer> sampled =
+            frame.ScaledVideoFrameBuffer(kLayerWidths[i], kLayerHeights[i]);
+        benchmark::DoNotOptimize(sampled->ToI420());
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ScaleForSimulcast)
+    ->ArgNames({"pyramid", "corruption_detection"})
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace webrtc
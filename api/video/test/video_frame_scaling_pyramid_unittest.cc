@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/video_frame_scaling_pyramid.h"
+
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// A buffer that remembers the buffer it was scaled from.
+class ScaledBuffer : public VideoFrameBuffer {
+ public:
+  ScaledBuffer(int width, int height, scoped_refptr<VideoFrameBuffer> source)
+      : width_(width), height_(height), source_(source) {}
+
+  Type type() const override { return Type::kNative; }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  scoped_refptr<I420BufferInterface> ToI420() override { return nullptr; }
+
+  scoped_refptr<VideoFrameBuffer> CropAndScale(int /* offset_x */,
+                                               int /* offset_y */,
+                                               int /* crop_width */,
+                                               int /* crop_height */,
+                                               int scaled_width,
+                                               int scaled_height) override {
+    return make_ref_counted<ScaledBuffer>(
+        scaled_width, scaled_height, scoped_refptr<VideoFrameBuffer>(this));
+  }
+
+  const VideoFrameBuffer* source() const { return source_.get(); }
+
+ private:
+  const int width_;
+  const int height_;
+  const scoped_refptr<VideoFrameBuffer> source_;
+};
+
+const VideoFrameBuffer* SourceOf(
+    const scoped_refptr<VideoFrameBuffer>& buffer) {
+  return static_cast<const ScaledBuffer*>(buffer.get())->source();
+}
+
+scoped_refptr<VideoFrameBuffer> CreateSource() {
+  return make_ref_counted<ScaledBuffer>(1920, 1080, nullptr);
+}
+
+TEST(VideoFrameScalingPyramidTest, ReturnsTheSourceForItsResolution) {
+  scoped_refptr<VideoFrameBuffer> source = CreateSource();
+  auto pyramid = make_ref_counted<VideoFrameScalingPyramid>(source);
+  EXPECT_EQ(pyramid->Scale(1920, 1080), source);
+  EXPECT_EQ(pyramid->num_levels(), 0);
+}
+
+TEST(VideoFrameScalingPyramidTest, ScalesEachResolutionOnce) {
+  scoped_refptr<VideoFrameBuffer> source = CreateSource();
+  auto pyramid = make_ref_counted<VideoFrameScalingPyramid>(source);
+  scoped_refptr<VideoFrameBuffer> scaled = pyramid->Scale(960, 540);
+  ASSERT_TRUE(scaled);
+  EXPECT_EQ(scaled->width(), 960);
+  EXPECT_EQ(scaled->height(), 540);
+  EXPECT_EQ(pyramid->Scale(960, 540), scaled);
+  EXPECT_EQ(pyramid->num_levels(), 1);
+}
+
+TEST(VideoFrameScalingPyramidTest, ScalesFromTheSmallestLargerLevel) {
+  scoped_refptr<VideoFrameBuffer> source = CreateSource();
+  auto pyramid = make_ref_counted<VideoFrameScalingPyramid>(source);
+  scoped_refptr<VideoFrameBuffer> level_720p = pyramid->Scale(1280, 720);
+  scoped_refptr<VideoFrameBuffer> level_540p = pyramid->Scale(960, 540);
+  EXPECT_EQ(SourceOf(level_720p), source.get());
+  EXPECT_EQ(SourceOf(level_540p), level_720p.get());
+  EXPECT_EQ(SourceOf(pyramid->Scale(480, 270)), level_540p.get());
+  // Not scaled from the 540p level, which is less wide.
+  EXPECT_EQ(SourceOf(pyramid->Scale(1000, 200)), level_720p.get());
+  EXPECT_EQ(pyramid->num_levels(), 4);
+}
+
+TEST(VideoFrameScalingPyramidTest, DoesNotCacheUpscaledBuffers) {
+  scoped_refptr<VideoFrameBuffer> source = CreateSource();
+  auto pyramid = make_ref_counted<VideoFrameScalingPyramid>(source);
+  scoped_refptr<VideoFrameBuffer> upscaled = pyramid->Scale(3840, 2160);
+  ASSERT_TRUE(upscaled);
+  EXPECT_EQ(SourceOf(upscaled), source.get());
+  EXPECT_EQ(pyramid->num_levels(), 0);
+}
+
+TEST(VideoFrameScalingPyramidTest, IsSharedByFrameCopiesWithTheSameBuffer) {
+  VideoFrame frame =
+      VideoFrame::Builder().set_video_frame_buffer(CreateSource()).build();
+  EXPECT_FALSE(frame.has_scaling_pyramid());
+  frame.AttachScalingPyramid();
+  VideoFrame copy = frame;
+  EXPECT_TRUE(copy.has_scaling_pyramid());
+  EXPECT_EQ(copy.ScaledVideoFrameBuffer(640, 360),
+            frame.ScaledVideoFrameBuffer(640, 360));
+
+  copy.set_video_frame_buffer(CreateSource());
+  EXPECT_FALSE(copy.has_scaling_pyramid());
+  EXPECT_NE(copy.ScaledVideoFrameBuffer(640, 360),
+            frame.ScaledVideoFrameBuffer(640, 360));
+}
+
+}  // namespace
+}  // namespace webrtc
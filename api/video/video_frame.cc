@@ -15,11 +15,13 @@
 #include <optional>
 #include <utility>
 
+#include "api/make_ref_counted.h"
 #include "api/rtp_packet_infos.h"
 #include "api/scoped_refptr.h"
 #include "api/units/timestamp.h"
 #include "api/video/color_space.h"
 #include "api/video/video_frame_buffer.h"
+#include "api/video/video_frame_scaling_pyramid.h"
 #include "api/video/video_rotation.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/time_utils.h"
@@ -343,9 +345,32 @@ rtc::scoped_refptr<VideoFrameBuffer> VideoFrame::video_frame_buffer() const {
 void VideoFrame::set_video_frame_buffer(
     const rtc::scoped_refptr<VideoFrameBuffer>& buffer) {
   RTC_CHECK(buffer);
+  if (buffer != video_frame_buffer_) {
+    scaling_pyramid_ = nullptr;
+  }
   video_frame_buffer_ = buffer;
 }
 
+void VideoFrame::AttachScalingPyramid() {
+  RTC_DCHECK(video_frame_buffer_);
+  if (!scaling_pyramid_) {
+    scaling_pyramid_ =
+        make_ref_counted<VideoFrameScalingPyramid>(video_frame_buffer_);
+  }
+}
+
+rtc::scoped_refptr<VideoFrameBuffer> VideoFrame::ScaledVideoFrameBuffer(
+    int width,
+    int height) const {
+  if (scaling_pyramid_) {
+    return scaling_pyramid_->Scale(width, height);
+  }
+  if (width == this->width() && height == this->height()) {
+    return video_frame_buffer_;
+  }
+  return video_frame_buffer_->Scale(width, height);
+}
+
 int64_t VideoFrame::render_time_ms() const {
   return timestamp_us() / rtc::kNumMicrosecsPerMillisec;
 }
@@ -22,6 +22,7 @@
 #include "api/units/timestamp.h"
 #include "api/video/color_space.h"
 #include "api/video/video_frame_buffer.h"
+#include "api/video/video_frame_scaling_pyramid.h"
 #include "api/video/video_rotation.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/system/rtc_export.h"
@@ -245,6 +246,17 @@ class RTC_EXPORT VideoFrame {
   void set_video_frame_buffer(
       const rtc::scoped_refptr<VideoFrameBuffer>& buffer);
 
+  // Attaches a VideoFrameScalingPyramid to the buffer, unless one is attached
+  // already. Copies of the frame share the pyramid until their buffer is
+  // replaced.
+  void AttachScalingPyramid();
+  bool has_scaling_pyramid() const { return scaling_pyramid_ != nullptr; }
+
+  // Returns the buffer scaled to `width`x`height`, or nullptr if it can't be
+  // scaled. Uses the scaling pyramid if one is attached.
+  rtc::scoped_refptr<VideoFrameBuffer> ScaledVideoFrameBuffer(int width,
+                                                              int height) const;
+
   // Return true if the frame is stored in a texture.
   bool is_texture() const {
     return video_frame_buffer()->type() == VideoFrameBuffer::Type::kNative;
@@ -300,6 +312,8 @@ class RTC_EXPORT VideoFrame {
   uint16_t id_;
   // An opaque reference counted handle that stores the pixel data.
   rtc::scoped_refptr<webrtc::VideoFrameBuffer> video_frame_buffer_;
+  // Downscaled versions of `video_frame_buffer_`, if attached.
+  rtc::scoped_refptr<VideoFrameScalingPyramid> scaling_pyramid_;
   uint32_t timestamp_rtp_;
   int64_t ntp_time_ms_;
   int64_t timestamp_us_;
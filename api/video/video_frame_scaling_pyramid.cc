@@ -0,0 +1,58 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/video_frame_scaling_pyramid.h"
+
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+VideoFrameScalingPyramid::VideoFrameScalingPyramid(
+    scoped_refptr<VideoFrameBuffer> source)
+    : source_(std::move(source)) {
+  RTC_DCHECK(source_);
+}
+
+scoped_refptr<VideoFrameBuffer> VideoFrameScalingPyramid::Scale(int width,
+                                                                int height) {
+  if (width == source_->width() && height == source_->height()) {
+    return source_;
+  }
+  // Upscaling from the source is not worth caching.
+  if (width > source_->width() || height > source_->height()) {
+    return source_->Scale(width, height);
+  }
+  MutexLock lock(&mutex_);
+  VideoFrameBuffer* scale_from = source_.get();
+  for (const scoped_refptr<VideoFrameBuffer>& level : levels_) {
+    if (level->width() == width && level->height() == height) {
+      return level;
+    }
+    if (level->width() >= width && level->height() >= height &&
+        level->width() * level->height() <
+            scale_from->width() * scale_from->height()) {
+      scale_from = level.get();
+    }
+  }
+  scoped_refptr<VideoFrameBuffer> scaled = scale_from->Scale(width, height);
+  if (scaled) {
+    levels_.push_back(scaled);
+  }
+  return scaled;
+}
+
+int VideoFrameScalingPyramid::num_levels() const {
+  MutexLock lock(&mutex_);
+  return levels_.size();
+}
+
+}  // namespace webrtc
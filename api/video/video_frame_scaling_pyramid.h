@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_VIDEO_FRAME_SCALING_PYRAMID_H_
+#define API_VIDEO_VIDEO_FRAME_SCALING_PYRAMID_H_
+
+#include <vector>
+
+#include "api/ref_counted_base.h"
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Caches the downscaled versions of a video frame buffer, so that consumers
+// that need the same frame at the same resolution, e.g. the simulcast
+// encoders, the encoder adaptation and corruption detection, scale it only
+// once. Each new resolution is scaled from the smallest cached level that is
+// at least as large, rather than from the full resolution source. The levels
+// are released together with the pyramid, i.e. with the last VideoFrame that
+// refers to it. Thread safe.
+class RTC_EXPORT VideoFrameScalingPyramid final
+    : public RefCountedNonVirtual<VideoFrameScalingPyramid> {
+ public:
+  explicit VideoFrameScalingPyramid(scoped_refptr<VideoFrameBuffer> source);
+
+  VideoFrameScalingPyramid(const VideoFrameScalingPyramid&) = delete;
+  VideoFrameScalingPyramid& operator=(const VideoFrameScalingPyramid&) =
+      delete;
+
+  const scoped_refptr<VideoFrameBuffer>& source() const { return source_; }
+
+  // Returns the source scaled to `width`x`height`, or nullptr if the buffer
+  // can't be scaled. Concurrent calls are serialized, so that every level is
+  // only scaled once.
+  scoped_refptr<VideoFrameBuffer> Scale(int width, int height);
+
+  // The number of downscaled buffers that are cached.
+  int num_levels() const;
+
+ private:
+  friend class RefCountedNonVirtual<VideoFrameScalingPyramid>;
+  ~VideoFrameScalingPyramid() = default;
+
+  const scoped_refptr<VideoFrameBuffer> source_;
+  mutable Mutex mutex_;
+  std::vector<scoped_refptr<VideoFrameBuffer>> levels_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_VIDEO_FRAME_SCALING_PYRAMID_H_
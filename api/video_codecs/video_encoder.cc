@@ -113,7 +113,8 @@ VideoEncoder::EncoderInfo::EncoderInfo()
           1,
           kMaxFramerateFraction)},
       supports_simulcast(false),
-      preferred_pixel_formats{VideoFrameBuffer::Type::kI420} {}
+      preferred_pixel_formats{VideoFrameBuffer::Type::kI420},
+      supports_encode_from_any_thread(false) {}
 
 VideoEncoder::EncoderInfo::EncoderInfo(const EncoderInfo&) = default;
 
@@ -198,6 +199,8 @@ std::string VideoEncoder::EncoderInfo::ToString() const {
   if (is_qp_trusted.has_value()) {
     oss << ", is_qp_trusted = " << is_qp_trusted.value();
   }
+  oss << ", supports_encode_from_any_thread = "
+      << supports_encode_from_any_thread;
   oss << "}";
   return oss.str();
 }
@@ -233,7 +236,8 @@ bool VideoEncoder::EncoderInfo::operator==(const EncoderInfo& rhs) const {
   }
 
   if (resolution_bitrate_limits != rhs.resolution_bitrate_limits ||
-      supports_simulcast != rhs.supports_simulcast) {
+      supports_simulcast != rhs.supports_simulcast ||
+      supports_encode_from_any_thread != rhs.supports_encode_from_any_thread) {
     return false;
   }
 
@@ -266,6 +266,11 @@ class RTC_EXPORT VideoEncoder {
     // configuration. This may be used to determine if the encoder has reached
     // its target video quality for static screenshare content.
     std::optional<int> min_qp;
+
+    // If true, Encode() may be called on any thread, as long as the calls are
+    // not concurrent and the other methods are still called on the encoder
+    // sequence. Required by Settings::parallel_simulcast_encoding.
+    bool supports_encode_from_any_thread;
   };
 
   struct RTC_EXPORT RateControlParameters {
@@ -340,6 +345,14 @@ class RTC_EXPORT VideoEncoder {
     // Experimental API - currently only supported by LibvpxVp8Encoder and
     // the OpenH264 encoder. If set, limits the number of encoder threads.
     std::optional<int> encoder_thread_limit;
+    // Experimental API - currently only supported by SimulcastEncoderAdapter.
+    // If set, the simulcast streams of a frame are encoded concurrently, on
+    // up to `number_of_cores` threads that the streams' encoders split
+    // between them. Encode() of the streams' encoders is then called on
+    // worker threads that may differ from frame to frame, instead of on the
+    // encoder sequence. Therefore this only takes effect if the encoder of
+    // every stream sets EncoderInfo::supports_encode_from_any_thread.
+    bool parallel_simulcast_encoding = false;
   };
 
   static VideoCodecVP8 GetDefaultVp8Settings();
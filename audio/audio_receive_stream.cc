@@ -397,6 +397,14 @@ int AudioReceiveStreamImpl::PreferredSampleRate() const {
   return channel_receive_->PreferredSampleRate();
 }
 
+std::optional<AudioLevel> AudioReceiveStreamImpl::GetAudioLevelHint() const {
+  return channel_receive_->GetReceivedAudioLevel();
+}
+
+void AudioReceiveStreamImpl::SkipAudioFrame(int sample_rate_hz) {
+  channel_receive_->SkipAudioFrame(sample_rate_hz);
+}
+
 uint32_t AudioReceiveStreamImpl::id() const {
   RTC_DCHECK_RUN_ON(&worker_thread_checker_);
   return remote_ssrc();
@@ -112,6 +112,8 @@ class AudioReceiveStreamImpl final : public webrtc::AudioReceiveStreamInterface,
                                        AudioFrame* audio_frame) override;
   int Ssrc() const override;
   int PreferredSampleRate() const override;
+  std::optional<AudioLevel> GetAudioLevelHint() const override;
+  void SkipAudioFrame(int sample_rate_hz) override;
 
   // Syncable
   uint32_t id() const override;
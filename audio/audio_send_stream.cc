@@ -113,16 +113,18 @@ AudioSendStream::AudioSendStream(
                       rtp_transport,
                       bitrate_allocator,
                       suspended_rtp_state,
-                      voe::CreateChannelSend(env,
-                                             config.send_transport,
-                                             rtcp_rtt_stats,
-                                             config.frame_encryptor.get(),
-                                             config.crypto_options,
-                                             config.rtp.extmap_allow_mixed,
-                                             config.rtcp_report_interval_ms,
-                                             config.rtp.ssrc,
-                                             config.frame_transformer,
-                                             rtp_transport)) {}
+                      voe::CreateChannelSend(
+                          env,
+                          config.send_transport,
+                          rtcp_rtt_stats,
+                          config.frame_encryptor.get(),
+                          config.crypto_options,
+                          config.rtp.extmap_allow_mixed,
+                          config.rtcp_report_interval_ms,
+                          config.rtp.ssrc,
+                          config.frame_transformer,
+                          rtp_transport,
+                          config.encoder_task_queue_factory)) {}
 
 AudioSendStream::AudioSendStream(
     const Environment& env,
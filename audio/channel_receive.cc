@@ -11,6 +11,7 @@
 #include "audio/channel_receive.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -200,6 +201,10 @@ class ChannelReceive : public ChannelReceiveInterface,
 
   int PreferredSampleRate() const override;
 
+  std::optional<webrtc::AudioLevel> GetReceivedAudioLevel() const override;
+
+  void SkipAudioFrame(int sample_rate_hz) override;
+
   std::vector<RtpSource> GetSources() const override;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
@@ -278,6 +283,11 @@ class ChannelReceive : public ChannelReceiveInterface,
   acm2::CallStatistics call_stats_ RTC_GUARDED_BY(call_stats_mutex_);
   AudioSinkInterface* audio_sink_ = nullptr;
   AudioLevel _outputAudioLevel;
+  // Written on the worker thread and read on the audio thread, packed as
+  // (voice_activity << 7) | level, or -1 before the first audio level.
+  std::atomic<int> received_audio_level_{-1};
+  // Receives the audio pulled from NetEq in SkipAudioFrame().
+  AudioFrame skipped_audio_frame_ RTC_GUARDED_BY(audio_thread_race_checker_);
 
   RemoteNtpTimeEstimator ntp_estimator_ RTC_GUARDED_BY(ts_stats_lock_);
 
@@ -373,6 +383,13 @@ void ChannelReceive::OnReceivedPayloadData(
     return;
   }
 
+  if (const std::optional<webrtc::AudioLevel> audio_level =
+          rtpHeader.extension.audio_level()) {
+    received_audio_level_.store(
+        (audio_level->voice_activity() ? 0x80 : 0) | audio_level->level(),
+        std::memory_order_relaxed);
+  }
+
   TimeDelta round_trip_time = rtp_rtcp_->LastRtt().value_or(TimeDelta::Zero());
 
   std::vector<uint16_t> nack_list = neteq_->GetNackList(round_trip_time.ms());
@@ -544,6 +561,32 @@ AudioMixer::Source::AudioFrameInfo ChannelReceive::GetAudioFrameWithInfo(
                               : AudioMixer::Source::AudioFrameInfo::kNormal;
 }
 
+std::optional<webrtc::AudioLevel> ChannelReceive::GetReceivedAudioLevel()
+    const {
+  const int audio_level = received_audio_level_.load(std::memory_order_relaxed);
+  if (audio_level < 0) {
+    return std::nullopt;
+  }
+  return webrtc::AudioLevel(/*voice_activity=*/(audio_level & 0x80) != 0,
+                            audio_level & 0x7f);
+}
+
+void ChannelReceive::SkipAudioFrame(int /* sample_rate_hz */) {
+  TRACE_EVENT0("webrtc", "ChannelReceive::SkipAudioFrame");
+  RTC_DCHECK_RUNS_SERIALIZED(&audio_thread_race_checker_);
+  // NetEq is clocked by the 10 ms pulls, so it has to run for the jitter
+  // buffer to drain and keep its delay estimate. The audio is not decoded,
+  // and resampling, the audio sink, gain, level and timing are only needed
+  // for audio that is played out.
+  if (neteq_->GetAudioWithoutDecoding(&skipped_audio_frame_) != NetEq::kOK) {
+    RTC_DLOG(LS_ERROR)
+        << "ChannelReceive::SkipAudioFrame() GetAudioWithoutDecoding failed!";
+    return;
+  }
+  MutexLock lock(&call_stats_mutex_);
+  call_stats_.DecodingSkippedByNetEq();
+}
+
 int ChannelReceive::PreferredSampleRate() const {
   RTC_DCHECK_RUNS_SERIALIZED(&audio_thread_race_checker_);
   const std::optional<NetEq::DecoderFormat> decoder =
@@ -159,6 +159,17 @@ class ChannelReceiveInterface : public RtpPacketSinkInterface {
 
   virtual int PreferredSampleRate() const = 0;
 
+  // Returns the level of the most recently received audio according to its
+  // RTP audio level header extension, or nullopt if the stream doesn't carry
+  // the extension.
+  virtual std::optional<webrtc::AudioLevel> GetReceivedAudioLevel() const = 0;
+
+  // Runs NetEq for 10 ms of audio that won't be played out, without decoding
+  // it. The jitter buffer keeps following the stream, so that playout can
+  // resume at any time, but none of the processing of played out audio is
+  // done.
+  virtual void SkipAudioFrame(int sample_rate_hz) = 0;
+
   virtual std::vector<RtpSource> GetSources() const = 0;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
@@ -17,12 +17,14 @@
 #include "api/environment/environment_factory.h"
 #include "api/test/mock_frame_transformer.h"
 #include "modules/audio_device/include/mock_audio_device.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
 #include "modules/rtp_rtcp/source/ntp_time_util.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sdes.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/thread.h"
@@ -82,12 +84,18 @@ class ChannelReceiveTest : public Test {
     return rtc::TimeMillis() * 1000 / kSampleRateHz;
   }
 
-  RtpPacketReceived CreateRtpPacket() {
-    RtpPacketReceived packet;
+  RtpPacketReceived CreateRtpPacket(
+      std::optional<webrtc::AudioLevel> audio_level = std::nullopt) {
+    RtpHeaderExtensionMap extensions;
+    extensions.Register<AudioLevelExtension>(/*id=*/1);
+    RtpPacketReceived packet(&extensions);
     packet.set_arrival_time(time_controller_.GetClock()->CurrentTime());
     packet.SetTimestamp(RtpNow());
     packet.SetSsrc(kLocalSsrc);
     packet.SetPayloadType(kPayloadType);
+    if (audio_level) {
+      packet.SetExtension<AudioLevelExtension>(*audio_level);
+    }
     // Packet size should be enough to give at least 10 ms of data.
     // For PCMA, that's 80 bytes; this should be enough.
     uint8_t* datapos = packet.SetPayloadSize(100);
@@ -260,6 +268,38 @@ TEST_F(ChannelReceiveTest, SettingFrameTransformerMultipleTimes) {
   channel->SetDepacketizerToDecoderFrameTransformer(mock_frame_transformer);
 }
 
+TEST_F(ChannelReceiveTest, ReportsAudioLevelOfReceivedPackets) {
+  auto channel = CreateTestChannelReceive();
+  channel->StartPlayout();
+  EXPECT_EQ(channel->GetReceivedAudioLevel(), std::nullopt);
+
+  channel->OnRtpPacket(
+      CreateRtpPacket(webrtc::AudioLevel(/*voice_activity=*/true, 42)));
+
+  std::optional<webrtc::AudioLevel> audio_level =
+      channel->GetReceivedAudioLevel();
+  ASSERT_TRUE(audio_level.has_value());
+  EXPECT_TRUE(audio_level->voice_activity());
+  EXPECT_EQ(audio_level->level(), 42);
+}
+
+TEST_F(ChannelReceiveTest, SkipAudioFrameRunsNetEq) {
+  auto channel = CreateTestChannelReceive();
+  channel->StartPlayout();
+  channel->OnRtpPacket(CreateRtpPacket());
+
+  channel->SkipAudioFrame(kSampleRateHz);
+  channel->SkipAudioFrame(kSampleRateHz);
+  EXPECT_EQ(channel->GetDecodingCallStatistics().calls_to_neteq, 2);
+
+  // Playout picks up where the skipped audio left off.
+  AudioFrame audio_frame;
+  EXPECT_EQ(channel->GetAudioFrameWithInfo(kSampleRateHz, &audio_frame),
+            AudioMixer::Source::AudioFrameInfo::kNormal);
+  EXPECT_EQ(audio_frame.sample_rate_hz_, kSampleRateHz);
+  EXPECT_EQ(channel->GetDecodingCallStatistics().calls_to_neteq, 3);
+}
+
 }  // namespace
 }  // namespace voe
 }  // namespace webrtc
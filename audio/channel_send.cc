@@ -136,7 +136,8 @@ class ChannelSend : public ChannelSendInterface,
               int rtcp_report_interval_ms,
               uint32_t ssrc,
               rtc::scoped_refptr<FrameTransformerInterface> frame_transformer,
-              RtpTransportControllerSendInterface* transport_controller);
+              RtpTransportControllerSendInterface* transport_controller,
+              TaskQueueFactory* encoder_task_queue_factory);
 
   ~ChannelSend() override;
 
@@ -490,7 +491,8 @@ ChannelSend::ChannelSend(
     int rtcp_report_interval_ms,
     uint32_t ssrc,
     rtc::scoped_refptr<FrameTransformerInterface> frame_transformer,
-    RtpTransportControllerSendInterface* transport_controller)
+    RtpTransportControllerSendInterface* transport_controller,
+    TaskQueueFactory* encoder_task_queue_factory)
     : env_(env),
       ssrc_(ssrc),
       rtp_packet_pacer_proxy_(new RtpPacketSenderProxy()),
@@ -498,9 +500,11 @@ ChannelSend::ChannelSend(
           new RateLimiter(&env_.clock(), kMaxRetransmissionWindow.ms())),
       frame_encryptor_(frame_encryptor),
       crypto_options_(crypto_options),
-      encoder_queue_(env_.task_queue_factory().CreateTaskQueue(
-          "AudioEncoder",
-          TaskQueueFactory::Priority::NORMAL)),
+      encoder_queue_((encoder_task_queue_factory
+                          ? *encoder_task_queue_factory
+                          : env_.task_queue_factory())
+                         .CreateTaskQueue("AudioEncoder",
+                                          TaskQueueFactory::Priority::NORMAL)),
       encoder_queue_checker_(encoder_queue_.get()),
       encoder_format_("x-unknown", 0, 0) {
   audio_coding_ = AudioCodingModule::Create();
@@ -972,11 +976,13 @@ std::unique_ptr<ChannelSendInterface> CreateChannelSend(
     int rtcp_report_interval_ms,
     uint32_t ssrc,
     rtc::scoped_refptr<FrameTransformerInterface> frame_transformer,
-    RtpTransportControllerSendInterface* transport_controller) {
+    RtpTransportControllerSendInterface* transport_controller,
+    TaskQueueFactory* encoder_task_queue_factory) {
   return std::make_unique<ChannelSend>(
       env, rtp_transport, rtcp_rtt_stats, frame_encryptor, crypto_options,
       extmap_allow_mixed, rtcp_report_interval_ms, ssrc,
-      std::move(frame_transformer), transport_controller);
+      std::move(frame_transformer), transport_controller,
+      encoder_task_queue_factory);
 }
 
 }  // namespace voe
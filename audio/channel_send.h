@@ -27,6 +27,7 @@
 #include "api/frame_transformer_interface.h"
 #include "api/function_view.h"
 #include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/units/data_rate.h"
 #include "api/units/time_delta.h"
 #include "modules/rtp_rtcp/include/report_block_data.h"
@@ -125,7 +126,8 @@ std::unique_ptr<ChannelSendInterface> CreateChannelSend(
     int rtcp_report_interval_ms,
     uint32_t ssrc,
     rtc::scoped_refptr<FrameTransformerInterface> frame_transformer,
-    RtpTransportControllerSendInterface* transport_controller);
+    RtpTransportControllerSendInterface* transport_controller,
+    TaskQueueFactory* encoder_task_queue_factory = nullptr);
 
 }  // namespace voe
 }  // namespace webrtc
@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "api/audio/audio_frame.h"
 #include "api/audio_codecs/audio_encoder.h"
@@ -32,6 +33,8 @@
 #include "api/make_ref_counted.h"
 #include "api/rtp_headers.h"
 #include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/test/mock_frame_transformer.h"
 #include "api/test/mock_transformable_audio_frame.h"
 #include "api/test/rtc_error_matchers.h"
@@ -67,6 +70,26 @@ constexpr int kPayloadType = 1;
 constexpr int kSampleRateHz = 48000;
 constexpr int kRtpRateHz = 48000;
 
+// Creates the task queues of `factory` and counts them.
+class CountingTaskQueueFactory : public TaskQueueFactory {
+ public:
+  explicit CountingTaskQueueFactory(const TaskQueueFactory* factory)
+      : factory_(factory) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override {
+    ++num_task_queues_;
+    return factory_->CreateTaskQueue(name, priority);
+  }
+
+  int num_task_queues() const { return num_task_queues_; }
+
+ private:
+  const TaskQueueFactory* const factory_;
+  mutable int num_task_queues_ = 0;
+};
+
 BitrateConstraints GetBitrateConfig() {
   BitrateConstraints bitrate_config;
   bitrate_config.min_bitrate_bps = 10000;
@@ -151,6 +174,31 @@ TEST_F(ChannelSendTest, StopSendShouldResetEncoder) {
   ProcessNextFrame();
 }
 
+TEST_F(ChannelSendTest, EncodesOnTaskQueueOfEncoderTaskQueueFactory) {
+  CountingTaskQueueFactory encoder_task_queue_factory(
+      &env_.task_queue_factory());
+  channel_->ResetSenderCongestionControlObjects();
+  channel_ = voe::CreateChannelSend(
+      env_, &transport_, nullptr, nullptr, crypto_options_, false,
+      kRtcpIntervalMs, kSsrc, nullptr, &transport_controller_,
+      &encoder_task_queue_factory);
+  EXPECT_EQ(encoder_task_queue_factory.num_task_queues(), 1);
+  SdpAudioFormat opus = SdpAudioFormat("opus", kRtpRateHz, 2);
+  channel_->SetEncoder(
+      kPayloadType, opus,
+      encoder_factory_->Create(env_, opus, {.payload_type = kPayloadType}));
+  channel_->RegisterSenderCongestionControlObjects(&transport_controller_);
+  channel_->StartSend();
+
+  EXPECT_CALL(transport_, SendRtp).Times(1);
+  ProcessNextFrame();
+  ProcessNextFrame();
+
+  channel_->StopSend();
+  channel_->ResetSenderCongestionControlObjects();
+  channel_ = nullptr;
+}
+
 TEST_F(ChannelSendTest, IncreaseRtpTimestampByPauseDuration) {
   channel_->StartSend();
   uint32_t timestamp;
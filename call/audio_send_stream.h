@@ -29,6 +29,7 @@
 #include "api/rtp_parameters.h"
 #include "api/rtp_sender_interface.h"
 #include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/units/time_delta.h"
 #include "call/audio_sender.h"
 #include "modules/rtp_rtcp/include/report_block_data.h"
@@ -170,6 +171,13 @@ class AudioSendStream : public AudioSender {
     // An optional frame transformer used by insertable streams to transform
     // encoded frames.
     rtc::scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer;
+
+    // An optional factory of the task queue that encodes the audio. Hosts
+    // with many send streams can set a factory that runs the encoders of all
+    // streams on a shared pool of threads, see CreatePooledTaskQueueFactory().
+    // If null, the task queue factory of the environment is used. Must
+    // outlive the stream.
+    TaskQueueFactory* encoder_task_queue_factory = nullptr;
   };
 
   virtual ~AudioSendStream() = default;
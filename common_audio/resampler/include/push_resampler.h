@@ -12,15 +12,15 @@
 #define COMMON_AUDIO_RESAMPLER_INCLUDE_PUSH_RESAMPLER_H_
 
 #include <memory>
-#include <vector>
 
 #include "api/audio/audio_view.h"
 
 namespace webrtc {
 
-class PushSincResampler;
+class MultichannelSincResampler;
 
-// Wraps PushSincResampler to provide stereo support.
+// Wraps MultichannelSincResampler to provide a resampler for any number of
+// channels which is reconfigured when the format changes.
 // Note: This implementation assumes 10ms buffer sizes throughout.
 template <typename T>
 class PushResampler final {
@@ -39,19 +39,17 @@ class PushResampler final {
   int Resample(MonoView<const T> src, MonoView<T> dst);
 
  private:
-  // Ensures that source and destination buffers for deinterleaving are
-  // correctly configured prior to resampling that requires deinterleaving.
+  // Ensures that the resampler is configured for the given format.
   void EnsureInitialized(size_t src_samples_per_channel,
                          size_t dst_samples_per_channel,
                          size_t num_channels);
 
-  // Buffers used for when a deinterleaving step is necessary.
-  std::unique_ptr<T[]> source_;
-  std::unique_ptr<T[]> destination_;
-  DeinterleavedView<T> source_view_;
-  DeinterleavedView<T> destination_view_;
+  size_t src_samples_per_channel_ = 0;
+  size_t dst_samples_per_channel_ = 0;
+  size_t num_channels_ = 0;
 
-  std::vector<std::unique_ptr<PushSincResampler>> resamplers_;
+  // Resamples all channels in one pass over the interleaved samples.
+  std::unique_ptr<MultichannelSincResampler> resampler_;
 };
 }  // namespace webrtc
 
@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/resampler/multichannel_sinc_resampler.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "common_audio/include/audio_util.h"
+#include "common_audio/resampler/sinc_resampler.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr size_t kKernelSize = SincResampler::kKernelSize;
+constexpr size_t kKernelOffsetCount = SincResampler::kKernelOffsetCount;
+constexpr size_t kKernelStorageSize = SincResampler::kKernelStorageSize;
+
+// Same as SincResampler::Convolve_C() for each of the `kNumChannels`
+// channels.
+template <size_t kNumChannels>
+void Convolve(const float* input_ptr,
+              const float* k1,
+              const float* k2,
+              double kernel_interpolation_factor,
+              float* destination) {
+  float sums1[kNumChannels] = {};
+  float sums2[kNumChannels] = {};
+  for (size_t i = 0; i < kKernelSize * kNumChannels; i += kNumChannels) {
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      sums1[ch] += input_ptr[i + ch] * k1[i + ch];
+      sums2[ch] += input_ptr[i + ch] * k2[i + ch];
+    }
+  }
+
+  // Linearly interpolate the two "convolutions".
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    destination[ch] =
+        static_cast<float>((1.0 - kernel_interpolation_factor) * sums1[ch] +
+                           kernel_interpolation_factor * sums2[ch]);
+  }
+}
+
+// Reads one block of source frames into `destination`.
+void ReadSource(const float* source, size_t size, float* destination) {
+  memcpy(destination, source, size * sizeof(*destination));
+}
+
+void ReadSource(const int16_t* source, size_t size, float* destination) {
+  for (size_t i = 0; i < size; ++i)
+    destination[i] = static_cast<float>(source[i]);
+}
+
+// Writes one output frame, computed by `convolve_proc`, to `destination`.
+template <typename ConvolveProc>
+void WriteFrame(ConvolveProc convolve_proc,
+                const float* input_ptr,
+                const float* k1,
+                const float* k2,
+                double kernel_interpolation_factor,
+                size_t /* num_channels */,
+                float* destination) {
+  convolve_proc(input_ptr, k1, k2, kernel_interpolation_factor, destination);
+}
+
+template <typename ConvolveProc>
+void WriteFrame(ConvolveProc convolve_proc,
+                const float* input_ptr,
+                const float* k1,
+                const float* k2,
+                double kernel_interpolation_factor,
+                size_t num_channels,
+                int16_t* destination) {
+  float frame[MultichannelSincResampler::kMaxNumChannels];
+  convolve_proc(input_ptr, k1, k2, kernel_interpolation_factor, frame);
+  for (size_t ch = 0; ch < num_channels; ++ch)
+    destination[ch] = FloatS16ToS16(frame[ch]);
+}
+
+}  // namespace
+
+MultichannelSincResampler::ConvolveProc
+MultichannelSincResampler::GetConvolve_C(size_t num_channels) {
+  switch (num_channels) {
+    case 1:
+      return Convolve<1>;
+    case 2:
+      return Convolve<2>;
+    case 3:
+      return Convolve<3>;
+    case 4:
+      return Convolve<4>;
+    case 5:
+      return Convolve<5>;
+    case 6:
+      return Convolve<6>;
+    case 7:
+      return Convolve<7>;
+    case 8:
+      return Convolve<8>;
+  }
+  RTC_DCHECK_NOTREACHED();
+  return nullptr;
+}
+
+// If we know the minimum architecture at compile time, avoid CPU detection.
+void MultichannelSincResampler::InitializeCPUSpecificFeatures() {
+#if defined(WEBRTC_HAS_NEON)
+  convolve_proc_ = GetConvolve_NEON(num_channels_);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  // The choice must match that of SincResampler for the output to be the same
+  // as that of PushSincResampler.
+  if (GetCPUInfo(kAVX2) && GetCPUInfo(kFMA3))
+    convolve_proc_ = GetConvolve_AVX2(num_channels_);
+  else if (GetCPUInfo(kSSE2))
+    convolve_proc_ = GetConvolve_SSE(num_channels_);
+  else
+    convolve_proc_ = GetConvolve_C(num_channels_);
+#else
+  // Unknown architecture.
+  convolve_proc_ = GetConvolve_C(num_channels_);
+#endif
+}
+
+MultichannelSincResampler::MultichannelSincResampler(
+    size_t source_frames,
+    size_t destination_frames,
+    size_t num_channels)
+    : num_channels_(num_channels),
+      io_sample_rate_ratio_(source_frames * 1.0 / destination_frames),
+      request_frames_(source_frames),
+      destination_frames_(destination_frames),
+      // Create the buffers with a 32-byte alignment for SIMD optimizations.
+      kernel_storage_(static_cast<float*>(
+          AlignedMalloc(sizeof(float) * kKernelStorageSize * num_channels,
+                        32))),
+      input_buffer_(static_cast<float*>(
+          AlignedMalloc(sizeof(float) * (request_frames_ + kKernelSize) *
+                            num_channels,
+                        32))),
+      convolve_proc_(nullptr),
+      r1_(input_buffer_.get()),
+      r2_(input_buffer_.get() + kKernelSize / 2 * num_channels) {
+  RTC_DCHECK_GT(num_channels_, 0);
+  RTC_DCHECK_LE(num_channels_, kMaxNumChannels);
+  RTC_DCHECK_GT(request_frames_, 0);
+  InitializeCPUSpecificFeatures();
+  RTC_DCHECK(convolve_proc_);
+
+  memset(input_buffer_.get(), 0,
+         sizeof(float) * (request_frames_ + kKernelSize) * num_channels_);
+  UpdateRegions(false);
+  RTC_DCHECK_GT(block_size_, kKernelSize);
+
+  float kernels[kKernelStorageSize];
+  SincResampler::ComputeKernels(io_sample_rate_ratio_, kernels);
+  for (size_t i = 0; i < kKernelStorageSize; ++i) {
+    for (size_t ch = 0; ch < num_channels_; ++ch)
+      kernel_storage_[i * num_channels_ + ch] = kernels[i];
+  }
+}
+
+MultichannelSincResampler::~MultichannelSincResampler() = default;
+
+void MultichannelSincResampler::UpdateRegions(bool second_load) {
+  // The regions are those of SincResampler, measured in samples of all
+  // channels.
+  r0_ = input_buffer_.get() +
+        (second_load ? kKernelSize : kKernelSize / 2) * num_channels_;
+  r3_ = r0_ + (request_frames_ - kKernelSize) * num_channels_;
+  r4_ = r0_ + (request_frames_ - kKernelSize / 2) * num_channels_;
+  block_size_ = (r4_ - r2_) / num_channels_;
+
+  RTC_DCHECK_EQ(r2_ - r1_, r4_ - r3_);
+  RTC_DCHECK_LT(r2_, r3_);
+}
+
+size_t MultichannelSincResampler::Resample(
+    InterleavedView<const float> source,
+    InterleavedView<float> destination) {
+  return ResampleInternal(source, destination);
+}
+
+size_t MultichannelSincResampler::Resample(
+    InterleavedView<const int16_t> source,
+    InterleavedView<int16_t> destination) {
+  return ResampleInternal(source, destination);
+}
+
+template <typename T>
+size_t MultichannelSincResampler::ResampleInternal(
+    InterleavedView<const T> source,
+    InterleavedView<T> destination) {
+  RTC_CHECK_EQ(SamplesPerChannel(source), request_frames_);
+  RTC_CHECK_GE(SamplesPerChannel(destination), destination_frames_);
+  RTC_CHECK_EQ(NumChannels(source), num_channels_);
+  RTC_CHECK_EQ(NumChannels(destination), num_channels_);
+
+  const T* source_ptr = source.data().data();
+
+  // On the first pass, prime the buffer with half a kernel of delay, as
+  // described in PushSincResampler::Resample(). The output is discarded.
+  if (first_pass_) {
+    Generate<T>(static_cast<size_t>(block_size_ / io_sample_rate_ratio_),
+                source_ptr, nullptr);
+    first_pass_ = false;
+  }
+
+  Generate(destination_frames_, source_ptr, destination.data().data());
+  return destination_frames_;
+}
+
+template <typename T>
+void MultichannelSincResampler::Generate(size_t frames,
+                                         const T*& source,
+                                         T* destination) {
+  size_t remaining_frames = frames;
+
+  // Prime the input buffer with the dummy input of PushSincResampler.
+  if (!buffer_primed_ && remaining_frames) {
+    memset(r0_, 0, sizeof(float) * request_frames_ * num_channels_);
+    buffer_primed_ = true;
+  }
+
+  const double current_io_ratio = io_sample_rate_ratio_;
+  const float* const kernel_ptr = kernel_storage_.get();
+  while (remaining_frames) {
+    for (int i = static_cast<int>(
+             ceil((block_size_ - virtual_source_idx_) / current_io_ratio));
+         i > 0; --i) {
+      RTC_DCHECK_LT(virtual_source_idx_, block_size_);
+
+      if (destination) {
+        const int source_idx = static_cast<int>(virtual_source_idx_);
+        const double subsample_remainder = virtual_source_idx_ - source_idx;
+
+        const double virtual_offset_idx =
+            subsample_remainder * kKernelOffsetCount;
+        const int offset_idx = static_cast<int>(virtual_offset_idx);
+
+        const float* const k1 =
+            kernel_ptr + offset_idx * kKernelSize * num_channels_;
+        const float* const k2 = k1 + kKernelSize * num_channels_;
+        RTC_DCHECK_EQ(0, reinterpret_cast<uintptr_t>(k1) % 32);
+        RTC_DCHECK_EQ(0, reinterpret_cast<uintptr_t>(k2) % 32);
+
+        const double kernel_interpolation_factor =
+            virtual_offset_idx - offset_idx;
+        WriteFrame(convolve_proc_, r1_ + source_idx * num_channels_, k1, k2,
+                   kernel_interpolation_factor, num_channels_, destination);
+        destination += num_channels_;
+      }
+
+      virtual_source_idx_ += current_io_ratio;
+
+      if (!--remaining_frames)
+        return;
+    }
+
+    // Wrap back around to the start.
+    virtual_source_idx_ -= block_size_;
+    memcpy(r1_, r3_, sizeof(float) * kKernelSize * num_channels_);
+    if (r0_ == r2_)
+      UpdateRegions(true);
+
+    // Ensure that the source is only read once per Resample() call.
+    RTC_CHECK(source);
+    ReadSource(source, request_frames_ * num_channels_, r0_);
+    source = nullptr;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_AUDIO_RESAMPLER_MULTICHANNEL_SINC_RESAMPLER_H_
+#define COMMON_AUDIO_RESAMPLER_MULTICHANNEL_SINC_RESAMPLER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "api/audio/audio_view.h"
+#include "rtc_base/memory/aligned_malloc.h"
+#include "rtc_base/system/arch.h"
+
+namespace webrtc {
+
+// A push-based sinc resampler for interleaved audio. It produces the same
+// output as one PushSincResampler per channel, but filters all channels in
+// one pass over the interleaved samples, without deinterleaving them into
+// per-channel buffers first. The kernels are stored with each tap repeated
+// once per channel, so that the SIMD versions of the convolution load all
+// channels of several consecutive frames at once.
+class MultichannelSincResampler {
+ public:
+  static constexpr size_t kMaxNumChannels = 8;
+
+  // Provide the size of the source and destination blocks in frames. These
+  // must correspond to the same time duration (typically 10 ms) as the sample
+  // ratio is inferred from them.
+  MultichannelSincResampler(size_t source_frames,
+                            size_t destination_frames,
+                            size_t num_channels);
+  ~MultichannelSincResampler();
+
+  MultichannelSincResampler(const MultichannelSincResampler&) = delete;
+  MultichannelSincResampler& operator=(const MultichannelSincResampler&) =
+      delete;
+
+  size_t num_channels() const { return num_channels_; }
+
+  // Performs the resampling. `source` must hold the `source_frames` provided
+  // at construction and `destination` must have room for at least
+  // `destination_frames`, both with `num_channels` channels. Returns the
+  // number of frames provided in `destination`.
+  size_t Resample(InterleavedView<const float> source,
+                  InterleavedView<float> destination);
+  size_t Resample(InterleavedView<const int16_t> source,
+                  InterleavedView<int16_t> destination);
+
+ private:
+  // Computes the convolution of two kernels over the interleaved channels at
+  // `input_ptr` and writes the linearly interpolated sums, one per channel,
+  // to `destination`. The number of channels is fixed per function.
+  typedef void (*ConvolveProc)(const float* input_ptr,
+                               const float* k1,
+                               const float* k2,
+                               double kernel_interpolation_factor,
+                               float* destination);
+
+  // Return the convolution for `num_channels` channels. Each channel gets the
+  // same result as with the matching SincResampler::Convolve_*() function.
+  static ConvolveProc GetConvolve_C(size_t num_channels);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static ConvolveProc GetConvolve_SSE(size_t num_channels);
+  static ConvolveProc GetConvolve_AVX2(size_t num_channels);
+#elif defined(WEBRTC_HAS_NEON)
+  static ConvolveProc GetConvolve_NEON(size_t num_channels);
+#endif
+
+  // Selects runtime specific CPU features in the same way as SincResampler.
+  void InitializeCPUSpecificFeatures();
+
+  void UpdateRegions(bool second_load);
+
+  // Port of SincResampler::Resample() which generates `frames` output frames.
+  // When the input buffer runs out, it is refilled from `source`, which is
+  // then set to nullptr since it may only be consumed once. The convolutions
+  // are skipped when `destination` is nullptr.
+  template <typename T>
+  void Generate(size_t frames, const T*& source, T* destination);
+
+  template <typename T>
+  size_t ResampleInternal(InterleavedView<const T> source,
+                          InterleavedView<T> destination);
+
+  const size_t num_channels_;
+
+  // The ratio of input / output sample rates.
+  const double io_sample_rate_ratio_;
+
+  // An index on the source input buffer with sub-sample precision.
+  double virtual_source_idx_ = 0;
+
+  // The buffer is primed once at the very beginning of processing.
+  bool buffer_primed_ = false;
+
+  // True on the first call to Resample(), to prime the buffer with the correct
+  // delay, see PushSincResampler::Resample().
+  bool first_pass_ = true;
+
+  // The number of source frames read for each processing pass.
+  const size_t request_frames_;
+
+  const size_t destination_frames_;
+
+  // The number of source frames processed per pass.
+  size_t block_size_;
+
+  // The SincResampler kernels, each of kKernelSize taps interleaved with
+  // `num_channels_` copies of every tap.
+  std::unique_ptr<float[], AlignedFreeDeleter> kernel_storage_;
+
+  // Interleaved source frames are copied into this buffer for each pass.
+  std::unique_ptr<float[], AlignedFreeDeleter> input_buffer_;
+
+  ConvolveProc convolve_proc_;
+
+  // Pointers to the regions inside `input_buffer_`, as in SincResampler.
+  float* r0_;
+  float* const r1_;
+  float* const r2_;
+  float* r3_;
+  float* r4_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_AUDIO_RESAMPLER_MULTICHANNEL_SINC_RESAMPLER_H_
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <xmmintrin.h>
+
+#include "common_audio/resampler/multichannel_sinc_resampler.h"
+#include "common_audio/resampler/sinc_resampler.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr size_t kKernelSize = SincResampler::kKernelSize;
+
+// Same as SincResampler::Convolve_AVX2() for each of the `kNumChannels`
+// channels. Sample `j` of a period of 8 * kNumChannels samples belongs to
+// channel j % kNumChannels and to the lane j / kNumChannels in which
+// SincResampler accumulates the tap.
+template <size_t kNumChannels>
+void Convolve(const float* input_ptr,
+              const float* k1,
+              const float* k2,
+              double kernel_interpolation_factor,
+              float* destination) {
+  // Each vector of a period of 8 * kNumChannels samples is accumulated
+  // separately, so that the accumulators stay in registers.
+  alignas(32) float sums1[8 * kNumChannels];
+  alignas(32) float sums2[8 * kNumChannels];
+  for (size_t v = 0; v < 8 * kNumChannels; v += 8) {
+    __m256 m_sums1 = _mm256_setzero_ps();
+    __m256 m_sums2 = _mm256_setzero_ps();
+    for (size_t i = v; i < kKernelSize * kNumChannels; i += 8 * kNumChannels) {
+      const __m256 m_input = _mm256_loadu_ps(input_ptr + i);
+      m_sums1 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k1 + i), m_sums1);
+      m_sums2 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k2 + i), m_sums2);
+    }
+    _mm256_store_ps(sums1 + v, m_sums1);
+    _mm256_store_ps(sums2 + v, m_sums2);
+  }
+
+  // Add lane `l` to lane `l` + 4 of each channel, which are 4 * kNumChannels
+  // floats apart. Then linearly interpolate the two "convolutions".
+  const __m128 m_factor1 =
+      _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor));
+  const __m128 m_factor2 =
+      _mm_set_ps1(static_cast<float>(kernel_interpolation_factor));
+  alignas(16) float sums[4 * kNumChannels];
+  for (size_t i = 0; i < 4 * kNumChannels; i += 4) {
+    __m128 m128_sums1 = _mm_add_ps(_mm_load_ps(sums1 + i),
+                                   _mm_load_ps(sums1 + 4 * kNumChannels + i));
+    __m128 m128_sums2 = _mm_add_ps(_mm_load_ps(sums2 + i),
+                                   _mm_load_ps(sums2 + 4 * kNumChannels + i));
+    m128_sums1 = _mm_mul_ps(m128_sums1, m_factor1);
+    m128_sums2 = _mm_mul_ps(m128_sums2, m_factor2);
+    _mm_store_ps(sums + i, _mm_add_ps(m128_sums1, m128_sums2));
+  }
+
+  // Sum components together, as (lane 0 + lane 2) + (lane 1 + lane 3).
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    destination[ch] = (sums[ch] + sums[2 * kNumChannels + ch]) +
+                      (sums[kNumChannels + ch] + sums[3 * kNumChannels + ch]);
+  }
+}
+
+}  // namespace
+
+MultichannelSincResampler::ConvolveProc
+MultichannelSincResampler::GetConvolve_AVX2(size_t num_channels) {
+  switch (num_channels) {
+    case 1:
+      return Convolve<1>;
+    case 2:
+      return Convolve<2>;
+    case 3:
+      return Convolve<3>;
+    case 4:
+      return Convolve<4>;
+    case 5:
+      return Convolve<5>;
+    case 6:
+      return Convolve<6>;
+    case 7:
+      return Convolve<7>;
+    case 8:
+      return Convolve<8>;
+  }
+  RTC_DCHECK_NOTREACHED();
+  return nullptr;
+}
+
+}  // namespace webrtc
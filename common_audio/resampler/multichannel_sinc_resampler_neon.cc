@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+#include <stddef.h>
+
+#include "common_audio/resampler/multichannel_sinc_resampler.h"
+#include "common_audio/resampler/sinc_resampler.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr size_t kKernelSize = SincResampler::kKernelSize;
+
+// Same as SincResampler::Convolve_NEON() for each of the `kNumChannels`
+// channels. Sample `j` of a period of 4 * kNumChannels samples belongs to
+// channel j % kNumChannels and to the lane j / kNumChannels in which
+// SincResampler accumulates the tap. `sums[j]` gets the interpolated sum.
+template <size_t kNumChannels>
+void Convolve(const float* input_ptr,
+              const float* k1,
+              const float* k2,
+              double kernel_interpolation_factor,
+              float* destination) {
+  const float32x4_t m_factor1 = vmovq_n_f32(1.0 - kernel_interpolation_factor);
+  const float32x4_t m_factor2 = vmovq_n_f32(kernel_interpolation_factor);
+
+  // Each vector of a period of 4 * kNumChannels samples is accumulated
+  // separately, so that the accumulators stay in registers.
+  float sums[4 * kNumChannels];
+  for (size_t v = 0; v < 4 * kNumChannels; v += 4) {
+    float32x4_t m_sums1 = vmovq_n_f32(0);
+    float32x4_t m_sums2 = vmovq_n_f32(0);
+    for (size_t i = v; i < kKernelSize * kNumChannels; i += 4 * kNumChannels) {
+      const float32x4_t m_input = vld1q_f32(input_ptr + i);
+      m_sums1 = vmlaq_f32(m_sums1, m_input, vld1q_f32(k1 + i));
+      m_sums2 = vmlaq_f32(m_sums2, m_input, vld1q_f32(k2 + i));
+    }
+
+    // Linearly interpolate the two "convolutions".
+    vst1q_f32(sums + v, vmlaq_f32(vmulq_f32(m_sums1, m_factor1), m_sums2,
+                                  m_factor2));
+  }
+
+  // Sum components together, as (lane 2 + lane 0) + (lane 3 + lane 1).
+  for (size_t ch = 0; ch < kNumChannels; ++ch) {
+    destination[ch] = (sums[2 * kNumChannels + ch] + sums[ch]) +
+                      (sums[3 * kNumChannels + ch] + sums[kNumChannels + ch]);
+  }
+}
+
+}  // namespace
+
+MultichannelSincResampler::ConvolveProc
+MultichannelSincResampler::GetConvolve_NEON(size_t num_channels) {
+  switch (num_channels) {
+    case 1:
+      return Convolve<1>;
+    case 2:
+      return Convolve<2>;
+    case 3:
+      return Convolve<3>;
+    case 4:
+      return Convolve<4>;
+    case 5:
+      return Convolve<5>;
+    case 6:
+      return Convolve<6>;
+    case 7:
+      return Convolve<7>;
+    case 8:
+      return Convolve<8>;
+  }
+  RTC_DCHECK_NOTREACHED();
+  return nullptr;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/resampler/multichannel_sinc_resampler.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common_audio/resampler/push_sinc_resampler.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumBlocks = 20;
+
+// Fills `samples` with random values in the int16 range.
+template <typename T>
+void FillRandom(std::mt19937& generator, std::vector<T>& samples) {
+  std::uniform_int_distribution<int> distribution(-32768, 32767);
+  for (T& sample : samples)
+    sample = static_cast<T>(distribution(generator));
+}
+
+class MultichannelSincResamplerTest
+    : public ::testing::TestWithParam<::testing::tuple<int, int, size_t>> {
+ protected:
+  // Verifies that the output is the same as that of one PushSincResampler per
+  // channel, for a number of 10 ms blocks.
+  template <typename T>
+  void ExpectSameAsPushSincResampler() {
+    const size_t input_frames =
+        static_cast<size_t>(::testing::get<0>(GetParam()) / 100);
+    const size_t output_frames =
+        static_cast<size_t>(::testing::get<1>(GetParam()) / 100);
+    const size_t num_channels = ::testing::get<2>(GetParam());
+
+    MultichannelSincResampler resampler(input_frames, output_frames,
+                                        num_channels);
+    std::vector<std::unique_ptr<PushSincResampler>> reference_resamplers;
+    for (size_t ch = 0; ch < num_channels; ++ch) {
+      reference_resamplers.push_back(
+          std::make_unique<PushSincResampler>(input_frames, output_frames));
+    }
+
+    std::mt19937 generator(42);
+    std::vector<T> source(input_frames * num_channels);
+    std::vector<T> destination(output_frames * num_channels);
+    std::vector<T> channel_source(input_frames);
+    std::vector<T> channel_destination(output_frames);
+    for (int block = 0; block < kNumBlocks; ++block) {
+      FillRandom(generator, source);
+      EXPECT_EQ(output_frames,
+                resampler.Resample(
+                    InterleavedView<const T>(source.data(), input_frames,
+                                             num_channels),
+                    InterleavedView<T>(destination.data(), output_frames,
+                                       num_channels)));
+
+      for (size_t ch = 0; ch < num_channels; ++ch) {
+        for (size_t i = 0; i < input_frames; ++i)
+          channel_source[i] = source[i * num_channels + ch];
+        reference_resamplers[ch]->Resample(channel_source.data(), input_frames,
+                                           channel_destination.data(),
+                                           output_frames);
+        for (size_t i = 0; i < output_frames; ++i) {
+          ASSERT_EQ(channel_destination[i], destination[i * num_channels + ch])
+              << "block " << block << ", channel " << ch << ", frame " << i;
+        }
+      }
+    }
+  }
+};
+
+TEST_P(MultichannelSincResamplerTest, FloatSameAsPushSincResampler) {
+  ExpectSameAsPushSincResampler<float>();
+}
+
+TEST_P(MultichannelSincResamplerTest, Int16SameAsPushSincResampler) {
+  ExpectSameAsPushSincResampler<int16_t>();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MultichannelSincResamplerTest,
+    MultichannelSincResamplerTest,
+    ::testing::Combine(::testing::Values(8000, 16000, 44100, 48000),
+                       ::testing::Values(16000, 32000, 44100, 48000),
+                       ::testing::Values(1, 2, 3, 6, 8)));
+
+}  // namespace
+}  // namespace webrtc
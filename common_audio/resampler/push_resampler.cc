@@ -17,7 +17,7 @@
 
 #include "api/audio/audio_frame.h"
 #include "common_audio/include/audio_util.h"
-#include "common_audio/resampler/push_sinc_resampler.h"
+#include "common_audio/resampler/multichannel_sinc_resampler.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -53,27 +53,18 @@ void PushResampler<T>::EnsureInitialized(size_t src_samples_per_channel,
   RTC_DCHECK_LE(dst_samples_per_channel, kMaxSamplesPerChannel10ms);
   RTC_DCHECK_LE(num_channels, kMaxNumberOfChannels);
 
-  if (src_samples_per_channel == SamplesPerChannel(source_view_) &&
-      dst_samples_per_channel == SamplesPerChannel(destination_view_) &&
-      num_channels == NumChannels(source_view_)) {
+  if (src_samples_per_channel == src_samples_per_channel_ &&
+      dst_samples_per_channel == dst_samples_per_channel_ &&
+      num_channels == num_channels_) {
     // No-op if settings haven't changed.
     return;
   }
 
-  // Allocate two buffers for all source and destination channels.
-  // Then organize source and destination views together with an array of
-  // resamplers for each channel in the deinterlaved buffers.
-  source_.reset(new T[src_samples_per_channel * num_channels]);
-  destination_.reset(new T[dst_samples_per_channel * num_channels]);
-  source_view_ = DeinterleavedView<T>(source_.get(), src_samples_per_channel,
-                                      num_channels);
-  destination_view_ = DeinterleavedView<T>(
-      destination_.get(), dst_samples_per_channel, num_channels);
-  resamplers_.resize(num_channels);
-  for (size_t i = 0; i < num_channels; ++i) {
-    resamplers_[i] = std::make_unique<PushSincResampler>(
-        src_samples_per_channel, dst_samples_per_channel);
-  }
+  src_samples_per_channel_ = src_samples_per_channel;
+  dst_samples_per_channel_ = dst_samples_per_channel;
+  num_channels_ = num_channels;
+  resampler_ = std::make_unique<MultichannelSincResampler>(
+      src_samples_per_channel, dst_samples_per_channel, num_channels);
 }
 
 template <typename T>
@@ -82,11 +73,6 @@ int PushResampler<T>::Resample(InterleavedView<const T> src,
   EnsureInitialized(SamplesPerChannel(src), SamplesPerChannel(dst),
                     NumChannels(src));
 
-  RTC_DCHECK_EQ(NumChannels(src), NumChannels(source_view_));
-  RTC_DCHECK_EQ(NumChannels(dst), NumChannels(destination_view_));
-  RTC_DCHECK_EQ(SamplesPerChannel(src), SamplesPerChannel(source_view_));
-  RTC_DCHECK_EQ(SamplesPerChannel(dst), SamplesPerChannel(destination_view_));
-
   if (SamplesPerChannel(src) == SamplesPerChannel(dst)) {
     // The old resampler provides this memcpy facility in the case of matching
     // sample rates, so reproduce it here for the sinc resampler.
@@ -94,30 +80,25 @@ int PushResampler<T>::Resample(InterleavedView<const T> src,
     return static_cast<int>(src.data().size());
   }
 
-  Deinterleave(src, source_view_);
-
-  for (size_t i = 0; i < resamplers_.size(); ++i) {
-    size_t dst_length_mono =
-        resamplers_[i]->Resample(source_view_[i], destination_view_[i]);
-    RTC_DCHECK_EQ(dst_length_mono, SamplesPerChannel(dst));
-  }
-
-  Interleave<T>(destination_view_, dst);
+  size_t dst_length = resampler_->Resample(src, dst);
+  RTC_DCHECK_EQ(dst_length, SamplesPerChannel(dst));
   return static_cast<int>(dst.size());
 }
 
 template <typename T>
 int PushResampler<T>::Resample(MonoView<const T> src, MonoView<T> dst) {
-  RTC_DCHECK_EQ(resamplers_.size(), 1);
-  RTC_DCHECK_EQ(SamplesPerChannel(src), SamplesPerChannel(source_view_));
-  RTC_DCHECK_EQ(SamplesPerChannel(dst), SamplesPerChannel(destination_view_));
+  RTC_DCHECK_EQ(num_channels_, 1);
+  RTC_DCHECK_EQ(SamplesPerChannel(src), src_samples_per_channel_);
+  RTC_DCHECK_EQ(SamplesPerChannel(dst), dst_samples_per_channel_);
 
   if (SamplesPerChannel(src) == SamplesPerChannel(dst)) {
     CopySamples(dst, src);
     return static_cast<int>(src.size());
   }
 
-  return resamplers_[0]->Resample(src, dst);
+  return static_cast<int>(resampler_->Resample(
+      InterleavedView<const T>(src.data(), SamplesPerChannel(src), 1),
+      InterleavedView<T>(dst.data(), SamplesPerChannel(dst), 1)));
 }
 
 // Explictly generate required instantiations.
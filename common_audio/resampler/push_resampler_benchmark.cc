@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_view.h"
+#include "benchmark/benchmark.h"
+#include "common_audio/include/audio_util.h"
+#include "common_audio/resampler/include/push_resampler.h"
+#include "common_audio/resampler/push_sinc_resampler.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+// Interleaved 10 ms input and output frames for the benchmark arguments: the
+// source rate, the destination rate and the number of channels.
+class Frames {
+ public:
+  explicit Frames(const benchmark::State& state)
+      : src_samples_per_channel_(state.range(0) / 100),
+        dst_samples_per_channel_(state.range(1) / 100),
+        num_channels_(state.range(2)),
+        src_(src_samples_per_channel_ * num_channels_),
+        dst_(dst_samples_per_channel_ * num_channels_) {
+    Random random(42);
+    for (int16_t& sample : src_) {
+      sample = static_cast<int16_t>(random.Rand(-32768, 32767));
+    }
+  }
+
+  size_t src_samples_per_channel() const { return src_samples_per_channel_; }
+  size_t dst_samples_per_channel() const { return dst_samples_per_channel_; }
+  size_t num_channels() const { return num_channels_; }
+  InterleavedView<const int16_t> src() const {
+    return InterleavedView<const int16_t>(
+        src_.data(), src_samples_per_channel_, num_channels_);
+  }
+  InterleavedView<int16_t> dst() {
+    return InterleavedView<int16_t>(dst_.data(), dst_samples_per_channel_,
+                                    num_channels_);
+  }
+
+ private:
+  const size_t src_samples_per_channel_;
+  const size_t dst_samples_per_channel_;
+  const size_t num_channels_;
+  std::vector<int16_t> src_;
+  std::vector<int16_t> dst_;
+};
+
+// Resamples one 10 ms frame per iteration with PushResampler, which filters
+// all channels in one pass over the interleaved samples.
+void BM_PushResampler(benchmark::State& state) {
+  Frames frames(state);
+  PushResampler<int16_t> resampler(frames.src_samples_per_channel(),
+                                   frames.dst_samples_per_channel(),
+                                   frames.num_channels());
+  for (auto s : state) {
+    resampler.Resample(frames.src(), frames.dst());
+  }
+}
+
+// Resamples one 10 ms frame per iteration by deinterleaving the channels and
+// using one PushSincResampler per channel.
+void BM_PerChannelPushSincResampler(benchmark::State& state) {
+  Frames frames(state);
+  std::vector<std::unique_ptr<PushSincResampler>> resamplers;
+  for (size_t ch = 0; ch < frames.num_channels(); ++ch) {
+    resamplers.push_back(std::make_unique<PushSincResampler>(
+        frames.src_samples_per_channel(), frames.dst_samples_per_channel()));
+  }
+  std::vector<int16_t> src_buffer(frames.src().size());
+  std::vector<int16_t> dst_buffer(frames.dst().size());
+  DeinterleavedView<int16_t> src(src_buffer.data(),
+                                 frames.src_samples_per_channel(),
+                                 frames.num_channels());
+  DeinterleavedView<int16_t> dst(dst_buffer.data(),
+                                 frames.dst_samples_per_channel(),
+                                 frames.num_channels());
+  for (auto s : state) {
+    Deinterleave(frames.src(), src);
+    for (size_t ch = 0; ch < frames.num_channels(); ++ch) {
+      resamplers[ch]->Resample(src[ch], dst[ch]);
+    }
+    Interleave<int16_t>(dst, frames.dst());
+  }
+}
+
+void ResamplerArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"src_hz", "dst_hz", "channels"});
+  for (int num_channels : {1, 2, 6}) {
+    for (int rate_hz : {16000, 32000, 44100}) {
+      b->Args({rate_hz, 48000, num_channels});
+      b->Args({48000, rate_hz, num_channels});
+    }
+  }
+}
+
+BENCHMARK(BM_PushResampler)
+    ->Apply(ResamplerArguments)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PerChannelPushSincResampler)
+    ->Apply(ResamplerArguments)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace webrtc
@@ -117,6 +117,36 @@ double SincScaleFactor(double io_ratio) {
   return sinc_scale_factor;
 }
 
+// Blackman window parameters.
+constexpr double kAlpha = 0.16;
+constexpr double kA0 = 0.5 * (1.0 - kAlpha);
+constexpr double kA1 = 0.5;
+constexpr double kA2 = 0.5 * kAlpha;
+
+// Returns the argument of the sinc() for tap `i` of the kernel shifted by
+// `subsample_offset`.
+float PreSinc(size_t i, float subsample_offset) {
+  return static_cast<float>(
+      M_PI * (static_cast<int>(i) -
+              static_cast<int>(SincResampler::kKernelSize / 2) -
+              subsample_offset));
+}
+
+// Returns the Blackman window for tap `i`, matching the offset of the sinc().
+float Window(size_t i, float subsample_offset) {
+  const float x = (i - subsample_offset) / SincResampler::kKernelSize;
+  return static_cast<float>(kA0 - kA1 * cos(2.0 * M_PI * x) +
+                            kA2 * cos(4.0 * M_PI * x));
+}
+
+// Computes the sinc with offset, then windows it.
+float WindowedSinc(float window, float pre_sinc, double sinc_scale_factor) {
+  return static_cast<float>(
+      window * ((pre_sinc == 0)
+                    ? sinc_scale_factor
+                    : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
+}
+
 }  // namespace
 
 const size_t SincResampler::kKernelSize;
@@ -193,12 +223,6 @@ void SincResampler::UpdateRegions(bool second_load) {
 }
 
 void SincResampler::InitializeKernel() {
-  // Blackman window parameters.
-  static const double kAlpha = 0.16;
-  static const double kA0 = 0.5 * (1.0 - kAlpha);
-  static const double kA1 = 0.5;
-  static const double kA2 = 0.5 * kAlpha;
-
   // Generates a set of windowed sinc() kernels.
   // We generate a range of sub-sample offsets from 0.0 to 1.0.
   const double sinc_scale_factor = SincScaleFactor(io_sample_rate_ratio_);
@@ -208,23 +232,25 @@ void SincResampler::InitializeKernel() {
 
     for (size_t i = 0; i < kKernelSize; ++i) {
       const size_t idx = i + offset_idx * kKernelSize;
-      const float pre_sinc = static_cast<float>(
-          M_PI * (static_cast<int>(i) - static_cast<int>(kKernelSize / 2) -
-                  subsample_offset));
+      const float pre_sinc = PreSinc(i, subsample_offset);
       kernel_pre_sinc_storage_[idx] = pre_sinc;
-
-      // Compute Blackman window, matching the offset of the sinc().
-      const float x = (i - subsample_offset) / kKernelSize;
-      const float window = static_cast<float>(kA0 - kA1 * cos(2.0 * M_PI * x) +
-                                              kA2 * cos(4.0 * M_PI * x));
+      const float window = Window(i, subsample_offset);
       kernel_window_storage_[idx] = window;
+      kernel_storage_[idx] = WindowedSinc(window, pre_sinc, sinc_scale_factor);
+    }
+  }
+}
 
-      // Compute the sinc with offset, then window the sinc() function and store
-      // at the correct offset.
-      kernel_storage_[idx] = static_cast<float>(
-          window * ((pre_sinc == 0)
-                        ? sinc_scale_factor
-                        : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
+void SincResampler::ComputeKernels(double io_sample_rate_ratio,
+                                   float* kernels) {
+  const double sinc_scale_factor = SincScaleFactor(io_sample_rate_ratio);
+  for (size_t offset_idx = 0; offset_idx <= kKernelOffsetCount; ++offset_idx) {
+    const float subsample_offset =
+        static_cast<float>(offset_idx) / kKernelOffsetCount;
+    for (size_t i = 0; i < kKernelSize; ++i) {
+      kernels[i + offset_idx * kKernelSize] =
+          WindowedSinc(Window(i, subsample_offset),
+                       PreSinc(i, subsample_offset), sinc_scale_factor);
     }
   }
 }
@@ -246,10 +272,7 @@ void SincResampler::SetRatio(double io_sample_rate_ratio) {
       const float window = kernel_window_storage_[idx];
       const float pre_sinc = kernel_pre_sinc_storage_[idx];
 
-      kernel_storage_[idx] = static_cast<float>(
-          window * ((pre_sinc == 0)
-                        ? sinc_scale_factor
-                        : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
+      kernel_storage_[idx] = WindowedSinc(window, pre_sinc, sinc_scale_factor);
     }
   }
 }
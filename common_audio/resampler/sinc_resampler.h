@@ -89,6 +89,11 @@ class SincResampler {
 
   float* get_kernel_for_testing() { return kernel_storage_.get(); }
 
+  // Computes the kKernelOffsetCount + 1 windowed sinc() kernels that a
+  // SincResampler uses for `io_sample_rate_ratio` into `kernels`, which must
+  // hold kKernelStorageSize values.
+  static void ComputeKernels(double io_sample_rate_ratio, float* kernels);
+
  private:
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, Convolve);
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, ConvolveBenchmark);
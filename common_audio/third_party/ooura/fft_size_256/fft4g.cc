@@ -291,6 +291,12 @@ Appendix :
 #include <math.h>
 #include <stddef.h>
 
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 namespace webrtc {
 
 namespace {
@@ -823,6 +829,288 @@ void rftbsub(size_t n, float* a, size_t nc, float* c) {
   a[m + 1] = -a[m + 1];
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// SSE2 versions of the butterflies and of the real-FFT post- and
+// pre-processing. Every vector holds two complex values as [re, im, re, im].
+// The operations on each element are the same, and in the same order, as in
+// the scalar code; subtractions are only replaced with additions of negated
+// values, which gives identical results. The output is hence bit-exact.
+
+inline __m128 SwapReIm(__m128 v) {
+  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+inline __m128 NegateRe(__m128 v) {
+  return _mm_xor_ps(v, _mm_set_ps(0.f, -0.f, 0.f, -0.f));
+}
+
+inline __m128 NegateIm(__m128 v) {
+  return _mm_xor_ps(v, _mm_set_ps(-0.f, 0.f, -0.f, 0.f));
+}
+
+// Returns the real parts of `re` and the imaginary parts of `im`.
+inline __m128 MergeReIm(__m128 re, __m128 im) {
+  const __m128 re_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, 0, -1));
+  return _mm_or_ps(_mm_and_ps(re_mask, re), _mm_andnot_ps(re_mask, im));
+}
+
+// Computes (wr * x.re - wi * x.im, wr * x.im + wi * x.re) for each element.
+inline __m128 Rotate(__m128 x, __m128 wr, __m128 wi) {
+  return _mm_add_ps(_mm_mul_ps(wr, x),
+                    _mm_mul_ps(NegateRe(wi), SwapReIm(x)));
+}
+
+inline __m128 Rotate(__m128 x, float wr, float wi) {
+  return Rotate(x, _mm_set1_ps(wr), _mm_set1_ps(wi));
+}
+
+// The first butterfly step of a radix-4 stage.
+struct Radix4Sums {
+  Radix4Sums(const float* a, size_t j, size_t l) {
+    const __m128 a0 = _mm_loadu_ps(&a[j]);
+    const __m128 a1 = _mm_loadu_ps(&a[j + l]);
+    const __m128 a2 = _mm_loadu_ps(&a[j + 2 * l]);
+    const __m128 a3 = _mm_loadu_ps(&a[j + 3 * l]);
+    x0 = _mm_add_ps(a0, a1);
+    x1 = _mm_sub_ps(a0, a1);
+    x2 = _mm_add_ps(a2, a3);
+    x3 = _mm_sub_ps(a2, a3);
+  }
+  __m128 x0;
+  __m128 x1;
+  __m128 x2;
+  __m128 x3;
+};
+
+void Radix4WithoutTwiddles_SSE2(size_t j, size_t l, float* a) {
+  const Radix4Sums x(a, j, l);
+  const __m128 x3_swapped = SwapReIm(x.x3);
+  _mm_storeu_ps(&a[j], _mm_add_ps(x.x0, x.x2));
+  _mm_storeu_ps(&a[j + l], _mm_add_ps(x.x1, NegateRe(x3_swapped)));
+  _mm_storeu_ps(&a[j + 2 * l], _mm_sub_ps(x.x0, x.x2));
+  _mm_storeu_ps(&a[j + 3 * l], _mm_add_ps(x.x1, NegateIm(x3_swapped)));
+}
+
+void cftmdl_SSE2(size_t n, size_t l, float* a, float* w) {
+  const size_t m = l << 2;
+  for (size_t j = 0; j < l; j += 4) {
+    Radix4WithoutTwiddles_SSE2(j, l, a);
+  }
+
+  const __m128 wk1r = _mm_set1_ps(w[2]);
+  for (size_t j = m; j < l + m; j += 4) {
+    const Radix4Sums x(a, j, l);
+    _mm_storeu_ps(&a[j], _mm_add_ps(x.x0, x.x2));
+    // (x2i - x0i, x0r - x2r).
+    _mm_storeu_ps(&a[j + 2 * l],
+                  _mm_sub_ps(MergeReIm(SwapReIm(x.x2), SwapReIm(x.x0)),
+                             MergeReIm(SwapReIm(x.x0), SwapReIm(x.x2))));
+    const __m128 x3_swapped = SwapReIm(x.x3);
+    // (x1r - x3i, x1i + x3r), rotated by 45 degrees.
+    __m128 y = _mm_add_ps(x.x1, NegateRe(x3_swapped));
+    __m128 y_re = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 y_im = _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 1, 1));
+    _mm_storeu_ps(&a[j + l],
+                  _mm_mul_ps(wk1r, _mm_add_ps(y_re, NegateRe(y_im))));
+    // (x3i + x1r, x3r - x1i), rotated by 135 degrees.
+    y = _mm_add_ps(x3_swapped, NegateIm(x.x1));
+    y_re = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 2, 0, 0));
+    y_im = _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 1, 1));
+    _mm_storeu_ps(&a[j + 3 * l],
+                  _mm_mul_ps(wk1r, _mm_add_ps(y_im, NegateRe(y_re))));
+  }
+
+  size_t k1 = 0;
+  const size_t m2 = 2 * m;
+  for (size_t k = m2; k < n; k += m2) {
+    k1 += 2;
+    const size_t k2 = 2 * k1;
+    const float wk2r = w[k1];
+    const float wk2i = w[k1 + 1];
+    float wk1r = w[k2];
+    float wk1i = w[k2 + 1];
+    float wk3r = wk1r - 2 * wk2i * wk1i;
+    float wk3i = 2 * wk2i * wk1r - wk1i;
+    for (size_t j = k; j < l + k; j += 4) {
+      const Radix4Sums x(a, j, l);
+      const __m128 x3_swapped = SwapReIm(x.x3);
+      _mm_storeu_ps(&a[j], _mm_add_ps(x.x0, x.x2));
+      _mm_storeu_ps(&a[j + 2 * l],
+                    Rotate(_mm_sub_ps(x.x0, x.x2), wk2r, wk2i));
+      _mm_storeu_ps(&a[j + l], Rotate(_mm_add_ps(x.x1, NegateRe(x3_swapped)),
+                                      wk1r, wk1i));
+      _mm_storeu_ps(&a[j + 3 * l],
+                    Rotate(_mm_add_ps(x.x1, NegateIm(x3_swapped)), wk3r, wk3i));
+    }
+    wk1r = w[k2 + 2];
+    wk1i = w[k2 + 3];
+    wk3r = wk1r - 2 * wk2r * wk1i;
+    wk3i = 2 * wk2r * wk1r - wk1i;
+    for (size_t j = k + m; j < l + (k + m); j += 4) {
+      const Radix4Sums x(a, j, l);
+      const __m128 x3_swapped = SwapReIm(x.x3);
+      _mm_storeu_ps(&a[j], _mm_add_ps(x.x0, x.x2));
+      _mm_storeu_ps(&a[j + 2 * l],
+                    Rotate(_mm_sub_ps(x.x0, x.x2), -wk2i, wk2r));
+      _mm_storeu_ps(&a[j + l], Rotate(_mm_add_ps(x.x1, NegateRe(x3_swapped)),
+                                      wk1r, wk1i));
+      _mm_storeu_ps(&a[j + 3 * l],
+                    Rotate(_mm_add_ps(x.x1, NegateIm(x3_swapped)), wk3r, wk3i));
+    }
+  }
+}
+
+// Requires n >= 16, for all butterfly stages after cft1st() to operate on
+// multiples of two complex values.
+void cftfsub_SSE2(size_t n, float* a, float* w) {
+  cft1st(n, a, w);
+  size_t l = 8;
+  while ((l << 2) < n) {
+    cftmdl_SSE2(n, l, a, w);
+    l <<= 2;
+  }
+  if ((l << 2) == n) {
+    for (size_t j = 0; j < l; j += 4) {
+      Radix4WithoutTwiddles_SSE2(j, l, a);
+    }
+  } else {
+    for (size_t j = 0; j < l; j += 4) {
+      const __m128 a0 = _mm_loadu_ps(&a[j]);
+      const __m128 a1 = _mm_loadu_ps(&a[j + l]);
+      _mm_storeu_ps(&a[j], _mm_add_ps(a0, a1));
+      _mm_storeu_ps(&a[j + l], _mm_sub_ps(a0, a1));
+    }
+  }
+}
+
+// Requires n >= 16, see cftfsub_SSE2().
+void cftbsub_SSE2(size_t n, float* a, float* w) {
+  cft1st(n, a, w);
+  size_t l = 8;
+  while ((l << 2) < n) {
+    cftmdl_SSE2(n, l, a, w);
+    l <<= 2;
+  }
+  if ((l << 2) == n) {
+    for (size_t j = 0; j < l; j += 4) {
+      // The sums of the first two inputs are conjugated.
+      const __m128 a0 = NegateIm(_mm_loadu_ps(&a[j]));
+      const __m128 a1 = _mm_loadu_ps(&a[j + l]);
+      const __m128 a2 = _mm_loadu_ps(&a[j + 2 * l]);
+      const __m128 a3 = _mm_loadu_ps(&a[j + 3 * l]);
+      const __m128 x0 = _mm_add_ps(a0, NegateIm(a1));
+      const __m128 x1 = _mm_add_ps(a0, NegateRe(a1));
+      const __m128 x2 = _mm_add_ps(a2, a3);
+      const __m128 x3_swapped = SwapReIm(_mm_sub_ps(a2, a3));
+      _mm_storeu_ps(&a[j], _mm_add_ps(x0, NegateIm(x2)));
+      _mm_storeu_ps(&a[j + l], _mm_sub_ps(x1, x3_swapped));
+      _mm_storeu_ps(&a[j + 2 * l], _mm_add_ps(x0, NegateRe(x2)));
+      _mm_storeu_ps(&a[j + 3 * l], _mm_add_ps(x1, x3_swapped));
+    }
+  } else {
+    for (size_t j = 0; j < l; j += 4) {
+      const __m128 a0 = NegateIm(_mm_loadu_ps(&a[j]));
+      const __m128 a1 = _mm_loadu_ps(&a[j + l]);
+      _mm_storeu_ps(&a[j], _mm_add_ps(a0, NegateIm(a1)));
+      _mm_storeu_ps(&a[j + l], _mm_add_ps(a0, NegateRe(a1)));
+    }
+  }
+}
+
+// Loads the twiddle factors of rftfsub() and rftbsub() for the pair of
+// iterations starting at `kk`.
+void LoadRealFftTwiddles(size_t kk,
+                         size_t ks,
+                         size_t nc,
+                         const float* c,
+                         __m128* wr,
+                         __m128* wi) {
+  const float wkr0 = 0.5f - c[nc - kk];
+  const float wkr1 = 0.5f - c[nc - kk - ks];
+  *wr = _mm_set_ps(wkr1, wkr1, wkr0, wkr0);
+  *wi = _mm_set_ps(c[kk + ks], c[kk + ks], c[kk], c[kk]);
+}
+
+// Loads a[k] to a[k + 1] and a[k - 2] to a[k - 1], in that order.
+inline __m128 LoadMirrored(const float* a, size_t k) {
+  const __m128 v = _mm_loadu_ps(&a[k - 2]);
+  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+inline void StoreMirrored(__m128 v, size_t k, float* a) {
+  _mm_storeu_ps(&a[k - 2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+void rftfsub_SSE2(size_t n, float* a, size_t nc, float* c) {
+  const size_t m = n >> 1;
+  const size_t ks = 2 * nc / m;
+  size_t kk = ks;
+  size_t j = 2;
+  for (; j + 2 < m; j += 4, kk += 2 * ks) {
+    const size_t k = n - j;
+    __m128 wr;
+    __m128 wi;
+    LoadRealFftTwiddles(kk, ks, nc, c, &wr, &wi);
+    const __m128 aj = _mm_loadu_ps(&a[j]);
+    const __m128 ak = LoadMirrored(a, k);
+    const __m128 x = _mm_add_ps(aj, NegateRe(ak));
+    const __m128 y = Rotate(x, wr, wi);
+    _mm_storeu_ps(&a[j], _mm_sub_ps(aj, y));
+    StoreMirrored(_mm_add_ps(ak, NegateIm(y)), k, a);
+  }
+  for (; j < m; j += 2, kk += ks) {
+    const size_t k = n - j;
+    const float wkr = 0.5f - c[nc - kk];
+    const float wki = c[kk];
+    const float xr = a[j] - a[k];
+    const float xi = a[j + 1] + a[k + 1];
+    const float yr = wkr * xr - wki * xi;
+    const float yi = wkr * xi + wki * xr;
+    a[j] -= yr;
+    a[j + 1] -= yi;
+    a[k] += yr;
+    a[k + 1] -= yi;
+  }
+}
+
+void rftbsub_SSE2(size_t n, float* a, size_t nc, float* c) {
+  a[1] = -a[1];
+  const size_t m = n >> 1;
+  const size_t ks = 2 * nc / m;
+  size_t kk = ks;
+  size_t j = 2;
+  for (; j + 2 < m; j += 4, kk += 2 * ks) {
+    const size_t k = n - j;
+    __m128 wr;
+    __m128 wi;
+    LoadRealFftTwiddles(kk, ks, nc, c, &wr, &wi);
+    const __m128 aj = _mm_loadu_ps(&a[j]);
+    const __m128 ak = LoadMirrored(a, k);
+    const __m128 x = _mm_add_ps(aj, NegateRe(ak));
+    // Rotation by the conjugated twiddle factor.
+    const __m128 y = Rotate(x, wr, NegateRe(NegateIm(wi)));
+    // (ajr - yr, yi - aji) and (akr + yr, yi - aki).
+    _mm_storeu_ps(&a[j], _mm_sub_ps(MergeReIm(aj, y), MergeReIm(y, aj)));
+    StoreMirrored(
+        _mm_sub_ps(MergeReIm(ak, y), MergeReIm(NegateRe(y), ak)), k, a);
+  }
+  for (; j < m; j += 2, kk += ks) {
+    const size_t k = n - j;
+    const float wkr = 0.5f - c[nc - kk];
+    const float wki = c[kk];
+    const float xr = a[j] - a[k];
+    const float xi = a[j + 1] + a[k + 1];
+    const float yr = wkr * xr + wki * xi;
+    const float yi = wkr * xi - wki * xr;
+    a[j] -= yr;
+    a[j + 1] = yi - a[j + 1];
+    a[k] += yr;
+    a[k + 1] = yi - a[k + 1];
+  }
+  a[m + 1] = -a[m + 1];
+}
+#endif  // defined(WEBRTC_ARCH_X86_FAMILY)
+
 }  // namespace
 
 void WebRtc_rdft(size_t n, int isgn, float* a, size_t* ip, float* w) {
@@ -863,4 +1151,38 @@ void WebRtc_rdft(size_t n, int isgn, float* a, size_t* ip, float* w) {
   }
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void WebRtc_rdft_SSE2(size_t n, int isgn, float* a, size_t* ip, float* w) {
+  if (n < 16) {
+    WebRtc_rdft(n, isgn, a, ip, w);
+    return;
+  }
+
+  size_t nw = ip[0];
+  if (n > (nw << 2)) {
+    nw = n >> 2;
+    makewt(nw, ip, w);
+  }
+  size_t nc = ip[1];
+  if (n > (nc << 2)) {
+    nc = n >> 2;
+    makect(nc, ip, w + nw);
+  }
+  if (isgn >= 0) {
+    bitrv2(n, ip + 2, a);
+    cftfsub_SSE2(n, a, w);
+    rftfsub_SSE2(n, a, nc, w + nw);
+    const float xi = a[0] - a[1];
+    a[0] += a[1];
+    a[1] = xi;
+  } else {
+    a[1] = 0.5f * (a[0] - a[1]);
+    a[0] -= a[1];
+    rftbsub_SSE2(n, a, nc, w + nw);
+    bitrv2(n, ip + 2, a);
+    cftbsub_SSE2(n, a, w);
+  }
+}
+#endif
+
 }  // namespace webrtc
@@ -13,11 +13,20 @@
 
 #include <stddef.h>
 
+#include "rtc_base/system/arch.h"
+
 namespace webrtc {
 
 // Refer to fft4g.c for documentation.
 void WebRtc_rdft(size_t n, int isgn, float* a, size_t* ip, float* w);
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Same as WebRtc_rdft(), but with the butterflies and the real-FFT pre- and
+// post-processing done with SSE2. The result is bit-exact with
+// WebRtc_rdft(). Must only be called when SSE2 is available.
+void WebRtc_rdft_SSE2(size_t n, int isgn, float* a, size_t* ip, float* w);
+#endif
+
 }  // namespace webrtc
 
 #endif  // COMMON_AUDIO_THIRD_PARTY_OOURA_FFT_SIZE_256_FFT4G_H_
@@ -15,7 +15,7 @@
 #include <vector>
 
 #include "common_video/h264/h264_common.h"
-#include "rtc_base/bitstream_reader.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -37,11 +37,12 @@ H264BitstreamParser::Result H264BitstreamParser::ParseNonParameterSetNalu(
     return kInvalidStream;
 
   last_slice_qp_delta_ = std::nullopt;
-  const std::vector<uint8_t> slice_rbsp = H264::ParseRbsp(source);
-  if (slice_rbsp.size() < H264::kNaluTypeSize)
+  if (source.size() < H264::kNaluTypeSize)
     return kInvalidStream;
 
-  BitstreamReader slice_reader(slice_rbsp);
+  // Only the slice header is read, so the emulation prevention bytes are
+  // skipped while reading rather than unescaping the whole slice.
+  RbspBitstreamReader slice_reader(source);
   slice_reader.ConsumeBits(H264::kNaluTypeSize * 8);
 
   // Check to see if this is an IDR slice, which has an extra field to parse
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+#include "api/array_view.h"
+#include "benchmark/benchmark.h"
+#include "common_video/h264/h264_bitstream_parser.h"
+#include "common_video/h264/h264_common.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/random.h"
+#ifdef RTC_ENABLE_H265
+#include "common_video/h265/h265_bitstream_parser.h"
+#endif
+
+namespace webrtc {
+namespace {
+
+// SPS, PPS and the start of an IDR slice with slice QP 35.
+constexpr uint8_t kH264KeyFrameHeader[] = {
+    0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0x80, 0x20, 0xda, 0x01, 0x40, 0x16,
+    0xe8, 0x06, 0xd0, 0xa1, 0x35, 0x00, 0x00, 0x00, 0x01, 0x68, 0xce, 0x06,
+    0xe2, 0x00, 0x00, 0x00, 0x01, 0x65, 0xb8, 0x40, 0xf0, 0x8c, 0x03, 0xf2,
+    0x75, 0x67, 0xad, 0x41, 0x64, 0x24, 0x0e, 0xa0, 0xb2, 0x12, 0x1e, 0xf8,
+};
+
+#ifdef RTC_ENABLE_H265
+// VPS, SPS, PPS and the start of an IDR slice with slice QP 34.
+constexpr uint8_t kH265KeyFrameHeader[] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x78,
+    0x95, 0x98, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x78,
+    0xb0, 0x03, 0xc0, 0x80, 0x10, 0xe5, 0x96, 0x56, 0x69, 0x24, 0xca, 0xe0,
+    0x10, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x03, 0x01, 0xe0, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x62, 0x40, 0x00,
+    0x00, 0x01, 0x26, 0x01, 0xaf, 0x08, 0x42, 0x23, 0x10, 0x5d, 0x2b, 0x51,
+    0xf9, 0x7a, 0x55, 0x15, 0x0d, 0x10, 0x40, 0xe8, 0x10, 0x05, 0x30, 0x95,
+    0x09, 0x9a, 0xa5, 0xb6, 0x6a, 0x66, 0x6d, 0xde, 0xe0, 0xf9,
+};
+#endif
+
+// A key frame of `width`x`height` coded at half a bit per pixel: the headers
+// followed by random slice data, escaped like an encoder would.
+rtc::Buffer CreateKeyFrame(rtc::ArrayView<const uint8_t> header,
+                           int width,
+                           int height) {
+  Random random(/*seed=*/0x5eed);
+  std::vector<uint8_t> slice_data(static_cast<size_t>(width) * height / 16);
+  for (uint8_t& byte : slice_data) {
+    byte = random.Rand<uint8_t>();
+  }
+  rtc::Buffer frame(header.data(), header.size());
+  H264::WriteRbsp(slice_data, &frame);
+  return frame;
+}
+
+template <typename Parser>
+void ParseKeyFrameQp(benchmark::State& state,
+                     rtc::ArrayView<const uint8_t> header) {
+  const rtc::Buffer frame = CreateKeyFrame(header, state.range(0),
+                                           state.range(1));
+  Parser parser;
+  for (auto _ : state) {
+    parser.ParseBitstream(frame);
+    std::optional<int> qp = parser.GetLastSliceQp();
+    benchmark::DoNotOptimize(qp);
+  }
+  state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void BM_H264ParseKeyFrameQp(benchmark::State& state) {
+  ParseKeyFrameQp<H264BitstreamParser>(state, kH264KeyFrameHeader);
+}
+BENCHMARK(BM_H264ParseKeyFrameQp)
+    ->ArgNames({"width", "height"})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160});
+
+#ifdef RTC_ENABLE_H265
+void BM_H265ParseKeyFrameQp(benchmark::State& state) {
+  ParseKeyFrameQp<H265BitstreamParser>(state, kH265KeyFrameHeader);
+}
+BENCHMARK(BM_H265ParseKeyFrameQp)
+    ->ArgNames({"width", "height"})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160});
+#endif
+
+}  // namespace
+}  // namespace webrtc
@@ -12,11 +12,10 @@
 
 #include <cstdint>
 #include <limits>
-#include <vector>
 
 #include "absl/numeric/bits.h"
 #include "common_video/h264/h264_common.h"
-#include "rtc_base/bitstream_reader.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -31,10 +30,11 @@ constexpr int kMinPicInitQpDeltaValue = -26;
 
 std::optional<PpsParser::PpsState> PpsParser::ParsePps(
     rtc::ArrayView<const uint8_t> data) {
-  // First, parse out rbsp, which is basically the source buffer minus emulation
-  // bytes (the last byte of a 0x00 0x00 0x03 sequence). RBSP is defined in
+  // The reader skips the emulation bytes (the last byte of a 0x00 0x00 0x03
+  // sequence) of the source buffer, i.e. reads the RBSP, which is defined in
   // section 7.3.1 of the H.264 standard.
-  return ParseInternal(H264::ParseRbsp(data));
+  RbspBitstreamReader reader(data);
+  return ParseInternal(reader);
 }
 
 bool PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
@@ -42,11 +42,7 @@ bool PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
                             uint32_t* sps_id) {
   RTC_DCHECK(pps_id);
   RTC_DCHECK(sps_id);
-  // First, parse out rbsp, which is basically the source buffer minus emulation
-  // bytes (the last byte of a 0x00 0x00 0x03 sequence). RBSP is defined in
-  // section 7.3.1 of the H.264 standard.
-  std::vector<uint8_t> unpacked_buffer = H264::ParseRbsp(data);
-  BitstreamReader reader(unpacked_buffer);
+  RbspBitstreamReader reader(data);
   *pps_id = reader.ReadExponentialGolomb();
   *sps_id = reader.ReadExponentialGolomb();
   return reader.Ok();
@@ -54,8 +50,7 @@ bool PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
 
 std::optional<PpsParser::SliceHeader> PpsParser::ParseSliceHeader(
     rtc::ArrayView<const uint8_t> data) {
-  std::vector<uint8_t> unpacked_buffer = H264::ParseRbsp(data);
-  BitstreamReader slice_reader(unpacked_buffer);
+  RbspBitstreamReader slice_reader(data);
   PpsParser::SliceHeader slice_header;
 
   // first_mb_in_slice: ue(v)
@@ -74,8 +69,7 @@ std::optional<PpsParser::SliceHeader> PpsParser::ParseSliceHeader(
 }
 
 std::optional<PpsParser::PpsState> PpsParser::ParseInternal(
-    rtc::ArrayView<const uint8_t> buffer) {
-  BitstreamReader reader(buffer);
+    RbspBitstreamReader& reader) {
   PpsState pps;
   pps.id = reader.ReadExponentialGolomb();
   pps.sps_id = reader.ReadExponentialGolomb();
@@ -17,6 +17,7 @@
 #include <optional>
 
 #include "api/array_view.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 
 namespace webrtc {
 
@@ -63,10 +64,8 @@ class PpsParser {
       rtc::ArrayView<const uint8_t> data);
 
  protected:
-  // Parse the PPS state, for a buffer where RBSP decoding has already been
-  // performed.
-  static std::optional<PpsState> ParseInternal(
-      rtc::ArrayView<const uint8_t> buffer);
+  // Parse the PPS state, reading the RBSP of the payload.
+  static std::optional<PpsState> ParseInternal(RbspBitstreamReader& reader);
 };
 
 }  // namespace webrtc
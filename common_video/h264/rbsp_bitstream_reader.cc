@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/rbsp_bitstream_reader.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+// An emulation prevention byte follows two zero bytes, see section 7.4.1 of
+// the H264 spec.
+constexpr uint8_t kEmulationPreventionByte = 0x03;
+constexpr int kZerosBeforeEmulationPreventionByte = 2;
+
+}  // namespace
+
+int RbspBitstreamReader::RemainingBitCount() const {
+  set_last_read_is_verified(true);
+  if (!ok_) {
+    return -1;
+  }
+  int remaining_bits = current_byte_bits_;
+  int zero_count = zero_count_;
+  for (const uint8_t* byte = next_; byte != end_; ++byte) {
+    if (*byte == kEmulationPreventionByte &&
+        zero_count >= kZerosBeforeEmulationPreventionByte) {
+      zero_count = 0;
+      continue;
+    }
+    zero_count = *byte == 0 ? zero_count + 1 : 0;
+    remaining_bits += 8;
+  }
+  return remaining_bits;
+}
+
+void RbspBitstreamReader::Invalidate() {
+  ok_ = false;
+  next_ = end_;
+  current_byte_bits_ = 0;
+}
+
+bool RbspBitstreamReader::LoadNextByte() {
+  if (next_ == end_) {
+    return false;
+  }
+  uint8_t byte = *next_++;
+  if (byte == kEmulationPreventionByte &&
+      zero_count_ >= kZerosBeforeEmulationPreventionByte) {
+    if (next_ == end_) {
+      return false;
+    }
+    byte = *next_++;
+    zero_count_ = 0;
+  }
+  zero_count_ = byte == 0 ? zero_count_ + 1 : 0;
+  current_byte_ = byte;
+  current_byte_bits_ = 8;
+  return true;
+}
+
+void RbspBitstreamReader::ConsumeBits(int bits) {
+  RTC_DCHECK_GE(bits, 0);
+  set_last_read_is_verified(false);
+  while (bits > current_byte_bits_) {
+    bits -= current_byte_bits_;
+    current_byte_bits_ = 0;
+    if (!LoadNextByte()) {
+      Invalidate();
+      return;
+    }
+  }
+  current_byte_bits_ -= bits;
+}
+
+int RbspBitstreamReader::ReadBit() {
+  set_last_read_is_verified(false);
+  if (current_byte_bits_ == 0 && !LoadNextByte()) {
+    Invalidate();
+    return 0;
+  }
+  --current_byte_bits_;
+  return (current_byte_ >> current_byte_bits_) & 0x01;
+}
+
+uint64_t RbspBitstreamReader::ReadBits(int bits) {
+  RTC_DCHECK_GE(bits, 0);
+  RTC_DCHECK_LE(bits, 64);
+  set_last_read_is_verified(false);
+
+  uint64_t result = 0;
+  while (bits > 0) {
+    if (current_byte_bits_ == 0 && !LoadNextByte()) {
+      Invalidate();
+      return 0;
+    }
+    int bits_from_byte = std::min(bits, current_byte_bits_);
+    bits -= bits_from_byte;
+    current_byte_bits_ -= bits_from_byte;
+    result = (result << bits_from_byte) |
+             ((current_byte_ >> current_byte_bits_) &
+              ((1 << bits_from_byte) - 1));
+  }
+  return result;
+}
+
+uint32_t RbspBitstreamReader::ReadExponentialGolomb() {
+  // Count the number of leading 0.
+  int zero_bit_count = 0;
+  while (ReadBit() == 0) {
+    if (++zero_bit_count >= 32) {
+      // Golob value won't fit into 32 bits of the return value. Fail the parse.
+      Invalidate();
+      return 0;
+    }
+  }
+
+  // The bit count of the value is the number of zeros + 1.
+  // However the first '1' was already read above.
+  return (uint32_t{1} << zero_bit_count) +
+         rtc::dchecked_cast<uint32_t>(ReadBits(zero_bit_count)) - 1;
+}
+
+int RbspBitstreamReader::ReadSignedExponentialGolomb() {
+  uint32_t unsigned_val = ReadExponentialGolomb();
+  if ((unsigned_val & 1) == 0) {
+    return -static_cast<int>(unsigned_val / 2);
+  } else {
+    return (unsigned_val + 1) / 2;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_H264_RBSP_BITSTREAM_READER_H_
+#define COMMON_VIDEO_H264_RBSP_BITSTREAM_READER_H_
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "absl/base/attributes.h"
+#include "api/array_view.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/numerics/safe_conversions.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Reads the RBSP of an escaped H.264 or H.265 NAL unit payload, i.e. it
+// behaves like a BitstreamReader over the output of H264::ParseRbsp, but skips
+// the emulation prevention bytes as it reads instead of copying the payload.
+// Only the part of the payload that is read is visited, so parsing e.g. a
+// slice header costs the same for small and large slices.
+//
+// Like BitstreamReader, reads never fail but may put the reader into the
+// failure state, which has to be checked with `Ok`.
+class RTC_EXPORT RbspBitstreamReader {
+ public:
+  explicit RbspBitstreamReader(
+      rtc::ArrayView<const uint8_t> bytes ABSL_ATTRIBUTE_LIFETIME_BOUND);
+  RbspBitstreamReader(const RbspBitstreamReader&) = default;
+  RbspBitstreamReader& operator=(const RbspBitstreamReader&) = default;
+  ~RbspBitstreamReader();
+
+  // Returns the number of unread RBSP bits, or a negative number if there was
+  // a reading error. Unlike the reads, this scans the rest of the payload.
+  int RemainingBitCount() const;
+
+  // Returns `true` iff all calls to `Read` and `ConsumeBits` were successful.
+  bool Ok() const {
+    set_last_read_is_verified(true);
+    return ok_;
+  }
+
+  // Sets the reader into the failure state.
+  void Invalidate();
+
+  // Moves current read position forward. `bits` must be non-negative.
+  void ConsumeBits(int bits);
+
+  // Reads single bit. Returns 0 or 1.
+  ABSL_MUST_USE_RESULT int ReadBit();
+
+  // Reads `bits` from the bitstream. `bits` must be in range [0, 64].
+  // Returns an unsigned integer in range [0, 2^bits - 1].
+  // On failure sets the reader into the failure state and returns 0.
+  ABSL_MUST_USE_RESULT uint64_t ReadBits(int bits);
+
+  // Reads unsigned integer of fixed width.
+  template <typename T,
+            typename std::enable_if<std::is_unsigned<T>::value &&
+                                    !std::is_same<T, bool>::value &&
+                                    sizeof(T) <= 8>::type* = nullptr>
+  ABSL_MUST_USE_RESULT T Read() {
+    return rtc::dchecked_cast<T>(ReadBits(sizeof(T) * 8));
+  }
+
+  // Reads single bit as boolean.
+  template <
+      typename T,
+      typename std::enable_if<std::is_same<T, bool>::value>::type* = nullptr>
+  ABSL_MUST_USE_RESULT bool Read() {
+    return ReadBit() != 0;
+  }
+
+  // Reads exponential golomb encoded value, see
+  // BitstreamReader::ReadExponentialGolomb.
+  uint32_t ReadExponentialGolomb();
+
+  // Reads signed exponential golomb encoded value, see
+  // BitstreamReader::ReadSignedExponentialGolomb.
+  int ReadSignedExponentialGolomb();
+
+ private:
+  // Makes the next RBSP byte the current one. Returns false at the end of the
+  // payload.
+  bool LoadNextByte();
+  void set_last_read_is_verified(bool value) const;
+
+  // Next payload byte that hasn't been loaded.
+  const uint8_t* next_;
+  const uint8_t* end_;
+  uint8_t current_byte_ = 0;
+  // Number of unread bits in `current_byte_`.
+  int current_byte_bits_ = 0;
+  // Number of consecutive zero bytes loaded last, to detect the emulation
+  // prevention bytes.
+  int zero_count_ = 0;
+  bool ok_ = true;
+
+  // Unused in release mode.
+  mutable bool last_read_is_verified_ = true;
+};
+
+inline RbspBitstreamReader::RbspBitstreamReader(
+    rtc::ArrayView<const uint8_t> bytes)
+    : next_(bytes.data()), end_(bytes.data() + bytes.size()) {}
+
+inline RbspBitstreamReader::~RbspBitstreamReader() {
+  RTC_DCHECK(last_read_is_verified_) << "Latest calls to Read or ConsumeBit "
+                                        "were not checked with Ok function.";
+}
+
+inline void RbspBitstreamReader::set_last_read_is_verified(bool value) const {
+#if RTC_DCHECK_IS_ON
+  last_read_is_verified_ = value;
+#endif
+}
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_H264_RBSP_BITSTREAM_READER_H_
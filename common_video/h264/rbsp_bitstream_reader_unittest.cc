@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/rbsp_bitstream_reader.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "common_video/h264/h264_common.h"
+#include "rtc_base/bitstream_reader.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+TEST(RbspBitstreamReaderTest, SkipsEmulationPreventionBytes) {
+  const uint8_t kEscaped[] = {0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x03};
+  RbspBitstreamReader reader(kEscaped);
+  EXPECT_EQ(reader.RemainingBitCount(), 6 * 8);
+  EXPECT_EQ(reader.ReadBits(48), uint64_t{0x000001000003});
+  EXPECT_EQ(reader.RemainingBitCount(), 0);
+  EXPECT_TRUE(reader.Ok());
+}
+
+TEST(RbspBitstreamReaderTest, ReadsAcrossEmulationPreventionByte) {
+  // The RBSP is 00 00 80 00 01, which starts with the exponential golomb code
+  // of 2^16 - 1.
+  const uint8_t kEscaped[] = {0x00, 0x00, 0x03, 0x80, 0x00, 0x01};
+  RbspBitstreamReader reader(kEscaped);
+  EXPECT_EQ(reader.ReadExponentialGolomb(), 0xFFFFu);
+  EXPECT_EQ(reader.RemainingBitCount(), 7);
+  EXPECT_TRUE(reader.Ok());
+}
+
+TEST(RbspBitstreamReaderTest, KeepsThreeNotFollowingTwoZeros) {
+  const uint8_t kEscaped[] = {0x00, 0x03, 0x00, 0x00, 0x00, 0x03};
+  RbspBitstreamReader reader(kEscaped);
+  EXPECT_EQ(reader.RemainingBitCount(), 5 * 8);
+  EXPECT_EQ(reader.ReadBits(40), uint64_t{0x0003000000});
+  EXPECT_TRUE(reader.Ok());
+}
+
+TEST(RbspBitstreamReaderTest, FailsReadingPastTheEnd) {
+  const uint8_t kEscaped[] = {0xFF, 0x00, 0x00, 0x03};
+  RbspBitstreamReader reader(kEscaped);
+  reader.ConsumeBits(20);
+  EXPECT_EQ(reader.RemainingBitCount(), 4);
+  EXPECT_EQ(reader.ReadBits(5), 0u);
+  EXPECT_FALSE(reader.Ok());
+  EXPECT_LT(reader.RemainingBitCount(), 0);
+  EXPECT_EQ(reader.ReadBit(), 0);
+  EXPECT_FALSE(reader.Ok());
+}
+
+TEST(RbspBitstreamReaderTest, ReadsLikeBitstreamReaderOverParsedRbsp) {
+  Random random(/*seed=*/0x4b1d);
+  for (int i = 0; i < 200; ++i) {
+    // Mostly zeros and emulation prevention bytes.
+    std::vector<uint8_t> escaped(random.Rand(1, 64));
+    for (uint8_t& byte : escaped) {
+      const uint8_t kBytes[] = {0x00, 0x00, 0x00, 0x03, 0x01, 0xFF};
+      byte = kBytes[random.Rand(0, 5)];
+    }
+    std::vector<uint8_t> rbsp = H264::ParseRbsp(escaped);
+    BitstreamReader expected(rbsp);
+    RbspBitstreamReader reader(escaped);
+    EXPECT_EQ(reader.RemainingBitCount(), expected.RemainingBitCount());
+    while (expected.RemainingBitCount() > 0) {
+      switch (random.Rand(0, 3)) {
+        case 0:
+          ASSERT_EQ(reader.ReadBit(), expected.ReadBit());
+          break;
+        case 1: {
+          int bits = random.Rand(0, 64);
+          ASSERT_EQ(reader.ReadBits(bits), expected.ReadBits(bits));
+          break;
+        }
+        case 2: {
+          int bits = random.Rand(0, 20);
+          reader.ConsumeBits(bits);
+          expected.ConsumeBits(bits);
+          break;
+        }
+        case 3:
+          ASSERT_EQ(reader.ReadExponentialGolomb(),
+                    expected.ReadExponentialGolomb());
+          break;
+      }
+      ASSERT_EQ(reader.Ok(), expected.Ok());
+      ASSERT_EQ(reader.RemainingBitCount(), expected.RemainingBitCount());
+    }
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
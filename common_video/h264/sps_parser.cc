@@ -11,10 +11,9 @@
 #include "common_video/h264/sps_parser.h"
 
 #include <cstdint>
-#include <vector>
 
 #include "common_video/h264/h264_common.h"
-#include "rtc_base/bitstream_reader.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 
 namespace {
 constexpr int kScalingDeltaMin = -128;
@@ -34,13 +33,12 @@ SpsParser::SpsState::~SpsState() = default;
 // Unpack RBSP and parse SPS state from the supplied buffer.
 std::optional<SpsParser::SpsState> SpsParser::ParseSps(
     rtc::ArrayView<const uint8_t> data) {
-  std::vector<uint8_t> unpacked_buffer = H264::ParseRbsp(data);
-  BitstreamReader reader(unpacked_buffer);
+  RbspBitstreamReader reader(data);
   return ParseSpsUpToVui(reader);
 }
 
 std::optional<SpsParser::SpsState> SpsParser::ParseSpsUpToVui(
-    BitstreamReader& reader) {
+    RbspBitstreamReader& reader) {
   // Now, we need to use a bitstream reader to parse through the actual AVC SPS
   // format. See Section 7.3.2.1.1 ("Sequence parameter set data syntax") of the
   // H.264 standard for a complete description.
@@ -114,7 +112,7 @@ std::optional<SpsParser::SpsState> SpsParser::ParseSpsUpToVui(
     }
   }
   // log2_max_frame_num and log2_max_pic_order_cnt_lsb are used with
-  // BitstreamReader::ReadBits, which can read at most 64 bits at a time. We
+  // RbspBitstreamReader::ReadBits, which can read at most 64 bits at a time. We
   // also have to avoid overflow when adding 4 to the on-wire golomb value,
   // e.g., for evil input data, ReadExponentialGolomb might return 0xfffc.
   const uint32_t kMaxLog2Minus4 = 12;
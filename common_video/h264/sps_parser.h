@@ -13,7 +13,7 @@
 
 #include <optional>
 
-#include "rtc_base/bitstream_reader.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -46,9 +46,9 @@ class RTC_EXPORT SpsParser {
   static std::optional<SpsState> ParseSps(rtc::ArrayView<const uint8_t> data);
 
  protected:
-  // Parse the SPS state, up till the VUI part, for a buffer where RBSP
-  // decoding has already been performed.
-  static std::optional<SpsState> ParseSpsUpToVui(BitstreamReader& reader);
+  // Parse the SPS state, up till the VUI part, reading the RBSP of the
+  // payload.
+  static std::optional<SpsState> ParseSpsUpToVui(RbspBitstreamReader& reader);
 };
 
 }  // namespace webrtc
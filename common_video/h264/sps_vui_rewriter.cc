@@ -19,9 +19,9 @@
 
 #include "api/video/color_space.h"
 #include "common_video/h264/h264_common.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h264/sps_parser.h"
 #include "rtc_base/bit_buffer.h"
-#include "rtc_base/bitstream_reader.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "system_wrappers/include/metrics.h"
@@ -54,7 +54,8 @@ enum SpsValidEvent {
     }                                                                  \
   } while (0)
 
-uint8_t CopyUInt8(BitstreamReader& source, rtc::BitBufferWriter& destination) {
+uint8_t CopyUInt8(RbspBitstreamReader& source,
+                  rtc::BitBufferWriter& destination) {
   uint8_t tmp = source.Read<uint8_t>();
   if (!destination.WriteUInt8(tmp)) {
     source.Invalidate();
@@ -62,7 +63,7 @@ uint8_t CopyUInt8(BitstreamReader& source, rtc::BitBufferWriter& destination) {
   return tmp;
 }
 
-uint32_t CopyExpGolomb(BitstreamReader& source,
+uint32_t CopyExpGolomb(RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination) {
   uint32_t tmp = source.ReadExponentialGolomb();
   if (!destination.WriteExponentialGolomb(tmp)) {
@@ -72,7 +73,7 @@ uint32_t CopyExpGolomb(BitstreamReader& source,
 }
 
 uint32_t CopyBits(int bits,
-                  BitstreamReader& source,
+                  RbspBitstreamReader& source,
                   rtc::BitBufferWriter& destination) {
   RTC_DCHECK_GT(bits, 0);
   RTC_DCHECK_LE(bits, 32);
@@ -84,12 +85,12 @@ uint32_t CopyBits(int bits,
 }
 
 bool CopyAndRewriteVui(const SpsParser::SpsState& sps,
-                       BitstreamReader& source,
+                       RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination,
                        const webrtc::ColorSpace* color_space,
                        SpsVuiRewriter::ParseResult& out_vui_rewritten);
 
-void CopyHrdParameters(BitstreamReader& source,
+void CopyHrdParameters(RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination);
 bool AddBitstreamRestriction(rtc::BitBufferWriter* destination,
                              uint32_t max_num_ref_frames);
@@ -97,11 +98,11 @@ bool IsDefaultColorSpace(const ColorSpace& color_space);
 bool AddVideoSignalTypeInfo(rtc::BitBufferWriter& destination,
                             const ColorSpace& color_space);
 bool CopyOrRewriteVideoSignalTypeInfo(
-    BitstreamReader& source,
+    RbspBitstreamReader& source,
     rtc::BitBufferWriter& destination,
     const ColorSpace* color_space,
     SpsVuiRewriter::ParseResult& out_vui_rewritten);
-bool CopyRemainingBits(BitstreamReader& source,
+bool CopyRemainingBits(RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination);
 }  // namespace
 
@@ -140,9 +141,10 @@ SpsVuiRewriter::ParseResult SpsVuiRewriter::ParseAndRewriteSps(
     const webrtc::ColorSpace* color_space,
     rtc::Buffer* destination) {
   // Create temporary RBSP decoded buffer of the payload (exlcuding the
-  // leading nalu type header byte (the SpsParser uses only the payload).
+  // leading nalu type header byte (the SpsParser uses only the payload), to
+  // copy the part that is not rewritten from.
   std::vector<uint8_t> rbsp_buffer = H264::ParseRbsp(buffer);
-  BitstreamReader source_buffer(rbsp_buffer);
+  RbspBitstreamReader source_buffer(buffer);
   std::optional<SpsParser::SpsState> sps_state =
       SpsParser::ParseSpsUpToVui(source_buffer);
   if (!sps_state)
@@ -282,7 +284,7 @@ rtc::Buffer SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
 
 namespace {
 bool CopyAndRewriteVui(const SpsParser::SpsState& sps,
-                       BitstreamReader& source,
+                       RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination,
                        const webrtc::ColorSpace* color_space,
                        SpsVuiRewriter::ParseResult& out_vui_rewritten) {
@@ -416,7 +418,7 @@ bool CopyAndRewriteVui(const SpsParser::SpsState& sps,
 }
 
 // Copies a VUI HRD parameters segment.
-void CopyHrdParameters(BitstreamReader& source,
+void CopyHrdParameters(RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination) {
   // cbp_cnt_minus1: ue(v)
   uint32_t cbp_cnt_minus1 = CopyExpGolomb(source, destination);
@@ -495,7 +497,7 @@ bool AddVideoSignalTypeInfo(rtc::BitBufferWriter& destination,
 }
 
 bool CopyOrRewriteVideoSignalTypeInfo(
-    BitstreamReader& source,
+    RbspBitstreamReader& source,
     rtc::BitBufferWriter& destination,
     const ColorSpace* color_space,
     SpsVuiRewriter::ParseResult& out_vui_rewritten) {
@@ -589,16 +591,20 @@ bool CopyOrRewriteVideoSignalTypeInfo(
   return true;
 }
 
-bool CopyRemainingBits(BitstreamReader& source,
+bool CopyRemainingBits(RbspBitstreamReader& source,
                        rtc::BitBufferWriter& destination) {
+  // Counting the remaining bits scans the rest of the source, so do it once.
+  int remaining_bits = source.RemainingBitCount();
   // Try to get at least the destination aligned.
-  if (source.RemainingBitCount() > 0 && source.RemainingBitCount() % 8 != 0) {
-    size_t misaligned_bits = source.RemainingBitCount() % 8;
+  if (remaining_bits > 0 && remaining_bits % 8 != 0) {
+    size_t misaligned_bits = remaining_bits % 8;
     CopyBits(misaligned_bits, source, destination);
+    remaining_bits -= misaligned_bits;
   }
-  while (source.RemainingBitCount() > 0) {
-    int count = std::min(32, source.RemainingBitCount());
+  while (remaining_bits > 0) {
+    int count = std::min(32, remaining_bits);
     CopyBits(count, source, destination);
+    remaining_bits -= count;
   }
   // TODO(noahric): The last byte could be all zeroes now, which we should just
   // strip.
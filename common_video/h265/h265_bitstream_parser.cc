@@ -15,9 +15,9 @@
 #include <limits>
 #include <vector>
 
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h265/h265_common.h"
 #include "rtc_base/bit_buffer.h"
-#include "rtc_base/bitstream_reader.h"
 #include "rtc_base/logging.h"
 
 #define IN_RANGE_OR_RETURN(val, min, max)                                     \
@@ -84,11 +84,12 @@ H265BitstreamParser::Result H265BitstreamParser::ParseNonParameterSetNalu(
     uint8_t nalu_type) {
   last_slice_qp_delta_ = std::nullopt;
   last_slice_pps_id_ = std::nullopt;
-  const std::vector<uint8_t> slice_rbsp = H265::ParseRbsp(source);
-  if (slice_rbsp.size() < H265::kNaluHeaderSize)
+  if (source.size() < H265::kNaluHeaderSize)
     return kInvalidStream;
 
-  BitstreamReader slice_reader(slice_rbsp);
+  // Only the slice segment header is read, so the emulation prevention bytes
+  // are skipped while reading rather than unescaping the whole slice.
+  RbspBitstreamReader slice_reader(source);
   slice_reader.ConsumeBits(H265::kNaluHeaderSize * 8);
 
   // first_slice_segment_in_pic_flag: u(1)
@@ -455,9 +456,7 @@ void H265BitstreamParser::ParseSlice(rtc::ArrayView<const uint8_t> slice) {
     case H265::NaluType::kPps: {
       std::optional<H265PpsParser::PpsState> pps_state;
       if (slice.size() >= H265::kNaluHeaderSize) {
-        std::vector<uint8_t> unpacked_buffer =
-            H265::ParseRbsp(slice.subview(H265::kNaluHeaderSize));
-        BitstreamReader slice_reader(unpacked_buffer);
+        RbspBitstreamReader slice_reader(slice.subview(H265::kNaluHeaderSize));
         // pic_parameter_set_id: ue(v)
         uint32_t pps_id = slice_reader.ReadExponentialGolomb();
         IN_RANGE_OR_RETURN_VOID(pps_id, 0, 63);
@@ -494,8 +493,7 @@ std::optional<uint32_t>
 H265BitstreamParser::ParsePpsIdFromSliceSegmentLayerRbsp(
     rtc::ArrayView<const uint8_t> data,
     uint8_t nalu_type) {
-  std::vector<uint8_t> unpacked_buffer = H265::ParseRbsp(data);
-  BitstreamReader slice_reader(unpacked_buffer);
+  RbspBitstreamReader slice_reader(data);
 
   // first_slice_segment_in_pic_flag: u(1)
   slice_reader.ConsumeBits(1);
@@ -521,8 +519,7 @@ H265BitstreamParser::ParsePpsIdFromSliceSegmentLayerRbsp(
 
 std::optional<bool> H265BitstreamParser::IsFirstSliceSegmentInPic(
     rtc::ArrayView<const uint8_t> data) {
-  std::vector<uint8_t> unpacked_buffer = H265::ParseRbsp(data);
-  BitstreamReader slice_reader(unpacked_buffer);
+  RbspBitstreamReader slice_reader(data);
 
   // first_slice_segment_in_pic_flag: u(1)
   bool first_slice_segment_in_pic_flag = slice_reader.Read<bool>();
@@ -12,11 +12,10 @@
 
 #include <memory>
 #include <optional>
-#include <vector>
 
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h265/h265_common.h"
 #include "rtc_base/bit_buffer.h"
-#include "rtc_base/bitstream_reader.h"
 #include "rtc_base/logging.h"
 
 #define IN_RANGE_OR_RETURN_NULL(val, min, max)                                \
@@ -65,10 +64,11 @@ namespace webrtc {
 std::optional<H265PpsParser::PpsState> H265PpsParser::ParsePps(
     rtc::ArrayView<const uint8_t> data,
     const H265SpsParser::SpsState* sps) {
-  // First, parse out rbsp, which is basically the source buffer minus emulation
-  // bytes (the last byte of a 0x00 0x00 0x03 sequence). RBSP is defined in
+  // The reader skips the emulation bytes (the last byte of a 0x00 0x00 0x03
+  // sequence) of the source buffer, i.e. reads the RBSP, which is defined in
   // section 7.3.1.1 of the H.265 standard.
-  return ParseInternal(H265::ParseRbsp(data), sps);
+  RbspBitstreamReader reader(data);
+  return ParseInternal(reader, sps);
 }
 
 bool H265PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
@@ -76,11 +76,7 @@ bool H265PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
                                 uint32_t* sps_id) {
   RTC_DCHECK(pps_id);
   RTC_DCHECK(sps_id);
-  // First, parse out rbsp, which is basically the source buffer minus emulation
-  // bytes (the last byte of a 0x00 0x00 0x03 sequence). RBSP is defined in
-  // section 7.3.1.1 of the H.265 standard.
-  std::vector<uint8_t> unpacked_buffer = H265::ParseRbsp(data);
-  BitstreamReader reader(unpacked_buffer);
+  RbspBitstreamReader reader(data);
   *pps_id = reader.ReadExponentialGolomb();
   IN_RANGE_OR_RETURN_FALSE(*pps_id, 0, 63);
   *sps_id = reader.ReadExponentialGolomb();
@@ -89,9 +85,8 @@ bool H265PpsParser::ParsePpsIds(rtc::ArrayView<const uint8_t> data,
 }
 
 std::optional<H265PpsParser::PpsState> H265PpsParser::ParseInternal(
-    rtc::ArrayView<const uint8_t> buffer,
+    RbspBitstreamReader& reader,
     const H265SpsParser::SpsState* sps) {
-  BitstreamReader reader(buffer);
   PpsState pps;
 
   if (!sps) {
@@ -234,7 +229,7 @@ std::optional<H265PpsParser::PpsState> H265PpsParser::ParseInternal(
   return pps;
 }
 
-bool H265PpsParser::ParsePpsIdsInternal(BitstreamReader& reader,
+bool H265PpsParser::ParsePpsIdsInternal(RbspBitstreamReader& reader,
                                         uint32_t& pps_id,
                                         uint32_t& sps_id) {
   // pic_parameter_set_id: ue(v)
@@ -14,8 +14,8 @@
 #include <optional>
 
 #include "api/array_view.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h265/h265_sps_parser.h"
-#include "rtc_base/bitstream_reader.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -66,12 +66,11 @@ class RTC_EXPORT H265PpsParser {
   }
 
  protected:
-  // Parse the PPS state, for a bit buffer where RBSP decoding has already been
-  // performed.
+  // Parse the PPS state, reading the RBSP of the payload.
   static std::optional<PpsState> ParseInternal(
-      rtc::ArrayView<const uint8_t> buffer,
+      RbspBitstreamReader& reader,
       const H265SpsParser::SpsState* sps);
-  static bool ParsePpsIdsInternal(BitstreamReader& reader,
+  static bool ParsePpsIdsInternal(RbspBitstreamReader& reader,
                                   uint32_t& pps_id,
                                   uint32_t& sps_id);
 };
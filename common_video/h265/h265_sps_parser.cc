@@ -14,6 +14,7 @@
 #include <memory>
 #include <vector>
 
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h265/h265_common.h"
 #include "rtc_base/bit_buffer.h"
 #include "rtc_base/logging.h"
@@ -105,10 +106,11 @@ size_t H265SpsParser::GetDpbMaxPicBuf(int general_profile_idc) {
 // Unpack RBSP and parse SPS state from the supplied buffer.
 std::optional<H265SpsParser::SpsState> H265SpsParser::ParseSps(
     rtc::ArrayView<const uint8_t> data) {
-  return ParseSpsInternal(H265::ParseRbsp(data));
+  RbspBitstreamReader reader(data);
+  return ParseSpsInternal(reader);
 }
 
-bool H265SpsParser::ParseScalingListData(BitstreamReader& reader) {
+bool H265SpsParser::ParseScalingListData(RbspBitstreamReader& reader) {
   int32_t scaling_list_dc_coef_minus8[kMaxNumSizeIds][kMaxNumMatrixIds] = {};
   for (int size_id = 0; size_id < kMaxNumSizeIds; size_id++) {
     for (int matrix_id = 0; matrix_id < kMaxNumMatrixIds;
@@ -153,7 +155,7 @@ H265SpsParser::ParseShortTermRefPicSet(
     const std::vector<H265SpsParser::ShortTermRefPicSet>&
         short_term_ref_pic_set,
     uint32_t sps_max_dec_pic_buffering_minus1,
-    BitstreamReader& reader) {
+    RbspBitstreamReader& reader) {
   H265SpsParser::ShortTermRefPicSet st_ref_pic_set;
 
   bool inter_ref_pic_set_prediction_flag = false;
@@ -306,7 +308,7 @@ H265SpsParser::ParseShortTermRefPicSet(
 std::optional<H265SpsParser::ProfileTierLevel>
 H265SpsParser::ParseProfileTierLevel(bool profile_present,
                                      int max_num_sub_layers_minus1,
-                                     BitstreamReader& reader) {
+                                     RbspBitstreamReader& reader) {
   H265SpsParser::ProfileTierLevel pf_tier_level;
   // 7.4.4
   if (profile_present) {
@@ -385,8 +387,7 @@ H265SpsParser::ParseProfileTierLevel(bool profile_present,
 }
 
 std::optional<H265SpsParser::SpsState> H265SpsParser::ParseSpsInternal(
-    rtc::ArrayView<const uint8_t> buffer) {
-  BitstreamReader reader(buffer);
+    RbspBitstreamReader& reader) {
 
   // Now, we need to use a bit buffer to parse through the actual H265 SPS
   // format. See Section 7.3.2.2.1 ("General sequence parameter set data
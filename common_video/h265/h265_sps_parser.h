@@ -15,7 +15,7 @@
 #include <vector>
 
 #include "api/array_view.h"
-#include "rtc_base/bitstream_reader.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -111,25 +111,23 @@ class RTC_EXPORT H265SpsParser {
     return ParseSps(rtc::MakeArrayView(data, length));
   }
 
-  static bool ParseScalingListData(BitstreamReader& reader);
+  static bool ParseScalingListData(RbspBitstreamReader& reader);
 
   static std::optional<ShortTermRefPicSet> ParseShortTermRefPicSet(
       uint32_t st_rps_idx,
       uint32_t num_short_term_ref_pic_sets,
       const std::vector<ShortTermRefPicSet>& ref_pic_sets,
       uint32_t sps_max_dec_pic_buffering_minus1,
-      BitstreamReader& reader);
+      RbspBitstreamReader& reader);
 
   static std::optional<H265SpsParser::ProfileTierLevel> ParseProfileTierLevel(
       bool profile_present,
       int max_num_sub_layers_minus1,
-      BitstreamReader& reader);
+      RbspBitstreamReader& reader);
 
  protected:
-  // Parse the SPS state, for a bit buffer where RBSP decoding has already been
-  // performed.
-  static std::optional<SpsState> ParseSpsInternal(
-      rtc::ArrayView<const uint8_t> buffer);
+  // Parse the SPS state, reading the RBSP of the payload.
+  static std::optional<SpsState> ParseSpsInternal(RbspBitstreamReader& reader);
 
   // From Table A.8 - General tier and level limits.
   static int GetMaxLumaPs(int general_level_idc);
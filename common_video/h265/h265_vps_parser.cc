@@ -10,9 +10,9 @@
 
 #include "common_video/h265/h265_vps_parser.h"
 
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "common_video/h265/h265_common.h"
 #include "rtc_base/bit_buffer.h"
-#include "rtc_base/bitstream_reader.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -26,12 +26,12 @@ H265VpsParser::VpsState::VpsState() = default;
 // Unpack RBSP and parse VPS state from the supplied buffer.
 std::optional<H265VpsParser::VpsState> H265VpsParser::ParseVps(
     rtc::ArrayView<const uint8_t> data) {
-  return ParseInternal(H265::ParseRbsp(data));
+  RbspBitstreamReader reader(data);
+  return ParseInternal(reader);
 }
 
 std::optional<H265VpsParser::VpsState> H265VpsParser::ParseInternal(
-    rtc::ArrayView<const uint8_t> buffer) {
-  BitstreamReader reader(buffer);
+    RbspBitstreamReader& reader) {
 
   // Now, we need to use a bit buffer to parse through the actual H265 VPS
   // format. See Section 7.3.2.1 ("Video parameter set RBSP syntax") of the
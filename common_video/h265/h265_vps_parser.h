@@ -14,6 +14,7 @@
 #include <optional>
 
 #include "api/array_view.h"
+#include "common_video/h264/rbsp_bitstream_reader.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -38,10 +39,8 @@ class RTC_EXPORT H265VpsParser {
   }
 
  protected:
-  // Parse the VPS state, for a bit buffer where RBSP decoding has already been
-  // performed.
-  static std::optional<VpsState> ParseInternal(
-      rtc::ArrayView<const uint8_t> buffer);
+  // Parse the VPS state, reading the RBSP of the payload.
+  static std::optional<VpsState> ParseInternal(RbspBitstreamReader& reader);
 };
 
 }  // namespace webrtc
@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_SHARED_VIDEO_FRAME_BUFFER_POOL_H_
+#define COMMON_VIDEO_INCLUDE_SHARED_VIDEO_FRAME_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "api/ref_count.h"
+#include "api/ref_counted_base.h"
+#include "api/scoped_refptr.h"
+#include "api/video/i010_buffer.h"
+#include "api/video/i210_buffer.h"
+#include "api/video/i410_buffer.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/i422_buffer.h"
+#include "api/video/i444_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// A thread safe pool of video frame buffers that can be shared by any number
+// of users, e.g. the decoders of an application through VideoFrameBufferPool.
+// Released buffers are kept in buckets by pixel format and resolution, so
+// that creating a buffer of a size that was used before takes one from its
+// bucket without allocating. The unused buffers are bounded by a memory
+// budget; the least recently released ones are freed first.
+//
+// The pool stays alive until it has been released by its owners and by all
+// buffers created from it that are in use.
+class RTC_EXPORT SharedVideoFrameBufferPool : public RefCountInterface {
+ public:
+  static constexpr size_t kDefaultMaxRetainedBytes = 64 * 1024 * 1024;
+
+  // Counts the buffers in use that were created with it, so that a user of
+  // the pool can limit the number of buffers it holds.
+  class InUseCounter final : public RefCountedNonVirtual<InUseCounter> {
+   public:
+    int num_in_use() const {
+      return num_in_use_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    friend class RefCountedNonVirtual<InUseCounter>;
+    friend class SharedVideoFrameBufferPool;
+    ~InUseCounter() = default;
+
+    std::atomic<int> num_in_use_{0};
+  };
+
+  struct CreateOptions {
+    // Zero-initializes newly allocated buffers. Reused buffers are never
+    // cleared.
+    bool zero_initialize = false;
+    // Counts the buffer while it is in use, if set.
+    scoped_refptr<InUseCounter> in_use_counter;
+  };
+
+  struct Stats {
+    // Buffers that were taken from a bucket, and buffers that had to be
+    // allocated. The hit rate is num_reused / (num_reused + num_allocated).
+    int64_t num_reused = 0;
+    int64_t num_allocated = 0;
+    // Unused buffers that were freed to stay within the memory budget.
+    int64_t num_evicted = 0;
+    // The unused buffers that are kept for reuse.
+    size_t num_retained_buffers = 0;
+    size_t retained_bytes = 0;
+  };
+
+  static scoped_refptr<SharedVideoFrameBufferPool> Create(
+      size_t max_retained_bytes = kDefaultMaxRetainedBytes);
+
+  scoped_refptr<I420Buffer> CreateI420Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<I422Buffer> CreateI422Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<I444Buffer> CreateI444Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<I010Buffer> CreateI010Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<I210Buffer> CreateI210Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<I410Buffer> CreateI410Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+  scoped_refptr<NV12Buffer> CreateNV12Buffer(int width,
+                                             int height,
+                                             const CreateOptions& options);
+
+  // Changes the memory budget of the unused buffers, freeing the least
+  // recently released ones that don't fit anymore.
+  void SetMaxRetainedBytes(size_t max_retained_bytes);
+
+  Stats GetStats() const;
+
+ protected:
+  explicit SharedVideoFrameBufferPool(size_t max_retained_bytes);
+  ~SharedVideoFrameBufferPool() override;
+
+ private:
+  // The pool's part of a buffer created from it.
+  class Entry;
+  template <typename T>
+  class PooledBuffer;
+
+  struct BucketKey {
+    bool operator==(const BucketKey& other) const = default;
+
+    VideoFrameBuffer::Type type;
+    int width;
+    int height;
+  };
+  struct BucketKeyHash {
+    size_t operator()(const BucketKey& key) const;
+  };
+  // Unused buffers of one format and resolution, the most recently released
+  // last.
+  using Bucket = std::deque<Entry*>;
+
+  template <typename T, typename... StrideArgs>
+  scoped_refptr<T> CreateBuffer(VideoFrameBuffer::Type type,
+                                int width,
+                                int height,
+                                const CreateOptions& options,
+                                StrideArgs... strides);
+  // Takes back a buffer that is no longer used, or frees it.
+  void Recycle(Entry* entry);
+  // Removes the least recently released buffers until the retained ones fit
+  // in the budget, and returns them to be freed outside the lock.
+  std::vector<Entry*> EvictUntilWithinBudget()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable Mutex mutex_;
+  size_t max_retained_bytes_ RTC_GUARDED_BY(mutex_);
+  std::unordered_map<BucketKey, Bucket, BucketKeyHash> buckets_
+      RTC_GUARDED_BY(mutex_);
+  // Orders the released buffers across buckets for eviction.
+  uint64_t next_release_sequence_number_ RTC_GUARDED_BY(mutex_) = 0;
+  Stats stats_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_SHARED_VIDEO_FRAME_BUFFER_POOL_H_
@@ -23,6 +23,7 @@
 #include "api/video/i422_buffer.h"
 #include "api/video/i444_buffer.h"
 #include "api/video/nv12_buffer.h"
+#include "common_video/include/shared_video_frame_buffer_pool.h"
 #include "rtc_base/race_checker.h"
 
 namespace webrtc {
@@ -36,11 +37,19 @@ namespace webrtc {
 // Note that Create(I420|NV12)Buffer will crash if more than
 // kMaxNumberOfFramesBeforeCrash are created. This is to prevent memory leaks
 // where frames are not returned.
+//
+// If constructed with a SharedVideoFrameBufferPool, buffers are taken from and
+// returned to the shared pool instead, which keeps the unused buffers of all
+// its users bucketed by format and resolution. The limit on the number of
+// buffers pending still applies per VideoFrameBufferPool.
 class VideoFrameBufferPool {
  public:
   VideoFrameBufferPool();
   explicit VideoFrameBufferPool(bool zero_initialize);
   VideoFrameBufferPool(bool zero_initialize, size_t max_number_of_buffers);
+  VideoFrameBufferPool(bool zero_initialize,
+                       size_t max_number_of_buffers,
+                       scoped_refptr<SharedVideoFrameBufferPool> shared_pool);
   ~VideoFrameBufferPool();
 
   // Returns a buffer from the pool. If no suitable buffer exist in the pool
@@ -66,6 +75,8 @@ class VideoFrameBufferPool {
  private:
   rtc::scoped_refptr<VideoFrameBuffer>
   GetExistingBuffer(int width, int height, VideoFrameBuffer::Type type);
+  // Whether another buffer may be taken from `shared_pool_`.
+  bool CanCreateSharedBuffer() const;
 
   rtc::RaceChecker race_checker_;
   std::list<rtc::scoped_refptr<VideoFrameBuffer>> buffers_;
@@ -77,6 +88,11 @@ class VideoFrameBufferPool {
   const bool zero_initialize_;
   // Max number of buffers this pool can have pending.
   size_t max_number_of_buffers_;
+  // Set if the buffers come from a shared pool, in which case `buffers_` is
+  // not used.
+  const scoped_refptr<SharedVideoFrameBufferPool> shared_pool_;
+  // Tracks the buffers taken from `shared_pool_` that are pending.
+  SharedVideoFrameBufferPool::CreateOptions shared_pool_options_;
 };
 
 }  // namespace webrtc
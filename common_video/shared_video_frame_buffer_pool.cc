@@ -0,0 +1,298 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/shared_video_frame_buffer_pool.h"
+
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/ref_counter.h"
+
+namespace webrtc {
+
+namespace {
+
+template <typename T>
+size_t DataSize(const T& buffer) {
+  return sizeof(*buffer.DataY()) *
+         (static_cast<size_t>(buffer.StrideY()) * buffer.height() +
+          static_cast<size_t>(buffer.StrideU() + buffer.StrideV()) *
+              buffer.ChromaHeight());
+}
+
+size_t DataSize(const NV12Buffer& buffer) {
+  return static_cast<size_t>(buffer.StrideY()) * buffer.height() +
+         static_cast<size_t>(buffer.StrideUV()) * buffer.ChromaHeight();
+}
+
+// The 10 bit buffers have never been zero-initialized by
+// VideoFrameBufferPool, and don't offer a way to do it.
+template <typename T>
+void InitializeData(T& /* buffer */) {}
+void InitializeData(I420Buffer& buffer) {
+  buffer.InitializeData();
+}
+void InitializeData(I422Buffer& buffer) {
+  buffer.InitializeData();
+}
+void InitializeData(I444Buffer& buffer) {
+  buffer.InitializeData();
+}
+void InitializeData(I410Buffer& buffer) {
+  buffer.InitializeData();
+}
+void InitializeData(NV12Buffer& buffer) {
+  buffer.InitializeData();
+}
+
+}  // namespace
+
+class SharedVideoFrameBufferPool::Entry {
+ public:
+  Entry(const BucketKey& key, size_t data_size)
+      : key(key), data_size(data_size) {}
+  virtual ~Entry() = default;
+
+  const BucketKey key;
+  const size_t data_size;
+  // Set while the buffer is retained by the pool.
+  uint64_t release_sequence_number = 0;
+  // Set while the buffer is in use.
+  scoped_refptr<SharedVideoFrameBufferPool> pool;
+  scoped_refptr<InUseCounter> in_use_counter;
+};
+
+// A buffer of type T that is handed back to its pool instead of being
+// deleted when the last reference to it is dropped.
+template <typename T>
+class SharedVideoFrameBufferPool::PooledBuffer final
+    : public T,
+      public SharedVideoFrameBufferPool::Entry {
+ public:
+  template <typename... Args>
+  PooledBuffer(VideoFrameBuffer::Type type,
+               int width,
+               int height,
+               Args... strides)
+      : T(width, height, strides...),
+        Entry(BucketKey{type, width, height},
+              DataSize(static_cast<const T&>(*this))) {}
+
+  void AddRef() const override { ref_count_.IncRef(); }
+
+  RefCountReleaseStatus Release() const override {
+    const RefCountReleaseStatus status = ref_count_.DecRef();
+    if (status == RefCountReleaseStatus::kDroppedLastRef) {
+      PooledBuffer* self = const_cast<PooledBuffer*>(this);
+      // Keeps the pool alive while it takes the buffer back. The buffer may
+      // be reused or deleted as soon as it is recycled.
+      scoped_refptr<SharedVideoFrameBufferPool> pool = std::move(self->pool);
+      pool->Recycle(self);
+    }
+    return status;
+  }
+
+ private:
+  mutable webrtc_impl::RefCounter ref_count_{0};
+};
+
+size_t SharedVideoFrameBufferPool::BucketKeyHash::operator()(
+    const BucketKey& key) const {
+  return (static_cast<size_t>(key.type) * 65599 +
+          static_cast<size_t>(key.width)) *
+             65599 +
+         static_cast<size_t>(key.height);
+}
+
+// static
+scoped_refptr<SharedVideoFrameBufferPool> SharedVideoFrameBufferPool::Create(
+    size_t max_retained_bytes) {
+  return make_ref_counted<SharedVideoFrameBufferPool>(max_retained_bytes);
+}
+
+SharedVideoFrameBufferPool::SharedVideoFrameBufferPool(
+    size_t max_retained_bytes)
+    : max_retained_bytes_(max_retained_bytes) {}
+
+SharedVideoFrameBufferPool::~SharedVideoFrameBufferPool() {
+  // Buffers in use keep the pool alive, so only retained buffers are left.
+  for (auto& [key, bucket] : buckets_) {
+    for (Entry* entry : bucket) {
+      delete entry;
+    }
+  }
+}
+
+scoped_refptr<I420Buffer> SharedVideoFrameBufferPool::CreateI420Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<I420Buffer>(VideoFrameBuffer::Type::kI420, width, height,
+                                  options);
+}
+
+scoped_refptr<I422Buffer> SharedVideoFrameBufferPool::CreateI422Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<I422Buffer>(VideoFrameBuffer::Type::kI422, width, height,
+                                  options);
+}
+
+scoped_refptr<I444Buffer> SharedVideoFrameBufferPool::CreateI444Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<I444Buffer>(VideoFrameBuffer::Type::kI444, width, height,
+                                  options);
+}
+
+scoped_refptr<I010Buffer> SharedVideoFrameBufferPool::CreateI010Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  // I010Buffer and I210Buffer have no constructor that picks the strides.
+  return CreateBuffer<I010Buffer>(VideoFrameBuffer::Type::kI010, width, height,
+                                  options, width, (width + 1) / 2,
+                                  (width + 1) / 2);
+}
+
+scoped_refptr<I210Buffer> SharedVideoFrameBufferPool::CreateI210Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<I210Buffer>(VideoFrameBuffer::Type::kI210, width, height,
+                                  options, width, (width + 1) / 2,
+                                  (width + 1) / 2);
+}
+
+scoped_refptr<I410Buffer> SharedVideoFrameBufferPool::CreateI410Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<I410Buffer>(VideoFrameBuffer::Type::kI410, width, height,
+                                  options);
+}
+
+scoped_refptr<NV12Buffer> SharedVideoFrameBufferPool::CreateNV12Buffer(
+    int width,
+    int height,
+    const CreateOptions& options) {
+  return CreateBuffer<NV12Buffer>(VideoFrameBuffer::Type::kNV12, width, height,
+                                  options);
+}
+
+void SharedVideoFrameBufferPool::SetMaxRetainedBytes(
+    size_t max_retained_bytes) {
+  std::vector<Entry*> evicted;
+  {
+    MutexLock lock(&mutex_);
+    max_retained_bytes_ = max_retained_bytes;
+    evicted = EvictUntilWithinBudget();
+  }
+  for (Entry* entry : evicted) {
+    delete entry;
+  }
+}
+
+SharedVideoFrameBufferPool::Stats SharedVideoFrameBufferPool::GetStats()
+    const {
+  MutexLock lock(&mutex_);
+  return stats_;
+}
+
+template <typename T, typename... StrideArgs>
+scoped_refptr<T> SharedVideoFrameBufferPool::CreateBuffer(
+    VideoFrameBuffer::Type type,
+    int width,
+    int height,
+    const CreateOptions& options,
+    StrideArgs... strides) {
+  PooledBuffer<T>* buffer = nullptr;
+  {
+    MutexLock lock(&mutex_);
+    auto it = buckets_.find(BucketKey{type, width, height});
+    if (it != buckets_.end() && !it->second.empty()) {
+      // The bucket only holds buffers created by this function for `type`.
+      buffer = static_cast<PooledBuffer<T>*>(it->second.back());
+      it->second.pop_back();
+      ++stats_.num_reused;
+      --stats_.num_retained_buffers;
+      stats_.retained_bytes -= buffer->data_size;
+    } else {
+      ++stats_.num_allocated;
+    }
+  }
+  if (buffer == nullptr) {
+    buffer = new PooledBuffer<T>(type, width, height, strides...);
+    if (options.zero_initialize) {
+      InitializeData(static_cast<T&>(*buffer));
+    }
+  }
+  // Each buffer in use keeps the pool alive.
+  buffer->pool = scoped_refptr<SharedVideoFrameBufferPool>(this);
+  if (options.in_use_counter) {
+    options.in_use_counter->num_in_use_.fetch_add(1,
+                                                  std::memory_order_relaxed);
+    buffer->in_use_counter = options.in_use_counter;
+  }
+  return scoped_refptr<T>(buffer);
+}
+
+void SharedVideoFrameBufferPool::Recycle(Entry* entry) {
+  if (entry->in_use_counter) {
+    entry->in_use_counter->num_in_use_.fetch_sub(1, std::memory_order_relaxed);
+    entry->in_use_counter = nullptr;
+  }
+  std::vector<Entry*> evicted;
+  {
+    MutexLock lock(&mutex_);
+    entry->release_sequence_number = next_release_sequence_number_++;
+    buckets_[entry->key].push_back(entry);
+    ++stats_.num_retained_buffers;
+    stats_.retained_bytes += entry->data_size;
+    evicted = EvictUntilWithinBudget();
+  }
+  for (Entry* evicted_entry : evicted) {
+    delete evicted_entry;
+  }
+}
+
+std::vector<SharedVideoFrameBufferPool::Entry*>
+SharedVideoFrameBufferPool::EvictUntilWithinBudget() {
+  std::vector<Entry*> evicted;
+  while (stats_.retained_bytes > max_retained_bytes_) {
+    // The front of every bucket is its least recently released buffer. There
+    // are few buckets, one per format and resolution in use.
+    auto oldest = buckets_.end();
+    for (auto it = buckets_.begin(); it != buckets_.end(); ++it) {
+      if (!it->second.empty() &&
+          (oldest == buckets_.end() ||
+           it->second.front()->release_sequence_number <
+               oldest->second.front()->release_sequence_number)) {
+        oldest = it;
+      }
+    }
+    RTC_DCHECK(oldest != buckets_.end());
+    Entry* entry = oldest->second.front();
+    oldest->second.pop_front();
+    if (oldest->second.empty()) {
+      buckets_.erase(oldest);
+    }
+    ++stats_.num_evicted;
+    --stats_.num_retained_buffers;
+    stats_.retained_bytes -= entry->data_size;
+    evicted.push_back(entry);
+  }
+  return evicted;
+}
+
+}  // namespace webrtc
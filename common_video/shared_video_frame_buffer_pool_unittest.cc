@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/shared_video_frame_buffer_pool.h"
+
+#include <stdint.h>
+
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/video/i010_buffer.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using Options = SharedVideoFrameBufferPool::CreateOptions;
+
+// The data size of a 16x16 I420 buffer.
+constexpr size_t kI420Size16x16 = 16 * 16 + 2 * 8 * 8;
+
+TEST(SharedVideoFrameBufferPoolTest, ReusesReleasedBuffer) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  scoped_refptr<I420Buffer> buffer = pool->CreateI420Buffer(16, 16, Options());
+  ASSERT_TRUE(buffer);
+  EXPECT_EQ(buffer->width(), 16);
+  EXPECT_EQ(buffer->height(), 16);
+  const uint8_t* data_y = buffer->DataY();
+  buffer = nullptr;
+  EXPECT_EQ(pool->GetStats().num_retained_buffers, 1u);
+  EXPECT_EQ(pool->GetStats().retained_bytes, kI420Size16x16);
+
+  buffer = pool->CreateI420Buffer(16, 16, Options());
+  EXPECT_EQ(buffer->DataY(), data_y);
+  SharedVideoFrameBufferPool::Stats stats = pool->GetStats();
+  EXPECT_EQ(stats.num_allocated, 1);
+  EXPECT_EQ(stats.num_reused, 1);
+  EXPECT_EQ(stats.num_retained_buffers, 0u);
+  EXPECT_EQ(stats.retained_bytes, 0u);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, DoesNotReuseBufferInUse) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  scoped_refptr<I420Buffer> buffer1 =
+      pool->CreateI420Buffer(16, 16, Options());
+  scoped_refptr<I420Buffer> buffer2 =
+      pool->CreateI420Buffer(16, 16, Options());
+  EXPECT_NE(buffer1->DataY(), buffer2->DataY());
+  EXPECT_EQ(pool->GetStats().num_allocated, 2);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, KeepsBuffersOfEachFormatAndSizeApart) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  scoped_refptr<I420Buffer> small = pool->CreateI420Buffer(16, 16, Options());
+  scoped_refptr<I420Buffer> large = pool->CreateI420Buffer(32, 32, Options());
+  scoped_refptr<NV12Buffer> nv12 = pool->CreateNV12Buffer(16, 16, Options());
+  const uint8_t* small_data = small->DataY();
+  const uint8_t* large_data = large->DataY();
+  const uint8_t* nv12_data = nv12->DataY();
+  small = nullptr;
+  large = nullptr;
+  nv12 = nullptr;
+  EXPECT_EQ(pool->GetStats().num_retained_buffers, 3u);
+
+  EXPECT_EQ(pool->CreateNV12Buffer(16, 16, Options())->DataY(), nv12_data);
+  EXPECT_EQ(pool->CreateI420Buffer(32, 32, Options())->DataY(), large_data);
+  EXPECT_EQ(pool->CreateI420Buffer(16, 16, Options())->DataY(), small_data);
+  EXPECT_EQ(pool->GetStats().num_reused, 3);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, CreatesTenBitBuffers) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  scoped_refptr<I010Buffer> buffer = pool->CreateI010Buffer(15, 9, Options());
+  ASSERT_TRUE(buffer);
+  EXPECT_EQ(buffer->width(), 15);
+  EXPECT_EQ(buffer->height(), 9);
+  EXPECT_EQ(buffer->StrideY(), 15);
+  EXPECT_EQ(buffer->StrideU(), 8);
+  const uint16_t* data_y = buffer->DataY();
+  buffer = nullptr;
+  // Two bytes per sample.
+  EXPECT_EQ(pool->GetStats().retained_bytes, 2u * (15 * 9 + 2 * 8 * 5));
+  EXPECT_EQ(pool->CreateI010Buffer(15, 9, Options())->DataY(), data_y);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, ZeroInitializesNewBuffers) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  Options options;
+  options.zero_initialize = true;
+  scoped_refptr<NV12Buffer> buffer = pool->CreateNV12Buffer(16, 16, options);
+  for (int i = 0; i < buffer->StrideY() * buffer->height(); ++i) {
+    EXPECT_EQ(buffer->DataY()[i], 0);
+  }
+  for (int i = 0; i < buffer->StrideUV() * buffer->ChromaHeight(); ++i) {
+    EXPECT_EQ(buffer->DataUV()[i], 0);
+  }
+}
+
+TEST(SharedVideoFrameBufferPoolTest, EvictsLeastRecentlyReleasedBuffers) {
+  auto pool = SharedVideoFrameBufferPool::Create(2 * kI420Size16x16);
+  scoped_refptr<I420Buffer> buffer1 =
+      pool->CreateI420Buffer(16, 16, Options());
+  scoped_refptr<I420Buffer> buffer2 =
+      pool->CreateI420Buffer(16, 16, Options());
+  scoped_refptr<I420Buffer> buffer3 =
+      pool->CreateI420Buffer(16, 16, Options());
+  const uint8_t* data2 = buffer2->DataY();
+  const uint8_t* data3 = buffer3->DataY();
+  buffer1 = nullptr;
+  buffer2 = nullptr;
+  buffer3 = nullptr;
+
+  SharedVideoFrameBufferPool::Stats stats = pool->GetStats();
+  EXPECT_EQ(stats.num_evicted, 1);
+  EXPECT_EQ(stats.num_retained_buffers, 2u);
+  EXPECT_EQ(stats.retained_bytes, 2 * kI420Size16x16);
+
+  // The most recently released buffer is reused first.
+  buffer3 = pool->CreateI420Buffer(16, 16, Options());
+  buffer2 = pool->CreateI420Buffer(16, 16, Options());
+  EXPECT_EQ(buffer3->DataY(), data3);
+  EXPECT_EQ(buffer2->DataY(), data2);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, EvictsAcrossBuckets) {
+  auto pool = SharedVideoFrameBufferPool::Create(2 * kI420Size16x16);
+  scoped_refptr<I420Buffer> old_buffer =
+      pool->CreateI420Buffer(16, 16, Options());
+  scoped_refptr<NV12Buffer> new_buffer =
+      pool->CreateNV12Buffer(16, 16, Options());
+  const uint8_t* new_data = new_buffer->DataY();
+  old_buffer = nullptr;
+  new_buffer = nullptr;
+
+  pool->SetMaxRetainedBytes(kI420Size16x16);
+  EXPECT_EQ(pool->GetStats().num_evicted, 1);
+  EXPECT_EQ(pool->GetStats().num_retained_buffers, 1u);
+  EXPECT_EQ(pool->CreateNV12Buffer(16, 16, Options())->DataY(), new_data);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, FreesBuffersWithoutBudget) {
+  auto pool = SharedVideoFrameBufferPool::Create(0);
+  pool->CreateI420Buffer(16, 16, Options());
+  SharedVideoFrameBufferPool::Stats stats = pool->GetStats();
+  EXPECT_EQ(stats.num_evicted, 1);
+  EXPECT_EQ(stats.num_retained_buffers, 0u);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, CountsBuffersInUse) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  Options options;
+  options.in_use_counter =
+      make_ref_counted<SharedVideoFrameBufferPool::InUseCounter>();
+  scoped_refptr<I420Buffer> buffer1 = pool->CreateI420Buffer(16, 16, options);
+  scoped_refptr<I420Buffer> buffer2 = pool->CreateI420Buffer(16, 16, options);
+  scoped_refptr<I420Buffer> uncounted =
+      pool->CreateI420Buffer(16, 16, Options());
+  EXPECT_EQ(options.in_use_counter->num_in_use(), 2);
+  buffer1 = nullptr;
+  EXPECT_EQ(options.in_use_counter->num_in_use(), 1);
+  // A reused buffer is counted by its new user.
+  uncounted = nullptr;
+  buffer1 = pool->CreateI420Buffer(16, 16, options);
+  EXPECT_EQ(options.in_use_counter->num_in_use(), 2);
+}
+
+TEST(SharedVideoFrameBufferPoolTest, BufferOutlivesPool) {
+  auto pool = SharedVideoFrameBufferPool::Create();
+  pool->CreateI420Buffer(32, 32, Options());
+  scoped_refptr<I420Buffer> buffer = pool->CreateI420Buffer(16, 16, Options());
+  pool = nullptr;
+  buffer->MutableDataY()[0] = 1;
+  EXPECT_EQ(buffer->DataY()[0], 1);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -11,6 +11,7 @@
 #include "common_video/include/video_frame_buffer_pool.h"
 
 #include <limits>
+#include <utility>
 
 #include "api/make_ref_counted.h"
 #include "rtc_base/checks.h"
@@ -68,8 +69,21 @@ VideoFrameBufferPool::VideoFrameBufferPool(bool zero_initialize)
 
 VideoFrameBufferPool::VideoFrameBufferPool(bool zero_initialize,
                                            size_t max_number_of_buffers)
+    : VideoFrameBufferPool(zero_initialize, max_number_of_buffers, nullptr) {}
+
+VideoFrameBufferPool::VideoFrameBufferPool(
+    bool zero_initialize,
+    size_t max_number_of_buffers,
+    scoped_refptr<SharedVideoFrameBufferPool> shared_pool)
     : zero_initialize_(zero_initialize),
-      max_number_of_buffers_(max_number_of_buffers) {}
+      max_number_of_buffers_(max_number_of_buffers),
+      shared_pool_(std::move(shared_pool)) {
+  if (shared_pool_) {
+    shared_pool_options_.zero_initialize = zero_initialize_;
+    shared_pool_options_.in_use_counter =
+        make_ref_counted<SharedVideoFrameBufferPool::InUseCounter>();
+  }
+}
 
 VideoFrameBufferPool::~VideoFrameBufferPool() = default;
 
@@ -79,6 +93,15 @@ void VideoFrameBufferPool::Release() {
 
 bool VideoFrameBufferPool::Resize(size_t max_number_of_buffers) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    if (static_cast<size_t>(
+            shared_pool_options_.in_use_counter->num_in_use()) >
+        max_number_of_buffers) {
+      return false;
+    }
+    max_number_of_buffers_ = max_number_of_buffers;
+    return true;
+  }
   size_t used_buffers_count = 0;
   for (const rtc::scoped_refptr<VideoFrameBuffer>& buffer : buffers_) {
     // If the buffer is in use, the ref count will be >= 2, one from the list we
@@ -111,6 +134,12 @@ rtc::scoped_refptr<I420Buffer> VideoFrameBufferPool::CreateI420Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI420Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI420);
@@ -142,6 +171,12 @@ rtc::scoped_refptr<I444Buffer> VideoFrameBufferPool::CreateI444Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI444Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI444);
@@ -173,6 +208,12 @@ rtc::scoped_refptr<I422Buffer> VideoFrameBufferPool::CreateI422Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI422Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI422);
@@ -204,6 +245,12 @@ rtc::scoped_refptr<NV12Buffer> VideoFrameBufferPool::CreateNV12Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateNV12Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kNV12);
@@ -235,6 +282,12 @@ rtc::scoped_refptr<I010Buffer> VideoFrameBufferPool::CreateI010Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI010Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI010);
@@ -262,6 +315,12 @@ rtc::scoped_refptr<I210Buffer> VideoFrameBufferPool::CreateI210Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI210Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI210);
@@ -289,6 +348,12 @@ rtc::scoped_refptr<I410Buffer> VideoFrameBufferPool::CreateI410Buffer(
     int width,
     int height) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  if (shared_pool_) {
+    return CanCreateSharedBuffer()
+               ? shared_pool_->CreateI410Buffer(width, height,
+                                                shared_pool_options_)
+               : nullptr;
+  }
 
   rtc::scoped_refptr<VideoFrameBuffer> existing_buffer =
       GetExistingBuffer(width, height, VideoFrameBuffer::Type::kI410);
@@ -312,6 +377,12 @@ rtc::scoped_refptr<I410Buffer> VideoFrameBufferPool::CreateI410Buffer(
   return buffer;
 }
 
+bool VideoFrameBufferPool::CanCreateSharedBuffer() const {
+  return static_cast<size_t>(
+             shared_pool_options_.in_use_counter->num_in_use()) <
+         max_number_of_buffers_;
+}
+
 rtc::scoped_refptr<VideoFrameBuffer> VideoFrameBufferPool::GetExistingBuffer(
     int width,
     int height,
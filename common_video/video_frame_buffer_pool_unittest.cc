@@ -16,6 +16,7 @@
 #include "api/scoped_refptr.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame_buffer.h"
+#include "common_video/include/shared_video_frame_buffer_pool.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -129,4 +130,30 @@ TEST(TestVideoFrameBufferPool, SwitchingPixelFormat) {
   EXPECT_EQ(nullptr, pool.CreateI210Buffer(16, 16).get());
 }
 
+TEST(TestVideoFrameBufferPool, SharesBuffersThroughSharedPool) {
+  auto shared_pool = SharedVideoFrameBufferPool::Create();
+  VideoFrameBufferPool pool1(false, 1, shared_pool);
+  VideoFrameBufferPool pool2(false, 1, shared_pool);
+  auto buffer = pool1.CreateI420Buffer(16, 16);
+  const uint8_t* y_ptr = buffer->DataY();
+  buffer = nullptr;
+  buffer = pool2.CreateI420Buffer(16, 16);
+  EXPECT_EQ(y_ptr, buffer->DataY());
+  EXPECT_EQ(1, shared_pool->GetStats().num_reused);
+}
+
+TEST(TestVideoFrameBufferPool, MaxNumberOfBuffersWithSharedPool) {
+  auto shared_pool = SharedVideoFrameBufferPool::Create();
+  VideoFrameBufferPool pool1(false, 1, shared_pool);
+  VideoFrameBufferPool pool2(false, 1, shared_pool);
+  auto buffer = pool1.CreateI420Buffer(16, 16);
+  EXPECT_NE(nullptr, buffer.get());
+  EXPECT_EQ(nullptr, pool1.CreateNV12Buffer(16, 16).get());
+  EXPECT_NE(nullptr, pool2.CreateNV12Buffer(16, 16).get());
+  EXPECT_FALSE(pool1.Resize(0));
+  buffer = nullptr;
+  EXPECT_TRUE(pool1.Resize(0));
+  EXPECT_EQ(nullptr, pool1.CreateI420Buffer(16, 16).get());
+}
+
 }  // namespace webrtc
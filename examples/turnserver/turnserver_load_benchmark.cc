@@ -0,0 +1,323 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Load test for ShardedTurnServer. Sets up a large number of UDP allocations
+// over loopback, binds a channel on each of them to a single peer and then
+// sends channel data round robin over all allocations for a fixed time. The
+// relayed packet rate is reported both in total and per core of CPU time
+// spent on the server's worker threads.
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/transport/stun.h"
+#include "p2p/base/port_interface.h"
+#include "p2p/base/sharded_turn_server.h"
+#include "p2p/base/turn_server.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/physical_socket_server.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+ABSL_FLAG(int, shards, 1, "Number of TURN server worker threads");
+ABSL_FLAG(int, allocations, 2000, "Number of simulated client allocations");
+ABSL_FLAG(int, duration_ms, 5000, "How long to send channel data for");
+ABSL_FLAG(int, payload_size, 160, "Payload bytes per channel data packet");
+ABSL_FLAG(int,
+          packets_per_round,
+          64,
+          "Channel data packets sent between polls of the client sockets");
+
+namespace {
+
+constexpr char kRealm[] = "load.test";
+constexpr char kUsername[] = "load";
+constexpr uint16_t kChannelNumber = cricket::kMinTurnChannelNumber;
+// Allocations are set up in batches so that the requests are not dropped by
+// the server's receive buffer.
+constexpr int kSetupBatchSize = 100;
+constexpr int64_t kSetupTimeoutMs = 5000;
+constexpr int kSocketBufferSize = 4 * 1024 * 1024;
+
+// Accepts any user whose password equals the user name.
+class LoadAuth : public cricket::TurnAuthInterface {
+ public:
+  bool GetKey(absl::string_view username,
+              absl::string_view realm,
+              std::string* key) override {
+    return cricket::ComputeStunCredentialHash(
+        std::string(username), std::string(realm), std::string(username), key);
+  }
+};
+
+// A client using its own UDP port, that requests an allocation and binds a
+// channel on it to `peer`.
+class SimulatedAllocation {
+ public:
+  SimulatedAllocation(rtc::SocketFactory* factory,
+                      const rtc::SocketAddress& server,
+                      const rtc::SocketAddress& peer)
+      : server_(server),
+        peer_(peer),
+        socket_(rtc::AsyncUDPSocket::Create(
+            factory,
+            rtc::SocketAddress(server.ipaddr(), 0))) {
+    if (socket_) {
+      socket_->RegisterReceivedPacketCallback(
+          [this](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket& packet) {
+            OnPacket(packet);
+          });
+    }
+  }
+
+  void Start() {
+    if (!socket_) {
+      failed_ = true;
+      return;
+    }
+    SendRequest(cricket::STUN_ALLOCATE_REQUEST);
+  }
+
+  bool ready() const { return ready_; }
+  bool done() const { return ready_ || failed_; }
+
+  bool SendChannelData(rtc::ArrayView<const uint8_t> packet) {
+    return socket_->SendTo(packet.data(), packet.size(), server_,
+                           rtc::PacketOptions()) > 0;
+  }
+
+ private:
+  void SendRequest(int type) {
+    cricket::TurnMessage request(type,
+                                 cricket::StunMessage::GenerateTransactionId());
+    if (type == cricket::STUN_ALLOCATE_REQUEST) {
+      request.AddAttribute(std::make_unique<cricket::StunUInt32Attribute>(
+          cricket::STUN_ATTR_REQUESTED_TRANSPORT, IPPROTO_UDP << 24));
+    } else {
+      request.AddAttribute(std::make_unique<cricket::StunUInt32Attribute>(
+          cricket::STUN_ATTR_CHANNEL_NUMBER, kChannelNumber << 16));
+      request.AddAttribute(std::make_unique<cricket::StunXorAddressAttribute>(
+          cricket::STUN_ATTR_XOR_PEER_ADDRESS, peer_));
+    }
+    if (!nonce_.empty()) {
+      request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+          cricket::STUN_ATTR_USERNAME, kUsername));
+      request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+          cricket::STUN_ATTR_REALM, realm_));
+      request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+          cricket::STUN_ATTR_NONCE, nonce_));
+      request.AddMessageIntegrity(key_);
+    }
+    rtc::ByteBufferWriter buf;
+    request.Write(&buf);
+    socket_->SendTo(buf.Data(), buf.Length(), server_, rtc::PacketOptions());
+  }
+
+  void OnPacket(const rtc::ReceivedPacket& packet) {
+    cricket::TurnMessage response;
+    rtc::ByteBufferReader buf(packet.payload());
+    if (!response.Read(&buf)) {
+      return;
+    }
+    switch (response.type()) {
+      case cricket::STUN_ALLOCATE_RESPONSE:
+        SendRequest(cricket::TURN_CHANNEL_BIND_REQUEST);
+        break;
+      case cricket::TURN_CHANNEL_BIND_RESPONSE:
+        ready_ = true;
+        break;
+      case cricket::STUN_ALLOCATE_ERROR_RESPONSE:
+        // Answer the authentication challenge once.
+        if (nonce_.empty() &&
+            response.GetErrorCodeValue() == cricket::STUN_ERROR_UNAUTHORIZED) {
+          realm_ = std::string(
+              response.GetByteString(cricket::STUN_ATTR_REALM)->string_view());
+          nonce_ = std::string(
+              response.GetByteString(cricket::STUN_ATTR_NONCE)->string_view());
+          cricket::ComputeStunCredentialHash(kUsername, realm_, kUsername,
+                                             &key_);
+          SendRequest(cricket::STUN_ALLOCATE_REQUEST);
+        } else {
+          failed_ = true;
+        }
+        break;
+      default:
+        failed_ = true;
+        break;
+    }
+  }
+
+  const rtc::SocketAddress server_;
+  const rtc::SocketAddress peer_;
+  const std::unique_ptr<rtc::AsyncUDPSocket> socket_;
+  std::string realm_;
+  std::string nonce_;
+  std::string key_;
+  bool ready_ = false;
+  bool failed_ = false;
+};
+
+// Sum of the CPU time spent so far on the worker threads of `server`.
+int64_t ServerCpuTimeNanos(cricket::ShardedTurnServer& server) {
+  int64_t cpu_time_ns = 0;
+  server.ForEachShard([&](cricket::TurnServer&) {
+    cpu_time_ns += rtc::GetThreadCpuTimeNanos();
+  });
+  return cpu_time_ns;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  const int num_shards = absl::GetFlag(FLAGS_shards);
+  const int num_allocations = absl::GetFlag(FLAGS_allocations);
+  const int payload_size = absl::GetFlag(FLAGS_payload_size);
+  const int packets_per_round = absl::GetFlag(FLAGS_packets_per_round);
+  if (num_shards < 1 || num_allocations < 1 || payload_size < 0 ||
+      packets_per_round < 1) {
+    std::cerr << "Invalid flags." << std::endl;
+    return 1;
+  }
+
+  // Setting up and tearing down allocations is logged at info level.
+  rtc::LogMessage::LogToDebug(rtc::LS_WARNING);
+
+  rtc::PhysicalSocketServer socket_server;
+  rtc::AutoSocketServerThread main_thread(&socket_server);
+
+  LoadAuth auth;
+  std::unique_ptr<cricket::ShardedTurnServer> server =
+      cricket::ShardedTurnServer::Create(
+          {.num_shards = num_shards,
+           .internal_address = rtc::SocketAddress("127.0.0.1", 0),
+           .external_ip = rtc::IPAddress(INADDR_LOOPBACK),
+           .realm = kRealm,
+           .software = "turnserver_load_benchmark",
+           .auth_hook = &auth});
+  if (!server) {
+    std::cerr << "Failed to start the TURN server." << std::endl;
+    return 1;
+  }
+
+  // The peer all relayed packets are sent to. It runs on a thread of its own
+  // so that counting does not compete with the clients.
+  std::unique_ptr<rtc::Thread> peer_thread =
+      rtc::Thread::CreateWithSocketServer();
+  peer_thread->Start();
+  std::atomic<int64_t> num_relayed{0};
+  std::unique_ptr<rtc::AsyncUDPSocket> peer;
+  rtc::SocketAddress peer_address;
+  peer_thread->BlockingCall([&] {
+    peer.reset(rtc::AsyncUDPSocket::Create(
+        peer_thread->socketserver(), rtc::SocketAddress("127.0.0.1", 0)));
+    peer->SetOption(rtc::Socket::OPT_RCVBUF, kSocketBufferSize);
+    peer->RegisterReceivedPacketCallback(
+        [&](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket&) {
+          num_relayed.fetch_add(1, std::memory_order_relaxed);
+        });
+    peer_address = peer->GetLocalAddress();
+  });
+
+  std::vector<std::unique_ptr<SimulatedAllocation>> clients;
+  std::vector<SimulatedAllocation*> ready;
+  for (int first = 0; first < num_allocations; first += kSetupBatchSize) {
+    const int last = std::min(first + kSetupBatchSize, num_allocations);
+    for (int i = first; i < last; ++i) {
+      clients.push_back(std::make_unique<SimulatedAllocation>(
+          &socket_server, server->internal_address(), peer_address));
+      clients.back()->Start();
+    }
+    const int64_t deadline_ms = rtc::TimeMillis() + kSetupTimeoutMs;
+    auto batch_done = [&] {
+      for (int i = first; i < last; ++i) {
+        if (!clients[i]->done()) {
+          return false;
+        }
+      }
+      return true;
+    };
+    while (!batch_done() && rtc::TimeMillis() < deadline_ms) {
+      main_thread.ProcessMessages(1);
+    }
+    for (int i = first; i < last; ++i) {
+      if (clients[i]->ready()) {
+        ready.push_back(clients[i].get());
+      }
+    }
+  }
+  std::cout << "Allocations: " << ready.size() << " of " << num_allocations
+            << " ready on " << num_shards << " shards ("
+            << server->num_allocations() << " on the server)" << std::endl;
+  if (ready.empty()) {
+    return 1;
+  }
+
+  std::vector<uint8_t> packet(4 + payload_size);
+  rtc::SetBE16(&packet[0], kChannelNumber);
+  rtc::SetBE16(&packet[2], static_cast<uint16_t>(payload_size));
+
+  const int64_t relayed_before = num_relayed.load();
+  const int64_t cpu_before_ns = ServerCpuTimeNanos(*server);
+  const int64_t start_ms = rtc::TimeMillis();
+  const int64_t end_ms = start_ms + absl::GetFlag(FLAGS_duration_ms);
+  int64_t num_sent = 0;
+  size_t next = 0;
+  while (rtc::TimeMillis() < end_ms) {
+    for (int i = 0; i < packets_per_round; ++i) {
+      num_sent += ready[next]->SendChannelData(packet);
+      next = (next + 1) % ready.size();
+    }
+    main_thread.ProcessMessages(0);
+  }
+  const int64_t elapsed_ms = rtc::TimeMillis() - start_ms;
+  // Let the server drain its socket buffers.
+  main_thread.ProcessMessages(200);
+  const int64_t cpu_ns = ServerCpuTimeNanos(*server) - cpu_before_ns;
+  const int64_t relayed = num_relayed.load() - relayed_before;
+
+  const double seconds = elapsed_ms / 1000.0;
+  const double cpu_seconds = cpu_ns / 1e9;
+  std::cout << "Sent: " << static_cast<int64_t>(num_sent / seconds)
+            << " packets/s" << std::endl;
+  std::cout << "Relayed: " << static_cast<int64_t>(relayed / seconds)
+            << " packets/s ("
+            << 100.0 * relayed / std::max<int64_t>(num_sent, 1)
+            << "% of sent)" << std::endl;
+  std::cout << "Server CPU: " << cpu_seconds / seconds << " cores" << std::endl;
+  if (cpu_seconds > 0) {
+    std::cout << "Relayed per core: "
+              << static_cast<int64_t>(relayed / cpu_seconds) << " packets/s"
+              << std::endl;
+  }
+
+  clients.clear();
+  peer_thread->BlockingCall([&] { peer = nullptr; });
+  peer_thread->Stop();
+  return 0;
+}
@@ -8,9 +8,11 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -18,6 +20,7 @@
 #include "examples/turnserver/read_auth_file.h"
 #include "p2p/base/basic_packet_socket_factory.h"
 #include "p2p/base/port_interface.h"
+#include "p2p/base/sharded_turn_server.h"
 #include "p2p/base/turn_server.h"
 #include "rtc_base/async_udp_socket.h"
 #include "rtc_base/ip_address.h"
@@ -52,8 +55,8 @@ class TurnFileAuth : public cricket::TurnAuthInterface {
 }  // namespace
 
 int main(int argc, char* argv[]) {
-  if (argc != 5) {
-    std::cerr << "usage: turnserver int-addr ext-ip realm auth-file"
+  if (argc != 5 && argc != 6) {
+    std::cerr << "usage: turnserver int-addr ext-ip realm auth-file [shards]"
               << std::endl;
     return 1;
   }
@@ -70,8 +73,41 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  const int num_shards = argc == 6 ? std::atoi(argv[5]) : 1;
+  if (num_shards < 1) {
+    std::cerr << "Invalid number of shards: " << argv[5] << std::endl;
+    return 1;
+  }
+
+  std::fstream auth_file(argv[4], std::fstream::in);
+  TurnFileAuth auth(auth_file.is_open()
+                        ? webrtc_examples::ReadAuthFile(&auth_file)
+                        : std::map<std::string, std::string>());
+
   rtc::PhysicalSocketServer socket_server;
   rtc::AutoSocketServerThread main(&socket_server);
+
+  if (num_shards > 1) {
+    // Spread UDP allocations over worker threads that share the port.
+    std::unique_ptr<cricket::ShardedTurnServer> server =
+        cricket::ShardedTurnServer::Create({.num_shards = num_shards,
+                                            .internal_address = int_addr,
+                                            .external_ip = ext_addr,
+                                            .realm = argv[3],
+                                            .software = kSoftware,
+                                            .auth_hook = &auth});
+    if (!server) {
+      std::cerr << "Failed to create " << num_shards
+                << " UDP sockets bound at " << int_addr.ToString()
+                << std::endl;
+      return 1;
+    }
+    std::cout << "Listening internally at " << int_addr.ToString() << " with "
+              << num_shards << " shards" << std::endl;
+    main.Run();
+    return 0;
+  }
+
   rtc::AsyncUDPSocket* int_socket =
       rtc::AsyncUDPSocket::Create(&socket_server, int_addr);
   if (!int_socket) {
@@ -81,11 +117,6 @@ int main(int argc, char* argv[]) {
   }
 
   cricket::TurnServer server(&main);
-  std::fstream auth_file(argv[4], std::fstream::in);
-
-  TurnFileAuth auth(auth_file.is_open()
-                        ? webrtc_examples::ReadAuthFile(&auth_file)
-                        : std::map<std::string, std::string>());
   server.set_realm(argv[3]);
   server.set_software(kSoftware);
   server.set_auth_hook(&auth);
@@ -173,7 +173,8 @@ MediaChannelUtil::TransportForMediaChannels::TransportForMediaChannels(
     : network_safety_(webrtc::PendingTaskSafetyFlag::CreateDetachedInactive()),
       network_thread_(network_thread),
 
-      enable_dscp_(enable_dscp) {}
+      enable_dscp_(enable_dscp),
+      rtp_buffer_pool_(rtc::CopyOnWriteBufferPool::Create(kMaxRtpPacketLen)) {}
 
 MediaChannelUtil::TransportForMediaChannels::~TransportForMediaChannels() {
   RTC_DCHECK(!network_interface_);
@@ -201,14 +202,15 @@ bool MediaChannelUtil::TransportForMediaChannels::SendRtcp(
 bool MediaChannelUtil::TransportForMediaChannels::SendRtp(
     rtc::ArrayView<const uint8_t> packet,
     const webrtc::PacketOptions& options) {
+  rtc::CopyOnWriteBuffer buffer = rtp_buffer_pool_->Allocate(kMaxRtpPacketLen);
+  buffer.AppendData(packet);
   auto send = [this, packet_id = options.packet_id,
                included_in_feedback = options.included_in_feedback,
                included_in_allocation = options.included_in_allocation,
                batchable = options.batchable,
                last_packet_in_batch = options.last_packet_in_batch,
                is_media = options.is_media, ect_1 = options.send_as_ect1,
-               packet =
-                   rtc::CopyOnWriteBuffer(packet, kMaxRtpPacketLen)]() mutable {
+               packet = std::move(buffer)]() mutable {
     rtc::PacketOptions rtc_options;
     rtc_options.packet_id = packet_id;
     if (DscpEnabled()) {
@@ -52,6 +52,7 @@
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/copy_on_write_buffer_pool.h"
 #include "rtc_base/dscp.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network/sent_packet.h"
@@ -166,6 +167,8 @@ class MediaChannelUtil {
         RTC_PT_GUARDED_BY(network_thread_);
     webrtc::TaskQueueBase* const network_thread_;
     const bool enable_dscp_;
+    // Storage for outgoing RTP packets, which are protected in place by SRTP.
+    const rtc::scoped_refptr<rtc::CopyOnWriteBufferPool> rtp_buffer_pool_;
     MediaChannelNetworkInterface* network_interface_
         RTC_GUARDED_BY(network_thread_) = nullptr;
     rtc::DiffServCodePoint preferred_dscp_ RTC_GUARDED_BY(network_thread_) =
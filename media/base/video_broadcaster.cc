@@ -71,8 +71,13 @@ VideoSinkWants VideoBroadcaster::wants() const {
   return current_wants_;
 }
 
-void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
+void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& input_frame) {
   webrtc::MutexLock lock(&sinks_and_wants_lock_);
+  // Sinks that scale the frame share the downscaled versions of it.
+  webrtc::VideoFrame frame = input_frame;
+  if (sink_pairs().size() > 1) {
+    frame.AttachScalingPyramid();
+  }
   bool current_frame_was_discarded = false;
   for (auto& sink_pair : sink_pairs()) {
     if (sink_pair.wants.rotation_applied &&
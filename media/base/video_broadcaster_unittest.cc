@@ -42,6 +42,16 @@ class MockSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
               (override));
 };
 
+class FrameRecordingSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+ public:
+  void OnFrame(const webrtc::VideoFrame& frame) override { frame_ = frame; }
+
+  const std::optional<webrtc::VideoFrame>& frame() const { return frame_; }
+
+ private:
+  std::optional<webrtc::VideoFrame> frame_;
+};
+
 TEST(VideoBroadcasterTest, frame_wanted) {
   VideoBroadcaster broadcaster;
   EXPECT_FALSE(broadcaster.frame_wanted());
@@ -437,3 +447,27 @@ TEST(VideoBroadcasterTest, IgnoreInactiveSinkIfNewApiUsed) {
   broadcaster.RemoveSink(&sink2);
   EXPECT_EQ(broadcaster.wants().resolution_alignment, 1);
 }
+
+TEST(VideoBroadcasterTest, SinksShareTheScalingPyramid) {
+  VideoBroadcaster broadcaster;
+  FrameRecordingSink sink1;
+  broadcaster.AddOrUpdateSink(&sink1, rtc::VideoSinkWants());
+  webrtc::VideoFrame frame = webrtc::VideoFrame::Builder()
+                                 .set_video_frame_buffer(
+                                     webrtc::I420Buffer::Create(100, 50))
+                                 .set_timestamp_us(0)
+                                 .build();
+
+  // A single sink has no one to share the downscaled frames with.
+  broadcaster.OnFrame(frame);
+  ASSERT_TRUE(sink1.frame());
+  EXPECT_FALSE(sink1.frame()->has_scaling_pyramid());
+
+  FrameRecordingSink sink2;
+  broadcaster.AddOrUpdateSink(&sink2, rtc::VideoSinkWants());
+  broadcaster.OnFrame(frame);
+  ASSERT_TRUE(sink1.frame());
+  ASSERT_TRUE(sink2.frame());
+  EXPECT_TRUE(sink1.frame()->has_scaling_pyramid());
+  EXPECT_TRUE(sink2.frame()->has_scaling_pyramid());
+}
@@ -32,6 +32,8 @@
 #include "api/field_trials_view.h"
 #include "api/scoped_refptr.h"
 #include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/units/data_rate.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
@@ -56,8 +58,10 @@
 #include "modules/video_coding/include/video_error_codes_utils.h"
 #include "modules/video_coding/utility/simulcast_rate_allocator.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
 #include "rtc_base/experiments/rate_control_settings.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/pooled_task_queue_factory.h"
 #include "rtc_base/strings/str_join.h"
 #include "rtc_base/strings/string_builder.h"
 
@@ -156,6 +160,51 @@ std::vector<uint32_t> GetStreamStartBitratesKbps(const Environment& env,
   return start_bitrates;
 }
 
+// If scaling isn't required, because the input resolution
+// matches the destination or the input image is empty (e.g.
+// a keyframe request for encoders with internal camera
+// sources) or the source image has a native handle, pass the image on
+// directly. Otherwise, we'll scale it to match what the encoder expects.
+// For texture frames, the underlying encoder is expected to be able to
+// correctly sample/scale the source texture.
+// TODO(perkj): ensure that works going forward, and figure out how this
+// affects webrtc:5683.
+bool PassesInputImageOn(VideoEncoder& encoder,
+                        int width,
+                        int height,
+                        const VideoFrame& input_image) {
+  return (width == input_image.width() && height == input_image.height()) ||
+         (input_image.video_frame_buffer()->type() ==
+              VideoFrameBuffer::Type::kNative &&
+          encoder.GetEncoderInfo().supports_native_handle);
+}
+
+int EncodeStream(VideoEncoder& encoder,
+                 int width,
+                 int height,
+                 const VideoFrame& input_image,
+                 const std::vector<VideoFrameType>& frame_types) {
+  if (PassesInputImageOn(encoder, width, height, input_image)) {
+    return encoder.Encode(input_image, &frame_types);
+  }
+
+  rtc::scoped_refptr<VideoFrameBuffer> dst_buffer =
+      input_image.ScaledVideoFrameBuffer(width, height);
+  if (!dst_buffer) {
+    RTC_LOG(LS_ERROR) << "Failed to scale video frame";
+    return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
+  }
+
+  // UpdateRect is not propagated to lower simulcast layers currently.
+  // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
+  VideoFrame frame(input_image);
+  frame.set_video_frame_buffer(dst_buffer);
+  frame.set_rotation(webrtc::kVideoRotation_0);
+  frame.set_update_rect(
+      VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
+  return encoder.Encode(frame, &frame_types);
+}
+
 }  // namespace
 
 SimulcastEncoderAdapter::EncoderContext::EncoderContext(
@@ -204,7 +253,10 @@ SimulcastEncoderAdapter::StreamContext::StreamContext(StreamContext&& rhs)
       width_(rhs.width_),
       height_(rhs.height_),
       is_keyframe_needed_(rhs.is_keyframe_needed_),
-      is_paused_(rhs.is_paused_) {
+      is_paused_(rhs.is_paused_),
+      buffer_encoded_images_(rhs.buffer_encoded_images_),
+      buffered_encoded_images_(std::move(rhs.buffered_encoded_images_)),
+      encode_queue_(std::move(rhs.encode_queue_)) {
   if (parent_) {
     encoder_context_->encoder().RegisterEncodeCompleteCallback(this);
   }
@@ -242,6 +294,10 @@ SimulcastEncoderAdapter::StreamContext::OnEncodedImage(
     const EncodedImage& encoded_image,
     const CodecSpecificInfo* codec_specific_info) {
   RTC_CHECK(parent_);  // If null, this method should never be called.
+  if (buffer_encoded_images_) {
+    buffered_encoded_images_.emplace_back(encoded_image, *codec_specific_info);
+    return Result(Result::OK, encoded_image.RtpTimestamp());
+  }
   return parent_->OnEncodedImage(stream_idx_, encoded_image,
                                  codec_specific_info);
 }
@@ -299,6 +355,7 @@ int SimulcastEncoderAdapter::Release() {
         std::move(stream_contexts_.back()).ReleaseEncoderContext());
     stream_contexts_.pop_back();
   }
+  encode_worker_pool_ = nullptr;
 
   bypass_mode_ = false;
 
@@ -404,6 +461,20 @@ int SimulcastEncoderAdapter::InitEncode(
   std::vector<uint32_t> stream_start_bitrate_kbps =
       GetStreamStartBitratesKbps(env_, codec_);
 
+  // Encoding in parallel calls Encode() of the upper streams' encoders on
+  // worker threads, so it is only done if the encoders allow it. The streams
+  // then share the cores instead of each encoder using all of them.
+  bool encode_in_parallel = settings.parallel_simulcast_encoding &&
+                            active_streams_count > 1 &&
+                            encoder_context->encoder()
+                                .GetEncoderInfo()
+                                .supports_encode_from_any_thread;
+  VideoEncoder::Settings stream_settings = settings;
+  if (encode_in_parallel) {
+    stream_settings.number_of_cores =
+        std::max(1, settings.number_of_cores / active_streams_count);
+  }
+
   for (int stream_idx = 0; stream_idx < total_streams_count_; ++stream_idx) {
     if (!is_legacy_singlecast && !codec_.simulcastStream[stream_idx].active) {
       continue;
@@ -427,7 +498,8 @@ int SimulcastEncoderAdapter::InitEncode(
                      << stream_idx << ", active: "
                      << (codec_.simulcastStream[stream_idx].active ? "true"
                                                                    : "false");
-    int ret = encoder_context->encoder().InitEncode(&stream_codec, settings);
+    int ret =
+        encoder_context->encoder().InitEncode(&stream_codec, stream_settings);
     if (ret < 0) {
       encoder_context.reset();
       Release();
@@ -435,6 +507,15 @@ int SimulcastEncoderAdapter::InitEncode(
                         << WebRtcVideoCodecErrorToString(ret);
       return ret;
     }
+    if (encode_in_parallel && !encoder_context->encoder()
+                                   .GetEncoderInfo()
+                                   .supports_encode_from_any_thread) {
+      RTC_LOG(LS_WARNING) << "[SEA] InitEncode: the encoder of stream "
+                          << stream_idx
+                          << " does not support encoding from any thread, "
+                             "encoding the streams one after another.";
+      encode_in_parallel = false;
+    }
 
     // Intercept frame encode complete callback only for upper streams, where
     // we need to set a correct stream index. Set `parent` to nullptr for the
@@ -449,6 +530,20 @@ int SimulcastEncoderAdapter::InitEncode(
     encoder_context = nullptr;
   }
 
+  // The first stream to encode is encoded on the encoder queue, so it takes
+  // one thread less than there are streams.
+  const int num_worker_threads =
+      std::min<int>(stream_contexts_.size(), settings.number_of_cores) - 1;
+  if (encode_in_parallel && num_worker_threads > 0) {
+    encode_worker_pool_ = CreatePooledTaskQueueFactory(
+        {.num_worker_threads = num_worker_threads,
+         .thread_name = "SimulcastEncoder"});
+    for (size_t i = 1; i < stream_contexts_.size(); ++i) {
+      stream_contexts_[i].set_encode_queue(encode_worker_pool_->CreateTaskQueue(
+          "SimulcastStreamEncoder", TaskQueueFactory::Priority::NORMAL));
+    }
+  }
+
   // To save memory, don't store encoders that we don't use.
   DestroyStoredEncoders();
 
@@ -501,10 +596,8 @@ int SimulcastEncoderAdapter::Encode(
     }
   }
 
-  // Temporary thay may hold the result of texture to i420 buffer conversion.
-  rtc::scoped_refptr<VideoFrameBuffer> src_buffer;
-  int src_width = input_image.width();
-  int src_height = input_image.height();
+  // The streams to encode, once the frame types of all of them are known.
+  std::vector<StreamEncode> streams;
 
   for (auto& layer : stream_contexts_) {
     // Don't encode frames in resolutions that we don't intend to send.
@@ -554,52 +647,94 @@ int SimulcastEncoderAdapter::Encode(
       continue;
     }
 
-    // If scaling isn't required, because the input resolution
-    // matches the destination or the input image is empty (e.g.
-    // a keyframe request for encoders with internal camera
-    // sources) or the source image has a native handle, pass the image on
-    // directly. Otherwise, we'll scale it to match what the encoder expects
-    // (below).
-    // For texture frames, the underlying encoder is expected to be able to
-    // correctly sample/scale the source texture.
-    // TODO(perkj): ensure that works going forward, and figure out how this
-    // affects webrtc:5683.
-    if ((layer.width() == src_width && layer.height() == src_height) ||
-        (input_image.video_frame_buffer()->type() ==
-             VideoFrameBuffer::Type::kNative &&
-         layer.encoder().GetEncoderInfo().supports_native_handle)) {
-      int ret = layer.encoder().Encode(input_image, &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
-      }
-    } else {
-      if (src_buffer == nullptr) {
-        src_buffer = input_image.video_frame_buffer();
-      }
-      rtc::scoped_refptr<VideoFrameBuffer> dst_buffer =
-          src_buffer->Scale(layer.width(), layer.height());
-      if (!dst_buffer) {
-        RTC_LOG(LS_ERROR) << "Failed to scale video frame";
-        return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
-      }
+    streams.push_back({&layer, std::move(stream_frame_types)});
+  }
 
-      // UpdateRect is not propagated to lower simulcast layers currently.
-      // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
-      VideoFrame frame(input_image);
-      frame.set_video_frame_buffer(dst_buffer);
-      frame.set_rotation(webrtc::kVideoRotation_0);
-      frame.set_update_rect(
-          VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
-      int ret = layer.encoder().Encode(frame, &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
-      }
+  // Scale the frame for the streams from the largest to the smallest, so that
+  // the scaling pyramid scales each stream from the next larger one rather
+  // than from the full resolution frame.
+  std::vector<std::pair<int, int>> scaled_sizes;
+  for (const StreamEncode& stream : streams) {
+    StreamContext& layer = *stream.stream;
+    if (!PassesInputImageOn(layer.encoder(), layer.width(), layer.height(),
+                            input_image)) {
+      scaled_sizes.emplace_back(layer.width(), layer.height());
+    }
+  }
+  std::optional<VideoFrame> frame_with_pyramid;
+  if (scaled_sizes.size() > 1 && !input_image.has_scaling_pyramid()) {
+    frame_with_pyramid = input_image;
+    frame_with_pyramid->AttachScalingPyramid();
+  }
+  const VideoFrame& frame =
+      frame_with_pyramid ? *frame_with_pyramid : input_image;
+  if (frame.has_scaling_pyramid()) {
+    absl::c_sort(scaled_sizes, [](const auto& a, const auto& b) {
+      return a.first * a.second > b.first * b.second;
+    });
+    for (const auto& [width, height] : scaled_sizes) {
+      frame.ScaledVideoFrameBuffer(width, height);
     }
   }
 
+  if (encode_worker_pool_ && !streams.empty()) {
+    return EncodeStreamsInParallel(frame, streams);
+  }
+  for (const StreamEncode& stream : streams) {
+    StreamContext& layer = *stream.stream;
+    int ret = EncodeStream(layer.encoder(), layer.width(), layer.height(),
+                           frame, stream.frame_types);
+    if (ret != WEBRTC_VIDEO_CODEC_OK) {
+      return ret;
+    }
+  }
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
+int SimulcastEncoderAdapter::EncodeStreamsInParallel(
+    const VideoFrame& input_image,
+    std::vector<StreamEncode>& streams) {
+  RTC_DCHECK_RUN_ON(&encoder_queue_);
+  std::vector<int> results(streams.size(), WEBRTC_VIDEO_CODEC_OK);
+  std::vector<rtc::Event> done(streams.size());
+  for (size_t i = 1; i < streams.size(); ++i) {
+    StreamContext& stream = *streams[i].stream;
+    // Only the lowest stream bypasses the adapter's callback, and it is never
+    // encoded on an encode queue.
+    RTC_DCHECK(stream.encode_queue());
+    RTC_DCHECK_GT(stream.stream_idx(), 0);
+    stream.encode_queue()->PostTask([&, i] {
+      StreamContext& stream = *streams[i].stream;
+      stream.set_buffer_encoded_images(true);
+      results[i] = EncodeStream(stream.encoder(), stream.width(),
+                                stream.height(), input_image,
+                                streams[i].frame_types);
+      stream.set_buffer_encoded_images(false);
+      done[i].Set();
+    });
+  }
+
+  StreamContext& first_stream = *streams[0].stream;
+  int result =
+      EncodeStream(first_stream.encoder(), first_stream.width(),
+                   first_stream.height(), input_image, streams[0].frame_types);
+
+  // Wait for every stream, also after an error, since the tasks refer to
+  // `streams` and `input_image`.
+  for (size_t i = 1; i < streams.size(); ++i) {
+    done[i].Wait(rtc::Event::kForever);
+    StreamContext& stream = *streams[i].stream;
+    for (auto& [encoded_image, codec_specific_info] :
+         stream.TakeBufferedEncodedImages()) {
+      OnEncodedImage(stream.stream_idx(), encoded_image, &codec_specific_info);
+    }
+    if (result == WEBRTC_VIDEO_CODEC_OK) {
+      result = results[i];
+    }
+  }
+  return result;
+}
+
 int SimulcastEncoderAdapter::RegisterEncodeCompleteCallback(
     EncodedImageCallback* callback) {
   RTC_DCHECK_RUN_ON(&encoder_queue_);
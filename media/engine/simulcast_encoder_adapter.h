@@ -26,6 +26,11 @@
 #include "api/fec_controller_override.h"
 #include "api/field_trials_view.h"
 #include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_type.h"
 #include "api/video_codecs/sdp_video_format.h"
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/video_encoder_factory.h"
@@ -41,6 +46,9 @@ namespace webrtc {
 // webrtc::VideoEncoder instances with the given VideoEncoderFactory.
 // The object is created and destroyed on the worker thread, but all public
 // interfaces should be called from the encoder task queue.
+//
+// If VideoEncoder::Settings::parallel_simulcast_encoding is set, the streams
+// of a frame are encoded concurrently, see EncodeStreamsInParallel().
 class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
  public:
   // `primary_factory` produces the first-choice encoders to use.
@@ -136,6 +144,23 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
     void OnKeyframe(Timestamp timestamp);
     bool ShouldDropFrame(Timestamp timestamp);
 
+    // The queue the stream is encoded on when encoding in parallel.
+    TaskQueueBase* encode_queue() const { return encode_queue_.get(); }
+    void set_encode_queue(
+        std::unique_ptr<TaskQueueBase, TaskQueueDeleter> encode_queue) {
+      encode_queue_ = std::move(encode_queue);
+    }
+
+    // While set, encoded images are kept instead of being passed to the
+    // parent. Only to be used by the thread that encodes the stream.
+    void set_buffer_encoded_images(bool buffer_encoded_images) {
+      buffer_encoded_images_ = buffer_encoded_images;
+    }
+    std::vector<std::pair<EncodedImage, CodecSpecificInfo>>
+    TakeBufferedEncodedImages() {
+      return std::move(buffered_encoded_images_);
+    }
+
    private:
     SimulcastEncoderAdapter* const parent_;
     std::unique_ptr<EncoderContext> encoder_context_;
@@ -145,6 +170,16 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
     const uint16_t height_;
     bool is_keyframe_needed_;
     bool is_paused_;
+    bool buffer_encoded_images_ = false;
+    std::vector<std::pair<EncodedImage, CodecSpecificInfo>>
+        buffered_encoded_images_;
+    // Destroyed first, so that no encode task outlives the encoder.
+    std::unique_ptr<TaskQueueBase, TaskQueueDeleter> encode_queue_;
+  };
+
+  struct StreamEncode {
+    StreamContext* stream;
+    std::vector<VideoFrameType> frame_types;
   };
 
   bool Initialized() const;
@@ -168,6 +203,14 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
 
   void OnDroppedFrame(size_t stream_idx);
 
+  // Encodes the first of `streams` on the calling thread and the others on
+  // their encode queues. The encoded images of a stream are passed on once it
+  // and all streams before it are done, so they are passed on in the same
+  // order as when encoding the streams one after another. Returns the first
+  // error in stream order.
+  int EncodeStreamsInParallel(const VideoFrame& input_image,
+                              std::vector<StreamEncode>& streams);
+
   void OverrideFromFieldTrial(VideoEncoder::EncoderInfo* info) const;
 
   const Environment env_;
@@ -178,6 +221,9 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
   VideoCodec codec_;
   int total_streams_count_;
   bool bypass_mode_;
+  // The worker threads of the encode queues of `stream_contexts_`, if
+  // encoding in parallel. Must outlive the queues.
+  std::unique_ptr<TaskQueueFactory> encode_worker_pool_;
   std::vector<StreamContext> stream_contexts_;
   EncodedImageCallback* encoded_complete_callback_;
 
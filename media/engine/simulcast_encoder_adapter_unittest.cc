@@ -17,11 +17,13 @@
 #include "api/environment/environment.h"
 #include "api/environment/environment_factory.h"
 #include "api/field_trials_view.h"
+#include "api/task_queue/task_queue_base.h"
 #include "api/test/create_simulcast_test_fixture.h"
 #include "api/test/simulcast_test_fixture.h"
 #include "api/test/video/function_video_decoder_factory.h"
 #include "api/test/video/function_video_encoder_factory.h"
 #include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
 #include "api/video/video_bitrate_allocator.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video_codecs/scalability_mode.h"
@@ -35,11 +37,13 @@
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/utility/simulcast_test_fixture_impl.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 #include "test/scoped_key_value_config.h"
 
 using ::testing::_;
+using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 using EncoderInfo = webrtc::VideoEncoder::EncoderInfo;
 using FramerateFractions =
@@ -197,6 +201,9 @@ class MockVideoEncoderFactory : public VideoEncoderFactory {
   void set_fallback_from_simulcast(std::optional<int32_t> return_value) {
     fallback_from_simulcast_ = return_value;
   }
+  void set_supports_encode_from_any_thread(bool supported) {
+    supports_encode_from_any_thread_ = supported;
+  }
 
   void DestroyVideoEncoder(VideoEncoder* encoder);
 
@@ -209,6 +216,7 @@ class MockVideoEncoderFactory : public VideoEncoderFactory {
   // Keep number of entries in sync with `kMaxSimulcastStreams`.
   std::vector<uint32_t> requested_resolution_alignments_ = {1, 1, 1};
   bool supports_simulcast_ = false;
+  bool supports_encode_from_any_thread_ = false;
   std::vector<VideoEncoder::ResolutionBitrateLimits> resolution_bitrate_limits_;
 };
 
@@ -226,8 +234,9 @@ class MockVideoEncoder : public VideoEncoder {
               (override));
 
   int32_t InitEncode(const VideoCodec* codecSettings,
-                     const VideoEncoder::Settings& /* settings */) override {
+                     const VideoEncoder::Settings& settings) override {
     codec_ = *codecSettings;
+    number_of_cores_ = settings.number_of_cores;
     if (codec_.numberOfSimulcastStreams > 1 && fallback_from_simulcast_) {
       return *fallback_from_simulcast_;
     }
@@ -266,6 +275,7 @@ class MockVideoEncoder : public VideoEncoder {
     info.supports_simulcast = supports_simulcast_;
     info.is_qp_trusted = is_qp_trusted_;
     info.resolution_bitrate_limits = resolution_bitrate_limits;
+    info.supports_encode_from_any_thread = supports_encode_from_any_thread_;
     return info;
   }
 
@@ -273,6 +283,8 @@ class MockVideoEncoder : public VideoEncoder {
 
   const VideoCodec& codec() const { return codec_; }
 
+  int number_of_cores() const { return number_of_cores_; }
+
   EncodedImageCallback* callback() const { return callback_; }
 
   void SendEncodedImage(int width, int height) {
@@ -345,6 +357,10 @@ class MockVideoEncoder : public VideoEncoder {
     resolution_bitrate_limits = limits;
   }
 
+  void set_supports_encode_from_any_thread(bool supported) {
+    supports_encode_from_any_thread_ = supported;
+  }
+
   bool supports_simulcast() const { return supports_simulcast_; }
 
   SdpVideoFormat video_format() const { return video_format_; }
@@ -364,10 +380,12 @@ class MockVideoEncoder : public VideoEncoder {
   FramerateFractions fps_allocation_;
   bool supports_simulcast_ = false;
   std::optional<bool> is_qp_trusted_;
+  bool supports_encode_from_any_thread_ = false;
   SdpVideoFormat video_format_;
   std::vector<VideoEncoder::ResolutionBitrateLimits> resolution_bitrate_limits;
 
   VideoCodec codec_;
+  int number_of_cores_ = 0;
   EncodedImageCallback* callback_;
 };
 
@@ -396,6 +414,8 @@ std::unique_ptr<VideoEncoder> MockVideoEncoderFactory::Create(
   encoder->set_supports_simulcast(supports_simulcast_);
   encoder->set_video_format(format);
   encoder->set_resolution_bitrate_limits(resolution_bitrate_limits_);
+  encoder->set_supports_encode_from_any_thread(
+      supports_encode_from_any_thread_);
   encoders_.push_back(encoder.get());
   return encoder;
 }
@@ -2106,5 +2126,206 @@ TEST_F(TestSimulcastEncoderAdapterFake, PopulatesScalabilityModeOfSubcodecs) {
             ScalabilityMode::kL1T3);
 }
 
+// A native buffer that remembers the buffer it was scaled from.
+class ScaledNativeBuffer : public VideoFrameBuffer {
+ public:
+  ScaledNativeBuffer(int width,
+                     int height,
+                     rtc::scoped_refptr<VideoFrameBuffer> source)
+      : width_(width), height_(height), source_(source) {}
+
+  Type type() const override { return Type::kNative; }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  rtc::scoped_refptr<I420BufferInterface> ToI420() override { return nullptr; }
+
+  rtc::scoped_refptr<VideoFrameBuffer> CropAndScale(
+      int /* offset_x */,
+      int /* offset_y */,
+      int /* crop_width */,
+      int /* crop_height */,
+      int scaled_width,
+      int scaled_height) override {
+    return rtc::make_ref_counted<ScaledNativeBuffer>(
+        scaled_width, scaled_height,
+        rtc::scoped_refptr<VideoFrameBuffer>(this));
+  }
+
+  const VideoFrameBuffer* source() const { return source_.get(); }
+
+ private:
+  const int width_;
+  const int height_;
+  const rtc::scoped_refptr<VideoFrameBuffer> source_;
+};
+
+TEST_F(TestSimulcastEncoderAdapterFake, ScalesEachStreamFromTheNextLargerOne) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.startBitrate = 3000;
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, kSettings));
+  adapter_->RegisterEncodeCompleteCallback(this);
+  std::vector<MockVideoEncoder*> encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+  std::array<rtc::scoped_refptr<VideoFrameBuffer>, 3> buffers;
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_CALL(*encoders[i], Encode)
+        .WillOnce([&, i](const VideoFrame& frame,
+                         const std::vector<VideoFrameType>* /* types */) {
+          buffers[i] = frame.video_frame_buffer();
+          return WEBRTC_VIDEO_CODEC_OK;
+        });
+  }
+
+  rtc::scoped_refptr<VideoFrameBuffer> input_buffer =
+      rtc::make_ref_counted<ScaledNativeBuffer>(1280, 720, nullptr);
+  VideoFrame input_frame = VideoFrame::Builder()
+                               .set_video_frame_buffer(input_buffer)
+                               .set_rtp_timestamp(0)
+                               .set_timestamp_ms(0)
+                               .build();
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameKey);
+  EXPECT_EQ(0, adapter_->Encode(input_frame, &frame_types));
+
+  ASSERT_TRUE(buffers[0] && buffers[1]);
+  EXPECT_EQ(buffers[2], input_buffer);
+  EXPECT_EQ(static_cast<ScaledNativeBuffer*>(buffers[1].get())->source(),
+            input_buffer.get());
+  EXPECT_EQ(static_cast<ScaledNativeBuffer*>(buffers[0].get())->source(),
+            buffers[1].get());
+}
+
+class EncodedWidthRecorder : public EncodedImageCallback {
+ public:
+  Result OnEncodedImage(
+      const EncodedImage& encoded_image,
+      const CodecSpecificInfo* /* codec_specific_info */) override {
+    widths_.push_back(encoded_image._encodedWidth);
+    return Result(Result::OK, encoded_image.RtpTimestamp());
+  }
+
+  const std::vector<int>& widths() const { return widths_; }
+
+ private:
+  std::vector<int> widths_;
+};
+
+TEST_F(TestSimulcastEncoderAdapterFake,
+       EncodesStreamsInParallelAndPassesImagesOnInStreamOrder) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.startBitrate = 3000;
+  VideoEncoder::Settings settings(kCapabilities, /*number_of_cores=*/4,
+                                  /*max_payload_size=*/1200);
+  settings.parallel_simulcast_encoding = true;
+  helper_->factory()->set_supports_encode_from_any_thread(true);
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, settings));
+  EncodedWidthRecorder recorder;
+  adapter_->RegisterEncodeCompleteCallback(&recorder);
+  std::vector<MockVideoEncoder*> encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+  // The streams split the cores between them.
+  for (MockVideoEncoder* encoder : encoders) {
+    EXPECT_EQ(encoder->number_of_cores(), 1);
+  }
+
+  // Stream 1 finishes after stream 2, which it can only do if they are
+  // encoded concurrently.
+  rtc::Event stream_2_encoded;
+  std::array<bool, 3> encoded_on_task_queue = {};
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_CALL(*encoders[i], Encode).WillOnce(InvokeWithoutArgs([&, i] {
+      encoded_on_task_queue[i] = TaskQueueBase::Current() != nullptr;
+      if (i == 1) {
+        EXPECT_TRUE(stream_2_encoded.Wait(TimeDelta::Seconds(5)));
+      }
+      encoders[i]->SendEncodedImage(/*width=*/100 * (i + 1), /*height=*/100);
+      if (i == 2) {
+        stream_2_encoded.Set();
+      }
+      return WEBRTC_VIDEO_CODEC_OK;
+    }));
+  }
+
+  VideoFrame input_frame =
+      VideoFrame::Builder()
+          .set_video_frame_buffer(I420Buffer::Create(1280, 720))
+          .set_rtp_timestamp(0)
+          .set_timestamp_ms(0)
+          .build();
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameKey);
+  EXPECT_EQ(0, adapter_->Encode(input_frame, &frame_types));
+
+  EXPECT_THAT(recorder.widths(), ::testing::ElementsAre(100, 200, 300));
+  // The lowest stream is encoded on the calling thread.
+  EXPECT_THAT(encoded_on_task_queue, ::testing::ElementsAre(false, true, true));
+}
+
+TEST_F(TestSimulcastEncoderAdapterFake,
+       EncodesStreamsOnTheCallingThreadIfEncodersRequireIt) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.startBitrate = 3000;
+  VideoEncoder::Settings settings(kCapabilities, /*number_of_cores=*/4,
+                                  /*max_payload_size=*/1200);
+  settings.parallel_simulcast_encoding = true;
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, settings));
+  adapter_->RegisterEncodeCompleteCallback(this);
+  std::vector<MockVideoEncoder*> encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+  std::array<bool, 3> encoded_on_task_queue = {};
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(encoders[i]->number_of_cores(), 4);
+    EXPECT_CALL(*encoders[i], Encode).WillOnce(InvokeWithoutArgs([&, i] {
+      encoded_on_task_queue[i] = TaskQueueBase::Current() != nullptr;
+      return WEBRTC_VIDEO_CODEC_OK;
+    }));
+  }
+
+  VideoFrame input_frame =
+      VideoFrame::Builder()
+          .set_video_frame_buffer(I420Buffer::Create(1280, 720))
+          .set_rtp_timestamp(0)
+          .set_timestamp_ms(0)
+          .build();
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameKey);
+  EXPECT_EQ(0, adapter_->Encode(input_frame, &frame_types));
+  EXPECT_THAT(encoded_on_task_queue,
+              ::testing::ElementsAre(false, false, false));
+}
+
+TEST_F(TestSimulcastEncoderAdapterFake,
+       ParallelEncodingReturnsTheFirstErrorInStreamOrder) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.startBitrate = 3000;
+  VideoEncoder::Settings settings(kCapabilities, /*number_of_cores=*/4,
+                                  /*max_payload_size=*/1200);
+  settings.parallel_simulcast_encoding = true;
+  helper_->factory()->set_supports_encode_from_any_thread(true);
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, settings));
+  adapter_->RegisterEncodeCompleteCallback(this);
+  std::vector<MockVideoEncoder*> encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+  EXPECT_CALL(*encoders[0], Encode).WillOnce(Return(WEBRTC_VIDEO_CODEC_OK));
+  EXPECT_CALL(*encoders[1], Encode)
+      .WillOnce(Return(WEBRTC_VIDEO_CODEC_FALLBACK_SOFTWARE));
+  EXPECT_CALL(*encoders[2], Encode).WillOnce(Return(WEBRTC_VIDEO_CODEC_ERROR));
+
+  VideoFrame input_frame =
+      VideoFrame::Builder()
+          .set_video_frame_buffer(I420Buffer::Create(1280, 720))
+          .set_rtp_timestamp(0)
+          .set_timestamp_ms(0)
+          .build();
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameKey);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_FALLBACK_SOFTWARE,
+            adapter_->Encode(input_frame, &frame_types));
+}
+
 }  // namespace test
 }  // namespace webrtc
@@ -54,6 +54,11 @@ void CallStatistics::DecodedBySilenceGenerator() {
   ++decoding_stat_.calls_to_silence_generator;
 }
 
+void CallStatistics::DecodingSkippedByNetEq() {
+  ++decoding_stat_.calls_to_neteq;
+  ++decoding_stat_.decoding_skipped;
+}
+
 const AudioDecodingCallStats& CallStatistics::GetDecodingStatistics() const {
   return decoding_stat_;
 }
@@ -45,6 +45,10 @@ class CallStatistics {
   // silence, i.e. call to NetEq is bypassed and the output audio is zero.
   void DecodedBySilenceGenerator();
 
+  // Call this method to indicate that NetEq was called without decoding, for
+  // audio that is not played out.
+  void DecodingSkippedByNetEq();
+
   // Get statistics for decoding. The statistics include the number of calls to
   // NetEq and silence generator, as well as the type of speech pulled of off
   // NetEq, c.f. declaration of AudioDecodingCallStats for detailed description.
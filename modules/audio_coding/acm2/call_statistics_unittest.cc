@@ -28,6 +28,7 @@ TEST(CallStatisticsTest, InitializedZero) {
   EXPECT_EQ(0, stats.decoded_neteq_plc);
   EXPECT_EQ(0, stats.decoded_plc_cng);
   EXPECT_EQ(0, stats.decoded_muted_output);
+  EXPECT_EQ(0, stats.decoding_skipped);
 }
 
 TEST(CallStatisticsTest, AllCalls) {
@@ -52,6 +53,17 @@ TEST(CallStatisticsTest, AllCalls) {
   EXPECT_EQ(1, stats.decoded_muted_output);
 }
 
+TEST(CallStatisticsTest, SkippedDecodingIsNotCountedAsDecoded) {
+  CallStatistics call_stats;
+  call_stats.DecodedByNetEq(AudioFrame::kNormalSpeech, false);
+  call_stats.DecodingSkippedByNetEq();
+
+  const AudioDecodingCallStats stats = call_stats.GetDecodingStatistics();
+  EXPECT_EQ(2, stats.calls_to_neteq);
+  EXPECT_EQ(1, stats.decoded_normal);
+  EXPECT_EQ(1, stats.decoding_skipped);
+}
+
 }  // namespace acm2
 
 }  // namespace webrtc
@@ -59,7 +59,8 @@ struct AudioDecodingCallStats {
         decoded_codec_plc(0),
         decoded_cng(0),
         decoded_plc_cng(0),
-        decoded_muted_output(0) {}
+        decoded_muted_output(0),
+        decoding_skipped(0) {}
 
   int calls_to_silence_generator;  // Number of calls where silence generated,
                                    // and NetEq was disengaged from decoding.
@@ -70,6 +71,8 @@ struct AudioDecodingCallStats {
   int decoded_cng;  // Number of calls where comfort noise generated due to DTX.
   int decoded_plc_cng;       // Number of calls resulted where PLC faded to CNG.
   int decoded_muted_output;  // Number of calls returning a muted state output.
+  int decoding_skipped;  // Number of calls to NetEq where the audio was not
+                         // decoded since it was not going to be played out.
 };
 
 // NETEQ statistics.
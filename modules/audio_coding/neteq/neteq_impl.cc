@@ -209,6 +209,27 @@ int NetEqImpl::GetAudio(AudioFrame* audio_frame,
                         std::optional<Operation> action_override) {
   TRACE_EVENT0("webrtc", "NetEqImpl::GetAudio");
   MutexLock lock(&mutex_);
+  return GetAudioLocked(audio_frame, muted, current_sample_rate_hz,
+                        action_override);
+}
+
+int NetEqImpl::GetAudioWithoutDecoding(AudioFrame* audio_frame) {
+  TRACE_EVENT0("webrtc", "NetEqImpl::GetAudioWithoutDecoding");
+  MutexLock lock(&mutex_);
+  skip_decoding_ = true;
+  stats_->SetOutputSkipped(true);
+  const int result = GetAudioLocked(audio_frame, /*muted=*/nullptr,
+                                    /*current_sample_rate_hz=*/nullptr,
+                                    /*action_override=*/std::nullopt);
+  stats_->SetOutputSkipped(false);
+  skip_decoding_ = false;
+  return result;
+}
+
+int NetEqImpl::GetAudioLocked(AudioFrame* audio_frame,
+                              bool* muted,
+                              int* current_sample_rate_hz,
+                              std::optional<Operation> action_override) {
   if (GetAudioInternal(audio_frame, action_override) != 0) {
     return kFail;
   }
@@ -219,7 +240,11 @@ int NetEqImpl::GetAudio(AudioFrame* audio_frame,
   if (muted != nullptr) {
     *muted = audio_frame->muted();
   }
-  audio_frame->speech_type_ = ToSpeechType(LastOutputType());
+  // The output of GetAudioWithoutDecoding() is not decoded audio, whatever
+  // mode NetEq is in.
+  audio_frame->speech_type_ = skip_decoding_
+                                  ? AudioFrame::kUndefined
+                                  : ToSpeechType(LastOutputType());
   last_output_sample_rate_hz_ = audio_frame->sample_rate_hz_;
   RTC_DCHECK(last_output_sample_rate_hz_ == 8000 ||
              last_output_sample_rate_hz_ == 16000 ||
@@ -803,7 +828,7 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
   switch (operation) {
     case Operation::kNormal: {
       DoNormal(decoded_buffer_.get(), length, speech_type, play_dtmf);
-      if (length > 0) {
+      if (length > 0 && !skip_decoding_) {
         stats_->DecodedOutputPlayed();
       }
       break;
@@ -814,7 +839,7 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
     }
     case Operation::kExpand: {
       RTC_DCHECK_EQ(return_value, 0);
-      if (!current_rtp_payload_type_ || !DoCodecPlc()) {
+      if (!current_rtp_payload_type_ || skip_decoding_ || !DoCodecPlc()) {
         return_value = DoExpand(play_dtmf);
       }
       RTC_DCHECK_GE(sync_buffer_->FutureLength() - expand_->overlap_length(),
@@ -1328,7 +1353,8 @@ int NetEqImpl::Decode(PacketList* packet_list,
 
   *decoded_length = 0;
   // Update codec-internal PLC state.
-  if ((*operation == Operation::kMerge) && decoder && decoder->HasDecodePlc()) {
+  if ((*operation == Operation::kMerge) && decoder && decoder->HasDecodePlc() &&
+      !skip_decoding_) {
     decoder->DecodePlc(1, &decoded_buffer_[*decoded_length]);
   }
 
@@ -1425,9 +1451,25 @@ int NetEqImpl::DecodeLoop(PacketList* packet_list,
                operation == Operation::kMerge ||
                operation == Operation::kPreemptiveExpand);
 
-    auto opt_result = packet_list->front().frame->Decode(
-        rtc::ArrayView<int16_t>(&decoded_buffer_[*decoded_length],
-                                decoded_buffer_length_ - *decoded_length));
+    rtc::ArrayView<int16_t> decoded(&decoded_buffer_[*decoded_length],
+                                    decoded_buffer_length_ - *decoded_length);
+    std::optional<AudioDecoder::EncodedAudioFrame::DecodeResult> opt_result;
+    const size_t skipped_samples =
+        skip_decoding_
+            ? packet_list->front().frame->Duration() * decoder->Channels()
+            : 0;
+    if (skipped_samples > 0 && skipped_samples <= decoded.size()) {
+      // Output silence for as long as the packet would have played. It is
+      // passed on as speech, so that NetEq advances as after decoding, but the
+      // output frame is not labelled as decoded, see GetAudioLocked().
+      std::fill_n(decoded.begin(), skipped_samples, 0);
+      opt_result = AudioDecoder::EncodedAudioFrame::DecodeResult{
+          .num_decoded_samples = skipped_samples,
+          .speech_type = AudioDecoder::kSpeech};
+    } else {
+      // Frames of unknown duration are decoded even when skipping.
+      opt_result = packet_list->front().frame->Decode(decoded);
+    }
     if (packet_list->front().packet_info) {
       last_decoded_packet_infos_.push_back(*packet_list->front().packet_info);
     }
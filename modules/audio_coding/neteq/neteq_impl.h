@@ -151,6 +151,8 @@ class NetEqImpl : public webrtc::NetEq {
       int* current_sample_rate_hz = nullptr,
       std::optional<Operation> action_override = std::nullopt) override;
 
+  int GetAudioWithoutDecoding(AudioFrame* audio_frame) override;
+
   void SetCodecs(const std::map<int, SdpAudioFormat>& codecs) override;
 
   bool RegisterPayloadType(int rtp_payload_type,
@@ -233,6 +235,13 @@ class NetEqImpl : public webrtc::NetEq {
                        std::optional<Operation> action_override)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Implements GetAudio and GetAudioWithoutDecoding.
+  int GetAudioLocked(AudioFrame* audio_frame,
+                     bool* muted,
+                     int* current_sample_rate_hz,
+                     std::optional<Operation> action_override)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // Provides a decision to the GetAudioInternal method. The decision what to
   // do is written to `operation`. Packets to decode are written to
   // `packet_list`, and a DTMF event to play is written to `dtmf_event`. When
@@ -408,6 +417,8 @@ class NetEqImpl : public webrtc::NetEq {
       RTC_GUARDED_BY(mutex_);
   std::vector<RtpPacketInfo> last_decoded_packet_infos_ RTC_GUARDED_BY(mutex_);
   bool no_time_stretching_ RTC_GUARDED_BY(mutex_);  // Only used for test.
+  // Set during GetAudioWithoutDecoding().
+  bool skip_decoding_ RTC_GUARDED_BY(mutex_) = false;
   rtc::BufferT<int16_t> concealment_audio_ RTC_GUARDED_BY(mutex_);
 };
 
@@ -1360,6 +1360,79 @@ TEST_F(NetEqImplTest, DecodedPayloadTooShort) {
   EXPECT_CALL(mock_decoder, Die());
 }
 
+TEST_F(NetEqImplTest, GetAudioWithoutDecoding) {
+  UseNoMocks();
+  MockAudioDecoder mock_decoder;
+  CreateInstance(
+      rtc::make_ref_counted<test::AudioDecoderProxyFactory>(&mock_decoder));
+
+  const uint8_t kPayloadType = 17;  // Just an arbitrary number.
+  const int kSampleRateHz = 8000;
+  const size_t kPayloadLengthSamples =
+      static_cast<size_t>(10 * kSampleRateHz / 1000);  // 10 ms.
+  const size_t kPayloadLengthBytes = 2 * kPayloadLengthSamples;
+  uint8_t payload[kPayloadLengthBytes] = {0};
+  RTPHeader rtp_header;
+  rtp_header.payloadType = kPayloadType;
+  rtp_header.sequenceNumber = 0x1234;
+  rtp_header.timestamp = 0x12345678;
+  rtp_header.ssrc = 0x87654321;
+
+  EXPECT_CALL(mock_decoder, Reset()).WillRepeatedly(Return());
+  EXPECT_CALL(mock_decoder, SampleRateHz())
+      .WillRepeatedly(Return(kSampleRateHz));
+  EXPECT_CALL(mock_decoder, Channels()).WillRepeatedly(Return(1));
+  EXPECT_CALL(mock_decoder, PacketDuration(_, _))
+      .WillRepeatedly(Return(rtc::checked_cast<int>(kPayloadLengthSamples)));
+  EXPECT_CALL(mock_decoder, DecodeInternal).Times(0);
+  EXPECT_TRUE(neteq_->RegisterPayloadType(kPayloadType,
+                                          SdpAudioFormat("L16", 8000, 1)));
+
+  // The packet is played out as silence, without decoding.
+  EXPECT_EQ(NetEq::kOK, neteq_->InsertPacket(rtp_header, payload));
+  AudioFrame output;
+  EXPECT_EQ(NetEq::kOK, neteq_->GetAudioWithoutDecoding(&output));
+  ASSERT_EQ(kPayloadLengthSamples, output.samples_per_channel_);
+  EXPECT_EQ(AudioFrame::kUndefined, output.speech_type_);
+  EXPECT_EQ(rtp_header.timestamp + kPayloadLengthSamples,
+            neteq_->sync_buffer_for_test()->end_timestamp());
+  EXPECT_EQ(0, neteq_->CurrentNetworkStatistics().current_buffer_size_ms);
+
+  // The next packet is decoded as usual.
+  rtp_header.sequenceNumber++;
+  rtp_header.timestamp += kPayloadLengthSamples;
+  EXPECT_EQ(NetEq::kOK, neteq_->InsertPacket(rtp_header, payload));
+  int16_t dummy_output[kPayloadLengthSamples] = {0};
+  EXPECT_CALL(mock_decoder,
+              DecodeInternal(_, kPayloadLengthBytes, kSampleRateHz, _, _))
+      .WillOnce(DoAll(
+          SetArrayArgument<3>(dummy_output,
+                              dummy_output + kPayloadLengthSamples),
+          SetArgPointee<4>(AudioDecoder::kSpeech),
+          Return(rtc::checked_cast<int>(kPayloadLengthSamples))));
+  EXPECT_EQ(NetEq::kOK, neteq_->GetAudio(&output));
+  EXPECT_EQ(AudioFrame::kNormalSpeech, output.speech_type_);
+  EXPECT_EQ(rtp_header.timestamp + kPayloadLengthSamples,
+            neteq_->sync_buffer_for_test()->end_timestamp());
+  const NetEqLifetimeStatistics stats = neteq_->GetLifetimeStatistics();
+  EXPECT_EQ(kPayloadLengthSamples, stats.total_samples_received);
+
+  // Skipped output is not counted as played out, neither as decoded nor as
+  // concealed audio.
+  rtp_header.sequenceNumber++;
+  rtp_header.timestamp += kPayloadLengthSamples;
+  EXPECT_EQ(NetEq::kOK, neteq_->InsertPacket(rtp_header, payload));
+  EXPECT_EQ(NetEq::kOK, neteq_->GetAudioWithoutDecoding(&output));
+  EXPECT_EQ(NetEq::kOK, neteq_->GetAudioWithoutDecoding(&output));
+  EXPECT_EQ(AudioFrame::kUndefined, output.speech_type_);
+  EXPECT_EQ(neteq_->GetLifetimeStatistics().total_samples_received,
+            stats.total_samples_received);
+  EXPECT_EQ(neteq_->GetLifetimeStatistics().concealed_samples,
+            stats.concealed_samples);
+
+  EXPECT_CALL(mock_decoder, Die());
+}
+
 // This test checks the behavior of NetEq when audio decoder fails.
 TEST_F(NetEqImplTest, DecodingError) {
   UseNoMocks();
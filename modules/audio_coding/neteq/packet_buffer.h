@@ -11,7 +11,11 @@
 #ifndef MODULES_AUDIO_CODING_NETEQ_PACKET_BUFFER_H_
 #define MODULES_AUDIO_CODING_NETEQ_PACKET_BUFFER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <optional>
+#include <vector>
 
 #include "modules/audio_coding/neteq/decoder_database.h"
 #include "modules/audio_coding/neteq/packet.h"
@@ -23,7 +27,9 @@ class DecoderDatabase;
 class StatisticsCalculator;
 class TickTimer;
 
-// This is the actual buffer holding the packets before decoding.
+// This is the actual buffer holding the packets before decoding. The packets
+// are kept sorted in a ring buffer of contiguous slots, so that the next
+// packet to decode is always at the front.
 class PacketBuffer {
  public:
   enum BufferReturnCodes {
@@ -135,8 +141,27 @@ class PacketBuffer {
  private:
   void LogPacketDiscarded(int codec_level);
 
+  // Returns the `index`th packet, counted from the front of the buffer.
+  Packet& at(size_t index);
+  const Packet& at(size_t index) const;
+  // Inserts `packet` so that it becomes the `index`th packet, moving the
+  // packets on the shorter side of `index` one slot.
+  void InsertAt(size_t index, Packet&& packet);
+  // Removes the front packet, which must have been moved from or reset.
+  void PopFront();
+  // Removes all packets for which `predicate` returns true, keeping the order
+  // of the remaining packets.
+  template <typename Predicate>
+  void RemoveIf(Predicate predicate);
+  // Grows `slots_` if it is full, up to `max_number_of_packets_` slots.
+  void MaybeGrow();
+
   size_t max_number_of_packets_;
-  PacketList buffer_;
+  // Ring buffer of `size_` packets starting at `first_`. It grows on demand,
+  // since most buffers never get close to `max_number_of_packets_`.
+  std::vector<Packet> slots_;
+  size_t first_ = 0;
+  size_t size_ = 0;
   const TickTimer* tick_timer_;
   StatisticsCalculator* stats_;
 };
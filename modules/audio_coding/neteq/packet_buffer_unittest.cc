@@ -363,6 +363,52 @@ TEST(PacketBuffer, Reordering) {
   EXPECT_TRUE(buffer.Empty());
 }
 
+// Keeps the buffer partly filled while packets arrive in pairs in reverse
+// order, so that insertions happen both at the front and the back of the
+// buffer while it wraps around and grows.
+TEST(PacketBuffer, ReorderingWhileWrappingAround) {
+  TickTimer tick_timer;
+  StrictMock<MockStatisticsCalculator> mock_stats(&tick_timer);
+  PacketBuffer buffer(100, &tick_timer, &mock_stats);  // 100 packets.
+  const uint32_t start_ts = 4711;
+  const uint32_t ts_increment = 10;
+  PacketGenerator gen(0xfff0, start_ts, 0, ts_increment);
+  const int payload_len = 10;
+
+  uint32_t current_ts = start_ts;
+  for (int i = 0; i < 40; ++i) {
+    Packet first = gen.NextPacket(payload_len, nullptr);
+    Packet second = gen.NextPacket(payload_len, nullptr);
+    EXPECT_EQ(PacketBuffer::kOK, buffer.InsertPacket(std::move(second)));
+    EXPECT_EQ(PacketBuffer::kOK, buffer.InsertPacket(std::move(first)));
+    // Let the buffer level grow to 20 packets, then keep it there.
+    if (i >= 10) {
+      for (int j = 0; j < 2; ++j) {
+        const std::optional<Packet> packet = buffer.GetNextPacket();
+        ASSERT_TRUE(packet);
+        EXPECT_EQ(current_ts, packet->timestamp);
+        current_ts += ts_increment;
+      }
+    }
+  }
+  EXPECT_EQ(20u, buffer.NumPacketsInBuffer());
+  uint32_t next_ts;
+  EXPECT_EQ(PacketBuffer::kOK, buffer.NextTimestamp(&next_ts));
+  EXPECT_EQ(current_ts, next_ts);
+
+  // Discarding the older half keeps the order of the remaining packets.
+  EXPECT_CALL(mock_stats, PacketsDiscarded(1)).Times(10);
+  buffer.DiscardAllOldPackets(current_ts + 10 * ts_increment);
+  current_ts += 10 * ts_increment;
+  for (int i = 0; i < 10; ++i) {
+    const std::optional<Packet> packet = buffer.GetNextPacket();
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(current_ts, packet->timestamp);
+    current_ts += ts_increment;
+  }
+  EXPECT_TRUE(buffer.Empty());
+}
+
 TEST(PacketBuffer, Failures) {
   const uint16_t start_seq_no = 17;
   const uint32_t start_ts = 4711;
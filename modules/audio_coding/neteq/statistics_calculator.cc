@@ -155,7 +155,7 @@ void StatisticsCalculator::ResetMcu() {
 
 void StatisticsCalculator::ExpandedVoiceSamples(size_t num_samples,
                                                 bool is_new_concealment_event) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   expanded_speech_samples_ += num_samples;
@@ -165,7 +165,7 @@ void StatisticsCalculator::ExpandedVoiceSamples(size_t num_samples,
 
 void StatisticsCalculator::ExpandedNoiseSamples(size_t num_samples,
                                                 bool is_new_concealment_event) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   expanded_noise_samples_ += num_samples;
@@ -174,7 +174,7 @@ void StatisticsCalculator::ExpandedNoiseSamples(size_t num_samples,
 }
 
 void StatisticsCalculator::ExpandedVoiceSamplesCorrection(int num_samples) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   expanded_speech_samples_ =
@@ -183,7 +183,7 @@ void StatisticsCalculator::ExpandedVoiceSamplesCorrection(int num_samples) {
 }
 
 void StatisticsCalculator::ExpandedNoiseSamplesCorrection(int num_samples) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   expanded_noise_samples_ =
@@ -196,7 +196,7 @@ void StatisticsCalculator::DecodedOutputPlayed() {
 }
 
 void StatisticsCalculator::EndExpandEvent(int fs_hz) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   RTC_DCHECK_GE(lifetime_stats_.concealed_samples,
@@ -205,7 +205,7 @@ void StatisticsCalculator::EndExpandEvent(int fs_hz) {
       1000 *
       (lifetime_stats_.concealed_samples - concealed_samples_at_event_end_) /
       fs_hz;
-  if (event_duration_ms >= kInterruptionLenMs && decoded_output_played_) {
+  if (event_duration_ms >= kInterruptionLenMs && OutputPlayed()) {
     lifetime_stats_.interruption_count++;
     lifetime_stats_.total_interruption_duration_ms += event_duration_ms;
     RTC_HISTOGRAM_COUNTS("WebRTC.Audio.AudioInterruptionMs", event_duration_ms,
@@ -216,7 +216,7 @@ void StatisticsCalculator::EndExpandEvent(int fs_hz) {
 
 void StatisticsCalculator::ConcealedSamplesCorrection(int num_samples,
                                                       bool is_voice) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   if (num_samples < 0) {
@@ -244,7 +244,7 @@ void StatisticsCalculator::ConcealedSamplesCorrection(int num_samples,
 }
 
 void StatisticsCalculator::PreemptiveExpandedSamples(size_t num_samples) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   preemptive_samples_ += num_samples;
@@ -253,7 +253,7 @@ void StatisticsCalculator::PreemptiveExpandedSamples(size_t num_samples) {
 }
 
 void StatisticsCalculator::AcceleratedSamples(size_t num_samples) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   accelerate_samples_ += num_samples;
@@ -262,7 +262,7 @@ void StatisticsCalculator::AcceleratedSamples(size_t num_samples) {
 }
 
 void StatisticsCalculator::GeneratedNoiseSamples(size_t num_samples) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   lifetime_stats_.generated_noise_samples += num_samples;
@@ -282,7 +282,7 @@ void StatisticsCalculator::SecondaryPacketsReceived(size_t num_packets) {
 }
 
 void StatisticsCalculator::IncreaseCounter(size_t num_samples, int fs_hz) {
-  if (!decoded_output_played_) {
+  if (!OutputPlayed()) {
     return;
   }
   const int time_step_ms =
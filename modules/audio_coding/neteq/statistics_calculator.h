@@ -56,6 +56,11 @@ class StatisticsCalculator {
 
   void DecodedOutputPlayed();
 
+  // Sets whether the output is skipped rather than played out, see
+  // NetEq::GetAudioWithoutDecoding(). The statistics of the played out audio
+  // are not updated while the output is skipped.
+  void SetOutputSkipped(bool skipped) { output_skipped_ = skipped; }
+
   // Mark end of expand event; triggers some stats to be reported.
   void EndExpandEvent(int fs_hz);
 
@@ -186,6 +191,11 @@ class StatisticsCalculator {
   // Expanded{Voice,Noise}Samples{Correction}.
   void ConcealedSamplesCorrection(int num_samples, bool is_voice);
 
+  // Returns true if the statistics of the played out audio are updated.
+  bool OutputPlayed() const {
+    return decoded_output_played_ && !output_skipped_;
+  }
+
   // Calculates numerator / denominator, and returns the value in Q14.
   static uint16_t CalculateQ14Ratio(size_t numerator, uint32_t denominator);
 
@@ -206,6 +216,7 @@ class StatisticsCalculator {
   PeriodicUmaAverage excess_buffer_delay_;
   PeriodicUmaCount buffer_full_counter_;
   bool decoded_output_played_ = false;
+  bool output_skipped_ = false;
   ExpandUmaLogger expand_uma_logger_;
   ExpandUmaLogger speech_expand_uma_logger_;
 };
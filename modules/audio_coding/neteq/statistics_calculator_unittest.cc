@@ -33,6 +33,22 @@ TEST(LifetimeStatistics, SamplesConcealed) {
   EXPECT_EQ(100u + 17u, stats.GetLifetimeStatistics().concealed_samples);
 }
 
+TEST(LifetimeStatistics, NoUpdateWhileOutputIsSkipped) {
+  TickTimer timer;
+  StatisticsCalculator stats(&timer);
+  stats.DecodedOutputPlayed();
+  stats.SetOutputSkipped(true);
+  stats.IncreaseCounter(480, 48000);
+  stats.ExpandedVoiceSamples(100, true);
+  EXPECT_EQ(0u, stats.GetLifetimeStatistics().total_samples_received);
+  EXPECT_EQ(0u, stats.GetLifetimeStatistics().concealed_samples);
+  EXPECT_EQ(0u, stats.GetLifetimeStatistics().concealment_events);
+
+  stats.SetOutputSkipped(false);
+  stats.IncreaseCounter(480, 48000);
+  EXPECT_EQ(480u, stats.GetLifetimeStatistics().total_samples_received);
+}
+
 // This test verifies that a negative correction of concealed_samples does not
 // result in a decrease in the stats value (because stats-consuming applications
 // would not expect the value to decrease). Instead, the correction should be
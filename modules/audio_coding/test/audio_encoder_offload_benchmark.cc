@@ -0,0 +1,202 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/opus/audio_encoder_opus.h"
+#include "api/audio_codecs/opus/audio_encoder_opus_config.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_coding/include/audio_coding_module.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/event.h"
+#include "rtc_base/pooled_task_queue_factory.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr size_t kSamplesPer10Ms = kSampleRateHz / 100;
+constexpr int kNumInputFrames = 100;
+constexpr int kPayloadType = 111;
+constexpr int64_t kTickNs = 10 * rtc::kNumNanosecsPerMillisec;
+
+// One second of a tone in noise, so that Opus encodes speech-like input
+// rather than the cheap digital silence.
+std::vector<int16_t> CreateInput() {
+  std::vector<int16_t> input(kNumInputFrames * kSamplesPer10Ms);
+  uint32_t seed = 1;
+  for (size_t i = 0; i < input.size(); ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    const int16_t tone = (i % 48) < 24 ? 3000 : -3000;
+    input[i] = tone + static_cast<int16_t>(static_cast<int32_t>(seed) >> 22);
+  }
+  return input;
+}
+
+// Waits until Decrement() has been called a given number of times.
+class TickBarrier {
+ public:
+  void Reset(int count) { count_.store(count); }
+  void Decrement() {
+    if (count_.fetch_sub(1) == 1) {
+      done_.Set();
+    }
+  }
+  void Wait() { done_.Wait(rtc::Event::kForever); }
+
+ private:
+  std::atomic<int> count_{0};
+  rtc::Event done_;
+};
+
+// The encoding half of a ChannelSend: an AudioCodingModule with an Opus
+// encoder that is fed on the stream's own encoder task queue.
+class EncodingStream : public AudioPacketizationCallback {
+ public:
+  EncodingStream(const Environment& env,
+                 TaskQueueFactory& task_queue_factory,
+                 const std::vector<int16_t>& input)
+      : input_(input), acm_(AudioCodingModule::Create()) {
+    AudioEncoderOpusConfig config;
+    acm_->SetEncoder(AudioEncoderOpus::MakeAudioEncoder(
+        env, config, {.payload_type = kPayloadType}));
+    acm_->RegisterTransportCallback(this);
+    encoder_queue_ = task_queue_factory.CreateTaskQueue(
+        "AudioEncoder", TaskQueueFactory::Priority::NORMAL);
+  }
+
+  ~EncodingStream() override {
+    // No tasks may run while the other members are destroyed.
+    encoder_queue_ = nullptr;
+  }
+
+  void EncodeNextFrame(TickBarrier* barrier) {
+    encoder_queue_->PostTask([this, barrier] {
+      const int16_t* data =
+          &input_[(num_frames_ % kNumInputFrames) * kSamplesPer10Ms];
+      frame_.UpdateFrame(num_frames_ * kSamplesPer10Ms, data, kSamplesPer10Ms,
+                         kSampleRateHz, AudioFrame::kNormalSpeech,
+                         AudioFrame::kVadActive);
+      ++num_frames_;
+      RTC_CHECK_GE(acm_->Add10MsData(frame_), 0);
+      barrier->Decrement();
+    });
+  }
+
+  int32_t SendData(AudioFrameType frame_type,
+                   uint8_t payload_type,
+                   uint32_t timestamp,
+                   const uint8_t* payload_data,
+                   size_t payload_len_bytes,
+                   int64_t absolute_capture_timestamp_ms) override {
+    if (num_packets_ > 0 && timestamp <= last_timestamp_) {
+      ++num_reordered_packets_;
+    }
+    last_timestamp_ = timestamp;
+    ++num_packets_;
+    return 0;
+  }
+
+  // Only to be called when no encode task is pending.
+  int num_reordered_packets() const { return num_reordered_packets_; }
+
+ private:
+  const std::vector<int16_t>& input_;
+  const std::unique_ptr<AudioCodingModule> acm_;
+  AudioFrame frame_;
+  uint32_t num_frames_ = 0;
+  int num_packets_ = 0;
+  uint32_t last_timestamp_ = 0;
+  int num_reordered_packets_ = 0;
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> encoder_queue_;
+};
+
+// Encodes one 10 ms tick of every stream per iteration, each stream on its
+// own encoder task queue. With zero `worker_threads` the task queues come from
+// the default factory, i.e. one thread per stream as ChannelSend does by
+// default; otherwise from a pooled factory with that many threads. Reports
+// the process CPU time per stream and tick, the ticks that took longer than
+// 10 ms and the packets that were delivered out of order, which must be none.
+void BM_EncodeOpusStreams(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  const int num_worker_threads = state.range(1);
+  const Environment env = CreateEnvironment();
+  std::unique_ptr<TaskQueueFactory> pooled_factory;
+  if (num_worker_threads > 0) {
+    pooled_factory = CreatePooledTaskQueueFactory(
+        {.num_worker_threads = num_worker_threads,
+         .pin_worker_threads = state.range(2) != 0});
+  }
+  TaskQueueFactory& task_queue_factory =
+      pooled_factory ? *pooled_factory : env.task_queue_factory();
+
+  const std::vector<int16_t> input = CreateInput();
+  std::vector<std::unique_ptr<EncodingStream>> streams;
+  for (int i = 0; i < num_streams; ++i) {
+    streams.push_back(
+        std::make_unique<EncodingStream>(env, task_queue_factory, input));
+  }
+
+  TickBarrier barrier;
+  int64_t num_deadline_misses = 0;
+  const int64_t start_cpu_ns = rtc::GetProcessCpuTimeNanos();
+  for (auto s : state) {
+    const int64_t tick_start_ns = rtc::TimeNanos();
+    barrier.Reset(num_streams);
+    for (auto& stream : streams) {
+      stream->EncodeNextFrame(&barrier);
+    }
+    barrier.Wait();
+    if (rtc::TimeNanos() - tick_start_ns > kTickNs) {
+      ++num_deadline_misses;
+    }
+  }
+  const int64_t cpu_ns = rtc::GetProcessCpuTimeNanos() - start_cpu_ns;
+
+  int num_reordered_packets = 0;
+  for (const auto& stream : streams) {
+    num_reordered_packets += stream->num_reordered_packets();
+  }
+  streams.clear();
+
+  state.counters["frames_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * num_streams,
+      benchmark::Counter::kIsRate);
+  state.counters["cpu_us_per_stream"] =
+      static_cast<double>(cpu_ns) / rtc::kNumNanosecsPerMicrosec /
+      state.iterations() / num_streams;
+  state.counters["deadline_misses"] = num_deadline_misses;
+  state.counters["reordered_packets"] = num_reordered_packets;
+}
+
+BENCHMARK(BM_EncodeOpusStreams)
+    ->ArgNames({"streams", "worker_threads", "pinned"})
+    ->Args({200, 0, 0})
+    ->Args({200, 1, 0})
+    ->Args({200, 2, 0})
+    ->Args({200, 4, 0})
+    ->Args({200, 4, 1})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
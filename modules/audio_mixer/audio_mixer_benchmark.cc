@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/rtp_headers.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_mixer/audio_mixer_impl.h"
+#include "modules/audio_mixer/default_output_rate_calculator.h"
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr int64_t kTickNs = 10 * rtc::kNumNanosecsPerMillisec;
+
+// Stands in for a ChannelReceive with an Opus stream. Real decoding needs the
+// Opus library and a packet source, so instead every frame is synthesized by
+// running excitation through a 16th order all-pole filter a few times, which
+// is in the order of the per-frame cost of NetEq with Opus at 48 kHz.
+class SimulatedOpusSource : public AudioMixer::Source {
+ public:
+  explicit SimulatedOpusSource(int ssrc) : ssrc_(ssrc), seed_(ssrc) {
+    for (size_t i = 0; i < kOrder; ++i) {
+      // A stable filter; the coefficients decay quickly.
+      coefficients_[i] = 0.5f / static_cast<float>((i + 1) * (i + 2));
+    }
+  }
+
+  AudioFrameInfo GetAudioFrameWithInfo(int sample_rate_hz,
+                                       AudioFrame* audio_frame) override {
+    const size_t samples_per_channel = sample_rate_hz / 100;
+    audio_frame->UpdateFrame(/*timestamp=*/0, /*data=*/nullptr,
+                             samples_per_channel, sample_rate_hz,
+                             AudioFrame::kNormalSpeech, AudioFrame::kVadActive,
+                             /*num_channels=*/1);
+    std::array<float, kOrder> history = history_;
+    int16_t* data = audio_frame->mutable_data();
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      for (size_t i = 0; i < samples_per_channel; ++i) {
+        seed_ = seed_ * 1664525u + 1013904223u;
+        float sample = static_cast<float>(static_cast<int32_t>(seed_) >> 20);
+        for (size_t k = 0; k < kOrder; ++k) {
+          sample += coefficients_[k] * history[k];
+        }
+        for (size_t k = kOrder - 1; k > 0; --k) {
+          history[k] = history[k - 1];
+        }
+        history[0] = sample;
+        data[i] = static_cast<int16_t>(sample);
+      }
+    }
+    history_ = history;
+    return AudioFrameInfo::kNormal;
+  }
+
+  // A few sources talk, the rest send comfort noise.
+  std::optional<AudioLevel> GetAudioLevelHint() const override {
+    return ssrc_ % 100 == 0 ? AudioLevel(/*voice_activity=*/true, 20)
+                            : AudioLevel(/*voice_activity=*/false, 90);
+  }
+
+  // Like ChannelReceive, which keeps the jitter buffer running without
+  // decoding, this is cheap next to producing a frame.
+  void SkipAudioFrame(int /* sample_rate_hz */) override {
+    seed_ = seed_ * 1664525u + 1013904223u;
+  }
+
+  int Ssrc() const override { return ssrc_; }
+  int PreferredSampleRate() const override { return kSampleRateHz; }
+
+ private:
+  static constexpr size_t kOrder = 16;
+  static constexpr int kNumPasses = 2;
+
+  const int ssrc_;
+  uint32_t seed_;
+  std::array<float, kOrder> coefficients_;
+  std::array<float, kOrder> history_ = {};
+};
+
+// Mixes one 10 ms tick per iteration. Reports the process CPU time spent per
+// stream and tick, and the ticks that took longer than 10 ms to mix. With
+// `mixed` non-zero, only that many of the loudest streams are mixed; the
+// others are skipped without decoding.
+void BM_MixSimulatedOpusStreams(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  AudioMixerImpl::Config config;
+  config.num_fetch_threads = state.range(1);
+  config.max_mixed_sources = state.range(2);
+  rtc::scoped_refptr<AudioMixerImpl> mixer =
+      AudioMixerImpl::Create(std::make_unique<DefaultOutputRateCalculator>(),
+                             /*use_limiter=*/true, config);
+  std::vector<std::unique_ptr<SimulatedOpusSource>> sources;
+  for (int i = 0; i < num_streams; ++i) {
+    sources.push_back(std::make_unique<SimulatedOpusSource>(i + 1));
+    mixer->AddSource(sources.back().get());
+  }
+
+  AudioFrame frame;
+  int64_t num_deadline_misses = 0;
+  const int64_t start_cpu_ns = rtc::GetProcessCpuTimeNanos();
+  for (auto s : state) {
+    const int64_t tick_start_ns = rtc::TimeNanos();
+    mixer->Mix(/*number_of_channels=*/1, &frame);
+    if (rtc::TimeNanos() - tick_start_ns > kTickNs) {
+      ++num_deadline_misses;
+    }
+  }
+  const int64_t cpu_ns = rtc::GetProcessCpuTimeNanos() - start_cpu_ns;
+
+  for (auto& source : sources) {
+    mixer->RemoveSource(source.get());
+  }
+  state.counters["cpu_us_per_stream"] =
+      static_cast<double>(cpu_ns) / rtc::kNumNanosecsPerMicrosec /
+      state.iterations() / num_streams;
+  state.counters["deadline_misses"] = num_deadline_misses;
+  state.counters["deadline_miss_ratio"] =
+      static_cast<double>(num_deadline_misses) / state.iterations();
+}
+
+BENCHMARK(BM_MixSimulatedOpusStreams)
+    ->ArgNames({"streams", "fetch_threads", "mixed"})
+    ->Args({500, 0, 0})
+    ->Args({500, 1, 0})
+    ->Args({500, 3, 0})
+    ->Args({500, 7, 0})
+    ->Args({500, 0, 3})
+    ->Args({500, 3, 3})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
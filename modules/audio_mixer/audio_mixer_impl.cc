@@ -14,9 +14,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
+#include "api/rtp_headers.h"
 #include "modules/audio_mixer/audio_frame_manipulator.h"
 #include "modules/audio_mixer/default_output_rate_calculator.h"
 #include "rtc_base/checks.h"
@@ -32,6 +34,12 @@ struct AudioMixerImpl::SourceStatus {
 
   // A frame that will be passed to audio_source->GetAudioFrameWithInfo.
   AudioFrame audio_frame;
+  // What audio_source->GetAudioFrameWithInfo returned for `audio_frame`.
+  Source::AudioFrameInfo audio_frame_info = Source::AudioFrameInfo::kError;
+  // What audio_source->GetAudioLevelHint() returned before the last pull.
+  std::optional<AudioLevel> level_hint;
+  // Whether the audio of the source is pulled and mixed in this Mix() call.
+  bool is_selected = true;
 };
 
 namespace {
@@ -57,15 +65,31 @@ struct AudioMixerImpl::HelperContainers {
 
   std::vector<AudioFrame*> audio_to_mix;
   std::vector<int> preferred_rates;
+  // Indices of the sources with a level hint, loudest first after
+  // selection.
+  std::vector<size_t> ranked_sources;
 };
 
 AudioMixerImpl::AudioMixerImpl(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
     bool use_limiter)
+    : AudioMixerImpl(std::move(output_rate_calculator),
+                     use_limiter,
+                     Config()) {}
+
+AudioMixerImpl::AudioMixerImpl(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter,
+    const Config& config)
     : output_rate_calculator_(std::move(output_rate_calculator)),
       audio_source_list_(),
       helper_containers_(std::make_unique<HelperContainers>()),
-      frame_combiner_(use_limiter) {}
+      frame_combiner_(use_limiter),
+      fetch_runner_(config.num_fetch_threads > 0
+                        ? std::make_unique<BatchTaskRunner>(
+                              config.num_fetch_threads, "AudioMixerFetch")
+                        : nullptr),
+      max_mixed_sources_(config.max_mixed_sources) {}
 
 AudioMixerImpl::~AudioMixerImpl() {}
 
@@ -82,6 +106,14 @@ rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
       std::move(output_rate_calculator), use_limiter);
 }
 
+rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter,
+    const Config& config) {
+  return rtc::make_ref_counted<AudioMixerImpl>(
+      std::move(output_rate_calculator), use_limiter, config);
+}
+
 void AudioMixerImpl::Mix(size_t number_of_channels,
                          AudioFrame* audio_frame_for_mixing) {
   TRACE_EVENT0("webrtc", "AudioMixerImpl::Mix");
@@ -125,14 +157,75 @@ void AudioMixerImpl::RemoveSource(Source* audio_source) {
   audio_source_list_.erase(iter);
 }
 
+void AudioMixerImpl::SelectSourcesToMix() {
+  const auto& sources = audio_source_list_;
+  std::vector<size_t>& ranked = helper_containers_->ranked_sources;
+  ranked.clear();
+  for (size_t i = 0; i < sources.size(); ++i) {
+    SourceStatus& status = *sources[i];
+    status.level_hint = status.audio_source->GetAudioLevelHint();
+    // Telling the level without a hint would mean decoding the audio, which
+    // is what the selection is there to avoid.
+    status.is_selected = !status.level_hint.has_value();
+    if (status.level_hint) {
+      ranked.push_back(i);
+    }
+  }
+
+  // Levels are in -dBov, so lower is louder. Ties go to the source that was
+  // added first, which keeps the selection stable.
+  const size_t num_selected = std::min(ranked.size(), max_mixed_sources_);
+  std::partial_sort(ranked.begin(), ranked.begin() + num_selected,
+                    ranked.end(), [&sources](size_t a, size_t b) {
+                      const AudioLevel& level_a = *sources[a]->level_hint;
+                      const AudioLevel& level_b = *sources[b]->level_hint;
+                      if (level_a.voice_activity() !=
+                          level_b.voice_activity()) {
+                        return level_a.voice_activity();
+                      }
+                      if (level_a.level() != level_b.level()) {
+                        return level_a.level() < level_b.level();
+                      }
+                      return a < b;
+                    });
+  for (size_t i = 0; i < num_selected; ++i) {
+    sources[ranked[i]]->is_selected = true;
+  }
+}
+
 rtc::ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromSources(
     int output_frequency) {
+  if (max_mixed_sources_ > 0) {
+    SelectSourcesToMix();
+  }
+
+  // Pull the audio of all sources first, and then pick the frames to mix in
+  // source order, so that the result is the same no matter which thread
+  // fetched which frame.
+  const auto& sources = audio_source_list_;
+  auto fetch = [&sources, output_frequency](size_t index) {
+    SourceStatus& status = *sources[index];
+    if (!status.is_selected) {
+      status.audio_source->SkipAudioFrame(output_frequency);
+      return;
+    }
+    status.audio_frame_info = status.audio_source->GetAudioFrameWithInfo(
+        output_frequency, &status.audio_frame);
+  };
+  if (fetch_runner_) {
+    fetch_runner_->Run(sources.size(), fetch);
+  } else {
+    for (size_t i = 0; i < sources.size(); ++i) {
+      fetch(i);
+    }
+  }
+
   int audio_to_mix_count = 0;
   for (auto& source_and_status : audio_source_list_) {
-    const auto audio_frame_info =
-        source_and_status->audio_source->GetAudioFrameWithInfo(
-            output_frequency, &source_and_status->audio_frame);
-    switch (audio_frame_info) {
+    if (!source_and_status->is_selected) {
+      continue;
+    }
+    switch (source_and_status->audio_frame_info) {
       case Source::AudioFrameInfo::kError:
         RTC_LOG_F(LS_WARNING)
             << "failed to GetAudioFrameWithInfo() from source";
@@ -24,6 +24,7 @@
 #include "modules/audio_mixer/output_rate_calculator.h"
 #include "rtc_base/race_checker.h"
 #include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/task_utils/batch_task_runner.h"
 #include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
@@ -41,6 +42,29 @@ class AudioMixerImpl : public AudioMixer {
       std::unique_ptr<OutputRateCalculator> output_rate_calculator,
       bool use_limiter);
 
+  // Options for mixing many sources, e.g. on a conference server.
+  struct Config {
+    // Each Mix() pulls the audio of all sources, i.e. runs their decoders,
+    // as one batch spread over `num_fetch_threads` worker threads and the
+    // mixing thread. The frames are still combined in the order the sources
+    // were added, so the output does not depend on the thread scheduling.
+    // Sources must tolerate GetAudioFrameWithInfo() being called from a
+    // different thread every time; the calls for one source never overlap.
+    int num_fetch_threads = 0;
+
+    // If non-zero, only the `max_mixed_sources` loudest sources with a level
+    // hint are pulled and mixed; the others are only asked to skip a frame.
+    // The sources are ranked by Source::GetAudioLevelHint() before any audio
+    // is pulled, voice active sources first. Sources without a level hint
+    // can't be ranked and are always mixed, on top of the selected ones.
+    size_t max_mixed_sources = 0;
+  };
+
+  static rtc::scoped_refptr<AudioMixerImpl> Create(
+      std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+      bool use_limiter,
+      const Config& config);
+
   ~AudioMixerImpl() override;
 
   AudioMixerImpl(const AudioMixerImpl&) = delete;
@@ -57,12 +81,19 @@ class AudioMixerImpl : public AudioMixer {
  protected:
   AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
                  bool use_limiter);
+  AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+                 bool use_limiter,
+                 const Config& config);
 
  private:
   struct HelperContainers;
 
   void UpdateSourceCountStats() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Picks the sources to pull audio from in this Mix() call, if the number
+  // of mixed sources is limited.
+  void SelectSourcesToMix() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // Fetches audio frames to mix from sources.
   rtc::ArrayView<AudioFrame* const> GetAudioFromSources(int output_frequency)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
@@ -83,6 +114,13 @@ class AudioMixerImpl : public AudioMixer {
   // Component that handles actual adding of audio frames.
   FrameCombiner frame_combiner_;
 
+  // Runs GetAudioFrameWithInfo() of the sources in parallel, if created with
+  // fetch threads.
+  const std::unique_ptr<BatchTaskRunner> fetch_runner_;
+
+  // Zero if all sources are mixed.
+  const size_t max_mixed_sources_;
+
   // The highest source count this mixer has ever had. Used for UMA stats.
   size_t max_source_count_ever_ = 0;
 };
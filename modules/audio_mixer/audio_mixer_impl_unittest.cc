@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "api/audio/audio_mixer.h"
+#include "api/rtp_headers.h"
 #include "api/rtp_packet_info.h"
 #include "api/rtp_packet_infos.h"
 #include "api/units/timestamp.h"
@@ -90,6 +91,11 @@ class MockMixerAudioSource : public ::testing::NiceMock<AudioMixer::Source> {
 
   MOCK_METHOD(int, PreferredSampleRate, (), (const, override));
   MOCK_METHOD(int, Ssrc, (), (const, override));
+  MOCK_METHOD(std::optional<AudioLevel>,
+              GetAudioLevelHint,
+              (),
+              (const, override));
+  MOCK_METHOD(void, SkipAudioFrame, (int sample_rate_hz), (override));
 
   AudioFrame* fake_frame() { return &fake_frame_; }
   AudioFrameInfo fake_info() { return fake_audio_frame_info_; }
@@ -479,6 +485,104 @@ TEST(AudioMixer, ShouldIncludeRtpPacketInfoFromAllMixedSources) {
   EXPECT_THAT(frame_for_mixing.packet_infos_, UnorderedElementsAre(p0, p1, p2));
 }
 
+TEST(AudioMixer, FetchThreadsGiveSameMixAsMixingThreadAlone) {
+  constexpr int kNumSources = 30;
+  std::vector<std::unique_ptr<MockMixerAudioSource>> sources;
+  for (int i = 0; i < kNumSources; ++i) {
+    sources.push_back(std::make_unique<MockMixerAudioSource>());
+    AudioFrame* frame = sources.back()->fake_frame();
+    ResetFrame(frame);
+    int16_t* data = frame->mutable_data();
+    for (size_t j = 0; j < frame->samples_per_channel_; ++j) {
+      data[j] = static_cast<int16_t>((i + 1) * 37 * (j % 13) - 2000);
+    }
+    if (i % 7 == 0) {
+      sources.back()->set_fake_info(
+          AudioMixer::Source::AudioFrameInfo::kMuted);
+    }
+    EXPECT_CALL(*sources.back(), GetAudioFrameWithInfo(_, _)).Times(4);
+  }
+
+  const auto mixer = AudioMixerImpl::Create();
+  AudioMixerImpl::Config config;
+  config.num_fetch_threads = 3;
+  const auto threaded_mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/true,
+      config);
+  for (auto& source : sources) {
+    mixer->AddSource(source.get());
+    threaded_mixer->AddSource(source.get());
+  }
+
+  // Mix twice to get past the ramp-up.
+  AudioFrame frame;
+  AudioFrame threaded_frame;
+  for (int i = 0; i < 2; ++i) {
+    mixer->Mix(1, &frame);
+    threaded_mixer->Mix(1, &threaded_frame);
+  }
+  ASSERT_EQ(frame.samples_per_channel_, threaded_frame.samples_per_channel_);
+  EXPECT_EQ(0, memcmp(frame.data(), threaded_frame.data(),
+                      frame.samples_per_channel_ * sizeof(int16_t)));
+
+  for (auto& source : sources) {
+    mixer->RemoveSource(source.get());
+    threaded_mixer->RemoveSource(source.get());
+  }
+}
+
+TEST(AudioMixer, MixesOnlyLoudestSourcesWithLevelHint) {
+  constexpr size_t kMaxMixedSources = 2;
+  AudioMixerImpl::Config config;
+  config.max_mixed_sources = kMaxMixedSources;
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/true,
+      config);
+
+  // Voice activity outranks level, so the quiet talker beats the loud noise.
+  const std::vector<std::optional<AudioLevel>> level_hints = {
+      AudioLevel(/*voice_activity=*/false, 10),
+      AudioLevel(/*voice_activity=*/true, 60),
+      std::nullopt,
+      AudioLevel(/*voice_activity=*/true, 30),
+      AudioLevel(/*voice_activity=*/true, 90),
+      AudioLevel(/*voice_activity=*/false, 127)};
+  const std::vector<bool> expected_mixed = {false, true,  true,
+                                            true,  false, false};
+  std::vector<std::unique_ptr<MockMixerAudioSource>> sources;
+  for (size_t i = 0; i < level_hints.size(); ++i) {
+    sources.push_back(std::make_unique<MockMixerAudioSource>());
+    MockMixerAudioSource& source = *sources.back();
+    ResetFrame(source.fake_frame());
+    EXPECT_CALL(source, GetAudioLevelHint())
+        .WillRepeatedly(Return(level_hints[i]));
+    EXPECT_CALL(source, GetAudioFrameWithInfo(_, _))
+        .Times(expected_mixed[i] ? 1 : 0);
+    EXPECT_CALL(source, SkipAudioFrame(kDefaultSampleRateHz))
+        .Times(expected_mixed[i] ? 0 : 1);
+    mixer->AddSource(&source);
+  }
+
+  mixer->Mix(1, &frame_for_mixing);
+
+  for (auto& source : sources) {
+    mixer->RemoveSource(source.get());
+  }
+}
+
+TEST(AudioMixer, PullsAllSourcesWithoutLimitOnMixedSources) {
+  const auto mixer = AudioMixerImpl::Create();
+  MockMixerAudioSource source;
+  ResetFrame(source.fake_frame());
+  ON_CALL(source, GetAudioLevelHint())
+      .WillByDefault(Return(AudioLevel(/*voice_activity=*/false, 127)));
+  EXPECT_CALL(source, GetAudioFrameWithInfo(_, _)).Times(1);
+  EXPECT_CALL(source, SkipAudioFrame(_)).Times(0);
+  mixer->AddSource(&source);
+  mixer->Mix(1, &frame_for_mixing);
+  mixer->RemoveSource(&source);
+}
+
 class HighOutputRateCalculator : public OutputRateCalculator {
  public:
   static const int kDefaultFrequency = 76000;
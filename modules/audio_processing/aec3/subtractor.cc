@@ -21,6 +21,7 @@
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_minmax.h"
+#include "system_wrappers/include/denormal_disabler.h"
 
 namespace webrtc {
 
@@ -134,6 +135,14 @@ Subtractor::Subtractor(const Environment& env,
       H2_k.fill(0.f);
     }
   }
+
+  const int num_worker_threads = std::min(
+      config_.filter.num_worker_threads,
+      static_cast<int>(num_capture_channels_) - 1);
+  if (num_worker_threads > 0) {
+    channel_runner_ =
+        std::make_unique<BatchTaskRunner>(num_worker_threads, "Aec3Subtractor");
+  }
 }
 
 Subtractor::~Subtractor() = default;
@@ -205,125 +214,146 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
                                &X2_coarse);
   }
 
-  // Process all capture channels
-  for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
-    SubtractorOutput& output = outputs[ch];
-    rtc::ArrayView<const float> y = capture.View(/*band=*/0, ch);
-    FftData& E_refined = output.E_refined;
-    FftData E_coarse;
-    std::array<float, kBlockSize>& e_refined = output.e_refined;
-    std::array<float, kBlockSize>& e_coarse = output.e_coarse;
-
-    FftData S;
-    FftData& G = S;
-
-    // Form the outputs of the refined and coarse filters.
-    refined_filters_[ch]->Filter(render_buffer, &S);
-    PredictionError(fft_, S, y, &e_refined, &output.s_refined);
-
-    coarse_filter_[ch]->Filter(render_buffer, &S);
-    PredictionError(fft_, S, y, &e_coarse, &output.s_coarse);
-
-    // Compute the signal powers in the subtractor output.
-    output.ComputeMetrics(y);
-
-    // Adjust the filter if needed.
-    bool refined_filters_adjusted = false;
-    filter_misadjustment_estimators_[ch].Update(output);
-    if (filter_misadjustment_estimators_[ch].IsAdjustmentNeeded()) {
-      float scale = filter_misadjustment_estimators_[ch].GetMisadjustment();
-      refined_filters_[ch]->ScaleFilter(scale);
-      for (auto& h_k : refined_impulse_responses_[ch]) {
-        h_k *= scale;
-      }
-      ScaleFilterOutput(y, scale, e_refined, output.s_refined);
-      filter_misadjustment_estimators_[ch].Reset();
-      refined_filters_adjusted = true;
+  // Process all capture channels.
+  auto process_channel = [&](size_t ch) {
+    // Worker threads keep the denormal handling they were created with, so
+    // disable denormals here like the audio processing module does on the
+    // calling thread.
+    DenormalDisabler denormal_disabler;
+    ProcessChannel(ch, render_buffer, capture, render_signal_analyzer,
+                   aec_state, X2_refined, X2_coarse, outputs[ch]);
+  };
+  if (channel_runner_) {
+    channel_runner_->Run(num_capture_channels_, process_channel);
+  } else {
+    for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
+      process_channel(ch);
     }
+  }
+}
 
-    // Compute the FFts of the refined and coarse filter outputs.
-    fft_.ZeroPaddedFft(e_refined, Aec3Fft::Window::kHanning, &E_refined);
-    fft_.ZeroPaddedFft(e_coarse, Aec3Fft::Window::kHanning, &E_coarse);
-
-    // Compute spectra for future use.
-    E_coarse.Spectrum(optimization_, output.E2_coarse);
-    E_refined.Spectrum(optimization_, output.E2_refined);
-
-    // Update the refined filter.
-    if (!refined_filters_adjusted) {
-      // Do not allow the performance of the coarse filter to affect the
-      // adaptation speed of the refined filter just after the coarse filter has
-      // been reset.
-      const bool disallow_leakage_diverged =
-          coarse_filter_reset_hangover_[ch] > 0 &&
-          use_coarse_filter_reset_hangover_;
-
-      std::array<float, kFftLengthBy2Plus1> erl;
-      ComputeErl(optimization_, refined_frequency_responses_[ch], erl);
-      refined_gains_[ch]->Compute(X2_refined, render_signal_analyzer, output,
-                                  erl, refined_filters_[ch]->SizePartitions(),
-                                  aec_state.SaturatedCapture(),
-                                  disallow_leakage_diverged, &G);
-    } else {
-      G.re.fill(0.f);
-      G.im.fill(0.f);
-    }
-    refined_filters_[ch]->Adapt(render_buffer, G,
-                                &refined_impulse_responses_[ch]);
-    refined_filters_[ch]->ComputeFrequencyResponse(
-        &refined_frequency_responses_[ch]);
-
-    if (ch == 0) {
-      data_dumper_->DumpRaw("aec3_subtractor_G_refined", G.re);
-      data_dumper_->DumpRaw("aec3_subtractor_G_refined", G.im);
+void Subtractor::ProcessChannel(
+    size_t ch,
+    const RenderBuffer& render_buffer,
+    const Block& capture,
+    const RenderSignalAnalyzer& render_signal_analyzer,
+    const AecState& aec_state,
+    const std::array<float, kFftLengthBy2Plus1>& X2_refined,
+    const std::array<float, kFftLengthBy2Plus1>& X2_coarse,
+    SubtractorOutput& output) {
+  rtc::ArrayView<const float> y = capture.View(/*band=*/0, ch);
+  FftData& E_refined = output.E_refined;
+  FftData E_coarse;
+  std::array<float, kBlockSize>& e_refined = output.e_refined;
+  std::array<float, kBlockSize>& e_coarse = output.e_coarse;
+
+  FftData S;
+  FftData& G = S;
+
+  // Form the outputs of the refined and coarse filters.
+  refined_filters_[ch]->Filter(render_buffer, &S);
+  PredictionError(fft_, S, y, &e_refined, &output.s_refined);
+
+  coarse_filter_[ch]->Filter(render_buffer, &S);
+  PredictionError(fft_, S, y, &e_coarse, &output.s_coarse);
+
+  // Compute the signal powers in the subtractor output.
+  output.ComputeMetrics(y);
+
+  // Adjust the filter if needed.
+  bool refined_filters_adjusted = false;
+  filter_misadjustment_estimators_[ch].Update(output);
+  if (filter_misadjustment_estimators_[ch].IsAdjustmentNeeded()) {
+    float scale = filter_misadjustment_estimators_[ch].GetMisadjustment();
+    refined_filters_[ch]->ScaleFilter(scale);
+    for (auto& h_k : refined_impulse_responses_[ch]) {
+      h_k *= scale;
     }
+    ScaleFilterOutput(y, scale, e_refined, output.s_refined);
+    filter_misadjustment_estimators_[ch].Reset();
+    refined_filters_adjusted = true;
+  }
 
-    // Update the coarse filter.
-    poor_coarse_filter_counters_[ch] =
-        output.e2_refined < output.e2_coarse
-            ? poor_coarse_filter_counters_[ch] + 1
-            : 0;
-    if (poor_coarse_filter_counters_[ch] < 5) {
-      coarse_gains_[ch]->Compute(X2_coarse, render_signal_analyzer, E_coarse,
-                                 coarse_filter_[ch]->SizePartitions(),
-                                 aec_state.SaturatedCapture(), &G);
-      coarse_filter_reset_hangover_[ch] =
-          std::max(coarse_filter_reset_hangover_[ch] - 1, 0);
-    } else {
-      poor_coarse_filter_counters_[ch] = 0;
-      coarse_filter_[ch]->SetFilter(refined_filters_[ch]->SizePartitions(),
-                                    refined_filters_[ch]->GetFilter());
-      coarse_gains_[ch]->Compute(X2_coarse, render_signal_analyzer, E_refined,
-                                 coarse_filter_[ch]->SizePartitions(),
-                                 aec_state.SaturatedCapture(), &G);
-      coarse_filter_reset_hangover_[ch] =
-          config_.filter.coarse_reset_hangover_blocks;
-    }
+  // Compute the FFts of the refined and coarse filter outputs.
+  fft_.ZeroPaddedFft(e_refined, Aec3Fft::Window::kHanning, &E_refined);
+  fft_.ZeroPaddedFft(e_coarse, Aec3Fft::Window::kHanning, &E_coarse);
+
+  // Compute spectra for future use.
+  E_coarse.Spectrum(optimization_, output.E2_coarse);
+  E_refined.Spectrum(optimization_, output.E2_refined);
+
+  // Update the refined filter.
+  if (!refined_filters_adjusted) {
+    // Do not allow the performance of the coarse filter to affect the
+    // adaptation speed of the refined filter just after the coarse filter has
+    // been reset.
+    const bool disallow_leakage_diverged =
+        coarse_filter_reset_hangover_[ch] > 0 &&
+        use_coarse_filter_reset_hangover_;
+
+    std::array<float, kFftLengthBy2Plus1> erl;
+    ComputeErl(optimization_, refined_frequency_responses_[ch], erl);
+    refined_gains_[ch]->Compute(X2_refined, render_signal_analyzer, output,
+                                erl, refined_filters_[ch]->SizePartitions(),
+                                aec_state.SaturatedCapture(),
+                                disallow_leakage_diverged, &G);
+  } else {
+    G.re.fill(0.f);
+    G.im.fill(0.f);
+  }
+  refined_filters_[ch]->Adapt(render_buffer, G,
+                              &refined_impulse_responses_[ch]);
+  refined_filters_[ch]->ComputeFrequencyResponse(
+      &refined_frequency_responses_[ch]);
+
+  if (ch == 0) {
+    data_dumper_->DumpRaw("aec3_subtractor_G_refined", G.re);
+    data_dumper_->DumpRaw("aec3_subtractor_G_refined", G.im);
+  }
 
-    if (ApmDataDumper::IsAvailable()) {
-      RTC_DCHECK_LT(ch, coarse_impulse_responses_.size());
-      coarse_filter_[ch]->Adapt(render_buffer, G,
-                                &coarse_impulse_responses_[ch]);
-    } else {
-      coarse_filter_[ch]->Adapt(render_buffer, G);
-    }
+  // Update the coarse filter.
+  poor_coarse_filter_counters_[ch] = output.e2_refined < output.e2_coarse
+                                         ? poor_coarse_filter_counters_[ch] + 1
+                                         : 0;
+  if (poor_coarse_filter_counters_[ch] < 5) {
+    coarse_gains_[ch]->Compute(X2_coarse, render_signal_analyzer, E_coarse,
+                               coarse_filter_[ch]->SizePartitions(),
+                               aec_state.SaturatedCapture(), &G);
+    coarse_filter_reset_hangover_[ch] =
+        std::max(coarse_filter_reset_hangover_[ch] - 1, 0);
+  } else {
+    poor_coarse_filter_counters_[ch] = 0;
+    coarse_filter_[ch]->SetFilter(refined_filters_[ch]->SizePartitions(),
+                                  refined_filters_[ch]->GetFilter());
+    coarse_gains_[ch]->Compute(X2_coarse, render_signal_analyzer, E_refined,
+                               coarse_filter_[ch]->SizePartitions(),
+                               aec_state.SaturatedCapture(), &G);
+    coarse_filter_reset_hangover_[ch] =
+        config_.filter.coarse_reset_hangover_blocks;
+  }
 
-    if (ch == 0) {
-      data_dumper_->DumpRaw("aec3_subtractor_G_coarse", G.re);
-      data_dumper_->DumpRaw("aec3_subtractor_G_coarse", G.im);
-      filter_misadjustment_estimators_[ch].Dump(data_dumper_);
-      DumpFilters();
-    }
+  if (ApmDataDumper::IsAvailable()) {
+    RTC_DCHECK_LT(ch, coarse_impulse_responses_.size());
+    coarse_filter_[ch]->Adapt(render_buffer, G, &coarse_impulse_responses_[ch]);
+  } else {
+    coarse_filter_[ch]->Adapt(render_buffer, G);
+  }
 
-    std::for_each(e_refined.begin(), e_refined.end(),
-                  [](float& a) { a = rtc::SafeClamp(a, -32768.f, 32767.f); });
+  if (ch == 0) {
+    data_dumper_->DumpRaw("aec3_subtractor_G_coarse", G.re);
+    data_dumper_->DumpRaw("aec3_subtractor_G_coarse", G.im);
+    filter_misadjustment_estimators_[ch].Dump(data_dumper_);
+    DumpFilters();
+  }
 
-    if (ch == 0) {
-      data_dumper_->DumpWav("aec3_refined_filters_output", kBlockSize,
-                            &e_refined[0], 16000, 1);
-      data_dumper_->DumpWav("aec3_coarse_filter_output", kBlockSize,
-                            &e_coarse[0], 16000, 1);
-    }
+  std::for_each(e_refined.begin(), e_refined.end(),
+                [](float& a) { a = rtc::SafeClamp(a, -32768.f, 32767.f); });
+
+  if (ch == 0) {
+    data_dumper_->DumpWav("aec3_refined_filters_output", kBlockSize,
+                          &e_refined[0], 16000, 1);
+    data_dumper_->DumpWav("aec3_coarse_filter_output", kBlockSize,
+                          &e_coarse[0], 16000, 1);
   }
 }
 
@@ -15,6 +15,7 @@
 #include <stddef.h>
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "api/array_view.h"
@@ -33,6 +34,7 @@
 #include "modules/audio_processing/aec3/subtractor_output.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/task_utils/batch_task_runner.h"
 
 namespace webrtc {
 
@@ -127,6 +129,18 @@ class Subtractor {
     int overhang_ = 0.f;
   };
 
+  // Performs the echo subtraction for the capture channel `ch`. The channels
+  // are independent of each other and may be processed concurrently.
+  void ProcessChannel(
+      size_t ch,
+      const RenderBuffer& render_buffer,
+      const Block& capture,
+      const RenderSignalAnalyzer& render_signal_analyzer,
+      const AecState& aec_state,
+      const std::array<float, kFftLengthBy2Plus1>& X2_refined,
+      const std::array<float, kFftLengthBy2Plus1>& X2_coarse,
+      SubtractorOutput& output);
+
   const Aec3Fft fft_;
   ApmDataDumper* data_dumper_;
   const Aec3Optimization optimization_;
@@ -145,6 +159,8 @@ class Subtractor {
       refined_frequency_responses_;
   std::vector<std::vector<float>> refined_impulse_responses_;
   std::vector<std::vector<float>> coarse_impulse_responses_;
+  // Spreads the capture channels over worker threads, if any are configured.
+  std::unique_ptr<BatchTaskRunner> channel_runner_;
 };
 
 }  // namespace webrtc
@@ -11,6 +11,7 @@
 #include "modules/audio_processing/aec3/subtractor.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -23,6 +24,7 @@
 #include "modules/audio_processing/utility/cascaded_biquad_filter.h"
 #include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
+#include "system_wrappers/include/denormal_disabler.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -242,6 +244,117 @@ TEST(Subtractor, CoarseFilterLongerThanRefinedFilter) {
   }
 }
 
+// Compares the bits of `a` and `b`. Comparing them as floats would not catch
+// a denormal that differs from zero when denormals are disabled.
+template <typename T>
+bool BitExact(const T& a, const T& b) {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// Verifies that spreading the capture channels over worker threads gives the
+// same output as processing them on the calling thread, for render signals
+// scaled by `signal_scale`. If `disable_denormals` is true, denormals are
+// disabled on the calling thread after the worker threads have been created,
+// so that the workers do not take that setting from it.
+void VerifyWorkerThreadsGiveBitExactOutput(float signal_scale,
+                                           bool disable_denormals) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kNumBands = NumBandsForRate(kSampleRateHz);
+  constexpr size_t kNumRenderChannels = 2;
+  constexpr size_t kNumCaptureChannels = 4;
+  const Environment env = CreateEnvironment();
+  ApmDataDumper data_dumper(42);
+  EchoCanceller3Config config;
+  config.delay.default_delay = 1;
+  Subtractor serial_subtractor(env, config, kNumRenderChannels,
+                               kNumCaptureChannels, &data_dumper,
+                               DetectOptimization());
+  config.filter.num_worker_threads = 2;
+  Subtractor parallel_subtractor(env, config, kNumRenderChannels,
+                                 kNumCaptureChannels, &data_dumper,
+                                 DetectOptimization());
+  DenormalDisabler denormal_disabler(disable_denormals);
+
+  std::unique_ptr<RenderDelayBuffer> render_delay_buffer(
+      RenderDelayBuffer::Create(config, kSampleRateHz, kNumRenderChannels));
+  RenderSignalAnalyzer render_signal_analyzer(config);
+  AecState aec_state(env, config, kNumCaptureChannels);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> Y2(kNumCaptureChannels);
+  std::vector<std::array<float, kFftLengthBy2Plus1>> E2_refined(
+      kNumCaptureChannels);
+  for (size_t ch = 0; ch < kNumCaptureChannels; ++ch) {
+    Y2[ch].fill(0.f);
+    E2_refined[ch].fill(0.f);
+  }
+  std::vector<SubtractorOutput> serial_output(kNumCaptureChannels);
+  std::vector<SubtractorOutput> parallel_output(kNumCaptureChannels);
+
+  std::vector<std::unique_ptr<DelayBuffer<float>>> delay_buffer(
+      kNumCaptureChannels);
+  for (size_t ch = 0; ch < kNumCaptureChannels; ++ch) {
+    delay_buffer[ch] = std::make_unique<DelayBuffer<float>>(64 + 50 * ch);
+  }
+
+  Block x(kNumBands, kNumRenderChannels);
+  Block y(/*num_bands=*/1, kNumCaptureChannels);
+  Random random_generator(42U);
+  for (int k = 0; k < 500; ++k) {
+    for (size_t ch = 0; ch < kNumRenderChannels; ++ch) {
+      RandomizeSampleVector(&random_generator, x.View(/*band=*/0, ch));
+      for (float& sample : x.View(/*band=*/0, ch)) {
+        sample *= signal_scale;
+      }
+    }
+    for (size_t ch = 0; ch < kNumCaptureChannels; ++ch) {
+      delay_buffer[ch]->Delay(x.View(/*band=*/0, ch % kNumRenderChannels),
+                              y.View(/*band=*/0, ch));
+    }
+
+    render_delay_buffer->Insert(x);
+    if (k == 0) {
+      render_delay_buffer->Reset();
+    }
+    render_delay_buffer->PrepareCaptureProcessing();
+    const RenderBuffer& render_buffer = *render_delay_buffer->GetRenderBuffer();
+    render_signal_analyzer.Update(render_buffer,
+                                  aec_state.MinDirectPathFilterDelay());
+
+    serial_subtractor.Process(render_buffer, y, render_signal_analyzer,
+                              aec_state, serial_output);
+    parallel_subtractor.Process(render_buffer, y, render_signal_analyzer,
+                                aec_state, parallel_output);
+    for (size_t ch = 0; ch < kNumCaptureChannels; ++ch) {
+      ASSERT_TRUE(
+          BitExact(serial_output[ch].e_refined, parallel_output[ch].e_refined));
+      ASSERT_TRUE(
+          BitExact(serial_output[ch].e_coarse, parallel_output[ch].e_coarse));
+      ASSERT_TRUE(BitExact(serial_output[ch].E2_refined,
+                           parallel_output[ch].E2_refined));
+      ASSERT_TRUE(
+          BitExact(serial_output[ch].E2_coarse, parallel_output[ch].E2_coarse));
+    }
+    ASSERT_EQ(serial_subtractor.FilterImpulseResponses(),
+              parallel_subtractor.FilterImpulseResponses());
+
+    aec_state.Update(std::nullopt, serial_subtractor.FilterFrequencyResponses(),
+                     serial_subtractor.FilterImpulseResponses(), render_buffer,
+                     E2_refined, Y2, serial_output);
+  }
+}
+
+TEST(Subtractor, WorkerThreadsGiveBitExactOutput) {
+  VerifyWorkerThreadsGiveBitExactOutput(/*signal_scale=*/1.f,
+                                        /*disable_denormals=*/false);
+}
+
+// Verifies that the worker threads flush denormals to zero like the calling
+// thread, on which the audio processing module disables denormals.
+TEST(Subtractor, WorkerThreadsGiveBitExactOutputWithDenormalsDisabled) {
+  // Signals this small make the filters produce denormals.
+  VerifyWorkerThreadsGiveBitExactOutput(/*signal_scale=*/1e-25f,
+                                        /*disable_denormals=*/true);
+}
+
 // Verifies that the subtractor does not converge on uncorrelated signals.
 TEST(Subtractor, NonConvergenceOnUncorrelatedSignals) {
   const Environment env = CreateEnvironment();
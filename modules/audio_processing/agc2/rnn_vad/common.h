@@ -71,6 +71,11 @@ static_assert(kCepstralCoeffsHistorySize > 2,
 
 constexpr int kFeatureVectorSize = 42;
 
+// Precision of the weights used by the RNN layers. With `kInt8`, the weights
+// are kept as the 8 bit integers with which the model is stored and the layer
+// inputs are quantized to 16 bit integers.
+enum class WeightsPrecision { kFloat, kInt8 };
+
 }  // namespace rnn_vad
 }  // namespace webrtc
 
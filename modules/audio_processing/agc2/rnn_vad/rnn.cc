@@ -38,12 +38,17 @@ static_assert(kOutputLayerOutputSize <= kFullyConnectedLayerMaxUnits, "");
 }  // namespace
 
 RnnVad::RnnVad(const AvailableCpuFeatures& cpu_features)
+    : RnnVad(cpu_features, WeightsPrecision::kFloat) {}
+
+RnnVad::RnnVad(const AvailableCpuFeatures& cpu_features,
+               WeightsPrecision weights_precision)
     : input_(kInputLayerInputSize,
              kInputLayerOutputSize,
              kInputDenseBias,
              kInputDenseWeights,
              ActivationFunction::kTansigApproximated,
              cpu_features,
+             weights_precision,
              /*layer_name=*/"FC1"),
       hidden_(kInputLayerOutputSize,
               kHiddenLayerOutputSize,
@@ -51,14 +56,17 @@ RnnVad::RnnVad(const AvailableCpuFeatures& cpu_features)
               kHiddenGruWeights,
               kHiddenGruRecurrentWeights,
               cpu_features,
+              weights_precision,
               /*layer_name=*/"GRU1"),
       output_(kHiddenLayerOutputSize,
               kOutputLayerOutputSize,
               kOutputDenseBias,
               kOutputDenseWeights,
               ActivationFunction::kSigmoidApproximated,
-              // The output layer is just 24x1. The unoptimized code is faster.
+              // The output layer is just 24x1. The unoptimized code is faster
+              // and the int8 blocks would be mostly padding.
               NoAvailableCpuFeatures(),
+              WeightsPrecision::kFloat,
               /*layer_name=*/"FC2") {
   // Input-output chaining size checks.
   RTC_DCHECK_EQ(input_.size(), hidden_.input_size())
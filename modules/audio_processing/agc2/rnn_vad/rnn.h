@@ -31,6 +31,9 @@ namespace rnn_vad {
 class RnnVad {
  public:
   explicit RnnVad(const AvailableCpuFeatures& cpu_features);
+  // Uses `weights_precision` for the input and the hidden layers.
+  RnnVad(const AvailableCpuFeatures& cpu_features,
+         WeightsPrecision weights_precision);
   RnnVad(const RnnVad&) = delete;
   RnnVad& operator=(const RnnVad&) = delete;
   ~RnnVad();
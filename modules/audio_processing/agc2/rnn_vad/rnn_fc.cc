@@ -14,7 +14,6 @@
 #include <numeric>
 
 #include "rtc_base/checks.h"
-#include "rtc_base/numerics/safe_conversions.h"
 #include "third_party/rnnoise/src/rnn_activations.h"
 #include "third_party/rnnoise/src/rnn_vad_weights.h"
 
@@ -31,25 +30,26 @@ std::vector<float> GetScaledParams(rtc::ArrayView<const int8_t> params) {
   return scaled_params;
 }
 
-// TODO(bugs.chromium.org/10480): Hard-code optimized layout and remove this
-// function to improve setup time.
-// Casts and scales `weights` and re-arranges the layout.
+// Casts and scales `weights`. The layout, `weights[i * output_size + o]`, is
+// that read by `VectorMath::AccumulateMatrixVectorProduct()`.
 std::vector<float> PreprocessWeights(rtc::ArrayView<const int8_t> weights,
-                                     int output_size) {
-  if (output_size == 1) {
-    return GetScaledParams(weights);
+                                     WeightsPrecision weights_precision) {
+  if (weights_precision != WeightsPrecision::kFloat) {
+    return {};
   }
-  // Transpose, scale and cast.
-  const int input_size = rtc::CheckedDivExact(
-      rtc::dchecked_cast<int>(weights.size()), output_size);
-  std::vector<float> w(weights.size());
-  for (int o = 0; o < output_size; ++o) {
-    for (int i = 0; i < input_size; ++i) {
-      w[o * input_size + i] = rnnoise::kWeightsScale *
-                              static_cast<float>(weights[i * output_size + o]);
-    }
+  return GetScaledParams(weights);
+}
+
+std::vector<int8_t> PreprocessQuantizedWeights(
+    rtc::ArrayView<const int8_t> weights,
+    int input_size,
+    int output_size,
+    WeightsPrecision weights_precision) {
+  if (weights_precision != WeightsPrecision::kInt8) {
+    return {};
   }
-  return w;
+  return PackQuantizedWeights(weights, input_size, output_size,
+                              /*stride=*/output_size);
 }
 
 rtc::FunctionView<float(float)> GetActivationFunction(
@@ -71,32 +71,54 @@ FullyConnectedLayer::FullyConnectedLayer(
     const rtc::ArrayView<const int8_t> weights,
     ActivationFunction activation_function,
     const AvailableCpuFeatures& cpu_features,
+    WeightsPrecision weights_precision,
     absl::string_view layer_name)
     : input_size_(input_size),
       output_size_(output_size),
-      bias_(GetScaledParams(bias)),
-      weights_(PreprocessWeights(weights, output_size)),
+      weights_precision_(weights_precision),
+      weights_(PreprocessWeights(weights, weights_precision)),
+      quantized_weights_(PreprocessQuantizedWeights(weights,
+                                                    input_size,
+                                                    output_size,
+                                                    weights_precision)),
       vector_math_(cpu_features),
       activation_function_(GetActivationFunction(activation_function)) {
+  static_assert(kFullyConnectedLayerMaxUnits % kQuantizedBlockSize == 0, "");
   RTC_DCHECK_LE(output_size_, kFullyConnectedLayerMaxUnits)
       << "Insufficient FC layer over-allocation (" << layer_name << ").";
-  RTC_DCHECK_EQ(output_size_, bias_.size())
+  RTC_DCHECK_EQ(output_size_, bias.size())
       << "Mismatching output size and bias terms array size (" << layer_name
       << ").";
-  RTC_DCHECK_EQ(input_size_ * output_size_, weights_.size())
+  RTC_DCHECK_EQ(input_size_ * output_size_, weights.size())
       << "Mismatching input-output size and weight coefficients array size ("
       << layer_name << ").";
+  bias_.fill(0.f);
+  const std::vector<float> scaled_bias = GetScaledParams(bias);
+  std::copy(scaled_bias.begin(), scaled_bias.end(), bias_.begin());
+  if (weights_precision_ == WeightsPrecision::kInt8) {
+    quantized_input_.resize(GetQuantizedNumInputs(input_size_));
+  }
 }
 
 FullyConnectedLayer::~FullyConnectedLayer() = default;
 
 void FullyConnectedLayer::ComputeOutput(rtc::ArrayView<const float> input) {
   RTC_DCHECK_EQ(input.size(), input_size_);
-  rtc::ArrayView<const float> weights(weights_);
+  output_ = bias_;
+  if (weights_precision_ == WeightsPrecision::kInt8) {
+    const float input_scale = QuantizeVector(input, quantized_input_);
+    vector_math_.AccumulateQuantizedMatrixVectorProduct(
+        quantized_input_, quantized_weights_,
+        input_scale * ::rnnoise::kWeightsScale,
+        {output_.data(), static_cast<size_t>(
+                             GetQuantizedNumOutputs(output_size_))});
+  } else {
+    vector_math_.AccumulateMatrixVectorProduct(
+        input, weights_, /*stride=*/output_size_,
+        {output_.data(), static_cast<size_t>(output_size_)});
+  }
   for (int o = 0; o < output_size_; ++o) {
-    output_[o] = activation_function_(
-        bias_[o] + vector_math_.DotProduct(
-                       input, weights.subview(o * input_size_, input_size_)));
+    output_[o] = activation_function_(output_[o]);
   }
 }
 
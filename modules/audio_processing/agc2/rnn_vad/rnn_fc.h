@@ -18,6 +18,7 @@
 #include "api/array_view.h"
 #include "api/function_view.h"
 #include "modules/audio_processing/agc2/cpu_features.h"
+#include "modules/audio_processing/agc2/rnn_vad/common.h"
 #include "modules/audio_processing/agc2/rnn_vad/vector_math.h"
 
 namespace webrtc {
@@ -40,6 +41,7 @@ class FullyConnectedLayer {
                       rtc::ArrayView<const int8_t> weights,
                       ActivationFunction activation_function,
                       const AvailableCpuFeatures& cpu_features,
+                      WeightsPrecision weights_precision,
                       absl::string_view layer_name);
   FullyConnectedLayer(const FullyConnectedLayer&) = delete;
   FullyConnectedLayer& operator=(const FullyConnectedLayer&) = delete;
@@ -58,8 +60,16 @@ class FullyConnectedLayer {
  private:
   const int input_size_;
   const int output_size_;
-  const std::vector<float> bias_;
+  const WeightsPrecision weights_precision_;
+  // Over-allocated array with size equal to `output_size_`.
+  std::array<float, kFullyConnectedLayerMaxUnits> bias_;
+  // Weights laid out as `weights[i * output_size + o]`; empty with int8
+  // precision.
   const std::vector<float> weights_;
+  // Weights packed by `PackQuantizedWeights()`; empty with float precision.
+  const std::vector<int8_t> quantized_weights_;
+  // Buffer for the quantized input; empty with float precision.
+  std::vector<int16_t> quantized_input_;
   const VectorMath vector_math_;
   rtc::FunctionView<float(float)> activation_function_;
   // Over-allocated array with size equal to `output_size_`.
@@ -56,16 +56,30 @@ TEST_P(RnnFcParametrization, CheckFullyConnectedLayerOutput) {
                          kInputDenseBias, kInputDenseWeights,
                          ActivationFunction::kTansigApproximated,
                          /*cpu_features=*/GetParam(),
+                         WeightsPrecision::kFloat,
                          /*layer_name=*/"FC");
   fc.ComputeOutput(kFullyConnectedInputVector);
   ExpectNearAbsolute(kFullyConnectedExpectedOutput, fc, 1e-5f);
 }
 
+// Checks that the output of a fully connected layer with int8 weights is within
+// tolerance given test input data.
+TEST_P(RnnFcParametrization, CheckFullyConnectedLayerOutputWithInt8Weights) {
+  FullyConnectedLayer fc(kInputLayerInputSize, kInputLayerOutputSize,
+                         kInputDenseBias, kInputDenseWeights,
+                         ActivationFunction::kTansigApproximated,
+                         /*cpu_features=*/GetParam(), WeightsPrecision::kInt8,
+                         /*layer_name=*/"FC");
+  fc.ComputeOutput(kFullyConnectedInputVector);
+  ExpectNearAbsolute(kFullyConnectedExpectedOutput, fc, 1e-3f);
+}
+
 TEST_P(RnnFcParametrization, DISABLED_BenchmarkFullyConnectedLayer) {
   const AvailableCpuFeatures cpu_features = GetParam();
   FullyConnectedLayer fc(kInputLayerInputSize, kInputLayerOutputSize,
                          kInputDenseBias, kInputDenseWeights,
                          ActivationFunction::kTansigApproximated, cpu_features,
+                         WeightsPrecision::kFloat,
                          /*layer_name=*/"FC");
 
   constexpr int kNumTests = 10000;
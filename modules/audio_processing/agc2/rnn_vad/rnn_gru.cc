@@ -10,6 +10,8 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/rnn_gru.h"
 
+#include <algorithm>
+
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "third_party/rnnoise/src/rnn_activations.h"
@@ -19,104 +21,42 @@ namespace webrtc {
 namespace rnn_vad {
 namespace {
 
-constexpr int kNumGruGates = 3;  // Update, reset, output.
-
-std::vector<float> PreprocessGruTensor(rtc::ArrayView<const int8_t> tensor_src,
-                                       int output_size) {
-  // Transpose, cast and scale.
-  // `n` is the size of the first dimension of the 3-dim tensor `weights`.
-  const int n = rtc::CheckedDivExact(rtc::dchecked_cast<int>(tensor_src.size()),
-                                     output_size * kNumGruGates);
-  const int stride_src = kNumGruGates * output_size;
-  const int stride_dst = n * output_size;
-  std::vector<float> tensor_dst(tensor_src.size());
-  for (int g = 0; g < kNumGruGates; ++g) {
-    for (int o = 0; o < output_size; ++o) {
-      for (int i = 0; i < n; ++i) {
-        tensor_dst[g * stride_dst + o * n + i] =
-            ::rnnoise::kWeightsScale *
-            static_cast<float>(
-                tensor_src[i * stride_src + g * output_size + o]);
-      }
-    }
+// Casts and scales `tensor`. The layout, `tensor[i * stride + g * output_size +
+// o]` with `stride = kNumGruGates * output_size`, is kept since it is the one
+// read by `VectorMath::AccumulateMatrixVectorProduct()` for each gate `g`.
+std::vector<float> PreprocessGruTensor(rtc::ArrayView<const int8_t> tensor,
+                                       WeightsPrecision weights_precision) {
+  if (weights_precision != WeightsPrecision::kFloat) {
+    return {};
   }
+  std::vector<float> tensor_dst(tensor.size());
+  std::transform(tensor.begin(), tensor.end(), tensor_dst.begin(),
+                 [](int8_t x) -> float {
+                   return ::rnnoise::kWeightsScale * static_cast<float>(x);
+                 });
   return tensor_dst;
 }
 
-// Computes the output for the update or the reset gate.
-// Operation: `g = sigmoid(W^T∙i + R^T∙s + b)` where
-// - `g`: output gate vector
-// - `W`: weights matrix
-// - `i`: input vector
-// - `R`: recurrent weights matrix
-// - `s`: state gate vector
-// - `b`: bias vector
-void ComputeUpdateResetGate(int input_size,
-                            int output_size,
-                            const VectorMath& vector_math,
-                            rtc::ArrayView<const float> input,
-                            rtc::ArrayView<const float> state,
-                            rtc::ArrayView<const float> bias,
-                            rtc::ArrayView<const float> weights,
-                            rtc::ArrayView<const float> recurrent_weights,
-                            rtc::ArrayView<float> gate) {
-  RTC_DCHECK_EQ(input.size(), input_size);
-  RTC_DCHECK_EQ(state.size(), output_size);
-  RTC_DCHECK_EQ(bias.size(), output_size);
-  RTC_DCHECK_EQ(weights.size(), input_size * output_size);
-  RTC_DCHECK_EQ(recurrent_weights.size(), output_size * output_size);
-  RTC_DCHECK_GE(gate.size(), output_size);  // `gate` is over-allocated.
-  for (int o = 0; o < output_size; ++o) {
-    float x = bias[o];
-    x += vector_math.DotProduct(input,
-                                weights.subview(o * input_size, input_size));
-    x += vector_math.DotProduct(
-        state, recurrent_weights.subview(o * output_size, output_size));
-    gate[o] = ::rnnoise::SigmoidApproximated(x);
-  }
-}
-
-// Computes the output for the state gate.
-// Operation: `s' = u .* s + (1 - u) .* ReLU(W^T∙i + R^T∙(s .* r) + b)` where
-// - `s'`: output state gate vector
-// - `s`: previous state gate vector
-// - `u`: update gate vector
-// - `W`: weights matrix
-// - `i`: input vector
-// - `R`: recurrent weights matrix
-// - `r`: reset gate vector
-// - `b`: bias vector
-// - `.*` element-wise product
-void ComputeStateGate(int input_size,
-                      int output_size,
-                      const VectorMath& vector_math,
-                      rtc::ArrayView<const float> input,
-                      rtc::ArrayView<const float> update,
-                      rtc::ArrayView<const float> reset,
-                      rtc::ArrayView<const float> bias,
-                      rtc::ArrayView<const float> weights,
-                      rtc::ArrayView<const float> recurrent_weights,
-                      rtc::ArrayView<float> state) {
-  RTC_DCHECK_EQ(input.size(), input_size);
-  RTC_DCHECK_GE(update.size(), output_size);  // `update` is over-allocated.
-  RTC_DCHECK_GE(reset.size(), output_size);   // `reset` is over-allocated.
-  RTC_DCHECK_EQ(bias.size(), output_size);
-  RTC_DCHECK_EQ(weights.size(), input_size * output_size);
-  RTC_DCHECK_EQ(recurrent_weights.size(), output_size * output_size);
-  RTC_DCHECK_EQ(state.size(), output_size);
-  std::array<float, kGruLayerMaxUnits> reset_x_state;
-  for (int o = 0; o < output_size; ++o) {
-    reset_x_state[o] = state[o] * reset[o];
+// Packs the weights of each gate in `tensor` with `PackQuantizedWeights()` and
+// concatenates them.
+std::vector<int8_t> PreprocessQuantizedGruTensor(
+    rtc::ArrayView<const int8_t> tensor,
+    int output_size,
+    WeightsPrecision weights_precision) {
+  if (weights_precision != WeightsPrecision::kInt8) {
+    return {};
   }
-  for (int o = 0; o < output_size; ++o) {
-    float x = bias[o];
-    x += vector_math.DotProduct(input,
-                                weights.subview(o * input_size, input_size));
-    x += vector_math.DotProduct(
-        {reset_x_state.data(), static_cast<size_t>(output_size)},
-        recurrent_weights.subview(o * output_size, output_size));
-    state[o] = update[o] * state[o] + (1.f - update[o]) * std::max(0.f, x);
+  // `n` is the size of the first dimension of the 3-dim tensor `weights`.
+  const int n = rtc::CheckedDivExact(rtc::dchecked_cast<int>(tensor.size()),
+                                     output_size * kNumGruGates);
+  std::vector<int8_t> tensor_dst;
+  for (int g = 0; g < kNumGruGates; ++g) {
+    const std::vector<int8_t> gate =
+        PackQuantizedWeights(tensor.subview(g * output_size), n, output_size,
+                             /*stride=*/kNumGruGates * output_size);
+    tensor_dst.insert(tensor_dst.end(), gate.begin(), gate.end());
   }
+  return tensor_dst;
 }
 
 }  // namespace
@@ -128,26 +68,47 @@ GatedRecurrentLayer::GatedRecurrentLayer(
     const rtc::ArrayView<const int8_t> weights,
     const rtc::ArrayView<const int8_t> recurrent_weights,
     const AvailableCpuFeatures& cpu_features,
+    WeightsPrecision weights_precision,
     absl::string_view layer_name)
     : input_size_(input_size),
       output_size_(output_size),
-      bias_(PreprocessGruTensor(bias, output_size)),
-      weights_(PreprocessGruTensor(weights, output_size)),
-      recurrent_weights_(PreprocessGruTensor(recurrent_weights, output_size)),
+      weights_precision_(weights_precision),
+      weights_(PreprocessGruTensor(weights, weights_precision)),
+      recurrent_weights_(
+          PreprocessGruTensor(recurrent_weights, weights_precision)),
+      quantized_weights_(PreprocessQuantizedGruTensor(weights,
+                                                      output_size,
+                                                      weights_precision)),
+      quantized_recurrent_weights_(
+          PreprocessQuantizedGruTensor(recurrent_weights,
+                                       output_size,
+                                       weights_precision)),
       vector_math_(cpu_features) {
+  static_assert(kGruLayerMaxUnits % kQuantizedBlockSize == 0, "");
   RTC_DCHECK_LE(output_size_, kGruLayerMaxUnits)
       << "Insufficient GRU layer over-allocation (" << layer_name << ").";
-  RTC_DCHECK_EQ(kNumGruGates * output_size_, bias_.size())
+  RTC_DCHECK_EQ(kNumGruGates * output_size_, bias.size())
       << "Mismatching output size and bias terms array size (" << layer_name
       << ").";
-  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_, weights_.size())
+  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_, weights.size())
       << "Mismatching input-output size and weight coefficients array size ("
       << layer_name << ").";
   RTC_DCHECK_EQ(kNumGruGates * output_size_ * output_size_,
-                recurrent_weights_.size())
+                recurrent_weights.size())
       << "Mismatching input-output size and recurrent weight coefficients array"
          " size ("
       << layer_name << ").";
+  for (int g = 0; g < kNumGruGates; ++g) {
+    bias_[g].fill(0.f);
+    for (int o = 0; o < output_size_; ++o) {
+      bias_[g][o] = ::rnnoise::kWeightsScale *
+                    static_cast<float>(bias[g * output_size_ + o]);
+    }
+  }
+  if (weights_precision_ == WeightsPrecision::kInt8) {
+    quantized_x_.resize(
+        GetQuantizedNumInputs(std::max(input_size_, output_size_)));
+  }
   Reset();
 }
 
@@ -157,41 +118,81 @@ void GatedRecurrentLayer::Reset() {
   state_.fill(0.f);
 }
 
+void GatedRecurrentLayer::AccumulateGates(rtc::ArrayView<const float> x,
+                                          bool recurrent,
+                                          int first_gate,
+                                          int last_gate,
+                                          Gates& gates) {
+  const int x_size = rtc::dchecked_cast<int>(x.size());
+  if (weights_precision_ == WeightsPrecision::kInt8) {
+    const int quantized_x_size = GetQuantizedNumInputs(x_size);
+    const int quantized_output_size = GetQuantizedNumOutputs(output_size_);
+    rtc::ArrayView<const int16_t> quantized_x(quantized_x_.data(),
+                                              quantized_x_size);
+    const float x_scale = QuantizeVector(
+        x, rtc::ArrayView<int16_t>(quantized_x_.data(), quantized_x_size));
+    rtc::ArrayView<const int8_t> weights(recurrent
+                                             ? quantized_recurrent_weights_
+                                             : quantized_weights_);
+    const int stride_weights = quantized_x_size * quantized_output_size;
+    for (int g = first_gate; g < last_gate; ++g) {
+      vector_math_.AccumulateQuantizedMatrixVectorProduct(
+          quantized_x, weights.subview(g * stride_weights, stride_weights),
+          x_scale * ::rnnoise::kWeightsScale,
+          {gates[g].data(), static_cast<size_t>(quantized_output_size)});
+    }
+    return;
+  }
+  rtc::ArrayView<const float> weights(recurrent ? recurrent_weights_
+                                                : weights_);
+  for (int g = first_gate; g < last_gate; ++g) {
+    vector_math_.AccumulateMatrixVectorProduct(
+        x, weights.subview(g * output_size_),
+        /*stride=*/kNumGruGates * output_size_,
+        {gates[g].data(), static_cast<size_t>(output_size_)});
+  }
+}
+
+// Operations:
+// - update and reset gates: `g = sigmoid(W^T∙i + R^T∙s + b)`;
+// - state gate: `s' = u .* s + (1 - u) .* ReLU(W^T∙i + R^T∙(s .* r) + b)`;
+// where
+// - `g`: output gate vector
+// - `W`: weights matrix
+// - `i`: input vector
+// - `R`: recurrent weights matrix
+// - `s`: state gate vector
+// - `s'`: output state gate vector
+// - `u`: update gate vector
+// - `r`: reset gate vector
+// - `b`: bias vector
+// - `.*` element-wise product
 void GatedRecurrentLayer::ComputeOutput(rtc::ArrayView<const float> input) {
   RTC_DCHECK_EQ(input.size(), input_size_);
-
-  // The tensors below are organized as a sequence of flattened tensors for the
-  // `update`, `reset` and `state` gates.
-  rtc::ArrayView<const float> bias(bias_);
-  rtc::ArrayView<const float> weights(weights_);
-  rtc::ArrayView<const float> recurrent_weights(recurrent_weights_);
-  // Strides to access to the flattened tensors for a specific gate.
-  const int stride_weights = input_size_ * output_size_;
-  const int stride_recurrent_weights = output_size_ * output_size_;
+  constexpr int kUpdate = 0;
+  constexpr int kReset = 1;
+  constexpr int kOutput = 2;
 
   rtc::ArrayView<float> state(state_.data(), output_size_);
+  Gates gates = bias_;
+  AccumulateGates(input, /*recurrent=*/false, kUpdate, kNumGruGates, gates);
+  AccumulateGates(state, /*recurrent=*/true, kUpdate, kOutput, gates);
+  for (int o = 0; o < output_size_; ++o) {
+    gates[kUpdate][o] = ::rnnoise::SigmoidApproximated(gates[kUpdate][o]);
+    gates[kReset][o] = ::rnnoise::SigmoidApproximated(gates[kReset][o]);
+  }
 
-  // Update gate.
-  std::array<float, kGruLayerMaxUnits> update;
-  ComputeUpdateResetGate(
-      input_size_, output_size_, vector_math_, input, state,
-      bias.subview(0, output_size_), weights.subview(0, stride_weights),
-      recurrent_weights.subview(0, stride_recurrent_weights), update);
-  // Reset gate.
-  std::array<float, kGruLayerMaxUnits> reset;
-  ComputeUpdateResetGate(input_size_, output_size_, vector_math_, input, state,
-                         bias.subview(output_size_, output_size_),
-                         weights.subview(stride_weights, stride_weights),
-                         recurrent_weights.subview(stride_recurrent_weights,
-                                                   stride_recurrent_weights),
-                         reset);
-  // State gate.
-  ComputeStateGate(input_size_, output_size_, vector_math_, input, update,
-                   reset, bias.subview(2 * output_size_, output_size_),
-                   weights.subview(2 * stride_weights, stride_weights),
-                   recurrent_weights.subview(2 * stride_recurrent_weights,
-                                             stride_recurrent_weights),
-                   state);
+  std::array<float, kGruLayerMaxUnits> reset_x_state;
+  for (int o = 0; o < output_size_; ++o) {
+    reset_x_state[o] = state[o] * gates[kReset][o];
+  }
+  AccumulateGates({reset_x_state.data(), static_cast<size_t>(output_size_)},
+                  /*recurrent=*/true, kOutput, kNumGruGates, gates);
+  for (int o = 0; o < output_size_; ++o) {
+    const float update = gates[kUpdate][o];
+    state[o] =
+        update * state[o] + (1.f - update) * std::max(0.f, gates[kOutput][o]);
+  }
 }
 
 }  // namespace rnn_vad
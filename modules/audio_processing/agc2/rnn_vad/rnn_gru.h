@@ -17,6 +17,7 @@
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "modules/audio_processing/agc2/cpu_features.h"
+#include "modules/audio_processing/agc2/rnn_vad/common.h"
 #include "modules/audio_processing/agc2/rnn_vad/vector_math.h"
 
 namespace webrtc {
@@ -24,6 +25,8 @@ namespace rnn_vad {
 
 // Maximum number of units for a GRU layer.
 constexpr int kGruLayerMaxUnits = 24;
+// Number of gates of a GRU layer (update, reset, output).
+constexpr int kNumGruGates = 3;
 
 // Recurrent layer with gated recurrent units (GRUs) with sigmoid and ReLU as
 // activation functions for the update/reset and output gates respectively.
@@ -36,6 +39,7 @@ class GatedRecurrentLayer {
                       rtc::ArrayView<const int8_t> weights,
                       rtc::ArrayView<const int8_t> recurrent_weights,
                       const AvailableCpuFeatures& cpu_features,
+                      WeightsPrecision weights_precision,
                       absl::string_view layer_name);
   GatedRecurrentLayer(const GatedRecurrentLayer&) = delete;
   GatedRecurrentLayer& operator=(const GatedRecurrentLayer&) = delete;
@@ -54,11 +58,32 @@ class GatedRecurrentLayer {
   void ComputeOutput(rtc::ArrayView<const float> input);
 
  private:
+  // Over-allocated arrays with size equal to `output_size_`, one per gate.
+  using Gates = std::array<std::array<float, kGruLayerMaxUnits>, kNumGruGates>;
+
+  // Adds to `gates[g]`, for each gate `g` in [`first_gate`, `last_gate`), the
+  // product between `x` and the weights of `g`, which are the recurrent ones
+  // if `recurrent` is true.
+  void AccumulateGates(rtc::ArrayView<const float> x,
+                       bool recurrent,
+                       int first_gate,
+                       int last_gate,
+                       Gates& gates);
+
   const int input_size_;
   const int output_size_;
-  const std::vector<float> bias_;
+  const WeightsPrecision weights_precision_;
+  Gates bias_;
+  // Weights laid out as `weights[i * kNumGruGates * output_size + g *
+  // output_size + o]`; empty with int8 precision.
   const std::vector<float> weights_;
   const std::vector<float> recurrent_weights_;
+  // Weights packed gate by gate by `PackQuantizedWeights()`; empty with float
+  // precision.
+  const std::vector<int8_t> quantized_weights_;
+  const std::vector<int8_t> quantized_recurrent_weights_;
+  // Buffer for the quantized input or state; empty with float precision.
+  std::vector<int16_t> quantized_x_;
   const VectorMath vector_math_;
   // Over-allocated array with size equal to `output_size_`.
   std::array<float, kGruLayerMaxUnits> state_;
@@ -29,7 +29,8 @@ namespace {
 void TestGatedRecurrentLayer(
     GatedRecurrentLayer& gru,
     rtc::ArrayView<const float> input_sequence,
-    rtc::ArrayView<const float> expected_output_sequence) {
+    rtc::ArrayView<const float> expected_output_sequence,
+    float tolerance) {
   const int input_sequence_length = rtc::CheckedDivExact(
       rtc::dchecked_cast<int>(input_sequence.size()), gru.input_size());
   const int output_sequence_length = rtc::CheckedDivExact(
@@ -44,7 +45,7 @@ void TestGatedRecurrentLayer(
         input_sequence.subview(i * gru.input_size(), gru.input_size()));
     const auto expected_output =
         expected_output_sequence.subview(i * gru.size(), gru.size());
-    ExpectNearAbsolute(expected_output, gru, 3e-6f);
+    ExpectNearAbsolute(expected_output, gru, tolerance);
   }
 }
 
@@ -113,8 +114,21 @@ TEST_P(RnnGruParametrization, CheckGatedRecurrentLayer) {
   GatedRecurrentLayer gru(kGruInputSize, kGruOutputSize, kGruBias, kGruWeights,
                           kGruRecurrentWeights,
                           /*cpu_features=*/GetParam(),
+                          WeightsPrecision::kFloat,
                           /*layer_name=*/"GRU");
-  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence);
+  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence,
+                          /*tolerance=*/3e-6f);
+}
+
+// Checks that the output of a GRU layer with int8 weights is within tolerance
+// given test input data.
+TEST_P(RnnGruParametrization, CheckGatedRecurrentLayerWithInt8Weights) {
+  GatedRecurrentLayer gru(kGruInputSize, kGruOutputSize, kGruBias, kGruWeights,
+                          kGruRecurrentWeights,
+                          /*cpu_features=*/GetParam(), WeightsPrecision::kInt8,
+                          /*layer_name=*/"GRU");
+  TestGatedRecurrentLayer(gru, kGruInputSequence, kGruExpectedOutputSequence,
+                          /*tolerance=*/1e-4f);
 }
 
 TEST_P(RnnGruParametrization, DISABLED_BenchmarkGatedRecurrentLayer) {
@@ -133,6 +147,7 @@ TEST_P(RnnGruParametrization, DISABLED_BenchmarkGatedRecurrentLayer) {
                           kHiddenGruBias, kHiddenGruWeights,
                           kHiddenGruRecurrentWeights,
                           /*cpu_features=*/GetParam(),
+                          WeightsPrecision::kFloat,
                           /*layer_name=*/"GRU");
 
   rtc::ArrayView<const float> input_sequence(gru_input_sequence);
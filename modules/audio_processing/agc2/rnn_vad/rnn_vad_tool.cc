@@ -26,6 +26,7 @@
 ABSL_FLAG(std::string, i, "", "Path to the input wav file");
 ABSL_FLAG(std::string, f, "", "Path to the output features file");
 ABSL_FLAG(std::string, o, "", "Path to the output VAD probabilities file");
+ABSL_FLAG(bool, int8_weights, false, "Use the int8 weights of the RNN");
 
 namespace webrtc {
 namespace rnn_vad {
@@ -67,7 +68,9 @@ int main(int argc, char* argv[]) {
   const AvailableCpuFeatures cpu_features = GetAvailableCpuFeatures();
   FeaturesExtractor features_extractor(cpu_features);
   std::array<float, kFeatureVectorSize> feature_vector;
-  RnnVad rnn_vad(cpu_features);
+  RnnVad rnn_vad(cpu_features, absl::GetFlag(FLAGS_int8_weights)
+                                   ? WeightsPrecision::kInt8
+                                   : WeightsPrecision::kFloat);
 
   // Compute VAD probabilities.
   while (true) {
@@ -108,6 +108,41 @@ TEST_P(RnnVadProbabilityParametrization, RnnVadProbabilityWithinTolerance) {
   }
 }
 
+// Checks that the VAD probability computed with int8 weights for a test input
+// sequence is close to that computed with float weights.
+TEST_P(RnnVadProbabilityParametrization, Int8WeightsCloseToFloatWeights) {
+  PushSincResampler decimator(kFrameSize10ms48kHz, kFrameSize10ms24kHz);
+  const AvailableCpuFeatures cpu_features = GetParam();
+  FeaturesExtractor features_extractor(cpu_features);
+  RnnVad float_rnn_vad(cpu_features, WeightsPrecision::kFloat);
+  RnnVad int8_rnn_vad(cpu_features, WeightsPrecision::kInt8);
+
+  std::unique_ptr<FileReader> samples_reader = CreatePcmSamplesReader();
+  // The last incomplete frame is ignored.
+  const int num_frames = samples_reader->size() / kFrameSize10ms48kHz;
+  std::vector<float> samples_48k(kFrameSize10ms48kHz);
+  std::vector<float> samples_24k(kFrameSize10ms24kHz);
+  std::vector<float> feature_vector(kFeatureVectorSize);
+
+  float cumulative_error = 0.f;
+  for (int i = 0; i < num_frames; ++i) {
+    ASSERT_TRUE(samples_reader->ReadChunk(samples_48k));
+    decimator.Resample(samples_48k.data(), samples_48k.size(),
+                       samples_24k.data(), samples_24k.size());
+    bool is_silence = features_extractor.CheckSilenceComputeFeatures(
+        {samples_24k.data(), kFrameSize10ms24kHz},
+        {feature_vector.data(), kFeatureVectorSize});
+    const float float_vad_prob = float_rnn_vad.ComputeVadProbability(
+        {feature_vector.data(), kFeatureVectorSize}, is_silence);
+    const float int8_vad_prob = int8_rnn_vad.ComputeVadProbability(
+        {feature_vector.data(), kFeatureVectorSize}, is_silence);
+    EXPECT_NEAR(int8_vad_prob, float_vad_prob, 5e-3f);
+    cumulative_error += std::abs(int8_vad_prob - float_vad_prob);
+  }
+  // Check average error.
+  EXPECT_LT(cumulative_error / num_frames, 2e-4f);
+}
+
 // Performance test for the RNN VAD (pre-fetching and downsampling are
 // excluded). Keep disabled and only enable locally to measure performance as
 // follows:
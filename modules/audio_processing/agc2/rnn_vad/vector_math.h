@@ -21,7 +21,12 @@
 #include <emmintrin.h>
 #endif
 
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <vector>
 
 #include "api/array_view.h"
 #include "modules/audio_processing/agc2/cpu_features.h"
@@ -32,6 +37,78 @@
 namespace webrtc {
 namespace rnn_vad {
 
+// Number of outputs that `VectorMath::AccumulateQuantizedMatrixVectorProduct()`
+// computes at once.
+constexpr int kQuantizedBlockSize = 8;
+
+// Returns the number of inputs and outputs of a quantized matrix with
+// `num_inputs` inputs and `num_outputs` outputs once zero-padded.
+constexpr int GetQuantizedNumInputs(int num_inputs) {
+  return (num_inputs + 1) & ~1;
+}
+constexpr int GetQuantizedNumOutputs(int num_outputs) {
+  return (num_outputs + kQuantizedBlockSize - 1) / kQuantizedBlockSize *
+         kQuantizedBlockSize;
+}
+
+// Packs the `num_inputs` x `num_outputs` matrix `w` with elements
+// `w[i][o] = weights[i * stride + o]` into the layout read by
+// `VectorMath::AccumulateQuantizedMatrixVectorProduct()`. The inputs are
+// zero-padded to an even number and the outputs to a multiple of
+// `kQuantizedBlockSize`. Each block of outputs is stored as a sequence of
+// pairs of consecutive inputs, and each pair interleaves the two inputs for
+// every output of the block.
+inline std::vector<int8_t> PackQuantizedWeights(
+    rtc::ArrayView<const int8_t> weights,
+    int num_inputs,
+    int num_outputs,
+    int stride) {
+  RTC_DCHECK_GE(stride, num_outputs);
+  RTC_DCHECK_GE(weights.size(), (num_inputs - 1) * stride + num_outputs);
+  const int padded_num_inputs = GetQuantizedNumInputs(num_inputs);
+  const int padded_num_outputs = GetQuantizedNumOutputs(num_outputs);
+  std::vector<int8_t> packed(padded_num_inputs * padded_num_outputs, 0);
+  for (int i = 0; i < num_inputs; ++i) {
+    for (int o = 0; o < num_outputs; ++o) {
+      const int block = o / kQuantizedBlockSize;
+      const int lane = o % kQuantizedBlockSize;
+      packed[(block * padded_num_inputs + (i & ~1)) * kQuantizedBlockSize +
+             2 * lane + (i & 1)] = weights[i * stride + o];
+    }
+  }
+  return packed;
+}
+
+// Quantizes `x` into `x_quantized` with a scale factor shared by all the
+// elements so that `x[i]` is approximately `scale * x_quantized[i]` and
+// returns the scale factor. The elements of `x_quantized` past the size of
+// `x` are set to zero.
+inline float QuantizeVector(rtc::ArrayView<const float> x,
+                            rtc::ArrayView<int16_t> x_quantized) {
+  RTC_DCHECK_GE(x_quantized.size(), x.size());
+  float max_abs = 0.f;
+  for (float v : x) {
+    max_abs = std::max(max_abs, std::fabs(v));
+  }
+  constexpr float kMaxQuantizedValue = 32767.f;
+  const float inverse_scale =
+      max_abs > 0.f ? kMaxQuantizedValue / max_abs : 0.f;
+  for (size_t i = 0; i < x.size(); ++i) {
+    x_quantized[i] = static_cast<int16_t>(std::lrintf(x[i] * inverse_scale));
+  }
+  std::fill(x_quantized.begin() + x.size(), x_quantized.end(), 0);
+  return max_abs / kMaxQuantizedValue;
+}
+
+// Returns `x0` and `x1` packed into a 32 bit integer with `x0` in the lower
+// half, which is the layout of a pair of 16 bit inputs read by
+// `_mm_madd_epi16()`.
+inline int32_t PackInt16Pair(int16_t x0, int16_t x1) {
+  return static_cast<int32_t>(
+      static_cast<uint16_t>(x0) |
+      (static_cast<uint32_t>(static_cast<uint16_t>(x1)) << 16));
+}
+
 // Provides optimizations for mathematical operations having vectors as
 // operand(s).
 class VectorMath {
@@ -101,9 +178,161 @@ class VectorMath {
     return std::inner_product(x.begin(), x.end(), y.begin(), 0.f);
   }
 
+  // Adds to `y` the product between `x` and the `x.size()` x `y.size()` matrix
+  // `w` with elements `w[i][o] = weights[i * stride + o]`; namely, computes
+  // `y[o] += sum_i x[i] * w[i][o]`. Since the outputs are computed side by
+  // side, no horizontal reduction is needed.
+  void AccumulateMatrixVectorProduct(rtc::ArrayView<const float> x,
+                                     rtc::ArrayView<const float> weights,
+                                     int stride,
+                                     rtc::ArrayView<float> y) const {
+    const int x_size = rtc::dchecked_cast<int>(x.size());
+    const int y_size = rtc::dchecked_cast<int>(y.size());
+    RTC_DCHECK_GT(x_size, 0);
+    RTC_DCHECK_GE(stride, y_size);
+    RTC_DCHECK_GE(weights.size(), (x_size - 1) * stride + y_size);
+    int o = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    if (cpu_features_.avx2) {
+      o = AccumulateMatrixVectorProductAvx2(x, weights, stride, y);
+    } else if (cpu_features_.sse2) {
+      constexpr int kBlockSize = 4;
+      for (; o + kBlockSize <= y_size; o += kBlockSize) {
+        __m128 accumulator = _mm_loadu_ps(&y[o]);
+        for (int i = 0; i < x_size; ++i) {
+          const __m128 w_i = _mm_loadu_ps(&weights[i * stride + o]);
+          accumulator =
+              _mm_add_ps(accumulator, _mm_mul_ps(_mm_set1_ps(x[i]), w_i));
+        }
+        _mm_storeu_ps(&y[o], accumulator);
+      }
+    }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    if (cpu_features_.neon) {
+      constexpr int kBlockSize = 4;
+      for (; o + kBlockSize <= y_size; o += kBlockSize) {
+        float32x4_t accumulator = vld1q_f32(&y[o]);
+        for (int i = 0; i < x_size; ++i) {
+          const float32x4_t w_i = vld1q_f32(&weights[i * stride + o]);
+          accumulator = vfmaq_n_f32(accumulator, w_i, x[i]);
+        }
+        vst1q_f32(&y[o], accumulator);
+      }
+    }
+#endif
+    // Compute the outputs left. The inner loop reads the weights sequentially
+    // and has no loop-carried dependency.
+    for (int i = 0; i < x_size; ++i) {
+      for (int k = o; k < y_size; ++k) {
+        y[k] += x[i] * weights[i * stride + k];
+      }
+    }
+  }
+
+  // Same as `AccumulateMatrixVectorProduct()`, but with integer operands:
+  // computes `y[o] += scale * sum_i x[i] * w[i][o]` where `packed_weights` is
+  // the output of `PackQuantizedWeights()`. The sizes of `x` and `y` must be
+  // those of the zero-padded matrix. The products are accumulated into 32 bit
+  // integers, which cannot overflow for up to 256 inputs.
+  void AccumulateQuantizedMatrixVectorProduct(
+      rtc::ArrayView<const int16_t> x,
+      rtc::ArrayView<const int8_t> packed_weights,
+      float scale,
+      rtc::ArrayView<float> y) const {
+    const int x_size = rtc::dchecked_cast<int>(x.size());
+    const int y_size = rtc::dchecked_cast<int>(y.size());
+    RTC_DCHECK_EQ(x_size % 2, 0);
+    RTC_DCHECK_LE(x_size, 256);
+    RTC_DCHECK_EQ(y_size % kQuantizedBlockSize, 0);
+    RTC_DCHECK_EQ(packed_weights.size(), x_size * y_size);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    if (cpu_features_.avx2) {
+      AccumulateQuantizedMatrixVectorProductAvx2(x, packed_weights, scale, y);
+      return;
+    } else if (cpu_features_.sse2) {
+      const __m128 scale_v = _mm_set1_ps(scale);
+      const int8_t* w = packed_weights.data();
+      for (int o = 0; o < y_size; o += kQuantizedBlockSize) {
+        __m128i accumulator_low = _mm_setzero_si128();
+        __m128i accumulator_high = _mm_setzero_si128();
+        for (int i = 0; i < x_size; i += 2, w += 2 * kQuantizedBlockSize) {
+          const __m128i x_i = _mm_set1_epi32(PackInt16Pair(x[i], x[i + 1]));
+          const __m128i w_i =
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(w));
+          // Sign-extend the weights to 16 bits.
+          const __m128i w_low = _mm_srai_epi16(_mm_unpacklo_epi8(w_i, w_i), 8);
+          const __m128i w_high = _mm_srai_epi16(_mm_unpackhi_epi8(w_i, w_i), 8);
+          accumulator_low =
+              _mm_add_epi32(accumulator_low, _mm_madd_epi16(w_low, x_i));
+          accumulator_high =
+              _mm_add_epi32(accumulator_high, _mm_madd_epi16(w_high, x_i));
+        }
+        const __m128 y_low =
+            _mm_mul_ps(scale_v, _mm_cvtepi32_ps(accumulator_low));
+        const __m128 y_high =
+            _mm_mul_ps(scale_v, _mm_cvtepi32_ps(accumulator_high));
+        _mm_storeu_ps(&y[o], _mm_add_ps(_mm_loadu_ps(&y[o]), y_low));
+        _mm_storeu_ps(&y[o + 4], _mm_add_ps(_mm_loadu_ps(&y[o + 4]), y_high));
+      }
+      return;
+    }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    if (cpu_features_.neon) {
+      const int8_t* w = packed_weights.data();
+      for (int o = 0; o < y_size; o += kQuantizedBlockSize) {
+        int32x4_t accumulator_low = vdupq_n_s32(0);
+        int32x4_t accumulator_high = vdupq_n_s32(0);
+        for (int i = 0; i < x_size; i += 2, w += 2 * kQuantizedBlockSize) {
+          // De-interleave the weights of the two inputs.
+          const int8x8x2_t w_i = vld2_s8(w);
+          const int16x8_t w_0 = vmovl_s8(w_i.val[0]);
+          const int16x8_t w_1 = vmovl_s8(w_i.val[1]);
+          accumulator_low =
+              vmlal_n_s16(accumulator_low, vget_low_s16(w_0), x[i]);
+          accumulator_low =
+              vmlal_n_s16(accumulator_low, vget_low_s16(w_1), x[i + 1]);
+          accumulator_high =
+              vmlal_n_s16(accumulator_high, vget_high_s16(w_0), x[i]);
+          accumulator_high =
+              vmlal_n_s16(accumulator_high, vget_high_s16(w_1), x[i + 1]);
+        }
+        vst1q_f32(&y[o], vmlaq_n_f32(vld1q_f32(&y[o]),
+                                     vcvtq_f32_s32(accumulator_low), scale));
+        vst1q_f32(&y[o + 4], vmlaq_n_f32(vld1q_f32(&y[o + 4]),
+                                         vcvtq_f32_s32(accumulator_high),
+                                         scale));
+      }
+      return;
+    }
+#endif
+    const int8_t* w = packed_weights.data();
+    for (int o = 0; o < y_size; o += kQuantizedBlockSize) {
+      int32_t accumulator[kQuantizedBlockSize] = {};
+      for (int i = 0; i < x_size; i += 2, w += 2 * kQuantizedBlockSize) {
+        for (int k = 0; k < kQuantizedBlockSize; ++k) {
+          accumulator[k] += w[2 * k] * x[i] + w[2 * k + 1] * x[i + 1];
+        }
+      }
+      for (int k = 0; k < kQuantizedBlockSize; ++k) {
+        y[o + k] += scale * static_cast<float>(accumulator[k]);
+      }
+    }
+  }
+
  private:
   float DotProductAvx2(rtc::ArrayView<const float> x,
                        rtc::ArrayView<const float> y) const;
+  // Returns the number of outputs computed, which is the largest multiple of
+  // the AVX2 block size not greater than `y.size()`.
+  int AccumulateMatrixVectorProductAvx2(rtc::ArrayView<const float> x,
+                                        rtc::ArrayView<const float> weights,
+                                        int stride,
+                                        rtc::ArrayView<float> y) const;
+  void AccumulateQuantizedMatrixVectorProductAvx2(
+      rtc::ArrayView<const int16_t> x,
+      rtc::ArrayView<const int8_t> packed_weights,
+      float scale,
+      rtc::ArrayView<float> y) const;
 
   const AvailableCpuFeatures cpu_features_;
 };
@@ -50,5 +50,54 @@ float VectorMath::DotProductAvx2(rtc::ArrayView<const float> x,
   return dot_product;
 }
 
+int VectorMath::AccumulateMatrixVectorProductAvx2(
+    rtc::ArrayView<const float> x,
+    rtc::ArrayView<const float> weights,
+    int stride,
+    rtc::ArrayView<float> y) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  constexpr int kBlockSizeLog2 = 3;
+  constexpr int kBlockSize = 1 << kBlockSizeLog2;
+  const int x_size = rtc::dchecked_cast<int>(x.size());
+  const int incomplete_block_index = (y.size() >> kBlockSizeLog2)
+                                     << kBlockSizeLog2;
+  for (int o = 0; o < incomplete_block_index; o += kBlockSize) {
+    __m256 accumulator = _mm256_loadu_ps(&y[o]);
+    for (int i = 0; i < x_size; ++i) {
+      const __m256 w_i = _mm256_loadu_ps(&weights[i * stride + o]);
+      accumulator = _mm256_fmadd_ps(_mm256_set1_ps(x[i]), w_i, accumulator);
+    }
+    _mm256_storeu_ps(&y[o], accumulator);
+  }
+  return incomplete_block_index;
+}
+
+void VectorMath::AccumulateQuantizedMatrixVectorProductAvx2(
+    rtc::ArrayView<const int16_t> x,
+    rtc::ArrayView<const int8_t> packed_weights,
+    float scale,
+    rtc::ArrayView<float> y) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  static_assert(kQuantizedBlockSize == 8, "");
+  const int x_size = rtc::dchecked_cast<int>(x.size());
+  const int y_size = rtc::dchecked_cast<int>(y.size());
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  const int8_t* w = packed_weights.data();
+  for (int o = 0; o < y_size; o += kQuantizedBlockSize) {
+    __m256i accumulator = _mm256_setzero_si256();
+    for (int i = 0; i < x_size; i += 2, w += 2 * kQuantizedBlockSize) {
+      // Broadcast the pair of inputs and sign-extend the interleaved weights
+      // so that `_mm256_madd_epi16()` adds the products of both inputs.
+      const __m256i x_i = _mm256_set1_epi32(PackInt16Pair(x[i], x[i + 1]));
+      const __m256i w_i = _mm256_cvtepi8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(w)));
+      accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(w_i, x_i));
+    }
+    _mm256_storeu_ps(&y[o], _mm256_fmadd_ps(scale_v,
+                                            _mm256_cvtepi32_ps(accumulator),
+                                            _mm256_loadu_ps(&y[o])));
+  }
+}
+
 }  // namespace rnn_vad
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/vector_math.h"
 
+#include <cmath>
 #include <vector>
 
 #include "modules/audio_processing/agc2/cpu_features.h"
@@ -41,6 +42,59 @@ TEST_P(VectorMathParametrization, TestDotProduct) {
       kEnergyOfXSubspan);
 }
 
+// Checks the matrix-vector product against a reference with sizes that are not
+// multiples of the SIMD block sizes.
+TEST_P(VectorMathParametrization, TestAccumulateMatrixVectorProduct) {
+  constexpr int kNumInputs = 5;
+  constexpr int kNumOutputs = 11;
+  constexpr int kStride = 13;
+  std::vector<float> weights(kNumInputs * kStride);
+  for (size_t k = 0; k < weights.size(); ++k) {
+    weights[k] = kX[k % kSizeOfX];
+  }
+  std::vector<float> y(kNumOutputs, 1.f);
+  VectorMath vector_math(/*cpu_features=*/GetParam());
+  vector_math.AccumulateMatrixVectorProduct({kX, kNumInputs}, weights, kStride,
+                                            y);
+  for (int o = 0; o < kNumOutputs; ++o) {
+    float expected = 1.f;
+    for (int i = 0; i < kNumInputs; ++i) {
+      expected += kX[i] * weights[i * kStride + o];
+    }
+    EXPECT_NEAR(y[o], expected, 1e-6f);
+  }
+}
+
+// Checks that the quantized matrix-vector product is close to the float one.
+TEST_P(VectorMathParametrization, TestAccumulateQuantizedMatrixVectorProduct) {
+  constexpr int kNumInputs = kSizeOfX;
+  constexpr int kNumOutputs = 11;
+  constexpr float kWeightsScale = 1.f / 256.f;
+  std::vector<int8_t> weights(kNumInputs * kNumOutputs);
+  for (size_t k = 0; k < weights.size(); ++k) {
+    weights[k] = static_cast<int8_t>((k * 37) % 256 - 128);
+  }
+  const std::vector<int8_t> packed_weights =
+      PackQuantizedWeights(weights, kNumInputs, kNumOutputs, kNumOutputs);
+  std::vector<int16_t> quantized_x(GetQuantizedNumInputs(kNumInputs));
+  const float x_scale = QuantizeVector(kX, quantized_x);
+  std::vector<float> y(GetQuantizedNumOutputs(kNumOutputs), 1.f);
+  VectorMath vector_math(/*cpu_features=*/GetParam());
+  vector_math.AccumulateQuantizedMatrixVectorProduct(
+      quantized_x, packed_weights, x_scale * kWeightsScale, y);
+  for (int o = 0; o < kNumOutputs; ++o) {
+    float expected = 1.f;
+    for (int i = 0; i < kNumInputs; ++i) {
+      expected += kX[i] * kWeightsScale * weights[i * kNumOutputs + o];
+    }
+    EXPECT_NEAR(y[o], expected, 1e-4f);
+  }
+  // The padded outputs are left unchanged.
+  for (size_t o = kNumOutputs; o < y.size(); ++o) {
+    EXPECT_EQ(y[o], 1.f);
+  }
+}
+
 // Finds the relevant CPU features combinations to test.
 std::vector<AvailableCpuFeatures> GetCpuFeaturesToTest() {
   std::vector<AvailableCpuFeatures> v;
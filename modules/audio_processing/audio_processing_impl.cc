@@ -51,6 +51,8 @@ namespace webrtc {
 
 namespace {
 
+using Submodule = SubmoduleTimingRecorder::Submodule;
+
 bool SampleRateSupportsMultiBand(int sample_rate_hz) {
   return sample_rate_hz == AudioProcessing::kSampleRate32kHz ||
          sample_rate_hz == AudioProcessing::kSampleRate48kHz;
@@ -583,6 +585,7 @@ void AudioProcessingImpl::InitializeLocked() {
   InitializePostProcessor();
   InitializePreProcessor();
   InitializeCaptureLevelsAdjuster();
+  InitializeSubmoduleTimingRecorder();
 
   if (aec_dump_) {
     aec_dump_->WriteInitMessage(formats_.api_format, rtc::TimeUTCMillis());
@@ -737,6 +740,8 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
     InitializeCaptureLevelsAdjuster();
   }
 
+  InitializeSubmoduleTimingRecorder();
+
   // Reinitialization must happen after all submodule configuration to avoid
   // additional reinitializations on the next capture / render processing call.
   if (pipeline_config_changed) {
@@ -920,7 +925,8 @@ int AudioProcessingImpl::ProcessStream(const float* const* src,
     capture_.capture_fullband_audio->CopyFrom(
         src, formats_.api_format.input_stream());
   }
-  RETURN_ON_ERR(ProcessCaptureStreamLocked());
+  RETURN_ON_ERR(ProcessCaptureStreamLocked(
+      /*full_band_high_pass_filter_applied=*/false));
   if (capture_.capture_fullband_audio) {
     capture_.capture_fullband_audio->CopyTo(formats_.api_format.output_stream(),
                                             dest);
@@ -934,6 +940,89 @@ int AudioProcessingImpl::ProcessStream(const float* const* src,
   return kNoError;
 }
 
+// The capture locks of all the instances are held during the processing, which
+// the thread safety analysis cannot follow.
+int AudioProcessingImpl::ProcessStreams(
+    rtc::ArrayView<AudioProcessingImpl* const> apms,
+    rtc::ArrayView<const float* const* const> src,
+    const StreamConfig& input_config,
+    const StreamConfig& output_config,
+    rtc::ArrayView<float* const* const> dest) RTC_NO_THREAD_SAFETY_ANALYSIS {
+  TRACE_EVENT0("webrtc", "AudioProcessing::ProcessStreams");
+  RTC_DCHECK_EQ(apms.size(), src.size());
+  RTC_DCHECK_EQ(apms.size(), dest.size());
+  DenormalDisabler denormal_disabler;
+  int error = kNoError;
+  for (size_t i = 0; i < apms.size(); ++i) {
+    const int stream_error = HandleUnsupportedAudioFormats(
+        src[i], input_config, output_config, dest[i]);
+    if (stream_error != kNoError) {
+      error = stream_error;
+    }
+  }
+  if (error != kNoError) {
+    return error;
+  }
+  for (AudioProcessingImpl* apm : apms) {
+    apm->MaybeInitializeCapture(input_config, output_config);
+  }
+
+  for (AudioProcessingImpl* apm : apms) {
+    apm->mutex_capture_.Lock();
+  }
+
+  // The streams share the input format, and therefore also the rate of the
+  // full-band high-pass filters, unless the maximum processing rate differs.
+  std::vector<HighPassFilter*> filters;
+  std::vector<AudioBuffer*> buffers;
+  std::vector<bool> filter_applied(apms.size(), false);
+  for (size_t i = 0; i < apms.size(); ++i) {
+    AudioProcessingImpl* apm = apms[i];
+    if (apm->aec_dump_) {
+      apm->RecordUnprocessedCaptureStream(src[i]);
+    }
+    apm->capture_.capture_audio->CopyFrom(
+        src[i], apm->formats_.api_format.input_stream());
+    if (apm->capture_.capture_fullband_audio) {
+      apm->capture_.capture_fullband_audio->CopyFrom(
+          src[i], apm->formats_.api_format.input_stream());
+    }
+    HighPassFilter* filter = apm->submodules_.high_pass_filter.get();
+    if (apm->UseFullBandHighPassFilterLocked() &&
+        (filters.empty() ||
+         filter->sample_rate_hz() == filters[0]->sample_rate_hz())) {
+      filters.push_back(filter);
+      buffers.push_back(apm->capture_.capture_audio.get());
+      filter_applied[i] = true;
+    }
+  }
+  HighPassFilter::ProcessInParallel(filters, buffers);
+
+  for (size_t i = 0; i < apms.size(); ++i) {
+    AudioProcessingImpl* apm = apms[i];
+    const int stream_error = apm->ProcessCaptureStreamLocked(filter_applied[i]);
+    if (stream_error != kNoError) {
+      error = stream_error;
+      continue;
+    }
+    if (apm->capture_.capture_fullband_audio) {
+      apm->capture_.capture_fullband_audio->CopyTo(
+          apm->formats_.api_format.output_stream(), dest[i]);
+    } else {
+      apm->capture_.capture_audio->CopyTo(
+          apm->formats_.api_format.output_stream(), dest[i]);
+    }
+    if (apm->aec_dump_) {
+      apm->RecordProcessedCaptureStream(dest[i]);
+    }
+  }
+
+  for (AudioProcessingImpl* apm : apms) {
+    apm->mutex_capture_.Unlock();
+  }
+  return error;
+}
+
 void AudioProcessingImpl::HandleCaptureRuntimeSettings() {
   RuntimeSetting setting;
   int num_settings_processed = 0;
@@ -1219,7 +1308,8 @@ int AudioProcessingImpl::ProcessStream(const int16_t* const src,
   if (capture_.capture_fullband_audio) {
     capture_.capture_fullband_audio->CopyFrom(src, input_config);
   }
-  RETURN_ON_ERR(ProcessCaptureStreamLocked());
+  RETURN_ON_ERR(ProcessCaptureStreamLocked(
+      /*full_band_high_pass_filter_applied=*/false));
   if (submodule_states_.CaptureMultiBandProcessingPresent() ||
       submodule_states_.CaptureFullBandProcessingActive()) {
     if (capture_.capture_fullband_audio) {
@@ -1235,7 +1325,19 @@ int AudioProcessingImpl::ProcessStream(const int16_t* const src,
   return kNoError;
 }
 
-int AudioProcessingImpl::ProcessCaptureStreamLocked() {
+bool AudioProcessingImpl::UseFullBandHighPassFilterLocked() const {
+  return submodules_.high_pass_filter &&
+         config_.high_pass_filter.apply_in_full_band &&
+         !constants_.enforce_split_band_hpf;
+}
+
+int AudioProcessingImpl::ProcessCaptureStreamLocked(
+    bool full_band_high_pass_filter_applied) {
+  SubmoduleTimingRecorder* const timing = capture_.submodule_timing_recorder;
+  if (timing) {
+    timing->StartFrame();
+  }
+
   EmptyQueuedRenderAudioLocked();
   HandleCaptureRuntimeSettings();
   DenormalDisabler denormal_disabler;
@@ -1253,14 +1355,17 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   AudioBuffer* capture_buffer = capture_.capture_audio.get();  // For brevity.
   AudioBuffer* linear_aec_buffer = capture_.linear_aec_output.get();
 
-  if (submodules_.high_pass_filter &&
-      config_.high_pass_filter.apply_in_full_band &&
-      !constants_.enforce_split_band_hpf) {
+  if (UseFullBandHighPassFilterLocked() &&
+      !full_band_high_pass_filter_applied) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kHighPassFilter);
     submodules_.high_pass_filter->Process(capture_buffer,
                                           /*use_split_band_data=*/false);
   }
 
   if (submodules_.capture_levels_adjuster) {
+    SubmoduleTimingRecorder::ScopedTimer timer(
+        timing, Submodule::kCaptureLevelsAdjuster);
     if (config_.capture_level_adjustment.analog_mic_gain_emulation.enabled) {
       // When the input volume is emulated, retrieve the volume applied to the
       // input audio and notify that to APM so that the volume is passed to the
@@ -1313,10 +1418,14 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
          capture_.prev_playout_volume >= 0);
     capture_.prev_playout_volume = capture_.playout_volume;
 
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kEchoController);
     submodules_.echo_controller->AnalyzeCapture(capture_buffer);
   }
 
   if (submodules_.agc_manager) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kGainController1);
     submodules_.agc_manager->AnalyzePreProcess(*capture_buffer);
   }
 
@@ -1325,6 +1434,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     // Expect the volume to be available if the input controller is enabled.
     RTC_DCHECK(capture_.applied_input_volume.has_value());
     if (capture_.applied_input_volume.has_value()) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kGainController2);
       submodules_.gain_controller2->Analyze(*capture_.applied_input_volume,
                                             *capture_buffer);
     }
@@ -1333,6 +1444,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if (submodule_states_.CaptureMultiBandSubModulesActive() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kBandSplitting);
     capture_buffer->SplitIntoFrequencyBands();
   }
 
@@ -1349,11 +1462,15 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if (submodules_.high_pass_filter &&
       (!config_.high_pass_filter.apply_in_full_band ||
        constants_.enforce_split_band_hpf)) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kHighPassFilter);
     submodules_.high_pass_filter->Process(capture_buffer,
                                           /*use_split_band_data=*/true);
   }
 
   if (submodules_.gain_control) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kGainController1);
     RETURN_ON_ERR(
         submodules_.gain_control->AnalyzeCaptureAudio(*capture_buffer));
   }
@@ -1361,6 +1478,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if ((!config_.noise_suppression.analyze_linear_aec_output_when_available ||
        !linear_aec_buffer || submodules_.echo_control_mobile) &&
       submodules_.noise_suppressor) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kNoiseSuppressor);
     submodules_.noise_suppressor->Analyze(*capture_buffer);
   }
 
@@ -1372,15 +1491,21 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
 
     if (submodules_.noise_suppressor) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Process(capture_buffer);
     }
 
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kEchoControlMobile);
     RETURN_ON_ERR(submodules_.echo_control_mobile->ProcessCaptureAudio(
         capture_buffer, stream_delay_ms()));
   } else {
     if (submodules_.echo_controller) {
       data_dumper_->DumpRaw("stream_delay", stream_delay_ms());
 
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kEchoController);
       if (capture_.was_stream_delay_set) {
         submodules_.echo_controller->SetAudioBufferDelay(stream_delay_ms());
       }
@@ -1391,15 +1516,21 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
 
     if (config_.noise_suppression.analyze_linear_aec_output_when_available &&
         linear_aec_buffer && submodules_.noise_suppressor) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Analyze(*linear_aec_buffer);
     }
 
     if (submodules_.noise_suppressor) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kNoiseSuppressor);
       submodules_.noise_suppressor->Process(capture_buffer);
     }
   }
 
   if (submodules_.agc_manager) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kGainController1);
     submodules_.agc_manager->Process(*capture_buffer);
 
     std::optional<int> new_digital_gain =
@@ -1410,6 +1541,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   }
 
   if (submodules_.gain_control) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kGainController1);
     // TODO(peah): Add reporting from AEC3 whether there is echo.
     RETURN_ON_ERR(submodules_.gain_control->ProcessCaptureAudio(
         capture_buffer, /*stream_has_echo*/ false));
@@ -1418,6 +1551,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   if (submodule_states_.CaptureMultiBandProcessingPresent() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
+    SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                               Submodule::kBandSplitting);
     capture_buffer->MergeFrequencyBands();
   }
 
@@ -1434,6 +1569,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
 
     if (submodules_.echo_detector) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kEchoDetector);
       submodules_.echo_detector->AnalyzeCaptureAudio(
           rtc::ArrayView<const float>(capture_buffer->channels()[0],
                                       capture_buffer->num_frames()));
@@ -1441,10 +1578,14 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
 
     // Experimental APM sub-module that analyzes `capture_buffer`.
     if (submodules_.capture_analyzer) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kCaptureAnalyzer);
       submodules_.capture_analyzer->Analyze(capture_buffer);
     }
 
     if (submodules_.gain_controller2) {
+      SubmoduleTimingRecorder::ScopedTimer timer(timing,
+                                                 Submodule::kGainController2);
       // TODO(bugs.webrtc.org/7494): Let AGC2 detect applied input volume
       // changes.
       submodules_.gain_controller2->Process(
@@ -1453,6 +1594,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
     }
 
     if (submodules_.capture_post_processor) {
+      SubmoduleTimingRecorder::ScopedTimer timer(
+          timing, Submodule::kCapturePostProcessor);
       submodules_.capture_post_processor->Process(capture_buffer);
     }
 
@@ -1496,6 +1639,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   }
 
   if (submodules_.capture_levels_adjuster) {
+    SubmoduleTimingRecorder::ScopedTimer timer(
+        timing, Submodule::kCaptureLevelsAdjuster);
     submodules_.capture_levels_adjuster->ApplyPostLevelAdjustment(
         *capture_buffer);
 
@@ -1529,6 +1674,10 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
                         capture_.recommended_input_volume.value_or(
                             kUnspecifiedDataDumpInputVolume));
 
+  if (timing) {
+    timing->EndFrame();
+  }
+
   return kNoError;
 }
 
@@ -2115,6 +2264,11 @@ void AudioProcessingImpl::InitializeAnalyzer() {
   }
 }
 
+void AudioProcessingImpl::InitializeSubmoduleTimingRecorder() {
+  capture_.submodule_timing_recorder =
+      stats_reporter_.EnableSubmoduleTiming(config_.submodule_timing.enabled);
+}
+
 void AudioProcessingImpl::InitializePostProcessor() {
   if (submodules_.capture_post_processor) {
     submodules_.capture_post_processor->Initialize(
@@ -2279,7 +2433,11 @@ AudioProcessingStats AudioProcessingImpl::ApmStatsReporter::GetStatistics() {
   // If the message queue is full, return the cached stats.
   static_cast<void>(new_stats_available);
 
-  return cached_stats_;
+  AudioProcessingStats stats = cached_stats_;
+  if (submodule_timing_enabled_.load(std::memory_order_acquire)) {
+    stats.submodule_timing = submodule_timing_recorder_.GetStatistics();
+  }
+  return stats;
 }
 
 void AudioProcessingImpl::ApmStatsReporter::UpdateStatistics(
@@ -2290,4 +2448,17 @@ void AudioProcessingImpl::ApmStatsReporter::UpdateStatistics(
   static_cast<void>(stats_message_passed);
 }
 
+SubmoduleTimingRecorder*
+AudioProcessingImpl::ApmStatsReporter::EnableSubmoduleTiming(bool enabled) {
+  if (!enabled) {
+    submodule_timing_enabled_.store(false, std::memory_order_release);
+    return nullptr;
+  }
+  if (!submodule_timing_enabled_.load(std::memory_order_relaxed)) {
+    submodule_timing_recorder_.Reset();
+    submodule_timing_enabled_.store(true, std::memory_order_release);
+  }
+  return &submodule_timing_recorder_;
+}
+
 }  // namespace webrtc
@@ -43,6 +43,7 @@
 #include "modules/audio_processing/ns/noise_suppressor.h"
 #include "modules/audio_processing/render_queue_item_verifier.h"
 #include "modules/audio_processing/rms_level.h"
+#include "modules/audio_processing/submodule_timing_recorder.h"
 #include "rtc_base/gtest_prod_util.h"
 #include "rtc_base/swap_queue.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -158,6 +159,18 @@ class AudioProcessingImpl : public AudioProcessing {
   FRIEND_TEST_ALL_PREFIXES(ApmConfiguration, ValidConfigBehavior);
   FRIEND_TEST_ALL_PREFIXES(ApmConfiguration, InValidConfigBehavior);
 
+  friend class MultiStreamAudioProcessing;
+
+  // Processes one capture frame of each of the `apms`, like ProcessStream()
+  // does for each of them, with all the streams in the same format. The
+  // full-band high-pass filters are applied to all the streams together.
+  // Returns the last error.
+  static int ProcessStreams(rtc::ArrayView<AudioProcessingImpl* const> apms,
+                            rtc::ArrayView<const float* const* const> src,
+                            const StreamConfig& input_config,
+                            const StreamConfig& output_config,
+                            rtc::ArrayView<float* const* const> dest);
+
   void set_stream_analog_level_locked(int level)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void UpdateRecommendedInputVolumeLocked()
@@ -270,6 +283,10 @@ class AudioProcessingImpl : public AudioProcessing {
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void InitializePostProcessor() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
   void InitializeAnalyzer() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
+  // Enables or disables the submodule timing according to the config. Timing
+  // that stays enabled keeps its statistics.
+  void InitializeSubmoduleTimingRecorder()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
 
   // Initializations of render-only submodules, requiring the render lock
   // already acquired.
@@ -297,7 +314,12 @@ class AudioProcessingImpl : public AudioProcessing {
 
   // Capture-side exclusive methods possibly running APM in a multi-threaded
   // manner that are called with the render lock already acquired.
-  int ProcessCaptureStreamLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
+  // `full_band_high_pass_filter_applied` is set when ProcessStreams() has
+  // already applied the full-band high-pass filter to the capture audio.
+  int ProcessCaptureStreamLocked(bool full_band_high_pass_filter_applied)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
+  bool UseFullBandHighPassFilterLocked() const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_capture_);
 
   // Render-side exclusive methods possibly running APM in a multi-threaded
   // manner that are called with the render lock already acquired.
@@ -449,6 +471,9 @@ class AudioProcessingImpl : public AudioProcessing {
     // that audio is acquired. Unspecified when no input volume can be
     // recommended.
     std::optional<int> recommended_input_volume;
+    // Points to the recorder of `stats_reporter_` if the submodule timing is
+    // enabled, null otherwise.
+    SubmoduleTimingRecorder* submodule_timing_recorder = nullptr;
   } capture_ RTC_GUARDED_BY(mutex_capture_);
 
   struct ApmCaptureNonLockedState {
@@ -485,10 +510,19 @@ class AudioProcessingImpl : public AudioProcessing {
     // Update the cached statistics.
     void UpdateStatistics(const AudioProcessingStats& new_stats);
 
+    // Enables or disables the submodule timing, which restarts from no
+    // frames when it is enabled again. Returns the recorder to time the
+    // capture frames with, or null if disabled. Unlike the other statistics,
+    // which are passed through a queue, the timing accumulates over all frames
+    // and GetStatistics() reads the latest one from the recorder.
+    SubmoduleTimingRecorder* EnableSubmoduleTiming(bool enabled);
+
    private:
     Mutex mutex_stats_;
     AudioProcessingStats cached_stats_ RTC_GUARDED_BY(mutex_stats_);
     SwapQueue<AudioProcessingStats> stats_message_queue_;
+    std::atomic<bool> submodule_timing_enabled_{false};
+    SubmoduleTimingRecorder submodule_timing_recorder_;
   } stats_reporter_;
 
   std::vector<int16_t> aecm_render_queue_buffer_ RTC_GUARDED_BY(mutex_render_);
@@ -233,6 +233,54 @@ TEST(AudioProcessingImplTest, UpdateCapturePreGainRuntimeSetting) {
       << "Frame should be amplified.";
 }
 
+TEST(AudioProcessingImplTest, ReportsSubmoduleTimingOnlyWhenEnabled) {
+  scoped_refptr<AudioProcessing> apm =
+      BuiltinAudioProcessingBuilder().Build(CreateEnvironment());
+  AudioProcessing::Config apm_config;
+  apm_config.echo_canceller.enabled = true;
+  apm_config.noise_suppression.enabled = true;
+  apm->ApplyConfig(apm_config);
+
+  constexpr int kSampleRateHz = 48000;
+  constexpr int kNumFrames = 10;
+  std::array<int16_t, kSampleRateHz / 100> frame;
+  StreamConfig config(kSampleRateHz, /*num_channels=*/1);
+  auto process_frames = [&] {
+    for (int i = 0; i < kNumFrames; ++i) {
+      frame.fill(1000);
+      apm->ProcessReverseStream(frame.data(), config, config, frame.data());
+      apm->ProcessStream(frame.data(), config, config, frame.data());
+    }
+  };
+
+  process_frames();
+  EXPECT_FALSE(apm->GetStatistics().submodule_timing);
+
+  apm_config.submodule_timing.enabled = true;
+  apm->ApplyConfig(apm_config);
+  process_frames();
+  std::optional<AudioProcessingStats::SubmoduleTiming> timing =
+      apm->GetStatistics().submodule_timing;
+  ASSERT_TRUE(timing);
+  ASSERT_TRUE(timing->total);
+  EXPECT_EQ(timing->total->num_frames, kNumFrames);
+  ASSERT_TRUE(timing->echo_controller);
+  EXPECT_EQ(timing->echo_controller->num_frames, kNumFrames);
+  ASSERT_TRUE(timing->noise_suppressor);
+  EXPECT_EQ(timing->noise_suppressor->num_frames, kNumFrames);
+  ASSERT_TRUE(timing->band_splitting);
+  EXPECT_EQ(timing->band_splitting->num_frames, kNumFrames);
+  EXPECT_FALSE(timing->echo_control_mobile);
+  EXPECT_FALSE(timing->gain_controller2);
+  EXPECT_LE(timing->echo_controller->total_time_us,
+            timing->total->total_time_us);
+
+  apm_config.submodule_timing.enabled = false;
+  apm->ApplyConfig(apm_config);
+  process_frames();
+  EXPECT_FALSE(apm->GetStatistics().submodule_timing);
+}
+
 TEST(AudioProcessingImplTest,
      LevelAdjustmentUpdateCapturePreGainRuntimeSetting) {
   scoped_refptr<AudioProcessing> apm =
@@ -12,22 +12,32 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "api/audio/builtin_audio_processing_builder.h"
+#include "api/audio/echo_canceller3_config.h"
 #include "api/environment/environment_factory.h"
 #include "api/numerics/samples_stats_counter.h"
 #include "api/test/metrics/global_metrics_logger_and_exporter.h"
 #include "api/test/metrics/metric.h"
+#include "modules/audio_processing/aec3/echo_canceller3.h"
+#include "modules/audio_processing/audio_buffer.h"
 #include "modules/audio_processing/audio_processing_impl.h"
+#include "modules/audio_processing/ns/noise_suppressor.h"
 #include "modules/audio_processing/test/test_utils.h"
 #include "rtc_base/event.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/platform_thread.h"
 #include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "rtc_base/time_utils.h"
 #include "system_wrappers/include/clock.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -553,6 +563,173 @@ bool TimedThreadApiProcessor::Process() {
 
 const float CallSimulator::kRenderInputFloatLevel = 0.5f;
 const float CallSimulator::kCaptureInputFloatLevel = 0.03125f;
+
+bool IsSupported(NsOptimization optimization) {
+  switch (optimization) {
+    case NsOptimization::kNone:
+      return true;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2:
+      return GetCPUInfo(kSSE2) != 0;
+    case NsOptimization::kAvx2:
+      return GetCPUInfo(kAVX2) != 0;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+std::string OptimizationName(NsOptimization optimization) {
+  switch (optimization) {
+    case NsOptimization::kNone:
+      return "Scalar";
+    case NsOptimization::kSse2:
+      return "Sse2";
+    case NsOptimization::kAvx2:
+      return "Avx2";
+    case NsOptimization::kNeon:
+      return "Neon";
+  }
+  return "";
+}
+
+// Measures the cost of the noise suppressor per 10 ms frame, i.e. of one
+// Analyze() and one Process() call, for a mono capture stream.
+class NoiseSuppressorPerformanceTest
+    : public ::testing::TestWithParam<std::tuple<int, NsOptimization>> {};
+
+TEST_P(NoiseSuppressorPerformanceTest, CostPer10msFrame) {
+  const int sample_rate_hz = std::get<0>(GetParam());
+  const NsOptimization optimization = std::get<1>(GetParam());
+  if (!IsSupported(optimization)) {
+    GTEST_SKIP() << "Optimization not supported by the CPU";
+  }
+  constexpr int kNumWarmUpFrames = 100;
+  constexpr int kNumFrames = 2000;
+  const size_t num_bands = sample_rate_hz / 16000;
+
+  AudioBuffer audio(sample_rate_hz, 1, sample_rate_hz, 1, sample_rate_hz, 1);
+  NoiseSuppressor noise_suppressor(NsConfig(), sample_rate_hz,
+                                   /*num_channels=*/1, optimization);
+  Random random(42);
+  SamplesStatsCounter frame_durations;
+  for (int frame = 0; frame < kNumWarmUpFrames + kNumFrames; ++frame) {
+    // Noise with a tone that is on half of the time, to have both noise-only
+    // and speech-like frames.
+    const float tone_amplitude = (frame / 50) % 2 ? 3000.f : 0.f;
+    for (size_t band = 0; band < num_bands; ++band) {
+      for (size_t i = 0; i < 160; ++i) {
+        audio.split_bands(0)[band][i] =
+            static_cast<float>(random.Gaussian(0.0, 300.0)) +
+            tone_amplitude * sinf(0.1f * (frame * 160 + i));
+      }
+    }
+
+    const int64_t start_ns = rtc::TimeNanos();
+    noise_suppressor.Analyze(audio);
+    noise_suppressor.Process(&audio);
+    const int64_t duration_ns = rtc::TimeNanos() - start_ns;
+    if (frame >= kNumWarmUpFrames) {
+      frame_durations.AddSample(static_cast<double>(duration_ns) /
+                                rtc::kNumNanosecsPerMillisec);
+    }
+  }
+
+  GetGlobalMetricsLogger()->LogMetric(
+      "ns_cost_per_frame_" + std::to_string(sample_rate_hz) + "Hz",
+      OptimizationName(optimization), frame_durations, Unit::kMilliseconds,
+      ImprovementDirection::kSmallerIsBetter);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AudioProcessingPerformanceTest,
+    NoiseSuppressorPerformanceTest,
+    ::testing::Combine(::testing::Values(16000, 32000, 48000),
+                       ::testing::Values(NsOptimization::kNone,
+                                         NsOptimization::kSse2,
+                                         NsOptimization::kAvx2,
+                                         NsOptimization::kNeon)));
+
+// Measures the latency of AEC3 per 10 ms frame, i.e. of one AnalyzeRender(),
+// one AnalyzeCapture() and one ProcessCapture() call, for a 48 kHz mono render
+// stream and a multichannel capture stream containing its echo. Besides the
+// per-frame durations, the tail latency percentiles are reported since they
+// bound the real-time margin of the capture thread.
+class EchoCanceller3PerformanceTest
+    : public ::testing::TestWithParam<std::tuple<size_t, int>> {};
+
+TEST_P(EchoCanceller3PerformanceTest, LatencyPer10msFrame) {
+  const size_t num_capture_channels = std::get<0>(GetParam());
+  const int num_worker_threads = std::get<1>(GetParam());
+  constexpr int kSampleRateHz = 48000;
+  constexpr size_t kSamplesPer10ms = kSampleRateHz / 100;
+  constexpr int kNumWarmUpFrames = 100;
+  constexpr int kNumFrames = 2000;
+
+  EchoCanceller3Config config;
+  config.filter.num_worker_threads = num_worker_threads;
+  EchoCanceller3 aec3(CreateEnvironment(), config,
+                      /*multichannel_config=*/std::nullopt, kSampleRateHz,
+                      /*num_render_channels=*/1, num_capture_channels);
+  AudioBuffer render(kSampleRateHz, 1, kSampleRateHz, 1, kSampleRateHz, 1);
+  AudioBuffer capture(kSampleRateHz, num_capture_channels, kSampleRateHz,
+                      num_capture_channels, kSampleRateHz,
+                      num_capture_channels);
+  std::vector<float> previous_render(kSamplesPer10ms, 0.f);
+  Random random(42);
+  SamplesStatsCounter frame_durations;
+  for (int frame = 0; frame < kNumWarmUpFrames + kNumFrames; ++frame) {
+    // The capture channels contain the render signal of the previous frame at
+    // different levels, plus near-end noise.
+    for (size_t ch = 0; ch < num_capture_channels; ++ch) {
+      for (size_t i = 0; i < kSamplesPer10ms; ++i) {
+        capture.channels()[ch][i] =
+            previous_render[i] / (2.f + ch) +
+            static_cast<float>(random.Gaussian(0.0, 30.0));
+      }
+    }
+    for (size_t i = 0; i < kSamplesPer10ms; ++i) {
+      render.channels()[0][i] = previous_render[i] =
+          static_cast<float>(random.Gaussian(0.0, 3000.0));
+    }
+    render.SplitIntoFrequencyBands();
+
+    const int64_t start_ns = rtc::TimeNanos();
+    aec3.AnalyzeRender(&render);
+    aec3.AnalyzeCapture(&capture);
+    capture.SplitIntoFrequencyBands();
+    aec3.ProcessCapture(&capture, /*level_change=*/false);
+    const int64_t duration_ns = rtc::TimeNanos() - start_ns;
+    if (frame >= kNumWarmUpFrames) {
+      frame_durations.AddSample(static_cast<double>(duration_ns) /
+                                rtc::kNumNanosecsPerMillisec);
+    }
+  }
+
+  const std::string test_case =
+      std::to_string(num_capture_channels) + "ch_" +
+      std::to_string(num_worker_threads) + "workers";
+  GetGlobalMetricsLogger()->LogMetric("aec3_latency_per_frame", test_case,
+                                      frame_durations, Unit::kMilliseconds,
+                                      ImprovementDirection::kSmallerIsBetter);
+  for (int percentile : {50, 95, 99}) {
+    GetGlobalMetricsLogger()->LogSingleValueMetric(
+        "aec3_latency_per_frame_p" + std::to_string(percentile), test_case,
+        frame_durations.GetPercentile(percentile / 100.0), Unit::kMilliseconds,
+        ImprovementDirection::kSmallerIsBetter);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AudioProcessingPerformanceTest,
+    EchoCanceller3PerformanceTest,
+    ::testing::Combine(::testing::Values(1, 2, 4),
+                       ::testing::Values(0, 1, 3)));
+
 }  // anonymous namespace
 
 TEST_P(CallSimulator, ApiCallDurationTest) {
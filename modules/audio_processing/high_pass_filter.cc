@@ -89,6 +89,25 @@ void HighPassFilter::Process(std::vector<std::vector<float>>* audio) {
   }
 }
 
+void HighPassFilter::ProcessInParallel(
+    rtc::ArrayView<HighPassFilter* const> filters,
+    rtc::ArrayView<AudioBuffer* const> audio) {
+  RTC_DCHECK_EQ(filters.size(), audio.size());
+  std::vector<CascadedBiQuadFilter*> channel_filters;
+  std::vector<rtc::ArrayView<float>> channel_data;
+  for (size_t i = 0; i < filters.size(); ++i) {
+    RTC_DCHECK(audio[i]);
+    RTC_DCHECK_EQ(filters[i]->sample_rate_hz(), filters[0]->sample_rate_hz());
+    RTC_DCHECK_EQ(filters[i]->filters_.size(), audio[i]->num_channels());
+    for (size_t k = 0; k < audio[i]->num_channels(); ++k) {
+      channel_filters.push_back(filters[i]->filters_[k].get());
+      channel_data.push_back(rtc::ArrayView<float>(&audio[i]->channels()[k][0],
+                                                   audio[i]->num_frames()));
+    }
+  }
+  CascadedBiQuadFilter::ProcessInParallel(channel_filters, channel_data);
+}
+
 void HighPassFilter::Reset() {
   for (size_t k = 0; k < filters_.size(); ++k) {
     filters_[k]->Reset();
@@ -30,6 +30,12 @@ class HighPassFilter {
 
   void Process(AudioBuffer* audio, bool use_split_band_data);
   void Process(std::vector<std::vector<float>>* audio);
+  // Applies each of the `filters`, which must have the same sample rate, on
+  // the full-band data of the corresponding buffer in `audio`. The channels of
+  // all the buffers are filtered together, several at a time, using
+  // CascadedBiQuadFilter::ProcessInParallel().
+  static void ProcessInParallel(rtc::ArrayView<HighPassFilter* const> filters,
+                                rtc::ArrayView<AudioBuffer* const> audio);
   void Reset();
   void Reset(size_t num_channels);
 
@@ -0,0 +1,52 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/multi_stream_audio_processing.h"
+
+#include "api/make_ref_counted.h"
+#include "modules/audio_processing/audio_processing_impl.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+MultiStreamAudioProcessing::MultiStreamAudioProcessing(
+    const Environment& env,
+    const AudioProcessing::Config& config,
+    size_t num_streams) {
+  streams_.reserve(num_streams);
+  stream_pointers_.reserve(num_streams);
+  for (size_t i = 0; i < num_streams; ++i) {
+    streams_.push_back(make_ref_counted<AudioProcessingImpl>(
+        env, config, /*capture_post_processor=*/nullptr,
+        /*render_pre_processor=*/nullptr, /*echo_control_factory=*/nullptr,
+        /*echo_detector=*/nullptr, /*capture_analyzer=*/nullptr));
+    stream_pointers_.push_back(streams_.back().get());
+  }
+}
+
+MultiStreamAudioProcessing::~MultiStreamAudioProcessing() = default;
+
+AudioProcessing* MultiStreamAudioProcessing::stream(size_t index) {
+  RTC_DCHECK_LT(index, streams_.size());
+  return streams_[index].get();
+}
+
+int MultiStreamAudioProcessing::ProcessStreams(
+    rtc::ArrayView<const float* const* const> src,
+    const StreamConfig& input_config,
+    const StreamConfig& output_config,
+    rtc::ArrayView<float* const* const> dest) {
+  RTC_DCHECK_EQ(src.size(), streams_.size());
+  RTC_DCHECK_EQ(dest.size(), streams_.size());
+  return AudioProcessingImpl::ProcessStreams(stream_pointers_, src,
+                                             input_config, output_config, dest);
+}
+
+}  // namespace webrtc
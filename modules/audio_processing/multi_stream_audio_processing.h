@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_MULTI_STREAM_AUDIO_PROCESSING_H_
+#define MODULES_AUDIO_PROCESSING_MULTI_STREAM_AUDIO_PROCESSING_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
+
+namespace webrtc {
+
+class AudioProcessingImpl;
+
+// Processes the capture streams of many audio processing instances, e.g. one
+// per participant on a server, in one call per 10 ms. Each stream has its own
+// instance, and therefore its own state, which is accessible through
+// `stream()` for everything but the capture stream processing. Processing the
+// streams together lets them share per-call overhead, and lets the full-band
+// high-pass filters of all the streams run together in SIMD lanes.
+//
+// The output of a stream is the same as if it had been processed with
+// AudioProcessing::ProcessStream() on its own.
+class MultiStreamAudioProcessing {
+ public:
+  MultiStreamAudioProcessing(const Environment& env,
+                             const AudioProcessing::Config& config,
+                             size_t num_streams);
+  ~MultiStreamAudioProcessing();
+  MultiStreamAudioProcessing(const MultiStreamAudioProcessing&) = delete;
+  MultiStreamAudioProcessing& operator=(const MultiStreamAudioProcessing&) =
+      delete;
+
+  size_t num_streams() const { return streams_.size(); }
+
+  // Returns the instance that processes the stream with index `index`.
+  // Capture frames must not be passed to its ProcessStream() methods.
+  AudioProcessing* stream(size_t index);
+
+  // Processes one 10 ms frame of each of the streams, where `src[i]` and
+  // `dest[i]` are the deinterleaved channels of the stream with index i. All
+  // streams use the same input and output formats. Returns an error code if
+  // the processing of any of the streams fails.
+  int ProcessStreams(rtc::ArrayView<const float* const* const> src,
+                     const StreamConfig& input_config,
+                     const StreamConfig& output_config,
+                     rtc::ArrayView<float* const* const> dest);
+
+ private:
+  std::vector<scoped_refptr<AudioProcessingImpl>> streams_;
+  std::vector<AudioProcessingImpl*> stream_pointers_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_MULTI_STREAM_AUDIO_PROCESSING_H_
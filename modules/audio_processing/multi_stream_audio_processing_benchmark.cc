@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "api/audio/audio_processing.h"
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/scoped_refptr.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_processing/multi_stream_audio_processing.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr size_t kNumFrames = kSampleRateHz / 100;
+// The number of distinct frames cycled through per stream, so that the noise
+// suppressors do not settle on a single spectrum.
+constexpr size_t kNumInputFrames = 8;
+
+// The capture processing of a server that receives the microphone audio of
+// its participants: high-pass filtering, noise suppression and adaptive gain.
+AudioProcessing::Config CreateServerConfig() {
+  AudioProcessing::Config config;
+  config.high_pass_filter.enabled = true;
+  config.noise_suppression.enabled = true;
+  config.noise_suppression.level =
+      AudioProcessing::Config::NoiseSuppression::kHigh;
+  config.gain_controller2.enabled = true;
+  config.gain_controller2.adaptive_digital.enabled = true;
+  return config;
+}
+
+// Mono input and output frames for `num_streams` streams.
+class StreamFrames {
+ public:
+  explicit StreamFrames(size_t num_streams)
+      : input_(num_streams * kNumInputFrames, std::vector<float>(kNumFrames)),
+        output_(num_streams, std::vector<float>(kNumFrames)),
+        input_channels_(input_.size()),
+        output_channels_(num_streams) {
+    Random random(num_streams);
+    for (size_t i = 0; i < input_.size(); ++i) {
+      for (float& sample : input_[i]) {
+        sample = static_cast<float>(random.Gaussian(0.0, 0.05));
+      }
+      input_channels_[i] = input_[i].data();
+    }
+    for (size_t i = 0; i < num_streams; ++i) {
+      output_channels_[i] = output_[i].data();
+      output_pointers_.push_back(&output_channels_[i]);
+    }
+  }
+
+  // Returns the input of each stream for the frame with index `frame`.
+  const std::vector<const float* const*>& Input(size_t frame) {
+    input_pointers_.clear();
+    const size_t offset = (frame % kNumInputFrames) * output_.size();
+    for (size_t i = 0; i < output_.size(); ++i) {
+      input_pointers_.push_back(&input_channels_[offset + i]);
+    }
+    return input_pointers_;
+  }
+  const std::vector<float* const*>& Output() { return output_pointers_; }
+
+ private:
+  std::vector<std::vector<float>> input_;
+  std::vector<std::vector<float>> output_;
+  std::vector<const float*> input_channels_;
+  std::vector<float*> output_channels_;
+  std::vector<const float* const*> input_pointers_;
+  std::vector<float* const*> output_pointers_;
+};
+
+// Processes one 10 ms frame of each stream per iteration, with one
+// ProcessStream() call per stream.
+void BM_ProcessStreamPerStream(benchmark::State& state) {
+  const size_t num_streams = state.range(0);
+  const Environment env = CreateEnvironment();
+  std::vector<scoped_refptr<AudioProcessing>> apms;
+  for (size_t i = 0; i < num_streams; ++i) {
+    apms.push_back(BuiltinAudioProcessingBuilder()
+                       .SetConfig(CreateServerConfig())
+                       .Build(env));
+  }
+  const StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  StreamFrames frames(num_streams);
+  size_t frame = 0;
+  for (auto s : state) {
+    const std::vector<const float* const*>& input = frames.Input(frame++);
+    for (size_t i = 0; i < num_streams; ++i) {
+      apms[i]->ProcessStream(input[i], stream_config, stream_config,
+                             frames.Output()[i]);
+    }
+  }
+  state.counters["time_per_stream"] = benchmark::Counter(
+      num_streams, benchmark::Counter::kIsIterationInvariantRate |
+                       benchmark::Counter::kInvert);
+}
+
+// Processes one 10 ms frame of each stream per iteration, with one
+// MultiStreamAudioProcessing::ProcessStreams() call.
+void BM_ProcessStreamsBatched(benchmark::State& state) {
+  const size_t num_streams = state.range(0);
+  MultiStreamAudioProcessing apm(CreateEnvironment(), CreateServerConfig(),
+                                 num_streams);
+  const StreamConfig stream_config(kSampleRateHz, /*num_channels=*/1);
+  StreamFrames frames(num_streams);
+  size_t frame = 0;
+  for (auto s : state) {
+    apm.ProcessStreams(frames.Input(frame++), stream_config, stream_config,
+                       frames.Output());
+  }
+  state.counters["time_per_stream"] = benchmark::Counter(
+      num_streams, benchmark::Counter::kIsIterationInvariantRate |
+                       benchmark::Counter::kInvert);
+}
+
+BENCHMARK(BM_ProcessStreamPerStream)
+    ->ArgName("streams")
+    ->Arg(4)
+    ->Arg(32)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ProcessStreamsBatched)
+    ->ArgName("streams")
+    ->Arg(4)
+    ->Arg(32)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace webrtc
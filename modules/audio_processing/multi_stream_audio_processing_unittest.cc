@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/multi_stream_audio_processing.h"
+
+#include <math.h>
+
+#include <tuple>
+#include <vector>
+
+#include "api/audio/audio_processing.h"
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Six streams fill one group of SIMD lanes and leave two streams over.
+constexpr size_t kNumStreams = 6;
+
+AudioProcessing::Config CreateConfig() {
+  AudioProcessing::Config config;
+  config.high_pass_filter.enabled = true;
+  config.noise_suppression.enabled = true;
+  config.gain_controller2.enabled = true;
+  config.gain_controller2.adaptive_digital.enabled = true;
+  return config;
+}
+
+// Holds one frame of deinterleaved audio for each of the streams.
+class MultiStreamFrame {
+ public:
+  explicit MultiStreamFrame(const StreamConfig& config)
+      : samples_(kNumStreams,
+                 std::vector<std::vector<float>>(
+                     config.num_channels(),
+                     std::vector<float>(config.num_frames()))),
+        channels_(kNumStreams) {
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      for (auto& channel : samples_[i]) {
+        channels_[i].push_back(channel.data());
+      }
+      stream_pointers_.push_back(channels_[i].data());
+      const_stream_pointers_.push_back(channels_[i].data());
+    }
+  }
+
+  void Randomize(Random& random) {
+    for (auto& stream : samples_) {
+      for (auto& channel : stream) {
+        for (float& sample : channel) {
+          sample = static_cast<float>(random.Gaussian(0.0, 0.1));
+        }
+      }
+    }
+  }
+
+  float* const* stream(size_t index) { return channels_[index].data(); }
+  const std::vector<std::vector<float>>& samples(size_t index) const {
+    return samples_[index];
+  }
+  const std::vector<float* const*>& streams() { return stream_pointers_; }
+  const std::vector<const float* const*>& const_streams() {
+    return const_stream_pointers_;
+  }
+
+ private:
+  std::vector<std::vector<std::vector<float>>> samples_;
+  std::vector<std::vector<float*>> channels_;
+  std::vector<float* const*> stream_pointers_;
+  std::vector<const float* const*> const_stream_pointers_;
+};
+
+class MultiStreamAudioProcessingTest
+    : public ::testing::TestWithParam<std::tuple<int, size_t>> {};
+
+INSTANTIATE_TEST_SUITE_P(
+    MultiStreamAudioProcessing,
+    MultiStreamAudioProcessingTest,
+    ::testing::Combine(::testing::Values(16000, 32000, 48000),
+                       ::testing::Values(1, 2)));
+
+// Verifies that processing the streams together gives the same output as
+// processing each of them with a separate instance.
+TEST_P(MultiStreamAudioProcessingTest, MatchesSeparateProcessing) {
+  const Environment env = CreateEnvironment();
+  const StreamConfig stream_config(std::get<0>(GetParam()),
+                                   std::get<1>(GetParam()));
+  MultiStreamAudioProcessing multi_stream_apm(env, CreateConfig(),
+                                              kNumStreams);
+  ASSERT_EQ(multi_stream_apm.num_streams(), kNumStreams);
+  std::vector<scoped_refptr<AudioProcessing>> apms;
+  for (size_t i = 0; i < kNumStreams; ++i) {
+    apms.push_back(
+        BuiltinAudioProcessingBuilder().SetConfig(CreateConfig()).Build(env));
+  }
+
+  Random random(42);
+  MultiStreamFrame input(stream_config);
+  MultiStreamFrame output(stream_config);
+  MultiStreamFrame reference(stream_config);
+  for (int frame = 0; frame < 100; ++frame) {
+    input.Randomize(random);
+    ASSERT_EQ(AudioProcessing::kNoError,
+              multi_stream_apm.ProcessStreams(input.const_streams(),
+                                              stream_config, stream_config,
+                                              output.streams()));
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      ASSERT_EQ(AudioProcessing::kNoError,
+                apms[i]->ProcessStream(input.stream(i), stream_config,
+                                       stream_config, reference.stream(i)));
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      EXPECT_EQ(reference.samples(i), output.samples(i));
+#else
+      for (size_t ch = 0; ch < stream_config.num_channels(); ++ch) {
+        for (size_t k = 0; k < stream_config.num_frames(); ++k) {
+          const float expected = reference.samples(i)[ch][k];
+          EXPECT_NEAR(expected, output.samples(i)[ch][k],
+                      1e-3f * (1.f + fabsf(expected)));
+        }
+      }
+#endif
+    }
+  }
+}
+
+TEST(MultiStreamAudioProcessing, RejectsUnsupportedFormats) {
+  const StreamConfig input_config(16000, 1);
+  const StreamConfig output_config(16000, 3);
+  MultiStreamAudioProcessing multi_stream_apm(CreateEnvironment(),
+                                              CreateConfig(), kNumStreams);
+  MultiStreamFrame input(input_config);
+  MultiStreamFrame output(output_config);
+  EXPECT_EQ(AudioProcessing::kBadNumberChannelsError,
+            multi_stream_apm.ProcessStreams(input.const_streams(),
+                                            input_config, output_config,
+                                            output.streams()));
+}
+
+}  // namespace
+}  // namespace webrtc
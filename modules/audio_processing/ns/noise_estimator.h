@@ -16,6 +16,7 @@
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/quantile_noise_estimator.h"
+#include "modules/audio_processing/ns/spectral_kernels.h"
 #include "modules/audio_processing/ns/suppression_params.h"
 
 namespace webrtc {
@@ -24,7 +25,8 @@ namespace webrtc {
 // signal.
 class NoiseEstimator {
  public:
-  explicit NoiseEstimator(const SuppressionParams& suppression_params);
+  NoiseEstimator(const SuppressionParams& suppression_params,
+                 NsOptimization optimization);
 
   // Prepare the estimator for analysis of a new frame.
   void PrepareAnalysis();
@@ -16,7 +16,6 @@
 
 #include <algorithm>
 
-#include "modules/audio_processing/ns/fast_math.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -144,46 +143,6 @@ float ComputeEnergyOfExtendedFrame(
   return energy;
 }
 
-// Computes the magnitude spectrum based on an FFT output.
-void ComputeMagnitudeSpectrum(
-    rtc::ArrayView<const float, kFftSize> real,
-    rtc::ArrayView<const float, kFftSize> imag,
-    rtc::ArrayView<float, kFftSizeBy2Plus1> signal_spectrum) {
-  signal_spectrum[0] = fabsf(real[0]) + 1.f;
-  signal_spectrum[kFftSizeBy2Plus1 - 1] =
-      fabsf(real[kFftSizeBy2Plus1 - 1]) + 1.f;
-
-  for (size_t i = 1; i < kFftSizeBy2Plus1 - 1; ++i) {
-    signal_spectrum[i] =
-        SqrtFastApproximation(real[i] * real[i] + imag[i] * imag[i]) + 1.f;
-  }
-}
-
-// Compute prior and post SNR.
-void ComputeSnr(rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
-                rtc::ArrayView<const float> prev_signal_spectrum,
-                rtc::ArrayView<const float> signal_spectrum,
-                rtc::ArrayView<const float> prev_noise_spectrum,
-                rtc::ArrayView<const float> noise_spectrum,
-                rtc::ArrayView<float> prior_snr,
-                rtc::ArrayView<float> post_snr) {
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    // Previous post SNR.
-    // Previous estimate: based on previous frame with gain filter.
-    float prev_estimate = prev_signal_spectrum[i] /
-                          (prev_noise_spectrum[i] + 0.0001f) * filter[i];
-    // Post SNR.
-    if (signal_spectrum[i] > noise_spectrum[i]) {
-      post_snr[i] = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
-    } else {
-      post_snr[i] = 0.f;
-    }
-    // The directed decision estimate of the prior SNR is a sum the current and
-    // previous estimates.
-    prior_snr[i] = 0.98f * prev_estimate + (1.f - 0.98f) * post_snr[i];
-  }
-}
-
 // Computes the attenuating gain for the noise suppression of the upper bands.
 float ComputeUpperBandsGain(
     float minimum_attenuating_gain,
@@ -240,9 +199,10 @@ float ComputeUpperBandsGain(
 
 NoiseSuppressor::ChannelState::ChannelState(
     const SuppressionParams& suppression_params,
-    size_t num_bands)
-    : wiener_filter(suppression_params),
-      noise_estimator(suppression_params),
+    size_t num_bands,
+    NsOptimization optimization)
+    : wiener_filter(suppression_params, optimization),
+      noise_estimator(suppression_params, optimization),
       process_delay_memory(num_bands > 1 ? num_bands - 1 : 0) {
   analyze_analysis_memory.fill(0.f);
   prev_analysis_signal_spectrum.fill(1.f);
@@ -256,17 +216,28 @@ NoiseSuppressor::ChannelState::ChannelState(
 NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
                                  size_t sample_rate_hz,
                                  size_t num_channels)
+    : NoiseSuppressor(config,
+                      sample_rate_hz,
+                      num_channels,
+                      DetectNsOptimization()) {}
+
+NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
+                                 size_t sample_rate_hz,
+                                 size_t num_channels,
+                                 NsOptimization optimization)
     : num_bands_(NumBandsForRate(sample_rate_hz)),
       num_channels_(num_channels),
       suppression_params_(config.target_level),
+      kernels_(optimization),
+      fft_(optimization),
       filter_bank_states_heap_(NumChannelsOnHeap(num_channels_)),
       upper_band_gains_heap_(NumChannelsOnHeap(num_channels_)),
       energies_before_filtering_heap_(NumChannelsOnHeap(num_channels_)),
       gain_adjustments_heap_(NumChannelsOnHeap(num_channels_)),
       channels_(num_channels_) {
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channels_[ch] =
-        std::make_unique<ChannelState>(suppression_params_, num_bands_);
+    channels_[ch] = std::make_unique<ChannelState>(suppression_params_,
+                                                   num_bands_, optimization);
   }
 }
 
@@ -339,7 +310,7 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
     fft_.Fft(extended_frame, real, imag);
 
     std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(real, imag, signal_spectrum);
+    kernels_.MagnitudeSpectrum(real, imag, signal_spectrum);
 
     // Compute energies.
     float signal_energy = 0.f;
@@ -360,10 +331,11 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
 
     std::array<float, kFftSizeBy2Plus1> post_snr;
     std::array<float, kFftSizeBy2Plus1> prior_snr;
-    ComputeSnr(ch_p->wiener_filter.get_filter(),
-               ch_p->prev_analysis_signal_spectrum, signal_spectrum,
-               ch_p->noise_estimator.get_prev_noise_spectrum(),
-               ch_p->noise_estimator.get_noise_spectrum(), prior_snr, post_snr);
+    kernels_.Snr(ch_p->wiener_filter.get_filter(),
+                 ch_p->prev_analysis_signal_spectrum, signal_spectrum,
+                 ch_p->noise_estimator.get_prev_noise_spectrum(),
+                 ch_p->noise_estimator.get_noise_spectrum(), prior_snr,
+                 post_snr);
 
     ch_p->speech_probability_estimator.Update(
         num_analyzed_frames_, prior_snr, post_snr,
@@ -426,8 +398,8 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
              filter_bank_states[ch].imag);
 
     std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(filter_bank_states[ch].real,
-                             filter_bank_states[ch].imag, signal_spectrum);
+    kernels_.MagnitudeSpectrum(filter_bank_states[ch].real,
+                               filter_bank_states[ch].imag, signal_spectrum);
 
     // Compute the frequency domain gain filter for noise attenuation.
     channels_[ch]->wiener_filter.Update(
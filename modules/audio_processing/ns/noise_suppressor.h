@@ -20,6 +20,7 @@
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/ns_config.h"
 #include "modules/audio_processing/ns/ns_fft.h"
+#include "modules/audio_processing/ns/spectral_kernels.h"
 #include "modules/audio_processing/ns/speech_probability_estimator.h"
 #include "modules/audio_processing/ns/wiener_filter.h"
 
@@ -31,6 +32,11 @@ class NoiseSuppressor {
   NoiseSuppressor(const NsConfig& config,
                   size_t sample_rate_hz,
                   size_t num_channels);
+  // Uses `optimization` instead of the best optimization the CPU supports.
+  NoiseSuppressor(const NsConfig& config,
+                  size_t sample_rate_hz,
+                  size_t num_channels,
+                  NsOptimization optimization);
   NoiseSuppressor(const NoiseSuppressor&) = delete;
   NoiseSuppressor& operator=(const NoiseSuppressor&) = delete;
 
@@ -53,12 +59,15 @@ class NoiseSuppressor {
   const size_t num_bands_;
   const size_t num_channels_;
   const SuppressionParams suppression_params_;
+  const SpectralKernels kernels_;
   int32_t num_analyzed_frames_ = -1;
   NrFft fft_;
   bool capture_output_used_ = true;
 
   struct ChannelState {
-    ChannelState(const SuppressionParams& suppression_params, size_t num_bands);
+    ChannelState(const SuppressionParams& suppression_params,
+                 size_t num_bands,
+                 NsOptimization optimization);
 
     SpeechProbabilityEstimator speech_probability_estimator;
     WienerFilter wiener_filter;
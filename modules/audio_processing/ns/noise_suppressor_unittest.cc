@@ -16,7 +16,10 @@
 #include <utility>
 #include <vector>
 
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 
@@ -99,4 +102,60 @@ TEST(NoiseSuppressor, IdenticalChannelEffects) {
   }
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Verifies that the SIMD optimizations give bit-exact results.
+TEST(NoiseSuppressor, SimdOptimizationsAreBitExact) {
+  constexpr int kRate = 48000;
+  constexpr size_t kNumChannels = 2;
+  constexpr size_t kNumBands = kRate / 16000;
+  std::vector<NsOptimization> optimizations;
+  if (GetCPUInfo(kSSE2) != 0) {
+    optimizations.push_back(NsOptimization::kSse2);
+  }
+  if (GetCPUInfo(kAVX2) != 0) {
+    optimizations.push_back(NsOptimization::kAvx2);
+  }
+
+  for (NsOptimization optimization : optimizations) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    AudioBuffer audio(kRate, kNumChannels, kRate, kNumChannels, kRate,
+                      kNumChannels);
+    AudioBuffer audio_simd(kRate, kNumChannels, kRate, kNumChannels, kRate,
+                           kNumChannels);
+    NsConfig cfg;
+    NoiseSuppressor ns(cfg, kRate, kNumChannels, NsOptimization::kNone);
+    NoiseSuppressor ns_simd(cfg, kRate, kNumChannels, optimization);
+    Random random(42);
+    for (size_t frame_index = 0; frame_index < 500; ++frame_index) {
+      // Alternate between noise only and noise with a louder tone.
+      const float tone_amplitude = (frame_index / 50) % 2 ? 3000.f : 0.f;
+      for (size_t ch = 0; ch < kNumChannels; ++ch) {
+        for (size_t b = 0; b < kNumBands; ++b) {
+          for (size_t i = 0; i < 160; ++i) {
+            const float value =
+                static_cast<float>(random.Gaussian(0.0, 300.0)) +
+                tone_amplitude * sinf(0.1f * (frame_index * 160 + i));
+            audio.split_bands(ch)[b][i] = value;
+            audio_simd.split_bands(ch)[b][i] = value;
+          }
+        }
+      }
+
+      ns.Analyze(audio);
+      ns.Process(&audio);
+      ns_simd.Analyze(audio_simd);
+      ns_simd.Process(&audio_simd);
+      for (size_t ch = 0; ch < kNumChannels; ++ch) {
+        for (size_t b = 0; b < kNumBands; ++b) {
+          for (size_t i = 0; i < 160; ++i) {
+            ASSERT_EQ(audio.split_bands_const(ch)[b][i],
+                      audio_simd.split_bands_const(ch)[b][i]);
+          }
+        }
+      }
+    }
+  }
+}
+#endif
+
 }  // namespace webrtc
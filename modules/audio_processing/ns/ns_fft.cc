@@ -10,25 +10,50 @@
 
 #include "modules/audio_processing/ns/ns_fft.h"
 
+#include <array>
+#include <vector>
+
 #include "common_audio/third_party/ooura/fft_size_256/fft4g.h"
+#include "rtc_base/system/arch.h"
 
 namespace webrtc {
 
-NrFft::NrFft() : bit_reversal_state_(kFftSize / 2), tables_(kFftSize / 2) {
-  // Initialize WebRtc_rdt (setting (bit_reversal_state_[0] to 0 triggers
-  // initialization)
-  bit_reversal_state_[0] = 0.f;
-  std::array<float, kFftSize> tmp_buffer;
-  tmp_buffer.fill(0.f);
-  WebRtc_rdft(kFftSize, 1, tmp_buffer.data(), bit_reversal_state_.data(),
-              tables_.data());
+namespace {
+
+// The initialized state of WebRtc_rdft. Many noise suppressors are typically
+// active in a server process, and sharing the tables keeps them in the cache.
+struct RdftState {
+  RdftState() : bit_reversal_state(kFftSize / 2), tables(kFftSize / 2) {
+    // Initialize WebRtc_rdt (setting (bit_reversal_state[0] to 0 triggers
+    // initialization)
+    bit_reversal_state[0] = 0.f;
+    std::array<float, kFftSize> tmp_buffer;
+    tmp_buffer.fill(0.f);
+    WebRtc_rdft(kFftSize, 1, tmp_buffer.data(), bit_reversal_state.data(),
+                tables.data());
+  }
+
+  std::vector<size_t> bit_reversal_state;
+  std::vector<float> tables;
+};
+
+RdftState& GetInitializedRdftState() {
+  static RdftState* const state = new RdftState();
+  return *state;
 }
 
+}  // namespace
+
+NrFft::NrFft(NsOptimization optimization)
+    : use_sse2_(optimization == NsOptimization::kSse2 ||
+                optimization == NsOptimization::kAvx2),
+      bit_reversal_state_(GetInitializedRdftState().bit_reversal_state),
+      tables_(GetInitializedRdftState().tables.data()) {}
+
 void NrFft::Fft(rtc::ArrayView<float, kFftSize> time_data,
                 rtc::ArrayView<float, kFftSize> real,
                 rtc::ArrayView<float, kFftSize> imag) {
-  WebRtc_rdft(kFftSize, 1, time_data.data(), bit_reversal_state_.data(),
-              tables_.data());
+  Rdft(1, time_data.data());
 
   imag[0] = 0;
   real[0] = time_data[0];
@@ -51,8 +76,7 @@ void NrFft::Ifft(rtc::ArrayView<const float> real,
     time_data[2 * i] = real[i];
     time_data[2 * i + 1] = imag[i];
   }
-  WebRtc_rdft(kFftSize, -1, time_data.data(), bit_reversal_state_.data(),
-              tables_.data());
+  Rdft(-1, time_data.data());
 
   // Scale the output
   constexpr float kScaling = 2.f / kFftSize;
@@ -61,4 +85,15 @@ void NrFft::Ifft(rtc::ArrayView<const float> real,
   }
 }
 
+void NrFft::Rdft(int direction, float* data) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (use_sse2_) {
+    WebRtc_rdft_SSE2(kFftSize, direction, data, bit_reversal_state_.data(),
+                     tables_);
+    return;
+  }
+#endif
+  WebRtc_rdft(kFftSize, direction, data, bit_reversal_state_.data(), tables_);
+}
+
 }  // namespace webrtc
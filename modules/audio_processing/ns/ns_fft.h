@@ -15,13 +15,14 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/spectral_kernels.h"
 
 namespace webrtc {
 
 // Wrapper class providing 256 point FFT functionality.
 class NrFft {
  public:
-  NrFft();
+  explicit NrFft(NsOptimization optimization);
   NrFft(const NrFft&) = delete;
   NrFft& operator=(const NrFft&) = delete;
 
@@ -36,8 +37,13 @@ class NrFft {
             rtc::ArrayView<float> time_data);
 
  private:
+  void Rdft(int direction, float* data);
+
+  const bool use_sse2_;
+  // Holds a work area that is written by every transform.
   std::vector<size_t> bit_reversal_state_;
-  std::vector<float> tables_;
+  // Shared by all instances, as the tables are only written when initialized.
+  float* const tables_;
 };
 
 }  // namespace webrtc
@@ -17,6 +17,7 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/spectral_kernels.h"
 
 namespace webrtc {
 
@@ -25,7 +26,7 @@ constexpr int kSimult = 3;
 // For quantile noise estimation.
 class QuantileNoiseEstimator {
  public:
-  QuantileNoiseEstimator();
+  explicit QuantileNoiseEstimator(NsOptimization optimization);
   QuantileNoiseEstimator(const QuantileNoiseEstimator&) = delete;
   QuantileNoiseEstimator& operator=(const QuantileNoiseEstimator&) = delete;
 
@@ -34,6 +35,7 @@ class QuantileNoiseEstimator {
                 rtc::ArrayView<float, kFftSizeBy2Plus1> noise_spectrum);
 
  private:
+  const SpectralKernels kernels_;
   std::array<float, kSimult * kFftSizeBy2Plus1> density_;
   std::array<float, kSimult * kFftSizeBy2Plus1> log_quantile_;
   std::array<float, kFftSizeBy2Plus1> quantile_;
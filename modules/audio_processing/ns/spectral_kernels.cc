@@ -0,0 +1,435 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/spectral_kernels.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#include "modules/audio_processing/ns/fast_math.h"
+#include "rtc_base/checks.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
+namespace webrtc {
+
+NsOptimization DetectNsOptimization() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2) != 0) {
+    return NsOptimization::kAvx2;
+  } else if (GetCPUInfo(kSSE2) != 0) {
+    return NsOptimization::kSse2;
+  }
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+  return NsOptimization::kNeon;
+#else
+  return NsOptimization::kNone;
+#endif
+}
+
+SpectralKernels::SpectralKernels(NsOptimization optimization)
+    : optimization_(optimization) {}
+
+void SpectralKernels::Log(rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+                          rtc::ArrayView<float, kFftSizeBy2Plus1> y) const {
+  size_t k = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kAvx2:
+      LogAvx2(x, y);
+      return;
+    case NsOptimization::kSse2: {
+      const __m128 scaling = _mm_set1_ps(kLog2Scaling);
+      const __m128 bias = _mm_set1_ps(kLog2Bias);
+      const __m128 log_of_2 = _mm_set1_ps(kLogOf2);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        // The input is positive, so the sign bit is zero and the signed
+        // conversion gives the same result as the unsigned one in the scalar
+        // code.
+        const __m128i bits = _mm_castps_si128(_mm_loadu_ps(&x[k]));
+        __m128 log2 = _mm_mul_ps(_mm_cvtepi32_ps(bits), scaling);
+        log2 = _mm_sub_ps(log2, bias);
+        _mm_storeu_ps(&y[k], _mm_mul_ps(log2, log_of_2));
+      }
+    } break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon: {
+      const float32x4_t scaling = vdupq_n_f32(kLog2Scaling);
+      const float32x4_t bias = vdupq_n_f32(kLog2Bias);
+      const float32x4_t log_of_2 = vdupq_n_f32(kLogOf2);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(&x[k]));
+        float32x4_t log2 = vmulq_f32(vcvtq_f32_u32(bits), scaling);
+        log2 = vsubq_f32(log2, bias);
+        vst1q_f32(&y[k], vmulq_f32(log2, log_of_2));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+  LogScalar(k, x, y);
+}
+
+void SpectralKernels::MagnitudeSpectrum(
+    rtc::ArrayView<const float, kFftSize> real,
+    rtc::ArrayView<const float, kFftSize> imag,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum) const {
+  spectrum[0] = fabsf(real[0]) + 1.f;
+  spectrum[kFftSizeBy2Plus1 - 1] = fabsf(real[kFftSizeBy2Plus1 - 1]) + 1.f;
+
+  size_t k = 1;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kAvx2:
+      MagnitudeSpectrumAvx2(real, imag, spectrum);
+      return;
+    case NsOptimization::kSse2: {
+      const __m128 one = _mm_set1_ps(1.f);
+      for (; k + 4 <= kFftSizeBy2Plus1 - 1; k += 4) {
+        const __m128 re = _mm_loadu_ps(&real[k]);
+        const __m128 im = _mm_loadu_ps(&imag[k]);
+        const __m128 power =
+            _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        _mm_storeu_ps(&spectrum[k], _mm_add_ps(_mm_sqrt_ps(power), one));
+      }
+    } break;
+#endif
+#if defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t one = vdupq_n_f32(1.f);
+      for (; k + 4 <= kFftSizeBy2Plus1 - 1; k += 4) {
+        const float32x4_t re = vld1q_f32(&real[k]);
+        const float32x4_t im = vld1q_f32(&imag[k]);
+        const float32x4_t power =
+            vaddq_f32(vmulq_f32(re, re), vmulq_f32(im, im));
+        vst1q_f32(&spectrum[k], vaddq_f32(vsqrtq_f32(power), one));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+  MagnitudeSpectrumScalar(k, real, imag, spectrum);
+}
+
+void SpectralKernels::Snr(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const {
+  size_t k = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kAvx2:
+      SnrAvx2(filter, prev_signal_spectrum, signal_spectrum,
+              prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+      return;
+    case NsOptimization::kSse2: {
+      const __m128 regularization = _mm_set1_ps(kSnrRegularization);
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 prev_weight = _mm_set1_ps(kPriorSnrSmoothing);
+      const __m128 current_weight = _mm_set1_ps(1.f - kPriorSnrSmoothing);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const __m128 prev_estimate = _mm_mul_ps(
+            _mm_div_ps(_mm_loadu_ps(&prev_signal_spectrum[k]),
+                       _mm_add_ps(_mm_loadu_ps(&prev_noise_spectrum[k]),
+                                  regularization)),
+            _mm_loadu_ps(&filter[k]));
+        const __m128 signal = _mm_loadu_ps(&signal_spectrum[k]);
+        const __m128 noise = _mm_loadu_ps(&noise_spectrum[k]);
+        const __m128 snr = _mm_sub_ps(
+            _mm_div_ps(signal, _mm_add_ps(noise, regularization)), one);
+        const __m128 post = _mm_and_ps(_mm_cmpgt_ps(signal, noise), snr);
+        _mm_storeu_ps(&post_snr[k], post);
+        _mm_storeu_ps(&prior_snr[k],
+                      _mm_add_ps(_mm_mul_ps(prev_weight, prev_estimate),
+                                 _mm_mul_ps(current_weight, post)));
+      }
+    } break;
+#endif
+#if defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t regularization = vdupq_n_f32(kSnrRegularization);
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t prev_weight = vdupq_n_f32(kPriorSnrSmoothing);
+      const float32x4_t current_weight = vdupq_n_f32(1.f - kPriorSnrSmoothing);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const float32x4_t prev_estimate = vmulq_f32(
+            vdivq_f32(vld1q_f32(&prev_signal_spectrum[k]),
+                      vaddq_f32(vld1q_f32(&prev_noise_spectrum[k]),
+                                regularization)),
+            vld1q_f32(&filter[k]));
+        const float32x4_t signal = vld1q_f32(&signal_spectrum[k]);
+        const float32x4_t noise = vld1q_f32(&noise_spectrum[k]);
+        const float32x4_t snr =
+            vsubq_f32(vdivq_f32(signal, vaddq_f32(noise, regularization)), one);
+        const float32x4_t post = vreinterpretq_f32_u32(
+            vandq_u32(vcgtq_f32(signal, noise), vreinterpretq_u32_f32(snr)));
+        vst1q_f32(&post_snr[k], post);
+        vst1q_f32(&prior_snr[k],
+                  vaddq_f32(vmulq_f32(prev_weight, prev_estimate),
+                            vmulq_f32(current_weight, post)));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+  SnrScalar(k, filter, prev_signal_spectrum, signal_spectrum,
+            prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+}
+
+void SpectralKernels::WienerGain(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    float over_subtraction_factor,
+    float minimum_gain,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) const {
+  size_t k = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kAvx2:
+      WienerGainAvx2(prior_snr, over_subtraction_factor, minimum_gain, filter);
+      return;
+    case NsOptimization::kSse2: {
+      const __m128 over_subtraction = _mm_set1_ps(over_subtraction_factor);
+      const __m128 min_gain = _mm_set1_ps(minimum_gain);
+      const __m128 one = _mm_set1_ps(1.f);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const __m128 snr = _mm_loadu_ps(&prior_snr[k]);
+        __m128 gain = _mm_div_ps(snr, _mm_add_ps(over_subtraction, snr));
+        // The operand order matches that of std::min() and std::max().
+        gain = _mm_max_ps(min_gain, _mm_min_ps(one, gain));
+        _mm_storeu_ps(&filter[k], gain);
+      }
+    } break;
+#endif
+#if defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t over_subtraction = vdupq_n_f32(over_subtraction_factor);
+      const float32x4_t min_gain = vdupq_n_f32(minimum_gain);
+      const float32x4_t one = vdupq_n_f32(1.f);
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const float32x4_t snr = vld1q_f32(&prior_snr[k]);
+        float32x4_t gain = vdivq_f32(snr, vaddq_f32(over_subtraction, snr));
+        gain = vmaxq_f32(vminq_f32(gain, one), min_gain);
+        vst1q_f32(&filter[k], gain);
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+  WienerGainScalar(k, prior_snr, over_subtraction_factor, minimum_gain,
+                   filter);
+}
+
+void SpectralKernels::UpdateQuantile(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    float counter,
+    float one_by_counter_plus_1,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) const {
+  size_t k = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kAvx2:
+      UpdateQuantileAvx2(log_spectrum, counter, one_by_counter_plus_1,
+                         log_quantile, density);
+      return;
+    case NsOptimization::kSse2: {
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 forty = _mm_set1_ps(40.f);
+      const __m128 counter_v = _mm_set1_ps(counter);
+      const __m128 one_by_counter_plus_1_v =
+          _mm_set1_ps(one_by_counter_plus_1);
+      const __m128 up_step = _mm_set1_ps(0.25f);
+      const __m128 down_step = _mm_set1_ps(0.75f);
+      const __m128 width = _mm_set1_ps(kQuantileWidth);
+      const __m128 one_by_width_plus_2 =
+          _mm_set1_ps(1.f / (2.f * kQuantileWidth));
+      const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const __m128 log_spectrum_k = _mm_loadu_ps(&log_spectrum[k]);
+        __m128 log_quantile_k = _mm_loadu_ps(&log_quantile[k]);
+        __m128 density_k = _mm_loadu_ps(&density[k]);
+
+        const __m128 dense = _mm_cmpgt_ps(density_k, one);
+        const __m128 delta =
+            _mm_or_ps(_mm_and_ps(dense, _mm_div_ps(forty, density_k)),
+                      _mm_andnot_ps(dense, forty));
+        const __m128 multiplier = _mm_mul_ps(delta, one_by_counter_plus_1_v);
+        const __m128 above = _mm_cmpgt_ps(log_spectrum_k, log_quantile_k);
+        const __m128 up =
+            _mm_add_ps(log_quantile_k, _mm_mul_ps(up_step, multiplier));
+        const __m128 down =
+            _mm_sub_ps(log_quantile_k, _mm_mul_ps(down_step, multiplier));
+        log_quantile_k =
+            _mm_or_ps(_mm_and_ps(above, up), _mm_andnot_ps(above, down));
+        _mm_storeu_ps(&log_quantile[k], log_quantile_k);
+
+        const __m128 close = _mm_cmplt_ps(
+            _mm_and_ps(abs_mask, _mm_sub_ps(log_spectrum_k, log_quantile_k)),
+            width);
+        const __m128 updated_density = _mm_mul_ps(
+            _mm_add_ps(_mm_mul_ps(counter_v, density_k), one_by_width_plus_2),
+            one_by_counter_plus_1_v);
+        density_k = _mm_or_ps(_mm_and_ps(close, updated_density),
+                              _mm_andnot_ps(close, density_k));
+        _mm_storeu_ps(&density[k], density_k);
+      }
+    } break;
+#endif
+#if defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t forty = vdupq_n_f32(40.f);
+      const float32x4_t counter_v = vdupq_n_f32(counter);
+      const float32x4_t one_by_counter_plus_1_v =
+          vdupq_n_f32(one_by_counter_plus_1);
+      const float32x4_t up_step = vdupq_n_f32(0.25f);
+      const float32x4_t down_step = vdupq_n_f32(0.75f);
+      const float32x4_t width = vdupq_n_f32(kQuantileWidth);
+      const float32x4_t one_by_width_plus_2 =
+          vdupq_n_f32(1.f / (2.f * kQuantileWidth));
+      for (; k + 4 <= kFftSizeBy2Plus1; k += 4) {
+        const float32x4_t log_spectrum_k = vld1q_f32(&log_spectrum[k]);
+        float32x4_t log_quantile_k = vld1q_f32(&log_quantile[k]);
+        float32x4_t density_k = vld1q_f32(&density[k]);
+
+        const float32x4_t delta = vbslq_f32(
+            vcgtq_f32(density_k, one), vdivq_f32(forty, density_k), forty);
+        const float32x4_t multiplier =
+            vmulq_f32(delta, one_by_counter_plus_1_v);
+        log_quantile_k = vbslq_f32(
+            vcgtq_f32(log_spectrum_k, log_quantile_k),
+            vaddq_f32(log_quantile_k, vmulq_f32(up_step, multiplier)),
+            vsubq_f32(log_quantile_k, vmulq_f32(down_step, multiplier)));
+        vst1q_f32(&log_quantile[k], log_quantile_k);
+
+        const float32x4_t updated_density = vmulq_f32(
+            vaddq_f32(vmulq_f32(counter_v, density_k), one_by_width_plus_2),
+            one_by_counter_plus_1_v);
+        density_k = vbslq_f32(
+            vcltq_f32(vabdq_f32(log_spectrum_k, log_quantile_k), width),
+            updated_density, density_k);
+        vst1q_f32(&density[k], density_k);
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+  UpdateQuantileScalar(k, log_spectrum, counter, one_by_counter_plus_1,
+                       log_quantile, density);
+}
+
+void SpectralKernels::LogScalar(
+    size_t begin,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> y) {
+  for (size_t k = begin; k < kFftSizeBy2Plus1; ++k) {
+    y[k] = LogApproximation(x[k]);
+  }
+}
+
+void SpectralKernels::MagnitudeSpectrumScalar(
+    size_t begin,
+    rtc::ArrayView<const float, kFftSize> real,
+    rtc::ArrayView<const float, kFftSize> imag,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum) {
+  RTC_DCHECK_GE(begin, 1);
+  for (size_t k = begin; k < kFftSizeBy2Plus1 - 1; ++k) {
+    spectrum[k] =
+        SqrtFastApproximation(real[k] * real[k] + imag[k] * imag[k]) + 1.f;
+  }
+}
+
+void SpectralKernels::SnrScalar(
+    size_t begin,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) {
+  for (size_t k = begin; k < kFftSizeBy2Plus1; ++k) {
+    // Previous estimate: based on previous frame with gain filter.
+    float prev_estimate = prev_signal_spectrum[k] /
+                          (prev_noise_spectrum[k] + kSnrRegularization) *
+                          filter[k];
+    // Post SNR.
+    if (signal_spectrum[k] > noise_spectrum[k]) {
+      post_snr[k] =
+          signal_spectrum[k] / (noise_spectrum[k] + kSnrRegularization) - 1.f;
+    } else {
+      post_snr[k] = 0.f;
+    }
+    // The directed decision estimate of the prior SNR is a sum the current and
+    // previous estimates.
+    prior_snr[k] = kPriorSnrSmoothing * prev_estimate +
+                   (1.f - kPriorSnrSmoothing) * post_snr[k];
+  }
+}
+
+void SpectralKernels::WienerGainScalar(
+    size_t begin,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    float over_subtraction_factor,
+    float minimum_gain,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) {
+  for (size_t k = begin; k < kFftSizeBy2Plus1; ++k) {
+    filter[k] = prior_snr[k] / (over_subtraction_factor + prior_snr[k]);
+    filter[k] = std::max(std::min(filter[k], 1.f), minimum_gain);
+  }
+}
+
+void SpectralKernels::UpdateQuantileScalar(
+    size_t begin,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    float counter,
+    float one_by_counter_plus_1,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) {
+  for (size_t k = begin; k < kFftSizeBy2Plus1; ++k) {
+    // Update log quantile estimate.
+    const float delta = density[k] > 1.f ? 40.f / density[k] : 40.f;
+
+    const float multiplier = delta * one_by_counter_plus_1;
+    if (log_spectrum[k] > log_quantile[k]) {
+      log_quantile[k] += 0.25f * multiplier;
+    } else {
+      log_quantile[k] -= 0.75f * multiplier;
+    }
+
+    // Update density estimate.
+    constexpr float kOneByWidthPlus2 = 1.f / (2.f * kQuantileWidth);
+    if (fabsf(log_spectrum[k] - log_quantile[k]) < kQuantileWidth) {
+      density[k] =
+          (counter * density[k] + kOneByWidthPlus2) * one_by_counter_plus_1;
+    }
+  }
+}
+
+}  // namespace webrtc
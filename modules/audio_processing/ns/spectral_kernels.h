@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_SPECTRAL_KERNELS_H_
+#define MODULES_AUDIO_PROCESSING_NS_SPECTRAL_KERNELS_H_
+
+#include <stddef.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "rtc_base/system/arch.h"
+
+namespace webrtc {
+
+enum class NsOptimization { kNone, kSse2, kAvx2, kNeon };
+
+// Detects what kind of optimizations to use for the noise suppressor.
+NsOptimization DetectNsOptimization();
+
+// Per-bin loops of the noise suppressor, with SSE2, AVX2 and NEON versions.
+// The SIMD versions perform the same operations, in the same order, as the
+// scalar ones. On x86 the results are therefore bit-exact. The NEON versions
+// of the loops that divide or take square roots are only used on ARM64.
+class SpectralKernels {
+ public:
+  explicit SpectralKernels(NsOptimization optimization);
+
+  NsOptimization optimization() const { return optimization_; }
+
+  // Computes y = LogApproximation(x) elementwise.
+  void Log(rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+           rtc::ArrayView<float, kFftSizeBy2Plus1> y) const;
+
+  // Computes the magnitude spectrum, offset by 1, of an FFT output.
+  void MagnitudeSpectrum(
+      rtc::ArrayView<const float, kFftSize> real,
+      rtc::ArrayView<const float, kFftSize> imag,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum) const;
+
+  // Computes the post SNR and the directed decision estimate of the prior SNR,
+  // based on the spectra of the current and the previous frame and on the
+  // filter applied to the previous frame.
+  void Snr(rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+           rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+           rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+           rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+           rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+           rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+           rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const;
+
+  // Computes the Wiener filter gains for a prior SNR, limited to
+  // [`minimum_gain`, 1].
+  void WienerGain(rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+                  float over_subtraction_factor,
+                  float minimum_gain,
+                  rtc::ArrayView<float, kFftSizeBy2Plus1> filter) const;
+
+  // Updates one of the simultaneous log quantile and density estimates of the
+  // quantile noise estimator.
+  void UpdateQuantile(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      float counter,
+      float one_by_counter_plus_1,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> density) const;
+
+ private:
+  // Scalar versions of the loops, starting at the bin `begin`. The SIMD
+  // versions use them for the bins that do not fill a whole vector.
+  static void LogScalar(size_t begin,
+                        rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+                        rtc::ArrayView<float, kFftSizeBy2Plus1> y);
+  static void MagnitudeSpectrumScalar(
+      size_t begin,
+      rtc::ArrayView<const float, kFftSize> real,
+      rtc::ArrayView<const float, kFftSize> imag,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum);
+  static void SnrScalar(
+      size_t begin,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr);
+  static void WienerGainScalar(
+      size_t begin,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+      float over_subtraction_factor,
+      float minimum_gain,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+  static void UpdateQuantileScalar(
+      size_t begin,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      float counter,
+      float one_by_counter_plus_1,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> density);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static void LogAvx2(rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+                      rtc::ArrayView<float, kFftSizeBy2Plus1> y);
+  static void MagnitudeSpectrumAvx2(
+      rtc::ArrayView<const float, kFftSize> real,
+      rtc::ArrayView<const float, kFftSize> imag,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum);
+  static void SnrAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr);
+  static void WienerGainAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+      float over_subtraction_factor,
+      float minimum_gain,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+  static void UpdateQuantileAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      float counter,
+      float one_by_counter_plus_1,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> density);
+#endif
+
+  // Constants shared by the scalar and the SIMD versions.
+  static constexpr float kSnrRegularization = 0.0001f;
+  static constexpr float kPriorSnrSmoothing = 0.98f;
+  static constexpr float kQuantileWidth = 0.01f;
+  static constexpr float kLog2Scaling = 1.1920929e-7f;  // 1/2^23
+  static constexpr float kLog2Bias = 126.942695f;
+  static constexpr float kLogOf2 = 0.69314718056f;
+
+  const NsOptimization optimization_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_SPECTRAL_KERNELS_H_
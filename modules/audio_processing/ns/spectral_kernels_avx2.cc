@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/spectral_kernels.h"
+
+namespace webrtc {
+
+// This file is built without FMA support, as fused multiply-adds would make
+// the results differ from those of the scalar code.
+
+void SpectralKernels::LogAvx2(rtc::ArrayView<const float, kFftSizeBy2Plus1> x,
+                              rtc::ArrayView<float, kFftSizeBy2Plus1> y) {
+  const __m256 scaling = _mm256_set1_ps(kLog2Scaling);
+  const __m256 bias = _mm256_set1_ps(kLog2Bias);
+  const __m256 log_of_2 = _mm256_set1_ps(kLogOf2);
+  size_t k = 0;
+  for (; k + 8 <= kFftSizeBy2Plus1; k += 8) {
+    const __m256i bits = _mm256_castps_si256(_mm256_loadu_ps(&x[k]));
+    __m256 log2 = _mm256_mul_ps(_mm256_cvtepi32_ps(bits), scaling);
+    log2 = _mm256_sub_ps(log2, bias);
+    _mm256_storeu_ps(&y[k], _mm256_mul_ps(log2, log_of_2));
+  }
+  LogScalar(k, x, y);
+}
+
+void SpectralKernels::MagnitudeSpectrumAvx2(
+    rtc::ArrayView<const float, kFftSize> real,
+    rtc::ArrayView<const float, kFftSize> imag,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> spectrum) {
+  const __m256 one = _mm256_set1_ps(1.f);
+  size_t k = 1;
+  for (; k + 8 <= kFftSizeBy2Plus1 - 1; k += 8) {
+    const __m256 re = _mm256_loadu_ps(&real[k]);
+    const __m256 im = _mm256_loadu_ps(&imag[k]);
+    const __m256 power =
+        _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+    _mm256_storeu_ps(&spectrum[k], _mm256_add_ps(_mm256_sqrt_ps(power), one));
+  }
+  MagnitudeSpectrumScalar(k, real, imag, spectrum);
+}
+
+void SpectralKernels::SnrAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) {
+  const __m256 regularization = _mm256_set1_ps(kSnrRegularization);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 prev_weight = _mm256_set1_ps(kPriorSnrSmoothing);
+  const __m256 current_weight = _mm256_set1_ps(1.f - kPriorSnrSmoothing);
+  size_t k = 0;
+  for (; k + 8 <= kFftSizeBy2Plus1; k += 8) {
+    const __m256 prev_estimate = _mm256_mul_ps(
+        _mm256_div_ps(_mm256_loadu_ps(&prev_signal_spectrum[k]),
+                      _mm256_add_ps(_mm256_loadu_ps(&prev_noise_spectrum[k]),
+                                    regularization)),
+        _mm256_loadu_ps(&filter[k]));
+    const __m256 signal = _mm256_loadu_ps(&signal_spectrum[k]);
+    const __m256 noise = _mm256_loadu_ps(&noise_spectrum[k]);
+    const __m256 snr = _mm256_sub_ps(
+        _mm256_div_ps(signal, _mm256_add_ps(noise, regularization)), one);
+    const __m256 post =
+        _mm256_and_ps(_mm256_cmp_ps(signal, noise, _CMP_GT_OQ), snr);
+    _mm256_storeu_ps(&post_snr[k], post);
+    _mm256_storeu_ps(&prior_snr[k],
+                     _mm256_add_ps(_mm256_mul_ps(prev_weight, prev_estimate),
+                                   _mm256_mul_ps(current_weight, post)));
+  }
+  SnrScalar(k, filter, prev_signal_spectrum, signal_spectrum,
+            prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+}
+
+void SpectralKernels::WienerGainAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    float over_subtraction_factor,
+    float minimum_gain,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) {
+  const __m256 over_subtraction = _mm256_set1_ps(over_subtraction_factor);
+  const __m256 min_gain = _mm256_set1_ps(minimum_gain);
+  const __m256 one = _mm256_set1_ps(1.f);
+  size_t k = 0;
+  for (; k + 8 <= kFftSizeBy2Plus1; k += 8) {
+    const __m256 snr = _mm256_loadu_ps(&prior_snr[k]);
+    __m256 gain = _mm256_div_ps(snr, _mm256_add_ps(over_subtraction, snr));
+    // The operand order matches that of std::min() and std::max().
+    gain = _mm256_max_ps(min_gain, _mm256_min_ps(one, gain));
+    _mm256_storeu_ps(&filter[k], gain);
+  }
+  WienerGainScalar(k, prior_snr, over_subtraction_factor, minimum_gain,
+                   filter);
+}
+
+void SpectralKernels::UpdateQuantileAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    float counter,
+    float one_by_counter_plus_1,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) {
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 forty = _mm256_set1_ps(40.f);
+  const __m256 counter_v = _mm256_set1_ps(counter);
+  const __m256 one_by_counter_plus_1_v = _mm256_set1_ps(one_by_counter_plus_1);
+  const __m256 up_step = _mm256_set1_ps(0.25f);
+  const __m256 down_step = _mm256_set1_ps(0.75f);
+  const __m256 width = _mm256_set1_ps(kQuantileWidth);
+  const __m256 one_by_width_plus_2 =
+      _mm256_set1_ps(1.f / (2.f * kQuantileWidth));
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  size_t k = 0;
+  for (; k + 8 <= kFftSizeBy2Plus1; k += 8) {
+    const __m256 log_spectrum_k = _mm256_loadu_ps(&log_spectrum[k]);
+    __m256 log_quantile_k = _mm256_loadu_ps(&log_quantile[k]);
+    __m256 density_k = _mm256_loadu_ps(&density[k]);
+
+    const __m256 delta =
+        _mm256_blendv_ps(forty, _mm256_div_ps(forty, density_k),
+                         _mm256_cmp_ps(density_k, one, _CMP_GT_OQ));
+    const __m256 multiplier = _mm256_mul_ps(delta, one_by_counter_plus_1_v);
+    log_quantile_k = _mm256_blendv_ps(
+        _mm256_sub_ps(log_quantile_k, _mm256_mul_ps(down_step, multiplier)),
+        _mm256_add_ps(log_quantile_k, _mm256_mul_ps(up_step, multiplier)),
+        _mm256_cmp_ps(log_spectrum_k, log_quantile_k, _CMP_GT_OQ));
+    _mm256_storeu_ps(&log_quantile[k], log_quantile_k);
+
+    const __m256 distance =
+        _mm256_and_ps(abs_mask, _mm256_sub_ps(log_spectrum_k, log_quantile_k));
+    const __m256 updated_density = _mm256_mul_ps(
+        _mm256_add_ps(_mm256_mul_ps(counter_v, density_k), one_by_width_plus_2),
+        one_by_counter_plus_1_v);
+    density_k = _mm256_blendv_ps(density_k, updated_density,
+                                 _mm256_cmp_ps(distance, width, _CMP_LT_OQ));
+    _mm256_storeu_ps(&density[k], density_k);
+  }
+  UpdateQuantileScalar(k, log_spectrum, counter, one_by_counter_plus_1,
+                       log_quantile, density);
+}
+
+}  // namespace webrtc
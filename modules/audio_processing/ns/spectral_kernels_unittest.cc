@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/spectral_kernels.h"
+
+#include <math.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Returns the SIMD optimizations that the CPU supports.
+std::vector<NsOptimization> SupportedSimdOptimizations() {
+  std::vector<NsOptimization> optimizations;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kSSE2) != 0) {
+    optimizations.push_back(NsOptimization::kSse2);
+  }
+  if (GetCPUInfo(kAVX2) != 0) {
+    optimizations.push_back(NsOptimization::kAvx2);
+  }
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  optimizations.push_back(NsOptimization::kNeon);
+#endif
+  return optimizations;
+}
+
+// The x86 versions are bit-exact. The NEON versions may be compiled
+// differently from the scalar code, e.g. with fused multiply-adds.
+template <size_t N>
+void ExpectMatch(const std::array<float, N>& expected,
+                 const std::array<float, N>& actual) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  EXPECT_EQ(expected, actual);
+#else
+  for (size_t k = 0; k < N; ++k) {
+    EXPECT_NEAR(expected[k], actual[k], 1e-5f * (1.f + fabsf(expected[k])));
+  }
+#endif
+}
+
+class SpectralKernelsTest : public ::testing::Test {
+ protected:
+  // Returns a spectrum with values in [min, max], with some of the values
+  // identical to those of `other`, to cover the equality cases of the
+  // comparisons.
+  std::array<float, kFftSizeBy2Plus1> RandomSpectrum(
+      float min,
+      float max,
+      const std::array<float, kFftSizeBy2Plus1>* other = nullptr) {
+    std::uniform_real_distribution<float> distribution(min, max);
+    std::array<float, kFftSizeBy2Plus1> x;
+    for (size_t k = 0; k < x.size(); ++k) {
+      x[k] = other && k % 7 == 0 ? (*other)[k] : distribution(generator_);
+    }
+    return x;
+  }
+
+  std::mt19937 generator_{42};
+};
+
+TEST_F(SpectralKernelsTest, Log) {
+  const SpectralKernels reference(NsOptimization::kNone);
+  for (NsOptimization optimization : SupportedSimdOptimizations()) {
+    const SpectralKernels kernels(optimization);
+    for (int i = 0; i < 10; ++i) {
+      const auto x = RandomSpectrum(1.f, 1e6f);
+      std::array<float, kFftSizeBy2Plus1> y;
+      std::array<float, kFftSizeBy2Plus1> y_simd;
+      reference.Log(x, y);
+      kernels.Log(x, y_simd);
+      ExpectMatch(y, y_simd);
+    }
+  }
+}
+
+TEST_F(SpectralKernelsTest, MagnitudeSpectrum) {
+  const SpectralKernels reference(NsOptimization::kNone);
+  for (NsOptimization optimization : SupportedSimdOptimizations()) {
+    const SpectralKernels kernels(optimization);
+    for (int i = 0; i < 10; ++i) {
+      std::uniform_real_distribution<float> distribution(-3e4f, 3e4f);
+      std::array<float, kFftSize> real;
+      std::array<float, kFftSize> imag;
+      for (size_t k = 0; k < kFftSize; ++k) {
+        real[k] = distribution(generator_);
+        imag[k] = distribution(generator_);
+      }
+      std::array<float, kFftSizeBy2Plus1> spectrum;
+      std::array<float, kFftSizeBy2Plus1> spectrum_simd;
+      reference.MagnitudeSpectrum(real, imag, spectrum);
+      kernels.MagnitudeSpectrum(real, imag, spectrum_simd);
+      ExpectMatch(spectrum, spectrum_simd);
+    }
+  }
+}
+
+TEST_F(SpectralKernelsTest, SnrAndWienerGain) {
+  const SpectralKernels reference(NsOptimization::kNone);
+  for (NsOptimization optimization : SupportedSimdOptimizations()) {
+    const SpectralKernels kernels(optimization);
+    for (int i = 0; i < 10; ++i) {
+      const auto filter = RandomSpectrum(0.f, 1.f);
+      const auto prev_signal = RandomSpectrum(1.f, 1e4f);
+      const auto signal = RandomSpectrum(1.f, 1e4f);
+      const auto prev_noise = RandomSpectrum(0.f, 1e4f);
+      const auto noise = RandomSpectrum(0.f, 1e4f, &signal);
+      std::array<float, kFftSizeBy2Plus1> prior_snr;
+      std::array<float, kFftSizeBy2Plus1> post_snr;
+      std::array<float, kFftSizeBy2Plus1> prior_snr_simd;
+      std::array<float, kFftSizeBy2Plus1> post_snr_simd;
+      reference.Snr(filter, prev_signal, signal, prev_noise, noise, prior_snr,
+                    post_snr);
+      kernels.Snr(filter, prev_signal, signal, prev_noise, noise,
+                  prior_snr_simd, post_snr_simd);
+      ExpectMatch(prior_snr, prior_snr_simd);
+      ExpectMatch(post_snr, post_snr_simd);
+
+      std::array<float, kFftSizeBy2Plus1> gain;
+      std::array<float, kFftSizeBy2Plus1> gain_simd;
+      reference.WienerGain(prior_snr, /*over_subtraction_factor=*/1.1f,
+                           /*minimum_gain=*/0.25f, gain);
+      kernels.WienerGain(prior_snr, /*over_subtraction_factor=*/1.1f,
+                         /*minimum_gain=*/0.25f, gain_simd);
+      ExpectMatch(gain, gain_simd);
+    }
+  }
+}
+
+TEST_F(SpectralKernelsTest, UpdateQuantile) {
+  const SpectralKernels reference(NsOptimization::kNone);
+  for (NsOptimization optimization : SupportedSimdOptimizations()) {
+    const SpectralKernels kernels(optimization);
+    auto log_quantile = RandomSpectrum(0.f, 10.f);
+    auto density = RandomSpectrum(0.f, 3.f);
+    auto log_quantile_simd = log_quantile;
+    auto density_simd = density;
+    for (int counter = 1; counter < 200; ++counter) {
+      // Spectra close to the quantile estimates update the densities too.
+      const auto log_spectrum = RandomSpectrum(0.f, 10.f, &log_quantile);
+      const float one_by_counter_plus_1 = 1.f / (counter + 1.f);
+      reference.UpdateQuantile(log_spectrum, counter, one_by_counter_plus_1,
+                               log_quantile, density);
+      kernels.UpdateQuantile(log_spectrum, counter, one_by_counter_plus_1,
+                             log_quantile_simd, density_simd);
+      ExpectMatch(log_quantile, log_quantile_simd);
+      ExpectMatch(density, density_simd);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
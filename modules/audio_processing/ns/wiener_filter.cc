@@ -21,8 +21,9 @@
 
 namespace webrtc {
 
-WienerFilter::WienerFilter(const SuppressionParams& suppression_params)
-    : suppression_params_(suppression_params) {
+WienerFilter::WienerFilter(const SuppressionParams& suppression_params,
+                           NsOptimization optimization)
+    : suppression_params_(suppression_params), kernels_(optimization) {
   filter_.fill(1.f);
   initial_spectral_estimate_.fill(0.f);
   spectrum_prev_process_.fill(0.f);
@@ -34,27 +35,14 @@ void WienerFilter::Update(
     rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
     rtc::ArrayView<const float, kFftSizeBy2Plus1> parametric_noise_spectrum,
     rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum) {
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    // Previous estimate based on previous frame with gain filter.
-    float prev_tsa = spectrum_prev_process_[i] /
-                     (prev_noise_spectrum[i] + 0.0001f) * filter_[i];
-
-    // Current estimate.
-    float current_tsa;
-    if (signal_spectrum[i] > noise_spectrum[i]) {
-      current_tsa = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
-    } else {
-      current_tsa = 0.f;
-    }
-
-    // Directed decision estimate is sum of two terms: current estimate and
-    // previous estimate.
-    float snr_prior = 0.98f * prev_tsa + (1.f - 0.98f) * current_tsa;
-    filter_[i] =
-        snr_prior / (suppression_params_.over_subtraction_factor + snr_prior);
-    filter_[i] = std::max(std::min(filter_[i], 1.f),
-                          suppression_params_.minimum_attenuating_gain);
-  }
+  // Directed decision estimate of the prior SNR, based on the current
+  // estimate and on the previous estimate with the gain filter applied.
+  std::array<float, kFftSizeBy2Plus1> snr_prior;
+  std::array<float, kFftSizeBy2Plus1> current_tsa;
+  kernels_.Snr(filter_, spectrum_prev_process_, signal_spectrum,
+               prev_noise_spectrum, noise_spectrum, snr_prior, current_tsa);
+  kernels_.WienerGain(snr_prior, suppression_params_.over_subtraction_factor,
+                      suppression_params_.minimum_attenuating_gain, filter_);
 
   if (num_analyzed_frames < kShortStartupPhaseBlocks) {
     for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/submodule_timing_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+void SubmoduleTimingRecorder::AccumulatedStats::AddFrameTime(int64_t time_ns) {
+  // Only the capture thread writes, so relaxed loads and stores suffice.
+  auto add = [](auto& value, auto delta) {
+    value.store(value.load(std::memory_order_relaxed) + delta,
+                std::memory_order_relaxed);
+  };
+  const int64_t time_us = time_ns / rtc::kNumNanosecsPerMicrosec;
+  add(num_frames, 1);
+  add(total_time_us, time_us);
+  if (time_us > max_time_us.load(std::memory_order_relaxed)) {
+    max_time_us.store(time_us, std::memory_order_relaxed);
+  }
+
+  // Bucket i > 0 holds [2^(i-1), 2^i) microseconds.
+  int bucket = 0;
+  for (int64_t t = time_us; t > 0; t >>= 1) {
+    ++bucket;
+  }
+  add(histogram[std::min(bucket,
+                         SubmoduleTimingStats::kNumHistogramBuckets - 1)],
+      1);
+}
+
+void SubmoduleTimingRecorder::AccumulatedStats::Reset() {
+  num_frames.store(0, std::memory_order_relaxed);
+  total_time_us.store(0, std::memory_order_relaxed);
+  max_time_us.store(0, std::memory_order_relaxed);
+  for (std::atomic<int>& count : histogram) {
+    count.store(0, std::memory_order_relaxed);
+  }
+}
+
+std::optional<SubmoduleTimingStats>
+SubmoduleTimingRecorder::AccumulatedStats::Get() const {
+  SubmoduleTimingStats stats;
+  stats.num_frames = num_frames.load(std::memory_order_relaxed);
+  if (stats.num_frames == 0) {
+    return std::nullopt;
+  }
+  stats.total_time_us = total_time_us.load(std::memory_order_relaxed);
+  stats.max_time_us = max_time_us.load(std::memory_order_relaxed);
+  for (int i = 0; i < SubmoduleTimingStats::kNumHistogramBuckets; ++i) {
+    stats.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+SubmoduleTimingRecorder::ScopedTimer::ScopedTimer(
+    SubmoduleTimingRecorder* recorder,
+    Submodule submodule)
+    : recorder_(recorder),
+      submodule_(submodule),
+      start_time_ns_(recorder ? rtc::TimeNanos() : 0) {}
+
+SubmoduleTimingRecorder::ScopedTimer::~ScopedTimer() {
+  if (recorder_) {
+    recorder_->AddTime(submodule_, rtc::TimeNanos() - start_time_ns_);
+  }
+}
+
+SubmoduleTimingRecorder::SubmoduleTimingRecorder() {
+  frame_time_ns_.fill(-1);
+}
+
+void SubmoduleTimingRecorder::StartFrame() {
+  frame_time_ns_.fill(-1);
+  frame_start_time_ns_ = rtc::TimeNanos();
+}
+
+void SubmoduleTimingRecorder::EndFrame() {
+  total_stats_.AddFrameTime(rtc::TimeNanos() - frame_start_time_ns_);
+  for (int k = 0; k < kNumSubmodules; ++k) {
+    if (frame_time_ns_[k] >= 0) {
+      submodule_stats_[k].AddFrameTime(frame_time_ns_[k]);
+    }
+  }
+  frame_time_ns_.fill(-1);
+}
+
+void SubmoduleTimingRecorder::AddTime(Submodule submodule, int64_t time_ns) {
+  RTC_DCHECK_LT(static_cast<int>(submodule), kNumSubmodules);
+  int64_t& frame_time_ns = frame_time_ns_[static_cast<int>(submodule)];
+  frame_time_ns = std::max<int64_t>(frame_time_ns, 0) + time_ns;
+}
+
+void SubmoduleTimingRecorder::Reset() {
+  total_stats_.Reset();
+  for (AccumulatedStats& stats : submodule_stats_) {
+    stats.Reset();
+  }
+}
+
+AudioProcessingStats::SubmoduleTiming SubmoduleTimingRecorder::GetStatistics()
+    const {
+  auto stats_of = [&](Submodule submodule) {
+    return submodule_stats_[static_cast<int>(submodule)].Get();
+  };
+  AudioProcessingStats::SubmoduleTiming timing;
+  timing.band_splitting = stats_of(Submodule::kBandSplitting);
+  timing.capture_levels_adjuster = stats_of(Submodule::kCaptureLevelsAdjuster);
+  timing.high_pass_filter = stats_of(Submodule::kHighPassFilter);
+  timing.echo_controller = stats_of(Submodule::kEchoController);
+  timing.echo_control_mobile = stats_of(Submodule::kEchoControlMobile);
+  timing.noise_suppressor = stats_of(Submodule::kNoiseSuppressor);
+  timing.gain_controller1 = stats_of(Submodule::kGainController1);
+  timing.gain_controller2 = stats_of(Submodule::kGainController2);
+  timing.echo_detector = stats_of(Submodule::kEchoDetector);
+  timing.capture_analyzer = stats_of(Submodule::kCaptureAnalyzer);
+  timing.capture_post_processor = stats_of(Submodule::kCapturePostProcessor);
+  timing.total = total_stats_.Get();
+  return timing;
+}
+
+}  // namespace webrtc
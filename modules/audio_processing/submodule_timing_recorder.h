@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_SUBMODULE_TIMING_RECORDER_H_
+#define MODULES_AUDIO_PROCESSING_SUBMODULE_TIMING_RECORDER_H_
+
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <optional>
+
+#include "api/audio/audio_processing_statistics.h"
+
+namespace webrtc {
+
+// Measures the time spent per capture frame by each submodule of
+// AudioProcessingImpl and accumulates the per-frame times into
+// AudioProcessingStats::SubmoduleTiming. The frames are timed on the capture
+// thread, while the statistics can be read on any thread.
+class SubmoduleTimingRecorder {
+ public:
+  enum class Submodule {
+    kBandSplitting,
+    kCaptureLevelsAdjuster,
+    kHighPassFilter,
+    kEchoController,
+    kEchoControlMobile,
+    kNoiseSuppressor,
+    kGainController1,
+    kGainController2,
+    kEchoDetector,
+    kCaptureAnalyzer,
+    kCapturePostProcessor,
+    kNumSubmodules
+  };
+
+  // Adds the time from its construction to its destruction to the time of
+  // `submodule` in the current frame. Does nothing if `recorder` is null, so
+  // that it costs close to nothing when the timing is disabled.
+  class ScopedTimer {
+   public:
+    ScopedTimer(SubmoduleTimingRecorder* recorder, Submodule submodule);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   private:
+    SubmoduleTimingRecorder* const recorder_;
+    const Submodule submodule_;
+    const int64_t start_time_ns_;
+  };
+
+  SubmoduleTimingRecorder();
+
+  SubmoduleTimingRecorder(const SubmoduleTimingRecorder&) = delete;
+  SubmoduleTimingRecorder& operator=(const SubmoduleTimingRecorder&) = delete;
+
+  // Marks the start and the end of the processing of a capture frame. The
+  // times recorded in between are added to the statistics at the end. A frame
+  // that is started but never ended is discarded.
+  void StartFrame();
+  void EndFrame();
+
+  // Adds `time_ns` to the time of `submodule` in the current frame.
+  void AddTime(Submodule submodule, int64_t time_ns);
+
+  // Discards the statistics of all the ended frames.
+  void Reset();
+
+  // Returns the statistics of all the ended frames. Can be called on any
+  // thread; a frame that ends concurrently may be partially included.
+  AudioProcessingStats::SubmoduleTiming GetStatistics() const;
+
+ private:
+  static constexpr int kNumSubmodules =
+      static_cast<int>(Submodule::kNumSubmodules);
+
+  // SubmoduleTimingStats that can be read while the capture thread, its only
+  // writer, updates it.
+  struct AccumulatedStats {
+    void AddFrameTime(int64_t time_ns);
+    void Reset();
+    std::optional<SubmoduleTimingStats> Get() const;
+
+    std::atomic<int> num_frames{0};
+    std::atomic<int64_t> total_time_us{0};
+    std::atomic<int64_t> max_time_us{0};
+    std::array<std::atomic<int>, SubmoduleTimingStats::kNumHistogramBuckets>
+        histogram = {};
+  };
+
+  // The time of the current frame for each submodule, or -1 if the submodule
+  // has not been called in the frame.
+  std::array<int64_t, kNumSubmodules> frame_time_ns_;
+  int64_t frame_start_time_ns_ = 0;
+
+  std::array<AccumulatedStats, kNumSubmodules> submodule_stats_;
+  AccumulatedStats total_stats_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_SUBMODULE_TIMING_RECORDER_H_
@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/submodule_timing_recorder.h"
+
+#include <numeric>
+
+#include "rtc_base/time_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using Submodule = SubmoduleTimingRecorder::Submodule;
+
+constexpr int64_t kUs = rtc::kNumNanosecsPerMicrosec;
+
+TEST(SubmoduleTimingRecorderTest, NoStatisticsBeforeTheFirstFrame) {
+  SubmoduleTimingRecorder recorder;
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  EXPECT_FALSE(timing.total);
+  EXPECT_FALSE(timing.echo_controller);
+  EXPECT_FALSE(timing.noise_suppressor);
+}
+
+TEST(SubmoduleTimingRecorderTest, ReportsOnlyTheTimedSubmodules) {
+  SubmoduleTimingRecorder recorder;
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kNoiseSuppressor, 10 * kUs);
+  recorder.EndFrame();
+
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.total);
+  EXPECT_EQ(timing.total->num_frames, 1);
+  ASSERT_TRUE(timing.noise_suppressor);
+  EXPECT_EQ(timing.noise_suppressor->num_frames, 1);
+  EXPECT_FALSE(timing.echo_controller);
+  EXPECT_FALSE(timing.high_pass_filter);
+}
+
+TEST(SubmoduleTimingRecorderTest, SumsTheTimesOfAFrame) {
+  SubmoduleTimingRecorder recorder;
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kEchoController, 30 * kUs);
+  recorder.AddTime(Submodule::kEchoController, 70 * kUs);
+  recorder.EndFrame();
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kEchoController, 20 * kUs);
+  recorder.EndFrame();
+
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.echo_controller);
+  EXPECT_EQ(timing.echo_controller->num_frames, 2);
+  EXPECT_EQ(timing.echo_controller->total_time_us, 120);
+  EXPECT_EQ(timing.echo_controller->max_time_us, 100);
+}
+
+TEST(SubmoduleTimingRecorderTest, DiscardsFramesThatAreNotEnded) {
+  SubmoduleTimingRecorder recorder;
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kGainController2, 50 * kUs);
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kGainController2, 5 * kUs);
+  recorder.EndFrame();
+
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.total);
+  EXPECT_EQ(timing.total->num_frames, 1);
+  ASSERT_TRUE(timing.gain_controller2);
+  EXPECT_EQ(timing.gain_controller2->num_frames, 1);
+  EXPECT_EQ(timing.gain_controller2->total_time_us, 5);
+}
+
+TEST(SubmoduleTimingRecorderTest, ResetDiscardsTheEndedFrames) {
+  SubmoduleTimingRecorder recorder;
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kHighPassFilter, 500 * kUs);
+  recorder.EndFrame();
+  recorder.Reset();
+  EXPECT_FALSE(recorder.GetStatistics().total);
+  EXPECT_FALSE(recorder.GetStatistics().high_pass_filter);
+
+  recorder.StartFrame();
+  recorder.AddTime(Submodule::kHighPassFilter, 2 * kUs);
+  recorder.EndFrame();
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.high_pass_filter);
+  EXPECT_EQ(timing.high_pass_filter->num_frames, 1);
+  EXPECT_EQ(timing.high_pass_filter->max_time_us, 2);
+  EXPECT_EQ(timing.high_pass_filter->histogram[2], 1);
+}
+
+TEST(SubmoduleTimingRecorderTest, HistogramBuckets) {
+  SubmoduleTimingRecorder recorder;
+  for (int64_t time_us : {0, 1, 2, 3, 4, 1000, 100000000}) {
+    recorder.StartFrame();
+    recorder.AddTime(Submodule::kHighPassFilter, time_us * kUs);
+    recorder.EndFrame();
+  }
+
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.high_pass_filter);
+  const auto& histogram = timing.high_pass_filter->histogram;
+  EXPECT_EQ(histogram[0], 1);
+  EXPECT_EQ(histogram[1], 1);
+  EXPECT_EQ(histogram[2], 2);
+  EXPECT_EQ(histogram[3], 1);
+  // 1000 us is in [512, 1024).
+  EXPECT_EQ(histogram[10], 1);
+  EXPECT_EQ(histogram[SubmoduleTimingStats::kNumHistogramBuckets - 1], 1);
+  EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), 0),
+            timing.high_pass_filter->num_frames);
+}
+
+TEST(SubmoduleTimingRecorderTest, ScopedTimerAddsTime) {
+  SubmoduleTimingRecorder recorder;
+  recorder.StartFrame();
+  {
+    SubmoduleTimingRecorder::ScopedTimer timer(&recorder,
+                                               Submodule::kBandSplitting);
+  }
+  {
+    SubmoduleTimingRecorder::ScopedTimer timer(nullptr,
+                                               Submodule::kEchoDetector);
+  }
+  recorder.EndFrame();
+
+  const AudioProcessingStats::SubmoduleTiming timing =
+      recorder.GetStatistics();
+  ASSERT_TRUE(timing.band_splitting);
+  EXPECT_EQ(timing.band_splitting->num_frames, 1);
+  EXPECT_FALSE(timing.echo_detector);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -545,6 +545,8 @@ void AudioProcessingSimulator::ConfigureAudioProcessor() {
         *settings_.ns_analysis_on_linear_aec_output;
   }
 
+  apm_config.submodule_timing.enabled = settings_.report_submodule_timing;
+
   ap_->ApplyConfig(apm_config);
 
   if (settings_.use_ts) {
@@ -137,6 +137,7 @@ struct SimulationSettings {
   std::optional<int> frame_for_sending_capture_output_used_true;
   bool report_performance = false;
   std::optional<std::string> performance_report_output_filename;
+  bool report_submodule_timing = false;
   bool report_bitexactness = false;
   bool use_verbose_logging = false;
   bool use_quiet_output = false;
@@ -182,6 +183,9 @@ class AudioProcessingSimulator {
     return api_call_statistics_;
   }
 
+  // Returns the statistics reported by the AudioProcessing instance.
+  AudioProcessingStats GetStatistics() { return ap_->GetStatistics(); }
+
   // Analyzes the data in the input and reports the resulting statistics.
   virtual void Analyze() = 0;
 
@@ -10,6 +10,8 @@
 
 #include "modules/audio_processing/test/audioproc_float_impl.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -26,6 +28,7 @@
 #include "absl/flags/parse.h"
 #include "absl/strings/string_view.h"
 #include "api/audio/audio_processing.h"
+#include "api/audio/audio_processing_statistics.h"
 #include "api/audio/builtin_audio_processing_builder.h"
 #include "api/audio/echo_canceller3_config.h"
 #include "api/audio/echo_canceller3_factory.h"
@@ -254,6 +257,10 @@ ABSL_FLAG(std::string,
           performance_report_output_file,
           "",
           "Generate a CSV file with the API call durations");
+ABSL_FLAG(bool,
+          submodule_timing_report,
+          false,
+          "Report the time spent per capture frame in each APM submodule");
 ABSL_FLAG(bool, verbose, false, "Produce verbose output");
 ABSL_FLAG(bool,
           quiet,
@@ -492,6 +499,8 @@ SimulationSettings CreateSettings() {
   settings.report_performance = absl::GetFlag(FLAGS_performance_report);
   SetSettingIfSpecified(absl::GetFlag(FLAGS_performance_report_output_file),
                         &settings.performance_report_output_filename);
+  settings.report_submodule_timing =
+      absl::GetFlag(FLAGS_submodule_timing_report);
   settings.use_verbose_logging = absl::GetFlag(FLAGS_verbose);
   settings.use_quiet_output = absl::GetFlag(FLAGS_quiet);
   settings.report_bitexactness = absl::GetFlag(FLAGS_bitexactness_report);
@@ -809,6 +818,68 @@ void SetDependencies(const SimulationSettings& settings,
   }
 }
 
+// Returns the upper edge, in microseconds, of the histogram bucket that holds
+// the `percentile` of the frame times in `stats`.
+int64_t PercentileUpperBoundUs(const SubmoduleTimingStats& stats,
+                               float percentile) {
+  const int64_t threshold = static_cast<int64_t>(
+      std::ceil(percentile / 100.f * stats.num_frames));
+  int64_t count = 0;
+  for (int k = 0; k < SubmoduleTimingStats::kNumHistogramBuckets - 1; ++k) {
+    count += stats.histogram[k];
+    if (count >= threshold) {
+      return int64_t{1} << k;
+    }
+  }
+  return stats.max_time_us;
+}
+
+void PrintSubmoduleTimingReport(
+    const AudioProcessingStats::SubmoduleTiming& timing) {
+  if (!timing.total) {
+    std::cout << std::endl << "No submodule timing available." << std::endl;
+    return;
+  }
+  const int64_t total_time_us =
+      std::max<int64_t>(timing.total->total_time_us, 1);
+  const std::vector<
+      std::pair<const char*, const std::optional<SubmoduleTimingStats>*>>
+      rows = {{"band_splitting", &timing.band_splitting},
+              {"capture_levels_adjuster", &timing.capture_levels_adjuster},
+              {"high_pass_filter", &timing.high_pass_filter},
+              {"echo_controller", &timing.echo_controller},
+              {"echo_control_mobile", &timing.echo_control_mobile},
+              {"noise_suppressor", &timing.noise_suppressor},
+              {"gain_controller1", &timing.gain_controller1},
+              {"gain_controller2", &timing.gain_controller2},
+              {"echo_detector", &timing.echo_detector},
+              {"capture_analyzer", &timing.capture_analyzer},
+              {"capture_post_processor", &timing.capture_post_processor},
+              {"total", &timing.total}};
+
+  std::cout << std::endl
+            << "Capture submodule timing (p50 and p99 are upper bounds):"
+            << std::endl;
+  char line[128];
+  snprintf(line, sizeof(line), " %-24s %8s %9s %9s %9s %9s %7s", "submodule",
+           "frames", "avg [us]", "p50 [us]", "p99 [us]", "max [us]", "share");
+  std::cout << line << std::endl;
+  for (const auto& [name, stats] : rows) {
+    if (!*stats) {
+      continue;
+    }
+    const SubmoduleTimingStats& s = **stats;
+    snprintf(line, sizeof(line),
+             " %-24s %8d %9.1f %9lld %9lld %9lld %6.1f%%", name, s.num_frames,
+             static_cast<double>(s.total_time_us) / s.num_frames,
+             static_cast<long long>(PercentileUpperBoundUs(s, 50.f)),
+             static_cast<long long>(PercentileUpperBoundUs(s, 99.f)),
+             static_cast<long long>(s.max_time_us),
+             100.0 * s.total_time_us / total_time_us);
+    std::cout << line << std::endl;
+  }
+}
+
 int RunSimulation(
     absl::Nonnull<std::unique_ptr<AudioProcessingBuilderInterface>> ap_builder,
     bool builtin_builder_provided,
@@ -855,6 +926,11 @@ int RunSimulation(
     processor->GetApiCallStatistics().WriteReportToFile(
         *settings.performance_report_output_filename);
   }
+  if (settings.report_submodule_timing) {
+    const AudioProcessingStats stats = processor->GetStatistics();
+    PrintSubmoduleTimingReport(stats.submodule_timing.value_or(
+        AudioProcessingStats::SubmoduleTiming()));
+  }
 
   if (settings.report_bitexactness && settings.aec_dump_input_filename) {
     if (processor->OutputWasBitexact()) {
@@ -243,6 +243,7 @@ void Aec3ConfigFromJsonString(absl::string_view json_string,
               &cfg.filter.high_pass_filter_echo_reference);
     ReadParam(section, "export_linear_aec_output",
               &cfg.filter.export_linear_aec_output);
+    ReadParam(section, "num_worker_threads", &cfg.filter.num_worker_threads);
   }
 
   if (rtc::GetValueFromJsonObject(aec3_root, "erle", &section)) {
@@ -553,7 +554,8 @@ std::string Aec3ConfigToJsonString(const EchoCanceller3Config& config) {
       << (config.filter.high_pass_filter_echo_reference ? "true" : "false")
       << ",";
   ost << "\"export_linear_aec_output\": "
-      << (config.filter.export_linear_aec_output ? "true" : "false");
+      << (config.filter.export_linear_aec_output ? "true" : "false") << ",";
+  ost << "\"num_worker_threads\": " << config.filter.num_worker_threads;
 
   ost << "},";
 
@@ -12,9 +12,197 @@
 #include <algorithm>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
 
 namespace webrtc {
 
+namespace {
+
+constexpr size_t kNumLanes = 4;
+
+#if defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
+bool HaveSameCoefficients(const CascadedBiQuadFilter::BiQuad& a,
+                          const CascadedBiQuadFilter::BiQuad& b) {
+  return std::equal(std::begin(a.coefficients.b), std::end(a.coefficients.b),
+                    std::begin(b.coefficients.b)) &&
+         std::equal(std::begin(a.coefficients.a), std::end(a.coefficients.a),
+                    std::begin(b.coefficients.a));
+}
+#endif
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Applies the biquads to four signals of the same length, one per lane. The
+// operations are performed in the same order as in ApplyBiQuad(), which makes
+// the result bit-exact.
+void ApplyBiQuadsInParallel_SSE2(
+    CascadedBiQuadFilter::BiQuad* const biquads[kNumLanes],
+    float* const y[kNumLanes],
+    size_t length) {
+  const CascadedBiQuadFilter::BiQuadCoefficients& c = biquads[0]->coefficients;
+  const __m128 c_a_0 = _mm_set1_ps(c.a[0]);
+  const __m128 c_a_1 = _mm_set1_ps(c.a[1]);
+  const __m128 c_b_0 = _mm_set1_ps(c.b[0]);
+  const __m128 c_b_1 = _mm_set1_ps(c.b[1]);
+  const __m128 c_b_2 = _mm_set1_ps(c.b[2]);
+  __m128 m_x_0 = _mm_setr_ps(biquads[0]->x[0], biquads[1]->x[0],
+                             biquads[2]->x[0], biquads[3]->x[0]);
+  __m128 m_x_1 = _mm_setr_ps(biquads[0]->x[1], biquads[1]->x[1],
+                             biquads[2]->x[1], biquads[3]->x[1]);
+  __m128 m_y_0 = _mm_setr_ps(biquads[0]->y[0], biquads[1]->y[0],
+                             biquads[2]->y[0], biquads[3]->y[0]);
+  __m128 m_y_1 = _mm_setr_ps(biquads[0]->y[1], biquads[1]->y[1],
+                             biquads[2]->y[1], biquads[3]->y[1]);
+
+  auto filter_sample = [&](__m128 tmp) {
+    __m128 out = _mm_add_ps(_mm_mul_ps(c_b_0, tmp), _mm_mul_ps(c_b_1, m_x_0));
+    out = _mm_add_ps(out, _mm_mul_ps(c_b_2, m_x_1));
+    out = _mm_sub_ps(out, _mm_mul_ps(c_a_0, m_y_0));
+    out = _mm_sub_ps(out, _mm_mul_ps(c_a_1, m_y_1));
+    m_x_1 = m_x_0;
+    m_x_0 = tmp;
+    m_y_1 = m_y_0;
+    m_y_0 = out;
+    return out;
+  };
+
+  size_t k = 0;
+  for (; k + kNumLanes <= length; k += kNumLanes) {
+    // Transpose four samples of each signal into four vectors holding one
+    // sample of every signal, filter them and transpose back.
+    __m128 s0 = _mm_loadu_ps(&y[0][k]);
+    __m128 s1 = _mm_loadu_ps(&y[1][k]);
+    __m128 s2 = _mm_loadu_ps(&y[2][k]);
+    __m128 s3 = _mm_loadu_ps(&y[3][k]);
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+    s0 = filter_sample(s0);
+    s1 = filter_sample(s1);
+    s2 = filter_sample(s2);
+    s3 = filter_sample(s3);
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+    _mm_storeu_ps(&y[0][k], s0);
+    _mm_storeu_ps(&y[1][k], s1);
+    _mm_storeu_ps(&y[2][k], s2);
+    _mm_storeu_ps(&y[3][k], s3);
+  }
+  for (; k < length; ++k) {
+    float out[kNumLanes];
+    _mm_storeu_ps(out, filter_sample(
+                           _mm_setr_ps(y[0][k], y[1][k], y[2][k], y[3][k])));
+    for (size_t lane = 0; lane < kNumLanes; ++lane) {
+      y[lane][k] = out[lane];
+    }
+  }
+
+  float state[4][kNumLanes];
+  _mm_storeu_ps(state[0], m_x_0);
+  _mm_storeu_ps(state[1], m_x_1);
+  _mm_storeu_ps(state[2], m_y_0);
+  _mm_storeu_ps(state[3], m_y_1);
+  for (size_t lane = 0; lane < kNumLanes; ++lane) {
+    biquads[lane]->x[0] = state[0][lane];
+    biquads[lane]->x[1] = state[1][lane];
+    biquads[lane]->y[0] = state[2][lane];
+    biquads[lane]->y[1] = state[3][lane];
+  }
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+// Transposes the 4x4 matrix with the rows `r0` to `r3` in place.
+void Transpose4x4(float32x4_t& r0,
+                  float32x4_t& r1,
+                  float32x4_t& r2,
+                  float32x4_t& r3) {
+  const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+  const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+  r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+  r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+  r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+  r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+// NEON version of ApplyBiQuadsInParallel_SSE2().
+void ApplyBiQuadsInParallel_NEON(
+    CascadedBiQuadFilter::BiQuad* const biquads[kNumLanes],
+    float* const y[kNumLanes],
+    size_t length) {
+  const CascadedBiQuadFilter::BiQuadCoefficients& c = biquads[0]->coefficients;
+  const float32x4_t c_a_0 = vdupq_n_f32(c.a[0]);
+  const float32x4_t c_a_1 = vdupq_n_f32(c.a[1]);
+  const float32x4_t c_b_0 = vdupq_n_f32(c.b[0]);
+  const float32x4_t c_b_1 = vdupq_n_f32(c.b[1]);
+  const float32x4_t c_b_2 = vdupq_n_f32(c.b[2]);
+  float state[4][kNumLanes];
+  for (size_t lane = 0; lane < kNumLanes; ++lane) {
+    state[0][lane] = biquads[lane]->x[0];
+    state[1][lane] = biquads[lane]->x[1];
+    state[2][lane] = biquads[lane]->y[0];
+    state[3][lane] = biquads[lane]->y[1];
+  }
+  float32x4_t m_x_0 = vld1q_f32(state[0]);
+  float32x4_t m_x_1 = vld1q_f32(state[1]);
+  float32x4_t m_y_0 = vld1q_f32(state[2]);
+  float32x4_t m_y_1 = vld1q_f32(state[3]);
+
+  auto filter_sample = [&](float32x4_t tmp) {
+    float32x4_t out = vaddq_f32(vmulq_f32(c_b_0, tmp), vmulq_f32(c_b_1, m_x_0));
+    out = vaddq_f32(out, vmulq_f32(c_b_2, m_x_1));
+    out = vsubq_f32(out, vmulq_f32(c_a_0, m_y_0));
+    out = vsubq_f32(out, vmulq_f32(c_a_1, m_y_1));
+    m_x_1 = m_x_0;
+    m_x_0 = tmp;
+    m_y_1 = m_y_0;
+    m_y_0 = out;
+    return out;
+  };
+
+  size_t k = 0;
+  for (; k + kNumLanes <= length; k += kNumLanes) {
+    float32x4_t s0 = vld1q_f32(&y[0][k]);
+    float32x4_t s1 = vld1q_f32(&y[1][k]);
+    float32x4_t s2 = vld1q_f32(&y[2][k]);
+    float32x4_t s3 = vld1q_f32(&y[3][k]);
+    Transpose4x4(s0, s1, s2, s3);
+    s0 = filter_sample(s0);
+    s1 = filter_sample(s1);
+    s2 = filter_sample(s2);
+    s3 = filter_sample(s3);
+    Transpose4x4(s0, s1, s2, s3);
+    vst1q_f32(&y[0][k], s0);
+    vst1q_f32(&y[1][k], s1);
+    vst1q_f32(&y[2][k], s2);
+    vst1q_f32(&y[3][k], s3);
+  }
+  for (; k < length; ++k) {
+    float out[kNumLanes] = {y[0][k], y[1][k], y[2][k], y[3][k]};
+    vst1q_f32(out, filter_sample(vld1q_f32(out)));
+    for (size_t lane = 0; lane < kNumLanes; ++lane) {
+      y[lane][k] = out[lane];
+    }
+  }
+
+  vst1q_f32(state[0], m_x_0);
+  vst1q_f32(state[1], m_x_1);
+  vst1q_f32(state[2], m_y_0);
+  vst1q_f32(state[3], m_y_1);
+  for (size_t lane = 0; lane < kNumLanes; ++lane) {
+    biquads[lane]->x[0] = state[0][lane];
+    biquads[lane]->x[1] = state[1][lane];
+    biquads[lane]->y[0] = state[2][lane];
+    biquads[lane]->y[1] = state[3][lane];
+  }
+}
+#endif
+
+}  // namespace
+
 CascadedBiQuadFilter::BiQuadParam::BiQuadParam(std::complex<float> zero,
                                                std::complex<float> pole,
                                                float gain,
@@ -95,6 +283,39 @@ void CascadedBiQuadFilter::Reset() {
   }
 }
 
+void CascadedBiQuadFilter::ProcessInParallel(
+    rtc::ArrayView<CascadedBiQuadFilter* const> filters,
+    rtc::ArrayView<const rtc::ArrayView<float>> signals) {
+  RTC_DCHECK_EQ(filters.size(), signals.size());
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
+  for (; i + kNumLanes <= filters.size(); i += kNumLanes) {
+    const size_t length = signals[i].size();
+    for (size_t s = 0; s < filters[i]->biquads_.size(); ++s) {
+      BiQuad* biquads[kNumLanes];
+      float* y[kNumLanes];
+      for (size_t lane = 0; lane < kNumLanes; ++lane) {
+        CascadedBiQuadFilter* filter = filters[i + lane];
+        RTC_DCHECK_EQ(filter->biquads_.size(), filters[i]->biquads_.size());
+        RTC_DCHECK(HaveSameCoefficients(filter->biquads_[s],
+                                        filters[i]->biquads_[s]));
+        RTC_DCHECK_EQ(signals[i + lane].size(), length);
+        biquads[lane] = &filter->biquads_[s];
+        y[lane] = signals[i + lane].data();
+      }
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      ApplyBiQuadsInParallel_SSE2(biquads, y, length);
+#else
+      ApplyBiQuadsInParallel_NEON(biquads, y, length);
+#endif
+    }
+  }
+#endif
+  for (; i < filters.size(); ++i) {
+    filters[i]->Process(signals[i]);
+  }
+}
+
 void CascadedBiQuadFilter::ApplyBiQuad(rtc::ArrayView<const float> x,
                                        rtc::ArrayView<float> y,
                                        CascadedBiQuadFilter::BiQuad* biquad) {
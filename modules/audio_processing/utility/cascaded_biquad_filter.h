@@ -67,6 +67,15 @@ class CascadedBiQuadFilter {
   // Resets the filter to its initial state.
   void Reset();
 
+  // Applies each of the `filters` on the corresponding signal in `signals` in
+  // an in-place manner. The signals are filtered in groups of four, one signal
+  // per SIMD lane, which requires the filters in a group to have the same
+  // coefficients and the signals to have the same length. The result is the
+  // same as when calling Process() for each of the filters.
+  static void ProcessInParallel(
+      rtc::ArrayView<CascadedBiQuadFilter* const> filters,
+      rtc::ArrayView<const rtc::ArrayView<float>> signals);
+
  private:
   void ApplyBiQuad(rtc::ArrayView<const float> x,
                    rtc::ArrayView<float> y,
@@ -10,8 +10,11 @@
 
 #include "modules/audio_processing/utility/cascaded_biquad_filter.h"
 
+#include <cmath>
+#include <memory>
 #include <vector>
 
+#include "rtc_base/system/arch.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -100,6 +103,51 @@ TEST(CascadedBiquadFilter, TransparentConfiguration) {
   EXPECT_EQ(input, output);
 }
 
+// Verifies that filtering several signals in parallel gives the same result as
+// filtering them one at a time, both for the signals that fill a group of SIMD
+// lanes and for the remaining ones, and for lengths that are not a multiple of
+// the number of lanes.
+TEST(CascadedBiquadFilter, ProcessInParallel) {
+  constexpr size_t kNumSignals = 7;
+  constexpr size_t kLength = 161;
+  std::vector<std::unique_ptr<CascadedBiQuadFilter>> filters;
+  std::vector<std::unique_ptr<CascadedBiQuadFilter>> reference_filters;
+  for (size_t i = 0; i < kNumSignals; ++i) {
+    filters.push_back(
+        std::make_unique<CascadedBiQuadFilter>(kHighPassFilterCoefficients, 2));
+    reference_filters.push_back(
+        std::make_unique<CascadedBiQuadFilter>(kHighPassFilterCoefficients, 2));
+  }
+  std::vector<CascadedBiQuadFilter*> filter_pointers;
+  for (auto& filter : filters) {
+    filter_pointers.push_back(filter.get());
+  }
+
+  for (int frame = 0; frame < 3; ++frame) {
+    std::vector<std::vector<float>> signals(kNumSignals);
+    for (size_t i = 0; i < kNumSignals; ++i) {
+      signals[i] = CreateInputWithIncreasingValues(kLength);
+      for (size_t k = 0; k < kLength; ++k) {
+        signals[i][k] *= (i % 2 == 0 ? 1.f : -0.5f) * (frame + 1);
+      }
+    }
+    std::vector<std::vector<float>> reference = signals;
+    std::vector<rtc::ArrayView<float>> views(signals.begin(), signals.end());
+    CascadedBiQuadFilter::ProcessInParallel(filter_pointers, views);
+    for (size_t i = 0; i < kNumSignals; ++i) {
+      reference_filters[i]->Process(reference[i]);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      EXPECT_EQ(reference[i], signals[i]);
+#else
+      for (size_t k = 0; k < kLength; ++k) {
+        EXPECT_NEAR(reference[i][k], signals[i][k],
+                    1e-4f * (1.f + std::fabs(reference[i][k])));
+      }
+#endif
+    }
+  }
+}
+
 #if RTC_DCHECK_IS_ON && GTEST_HAS_DEATH_TEST && !defined(WEBRTC_ANDROID)
 // Verifies that the check of the lengths for the input and output works for the
 // non-in-place call.
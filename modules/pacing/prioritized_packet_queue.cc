@@ -86,22 +86,32 @@ DataSize PrioritizedPacketQueue::QueuedPacket::PacketSize() const {
 PrioritizedPacketQueue::StreamQueue::StreamQueue(Timestamp creation_time)
     : last_enqueue_time_(creation_time), num_keyframe_packets_(0) {}
 
-bool PrioritizedPacketQueue::StreamQueue::EnqueuePacket(QueuedPacket packet,
+bool PrioritizedPacketQueue::StreamQueue::EnqueuePacket(QueuedPacket* packet,
                                                         int priority_level) {
-  if (packet.packet->is_key_frame()) {
+  if (packet->packet->is_key_frame()) {
     ++num_keyframe_packets_;
   }
-  bool first_packet_at_level = packets_[priority_level].empty();
-  packets_[priority_level].push_back(std::move(packet));
+  packet->next = nullptr;
+  bool first_packet_at_level = head_[priority_level] == nullptr;
+  if (first_packet_at_level) {
+    head_[priority_level] = packet;
+  } else {
+    tail_[priority_level]->next = packet;
+  }
+  tail_[priority_level] = packet;
   return first_packet_at_level;
 }
 
-PrioritizedPacketQueue::QueuedPacket
+PrioritizedPacketQueue::QueuedPacket*
 PrioritizedPacketQueue::StreamQueue::DequeuePacket(int priority_level) {
-  RTC_DCHECK(!packets_[priority_level].empty());
-  QueuedPacket packet = std::move(packets_[priority_level].front());
-  packets_[priority_level].pop_front();
-  if (packet.packet->is_key_frame()) {
+  RTC_DCHECK(head_[priority_level] != nullptr);
+  QueuedPacket* packet = head_[priority_level];
+  head_[priority_level] = packet->next;
+  if (head_[priority_level] == nullptr) {
+    tail_[priority_level] = nullptr;
+  }
+  packet->next = nullptr;
+  if (packet->packet->is_key_frame()) {
     RTC_DCHECK_GT(num_keyframe_packets_, 0);
     --num_keyframe_packets_;
   }
@@ -110,12 +120,12 @@ PrioritizedPacketQueue::StreamQueue::DequeuePacket(int priority_level) {
 
 bool PrioritizedPacketQueue::StreamQueue::HasPacketsAtPrio(
     int priority_level) const {
-  return !packets_[priority_level].empty();
+  return head_[priority_level] != nullptr;
 }
 
 bool PrioritizedPacketQueue::StreamQueue::IsEmpty() const {
-  for (const std::deque<QueuedPacket>& queue : packets_) {
-    if (!queue.empty()) {
+  for (const QueuedPacket* head : head_) {
+    if (head != nullptr) {
       return false;
     }
   }
@@ -124,23 +134,66 @@ bool PrioritizedPacketQueue::StreamQueue::IsEmpty() const {
 
 Timestamp PrioritizedPacketQueue::StreamQueue::LeadingPacketEnqueueTime(
     int priority_level) const {
-  RTC_DCHECK(!packets_[priority_level].empty());
-  return packets_[priority_level].begin()->enqueue_time;
+  RTC_DCHECK(head_[priority_level] != nullptr);
+  return head_[priority_level]->enqueue_time;
 }
 
 Timestamp PrioritizedPacketQueue::StreamQueue::LastEnqueueTime() const {
   return last_enqueue_time_;
 }
 
-std::array<std::deque<PrioritizedPacketQueue::QueuedPacket>,
-           PrioritizedPacketQueue::kNumPriorityLevels>
-PrioritizedPacketQueue::StreamQueue::DequeueAll() {
-  std::array<std::deque<QueuedPacket>, kNumPriorityLevels> packets_by_prio;
-  for (int i = 0; i < kNumPriorityLevels; ++i) {
-    packets_by_prio[i].swap(packets_[i]);
+PrioritizedPacketQueue::QueuedPacket*
+PrioritizedPacketQueue::StreamQueue::DequeueAll(int priority_level) {
+  QueuedPacket* packets = head_[priority_level];
+  for (QueuedPacket* packet = packets; packet != nullptr;
+       packet = packet->next) {
+    if (packet->packet->is_key_frame()) {
+      RTC_DCHECK_GT(num_keyframe_packets_, 0);
+      --num_keyframe_packets_;
+    }
+  }
+  head_[priority_level] = nullptr;
+  tail_[priority_level] = nullptr;
+  return packets;
+}
+
+void PrioritizedPacketQueue::ActiveStreams::PushBack(StreamQueue* stream) {
+  if (head_ == nullptr) {
+    stream->prev_active[priority_level_] = stream;
+    stream->next_active[priority_level_] = stream;
+    head_ = stream;
+  } else {
+    StreamQueue* tail = head_->prev_active[priority_level_];
+    stream->prev_active[priority_level_] = tail;
+    stream->next_active[priority_level_] = head_;
+    tail->next_active[priority_level_] = stream;
+    head_->prev_active[priority_level_] = stream;
+  }
+  ++size_;
+}
+
+void PrioritizedPacketQueue::ActiveStreams::Rotate() {
+  RTC_DCHECK(head_ != nullptr);
+  head_ = head_->next_active[priority_level_];
+}
+
+void PrioritizedPacketQueue::ActiveStreams::Remove(StreamQueue* stream) {
+  RTC_DCHECK_GT(size_, 0);
+  StreamQueue* prev = stream->prev_active[priority_level_];
+  StreamQueue* next = stream->next_active[priority_level_];
+  if (next == stream) {
+    RTC_DCHECK_EQ(head_, stream);
+    head_ = nullptr;
+  } else {
+    prev->next_active[priority_level_] = next;
+    next->prev_active[priority_level_] = prev;
+    if (head_ == stream) {
+      head_ = next;
+    }
   }
-  num_keyframe_packets_ = 0;
-  return packets_by_prio;
+  stream->prev_active[priority_level_] = nullptr;
+  stream->next_active[priority_level_] = nullptr;
+  --size_;
 }
 
 PrioritizedPacketQueue::PrioritizedPacketQueue(
@@ -157,7 +210,11 @@ PrioritizedPacketQueue::PrioritizedPacketQueue(
       last_update_time_(creation_time),
       paused_(false),
       last_culling_time_(creation_time),
-      top_active_prio_level_(-1) {}
+      streams_by_prio_{ActiveStreams(0), ActiveStreams(1), ActiveStreams(2),
+                       ActiveStreams(3), ActiveStreams(4)},
+      top_active_prio_level_(-1) {
+  static_assert(kNumPriorityLevels == 5);
+}
 
 void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
                                   std::unique_ptr<RtpPacketToSend> packet) {
@@ -168,8 +225,6 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   }
   stream_queue = it->second.get();
 
-  auto enqueue_time_iterator =
-      enqueue_times_.insert(enqueue_times_.end(), enqueue_time);
   RTC_DCHECK(packet->packet_type().has_value());
   RtpPacketMediaType packet_type = packet->packet_type().value();
   int prio_level =
@@ -179,9 +234,18 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   PurgeOldPacketsAtPriorityLevel(prio_level, enqueue_time);
   RTC_DCHECK_GE(prio_level, 0);
   RTC_DCHECK_LT(prio_level, kNumPriorityLevels);
-  QueuedPacket queued_packed = {.packet = std::move(packet),
-                                .enqueue_time = enqueue_time,
-                                .enqueue_time_iterator = enqueue_time_iterator};
+  QueuedPacket* queued_packet = AllocatePacket();
+  queued_packet->packet = std::move(packet);
+  queued_packet->original_enqueue_time = enqueue_time;
+  queued_packet->enqueue_time = enqueue_time;
+  queued_packet->older = newest_packet_;
+  queued_packet->newer = nullptr;
+  if (newest_packet_ != nullptr) {
+    newest_packet_->newer = queued_packet;
+  } else {
+    oldest_packet_ = queued_packet;
+  }
+  newest_packet_ = queued_packet;
   // In order to figure out how much time a packet has spent in the queue
   // while not in a paused state, we subtract the total amount of time the
   // queue has been paused so far, and when the packet is popped we subtract
@@ -189,14 +253,14 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   // way we subtract the total amount of time the packet has spent in the
   // queue while in a paused state.
   UpdateAverageQueueTime(enqueue_time);
-  queued_packed.enqueue_time -= pause_time_sum_;
+  queued_packet->enqueue_time -= pause_time_sum_;
   ++size_packets_;
   ++size_packets_per_media_type_[static_cast<size_t>(packet_type)];
-  size_payload_ += queued_packed.PacketSize();
+  size_payload_ += queued_packet->PacketSize();
 
-  if (stream_queue->EnqueuePacket(std::move(queued_packed), prio_level)) {
+  if (stream_queue->EnqueuePacket(queued_packet, prio_level)) {
     // Number packets at `prio_level` for this steam is now non-zero.
-    streams_by_prio_[prio_level].push_back(stream_queue);
+    streams_by_prio_[prio_level].PushBack(stream_queue);
   }
   if (top_active_prio_level_ < 0 || prio_level < top_active_prio_level_) {
     top_active_prio_level_ = prio_level;
@@ -222,20 +286,21 @@ std::unique_ptr<RtpPacketToSend> PrioritizedPacketQueue::Pop() {
   }
 
   RTC_DCHECK_GE(top_active_prio_level_, 0);
-  StreamQueue& stream_queue = *streams_by_prio_[top_active_prio_level_].front();
-  QueuedPacket packet = stream_queue.DequeuePacket(top_active_prio_level_);
-  DequeuePacketInternal(packet);
+  ActiveStreams& active_streams = streams_by_prio_[top_active_prio_level_];
+  StreamQueue& stream_queue = *active_streams.front();
+  std::unique_ptr<RtpPacketToSend> packet = DequeuePacketInternal(
+      stream_queue.DequeuePacket(top_active_prio_level_));
 
-  // Remove StreamQueue from head of fifo-queue for this prio level, and
-  // and add it to the end if it still has packets.
-  streams_by_prio_[top_active_prio_level_].pop_front();
+  // Move the StreamQueue from the head of the round-robin order for this prio
+  // level to the end, or remove it if it has no more packets.
   if (stream_queue.HasPacketsAtPrio(top_active_prio_level_)) {
-    streams_by_prio_[top_active_prio_level_].push_back(&stream_queue);
+    active_streams.Rotate();
   } else {
+    active_streams.Remove(&stream_queue);
     MaybeUpdateTopPrioLevel();
   }
 
-  return std::move(packet.packet);
+  return packet;
 }
 
 int PrioritizedPacketQueue::SizeInPackets() const {
@@ -300,8 +365,8 @@ Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTimeForRetransmission()
 }
 
 Timestamp PrioritizedPacketQueue::OldestEnqueueTime() const {
-  return enqueue_times_.empty() ? Timestamp::MinusInfinity()
-                                : enqueue_times_.front();
+  return oldest_packet_ == nullptr ? Timestamp::MinusInfinity()
+                                   : oldest_packet_->original_enqueue_time;
 }
 
 TimeDelta PrioritizedPacketQueue::AverageQueueTime() const {
@@ -338,38 +403,21 @@ void PrioritizedPacketQueue::RemovePacketsForSsrc(uint32_t ssrc) {
   if (kv != streams_.end()) {
     // Dequeue all packets from the queue for this SSRC.
     StreamQueue& queue = *kv->second;
-    std::array<std::deque<QueuedPacket>, kNumPriorityLevels> packets_by_prio =
-        queue.DequeueAll();
     for (int i = 0; i < kNumPriorityLevels; ++i) {
-      std::deque<QueuedPacket>& packet_queue = packets_by_prio[i];
-      if (packet_queue.empty()) {
+      if (!queue.HasPacketsAtPrio(i)) {
         continue;
       }
 
       // First erase all packets at this prio level.
-      while (!packet_queue.empty()) {
-        QueuedPacket packet = std::move(packet_queue.front());
-        packet_queue.pop_front();
+      QueuedPacket* packet = queue.DequeueAll(i);
+      while (packet != nullptr) {
+        QueuedPacket* next = packet->next;
         DequeuePacketInternal(packet);
+        packet = next;
       }
 
       // Next, deregister this `StreamQueue` from the round-robin tables.
-      RTC_DCHECK(!streams_by_prio_[i].empty());
-      if (streams_by_prio_[i].size() == 1) {
-        // This is the last and only queue that had packets for this prio level.
-        // Update the global top prio level if neccessary.
-        RTC_DCHECK(streams_by_prio_[i].front() == &queue);
-        streams_by_prio_[i].pop_front();
-      } else {
-        // More than stream had packets at this prio level, filter this one out.
-        std::deque<StreamQueue*> filtered_queue;
-        for (StreamQueue* queue_ptr : streams_by_prio_[i]) {
-          if (queue_ptr != &queue) {
-            filtered_queue.push_back(queue_ptr);
-          }
-        }
-        streams_by_prio_[i].swap(filtered_queue);
-      }
+      streams_by_prio_[i].Remove(&queue);
     }
   }
   MaybeUpdateTopPrioLevel();
@@ -383,14 +431,26 @@ bool PrioritizedPacketQueue::HasKeyframePackets(uint32_t ssrc) const {
   return false;
 }
 
-void PrioritizedPacketQueue::DequeuePacketInternal(QueuedPacket& packet) {
+PrioritizedPacketQueue::QueuedPacket*
+PrioritizedPacketQueue::AllocatePacket() {
+  if (free_packets_ == nullptr) {
+    return &packet_pool_.emplace_back();
+  }
+  QueuedPacket* packet = free_packets_;
+  free_packets_ = packet->next;
+  packet->next = nullptr;
+  return packet;
+}
+
+std::unique_ptr<RtpPacketToSend> PrioritizedPacketQueue::DequeuePacketInternal(
+    QueuedPacket* packet) {
   --size_packets_;
-  RTC_DCHECK(packet.packet->packet_type().has_value());
-  RtpPacketMediaType packet_type = packet.packet->packet_type().value();
+  RTC_DCHECK(packet->packet->packet_type().has_value());
+  RtpPacketMediaType packet_type = packet->packet->packet_type().value();
   --size_packets_per_media_type_[static_cast<size_t>(packet_type)];
   RTC_DCHECK_GE(size_packets_per_media_type_[static_cast<size_t>(packet_type)],
                 0);
-  size_payload_ -= packet.PacketSize();
+  size_payload_ -= packet->PacketSize();
 
   // Calculate the total amount of time spent by this packet in the queue
   // while in a non-paused state. Note that the `pause_time_sum_ms_` was
@@ -398,7 +458,7 @@ void PrioritizedPacketQueue::DequeuePacketInternal(QueuedPacket& packet) {
   // by subtracting it now we effectively remove the time spent in in the
   // queue while in a paused state.
   TimeDelta time_in_non_paused_state =
-      last_update_time_ - packet.enqueue_time - pause_time_sum_;
+      last_update_time_ - packet->enqueue_time - pause_time_sum_;
   queue_time_sum_ -= time_in_non_paused_state;
 
   // Set the time spent in the send queue, which is the per-packet equivalent of
@@ -406,12 +466,31 @@ void PrioritizedPacketQueue::DequeuePacketInternal(QueuedPacket& packet) {
   // detail that we do not want to expose, so it makes sense to report the
   // metric excluding the pause time. This also avoids spikes in the metric.
   // https://w3c.github.io/webrtc-stats/#dom-rtcoutboundrtpstreamstats-totalpacketsenddelay
-  packet.packet->set_time_in_send_queue(time_in_non_paused_state);
+  packet->packet->set_time_in_send_queue(time_in_non_paused_state);
 
   RTC_DCHECK(size_packets_ > 0 || queue_time_sum_ == TimeDelta::Zero());
 
-  RTC_CHECK(packet.enqueue_time_iterator != enqueue_times_.end());
-  enqueue_times_.erase(packet.enqueue_time_iterator);
+  // Unlink from the enqueue time ordered list.
+  if (packet->older != nullptr) {
+    packet->older->newer = packet->newer;
+  } else {
+    RTC_DCHECK_EQ(oldest_packet_, packet);
+    oldest_packet_ = packet->newer;
+  }
+  if (packet->newer != nullptr) {
+    packet->newer->older = packet->older;
+  } else {
+    RTC_DCHECK_EQ(newest_packet_, packet);
+    newest_packet_ = packet->older;
+  }
+  packet->older = nullptr;
+  packet->newer = nullptr;
+
+  // Return the QueuedPacket to the pool.
+  std::unique_ptr<RtpPacketToSend> rtp_packet = std::move(packet->packet);
+  packet->next = free_packets_;
+  free_packets_ = packet;
+  return rtp_packet;
 }
 
 void PrioritizedPacketQueue::MaybeUpdateTopPrioLevel() {
@@ -443,26 +522,25 @@ void PrioritizedPacketQueue::PurgeOldPacketsAtPriorityLevel(int prio_level,
     return;
   }
 
-  std::deque<StreamQueue*>& queues = streams_by_prio_[prio_level];
-  auto iter = queues.begin();
-  while (iter != queues.end()) {
-    StreamQueue* queue_ptr = *iter;
+  ActiveStreams& queues = streams_by_prio_[prio_level];
+  StreamQueue* queue_ptr = queues.front();
+  for (int i = queues.size(); i > 0; --i) {
+    StreamQueue* next_queue_ptr = queue_ptr->next_active[prio_level];
     while (queue_ptr->HasPacketsAtPrio(prio_level) &&
            (now - queue_ptr->LeadingPacketEnqueueTime(prio_level)) >
                time_to_live) {
-      QueuedPacket packet = queue_ptr->DequeuePacket(prio_level);
+      QueuedPacket* packet = queue_ptr->DequeuePacket(prio_level);
       RTC_LOG(LS_INFO) << "Dropping old packet on SSRC: "
-                       << packet.packet->Ssrc()
-                       << " seq:" << packet.packet->SequenceNumber()
-                       << " time in queue:" << (now - packet.enqueue_time).ms()
+                       << packet->packet->Ssrc()
+                       << " seq:" << packet->packet->SequenceNumber()
+                       << " time in queue:" << (now - packet->enqueue_time).ms()
                        << " ms";
       DequeuePacketInternal(packet);
     }
     if (!queue_ptr->HasPacketsAtPrio(prio_level)) {
-      iter = queues.erase(iter);
-    } else {
-      ++iter;
+      queues.Remove(queue_ptr);
     }
+    queue_ptr = next_queue_ptr;
   }
 }
 
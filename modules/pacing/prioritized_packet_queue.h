@@ -16,7 +16,6 @@
 #include <array>
 #include <cstdint>
 #include <deque>
-#include <list>
 #include <memory>
 #include <unordered_map>
 
@@ -105,13 +104,24 @@ class PrioritizedPacketQueue {
  private:
   static constexpr int kNumPriorityLevels = 5;
 
+  // A queued packet. Instances are owned by `packet_pool_` and recycled via
+  // `free_packets_`, so that no allocation is needed per packet in steady
+  // state. Each packet is linked into the FIFO of its stream and priority
+  // level, and into the list of all packets ordered by enqueue time.
   class QueuedPacket {
    public:
     DataSize PacketSize() const;
 
     std::unique_ptr<RtpPacketToSend> packet;
-    Timestamp enqueue_time;
-    std::list<Timestamp>::iterator enqueue_time_iterator;
+    // Time of Push(), with the total pause time at that point subtracted.
+    Timestamp enqueue_time = Timestamp::MinusInfinity();
+    // Time of Push(), as given.
+    Timestamp original_enqueue_time = Timestamp::MinusInfinity();
+    // Next packet in the stream FIFO, or next free packet when in the pool.
+    QueuedPacket* next = nullptr;
+    // Neighbours in the list of all packets, ordered by enqueue time.
+    QueuedPacket* older = nullptr;
+    QueuedPacket* newer = nullptr;
   };
 
   // Class containing packets for an RTP stream.
@@ -119,17 +129,15 @@ class PrioritizedPacketQueue {
   class StreamQueue {
    public:
     explicit StreamQueue(Timestamp creation_time);
-    StreamQueue(StreamQueue&&) = default;
-    StreamQueue& operator=(StreamQueue&&) = default;
 
     StreamQueue(const StreamQueue&) = delete;
     StreamQueue& operator=(const StreamQueue&) = delete;
 
     // Enqueue packet at the given priority level. Returns true if the packet
     // count for that priority level went from zero to non-zero.
-    bool EnqueuePacket(QueuedPacket packet, int priority_level);
+    bool EnqueuePacket(QueuedPacket* packet, int priority_level);
 
-    QueuedPacket DequeuePacket(int priority_level);
+    QueuedPacket* DequeuePacket(int priority_level);
 
     bool HasPacketsAtPrio(int priority_level) const;
     bool IsEmpty() const;
@@ -137,16 +145,49 @@ class PrioritizedPacketQueue {
     Timestamp LastEnqueueTime() const;
     bool has_keyframe_packets() const { return num_keyframe_packets_ > 0; }
 
-    std::array<std::deque<QueuedPacket>, kNumPriorityLevels> DequeueAll();
+    // Unlinks all packets at the given priority level and returns the first
+    // one. The rest follow via `QueuedPacket::next`.
+    QueuedPacket* DequeueAll(int priority_level);
+
+    // Links for the round-robin list of streams with packets at a given
+    // priority level, see `ActiveStreams`.
+    StreamQueue* prev_active[kNumPriorityLevels] = {};
+    StreamQueue* next_active[kNumPriorityLevels] = {};
 
    private:
-    std::deque<QueuedPacket> packets_[kNumPriorityLevels];
+    QueuedPacket* head_[kNumPriorityLevels] = {};
+    QueuedPacket* tail_[kNumPriorityLevels] = {};
     Timestamp last_enqueue_time_;
     int num_keyframe_packets_;
   };
 
-  // Remove the packet from the internal state, e.g. queue time / size etc.
-  void DequeuePacketInternal(QueuedPacket& packet);
+  // Circular list of the StreamQueues which have at least one packet pending
+  // for a priority level, in round-robin order starting with `front()`.
+  class ActiveStreams {
+   public:
+    explicit ActiveStreams(int priority_level)
+        : priority_level_(priority_level) {}
+
+    bool empty() const { return head_ == nullptr; }
+    int size() const { return size_; }
+    StreamQueue* front() const { return head_; }
+    // Adds `stream` last in the round-robin order.
+    void PushBack(StreamQueue* stream);
+    // Moves the front stream last in the round-robin order.
+    void Rotate();
+    void Remove(StreamQueue* stream);
+
+   private:
+    const int priority_level_;
+    StreamQueue* head_ = nullptr;
+    int size_ = 0;
+  };
+
+  QueuedPacket* AllocatePacket();
+
+  // Remove the packet from the internal state, e.g. queue time / size etc.,
+  // and return it to the pool. Returns the RTP packet it contained.
+  std::unique_ptr<RtpPacketToSend> DequeuePacketInternal(QueuedPacket* packet);
 
   // Check if the queue pointed to by `top_active_prio_level_` is empty and
   // if so move it to the lowest non-empty index.
@@ -181,17 +222,22 @@ class PrioritizedPacketQueue {
   // Map from SSRC to packet queues for the associated RTP stream.
   std::unordered_map<uint32_t, std::unique_ptr<StreamQueue>> streams_;
 
-  // For each priority level, a queue of StreamQueues which have at least one
-  // packet pending for that prio level.
-  std::deque<StreamQueue*> streams_by_prio_[kNumPriorityLevels];
+  // For each priority level, the StreamQueues which have at least one packet
+  // pending for that prio level.
+  std::array<ActiveStreams, kNumPriorityLevels> streams_by_prio_;
 
   // The first index into `stream_by_prio_` that is non-empty.
   int top_active_prio_level_;
 
-  // Ordered list of enqueue times. Additions are always increasing and added to
-  // the end. QueuedPacket instances have a iterators into this list for fast
-  // removal.
-  std::list<Timestamp> enqueue_times_;
+  // Storage for all QueuedPackets ever needed at once. Elements never move,
+  // and unused ones are kept in the singly-linked `free_packets_` list.
+  std::deque<QueuedPacket> packet_pool_;
+  QueuedPacket* free_packets_ = nullptr;
+
+  // Oldest and newest ends of the list of queued packets ordered by enqueue
+  // time. Additions are always increasing and added to the newest end.
+  QueuedPacket* oldest_packet_ = nullptr;
+  QueuedPacket* newest_packet_ = nullptr;
 };
 
 }  // namespace webrtc
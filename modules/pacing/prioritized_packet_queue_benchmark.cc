@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/pacing/prioritized_packet_queue.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kFirstSsrc = 1000;
+
+std::unique_ptr<RtpPacketToSend> CreatePacket(uint32_t ssrc, uint16_t seq) {
+  auto packet = std::make_unique<RtpPacketToSend>(/*extensions=*/nullptr);
+  packet->set_packet_type(seq % 10 == 0 ? RtpPacketMediaType::kRetransmission
+                                        : RtpPacketMediaType::kVideo);
+  packet->SetSsrc(ssrc);
+  packet->SetSequenceNumber(seq);
+  packet->SetPayloadSize(1000);
+  return packet;
+}
+
+// Fills a queue with `num_packets` packets spread over `num_ssrcs` streams.
+void FillQueue(PrioritizedPacketQueue& queue,
+               Timestamp now,
+               int num_packets,
+               int num_ssrcs) {
+  for (int i = 0; i < num_packets; ++i) {
+    queue.Push(now, CreatePacket(kFirstSsrc + i % num_ssrcs, i));
+  }
+}
+
+// Steady state pacing: every popped packet is pushed back again, keeping the
+// queue size constant.
+void BM_PushPop(benchmark::State& state) {
+  const int num_packets = state.range(0);
+  const int num_ssrcs = state.range(1);
+  Timestamp now = Timestamp::Millis(1000);
+  PrioritizedPacketQueue queue(now);
+  FillQueue(queue, now, num_packets, num_ssrcs);
+  for (auto s : state) {
+    now += TimeDelta::Micros(10);
+    std::unique_ptr<RtpPacketToSend> packet = queue.Pop();
+    queue.UpdateAverageQueueTime(now);
+    queue.Push(now, std::move(packet));
+    benchmark::DoNotOptimize(queue.OldestEnqueueTime());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Removes all packets of one stream and pushes them back again.
+void BM_RemovePacketsForSsrc(benchmark::State& state) {
+  const int num_packets = state.range(0);
+  const int num_ssrcs = state.range(1);
+  const int packets_per_ssrc = num_packets / num_ssrcs;
+  Timestamp now = Timestamp::Millis(1000);
+  PrioritizedPacketQueue queue(now);
+  FillQueue(queue, now, num_packets, num_ssrcs);
+  uint32_t ssrc = kFirstSsrc;
+  for (auto s : state) {
+    state.PauseTiming();
+    std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+    for (int i = 0; i < packets_per_ssrc; ++i) {
+      packets.push_back(CreatePacket(ssrc, i));
+    }
+    state.ResumeTiming();
+    queue.RemovePacketsForSsrc(ssrc);
+    for (std::unique_ptr<RtpPacketToSend>& packet : packets) {
+      queue.Push(now, std::move(packet));
+    }
+    ssrc = kFirstSsrc + (ssrc - kFirstSsrc + 1) % num_ssrcs;
+  }
+}
+
+BENCHMARK(BM_PushPop)->Args({1000, 10})->Args({10000, 200});
+BENCHMARK(BM_RemovePacketsForSsrc)->Args({1000, 10})->Args({10000, 200});
+
+}  // namespace
+}  // namespace webrtc
@@ -433,6 +433,40 @@ TEST(PrioritizedPacketQueue, ClearPacketsAffectsOnlySpecifiedSsrc) {
   EXPECT_TRUE(queue.Empty());
 }
 
+TEST(PrioritizedPacketQueue, ClearPacketsKeepsRoundRobinOrderOfOtherStreams) {
+  Timestamp now = Timestamp::Zero();
+  PrioritizedPacketQueue queue(now);
+
+  // Two video packets each for three streams.
+  for (uint16_t seq = 1; seq <= 6; ++seq) {
+    queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, seq,
+                                 /*ssrc=*/100 + (seq - 1) % 3));
+  }
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 1);
+  EXPECT_EQ(queue.OldestEnqueueTime(), now);
+
+  // Remove the stream in the middle of the round-robin order.
+  queue.RemovePacketsForSsrc(/*ssrc=*/101);
+  EXPECT_EQ(queue.SizeInPackets(), 3);
+
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 3);
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 4);
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 6);
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
+
+  // The queue keeps working when packets are pushed again.
+  queue.Push(Timestamp::Millis(10),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/7, /*ssrc=*/101));
+  queue.Push(Timestamp::Millis(20),
+             CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/8, /*ssrc=*/100));
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(10));
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 7);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(20));
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 8);
+  EXPECT_TRUE(queue.Empty());
+}
+
 TEST(PrioritizedPacketQueue, ReportsKeyframePackets) {
   Timestamp now = Timestamp::Zero();
   PrioritizedPacketQueue queue(now);
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "api/array_view.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+
+namespace {
+
+XorKernel DetectXorKernel() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2)) {
+    return &XorKernelAvx2;
+  }
+  if (GetCPUInfo(kSSE2)) {
+    return &XorKernelSse2;
+  }
+#endif
+  return &XorKernelC;
+}
+
+}  // namespace
+
+void XorKernelC(const uint8_t* const* sources,
+                size_t num_sources,
+                size_t length,
+                uint8_t* destination) {
+  RTC_DCHECK_GE(num_sources, 1);
+  RTC_DCHECK_LE(num_sources, kMaxXorKernelSources);
+  // Process eight bytes at a time. memcpy avoids unaligned access and lets the
+  // compiler use wider loads where available.
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t acc;
+    memcpy(&acc, destination + i, sizeof(acc));
+    for (size_t k = 0; k < num_sources; ++k) {
+      uint64_t word;
+      memcpy(&word, sources[k] + i, sizeof(word));
+      acc ^= word;
+    }
+    memcpy(destination + i, &acc, sizeof(acc));
+  }
+  for (; i < length; ++i) {
+    for (size_t k = 0; k < num_sources; ++k) {
+      destination[i] ^= sources[k][i];
+    }
+  }
+}
+
+XorKernel GetXorKernel() {
+  static const XorKernel kernel = DetectXorKernel();
+  return kernel;
+}
+
+void XorInto(rtc::ArrayView<const rtc::ArrayView<const uint8_t>> sources,
+             rtc::ArrayView<uint8_t> destination) {
+  const XorKernel kernel = GetXorKernel();
+  const uint8_t* group[kMaxXorKernelSources];
+  size_t index = 0;
+  while (index < sources.size()) {
+    const size_t num_sources =
+        std::min(sources.size() - index, kMaxXorKernelSources);
+    // XOR the length all sources in the group have in common in one pass,
+    // then each of the remaining tails separately.
+    size_t common_length = sources[index].size();
+    for (size_t k = 0; k < num_sources; ++k) {
+      RTC_DCHECK_LE(sources[index + k].size(), destination.size());
+      group[k] = sources[index + k].data();
+      common_length = std::min(common_length, sources[index + k].size());
+    }
+    if (common_length > 0) {
+      kernel(group, num_sources, common_length, destination.data());
+    }
+    for (size_t k = 0; k < num_sources; ++k) {
+      const rtc::ArrayView<const uint8_t> source = sources[index + k];
+      if (source.size() > common_length) {
+        const uint8_t* tail = source.data() + common_length;
+        kernel(&tail, 1, source.size() - common_length,
+               destination.data() + common_length);
+      }
+    }
+    index += num_sources;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,35 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
+#define MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/source/fec_xor_kernels.h"
+
+namespace webrtc {
+
+// Returns the fastest XorKernel supported by the CPU. CPU detection only runs
+// on the first call.
+XorKernel GetXorKernel();
+
+// XORs every buffer in `sources` into `destination`, which must be at least as
+// long as the longest source. Sources of different lengths are XORed as if
+// they were zero padded. Combines up to kMaxXorKernelSources sources in each
+// pass over `destination`.
+void XorInto(rtc::ArrayView<const rtc::ArrayView<const uint8_t>> sources,
+             rtc::ArrayView<uint8_t> destination);
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
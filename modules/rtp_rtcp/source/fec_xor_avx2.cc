@@ -0,0 +1,44 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules/rtp_rtcp/source/fec_xor_kernels.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+void XorKernelAvx2(const uint8_t* const* sources,
+                   size_t num_sources,
+                   size_t length,
+                   uint8_t* destination) {
+  RTC_DCHECK_GE(num_sources, 1);
+  RTC_DCHECK_LE(num_sources, kMaxXorKernelSources);
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    __m256i acc =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+    for (size_t k = 0; k < num_sources; ++k) {
+      const __m256i source =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sources[k] + i));
+      acc = _mm256_xor_si256(acc, source);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), acc);
+  }
+  for (; i < length; ++i) {
+    for (size_t k = 0; k < num_sources; ++k) {
+      destination[i] ^= sources[k][i];
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,49 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_FEC_XOR_KERNELS_H_
+#define MODULES_RTP_RTCP_SOURCE_FEC_XOR_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtc_base/system/arch.h"
+
+namespace webrtc {
+
+// Maximum number of sources combined by a single XorKernel call.
+constexpr size_t kMaxXorKernelSources = 4;
+
+// XORs the first `length` bytes of each of the `num_sources` buffers in
+// `sources` into `destination`. `num_sources` must be in the range
+// [1, kMaxXorKernelSources]. Buffers may not overlap `destination`.
+using XorKernel = void (*)(const uint8_t* const* sources,
+                           size_t num_sources,
+                           size_t length,
+                           uint8_t* destination);
+
+void XorKernelC(const uint8_t* const* sources,
+                size_t num_sources,
+                size_t length,
+                uint8_t* destination);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void XorKernelSse2(const uint8_t* const* sources,
+                   size_t num_sources,
+                   size_t length,
+                   uint8_t* destination);
+void XorKernelAvx2(const uint8_t* const* sources,
+                   size_t num_sources,
+                   size_t length,
+                   uint8_t* destination);
+#endif
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_FEC_XOR_KERNELS_H_
@@ -0,0 +1,44 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules/rtp_rtcp/source/fec_xor_kernels.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+void XorKernelSse2(const uint8_t* const* sources,
+                   size_t num_sources,
+                   size_t length,
+                   uint8_t* destination) {
+  RTC_DCHECK_GE(num_sources, 1);
+  RTC_DCHECK_LE(num_sources, kMaxXorKernelSources);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i acc =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+    for (size_t k = 0; k < num_sources; ++k) {
+      const __m128i source =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(sources[k] + i));
+      acc = _mm_xor_si128(acc, source);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), acc);
+  }
+  for (; i < length; ++i) {
+    for (size_t k = 0; k < num_sources; ++k) {
+      destination[i] ^= sources[k][i];
+    }
+  }
+}
+
+}  // namespace webrtc
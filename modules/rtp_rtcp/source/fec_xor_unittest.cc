@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/source/fec_xor_kernels.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "test/gtest.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+namespace {
+
+std::vector<uint8_t> RandomBytes(Random& random, size_t size) {
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& byte : bytes) {
+    byte = random.Rand<uint8_t>();
+  }
+  return bytes;
+}
+
+// Reference implementation: one byte at a time, zero padding short sources.
+std::vector<uint8_t> ReferenceXor(const std::vector<std::vector<uint8_t>>& srcs,
+                                  std::vector<uint8_t> dst) {
+  for (const std::vector<uint8_t>& src : srcs) {
+    for (size_t i = 0; i < src.size(); ++i) {
+      dst[i] ^= src[i];
+    }
+  }
+  return dst;
+}
+
+void ExpectKernelMatchesReference(XorKernel kernel) {
+  Random random(0x5eed);
+  for (size_t num_sources = 1; num_sources <= kMaxXorKernelSources;
+       ++num_sources) {
+    for (size_t length = 0; length <= 200; ++length) {
+      std::vector<std::vector<uint8_t>> srcs;
+      const uint8_t* src_ptrs[kMaxXorKernelSources];
+      for (size_t k = 0; k < num_sources; ++k) {
+        srcs.push_back(RandomBytes(random, length));
+        src_ptrs[k] = srcs.back().data();
+      }
+      std::vector<uint8_t> dst = RandomBytes(random, length);
+      std::vector<uint8_t> expected = ReferenceXor(srcs, dst);
+      kernel(src_ptrs, num_sources, length, dst.data());
+      EXPECT_EQ(dst, expected)
+          << "num_sources=" << num_sources << " length=" << length;
+    }
+  }
+}
+
+TEST(FecXorTest, CKernelMatchesReference) {
+  ExpectKernelMatchesReference(&XorKernelC);
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+TEST(FecXorTest, Sse2KernelMatchesReference) {
+  if (!GetCPUInfo(kSSE2)) {
+    GTEST_SKIP() << "SSE2 is not supported.";
+  }
+  ExpectKernelMatchesReference(&XorKernelSse2);
+}
+
+TEST(FecXorTest, Avx2KernelMatchesReference) {
+  if (!GetCPUInfo(kAVX2)) {
+    GTEST_SKIP() << "AVX2 is not supported.";
+  }
+  ExpectKernelMatchesReference(&XorKernelAvx2);
+}
+#endif
+
+TEST(FecXorTest, XorIntoHandlesSourcesOfDifferentLengths) {
+  Random random(0xfec);
+  for (size_t num_sources = 1; num_sources <= 12; ++num_sources) {
+    std::vector<std::vector<uint8_t>> srcs;
+    size_t max_length = 0;
+    for (size_t k = 0; k < num_sources; ++k) {
+      srcs.push_back(RandomBytes(random, random.Rand(0, 1300)));
+      max_length = std::max(max_length, srcs.back().size());
+    }
+    std::vector<rtc::ArrayView<const uint8_t>> views(srcs.begin(),
+                                                     srcs.end());
+    std::vector<uint8_t> dst = RandomBytes(random, max_length);
+    std::vector<uint8_t> expected = ReferenceXor(srcs, dst);
+    XorInto(views, dst);
+    EXPECT_EQ(dst, expected) << "num_sources=" << num_sources;
+  }
+}
+
+TEST(FecXorTest, XorIntoWithNoSourcesLeavesDestinationUnchanged) {
+  std::vector<uint8_t> dst = {1, 2, 3};
+  XorInto({}, dst);
+  EXPECT_EQ(dst, std::vector<uint8_t>({1, 2, 3}));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -16,9 +16,11 @@
 #include <utility>
 
 #include "absl/algorithm/container.h"
+#include "api/array_view.h"
 #include "modules/include/module_common_types_public.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/fec_xor.h"
 #include "modules/rtp_rtcp/source/flexfec_03_header_reader_writer.h"
 #include "modules/rtp_rtcp/source/forward_error_correction_internal.h"
 #include "modules/rtp_rtcp/source/ulpfec_header_reader_writer.h"
@@ -214,6 +216,10 @@ void ForwardErrorCorrection::GenerateFecPayloads(
     const size_t fec_header_size =
         fec_header_writer_->FecHeaderSize(min_packet_mask_size);
 
+    // Collect the media packets protected by `fec_packet` first, so that all
+    // of their payloads can be XORed in a single bulk pass.
+    xor_packets_.clear();
+    size_t max_media_payload_length = 0;
     size_t media_pkt_idx = 0;
     auto media_packets_it = media_packets.cbegin();
     uint16_t prev_seq_num =
@@ -222,19 +228,10 @@ void ForwardErrorCorrection::GenerateFecPayloads(
       Packet* const media_packet = media_packets_it->get();
       // Should `media_packet` be protected by `fec_packet`?
       if (packet_masks_[pkt_mask_idx] & (1 << (7 - media_pkt_idx))) {
-        size_t media_payload_length =
-            media_packet->data.size() - kRtpHeaderSize;
-
-        size_t fec_packet_length = fec_header_size + media_payload_length;
-        if (fec_packet_length > fec_packet->data.size()) {
-          size_t old_size = fec_packet->data.size();
-          fec_packet->data.SetSize(fec_packet_length);
-          memset(fec_packet->data.MutableData() + old_size, 0,
-                 fec_packet_length - old_size);
-        }
-        XorHeaders(*media_packet, fec_packet);
-        XorPayloads(*media_packet, media_payload_length, fec_header_size,
-                    fec_packet);
+        xor_packets_.push_back(media_packet);
+        max_media_payload_length =
+            std::max(max_media_payload_length,
+                     media_packet->data.size() - kRtpHeaderSize);
       }
       media_packets_it++;
       if (media_packets_it != media_packets.end()) {
@@ -246,6 +243,16 @@ void ForwardErrorCorrection::GenerateFecPayloads(
       pkt_mask_idx += media_pkt_idx / 8;
       media_pkt_idx %= 8;
     }
+    if (!xor_packets_.empty()) {
+      size_t fec_packet_length = fec_header_size + max_media_payload_length;
+      if (fec_packet_length > fec_packet->data.size()) {
+        size_t old_size = fec_packet->data.size();
+        fec_packet->data.SetSize(fec_packet_length);
+        memset(fec_packet->data.MutableData() + old_size, 0,
+               fec_packet_length - old_size);
+      }
+      XorPackets(xor_packets_, fec_header_size, fec_packet);
+    }
     RTC_DCHECK_GT(fec_packet->data.size(), 0)
         << "Packet mask is wrong or poorly designed.";
   }
@@ -622,24 +629,22 @@ void ForwardErrorCorrection::XorHeaders(const Packet& src, Packet* dst) {
   // Skip the 9th to 12th bytes of the header.
 }
 
-void ForwardErrorCorrection::XorPayloads(const Packet& src,
-                                         size_t payload_length,
-                                         size_t dst_offset,
-                                         Packet* dst) {
-  // XOR the payload.
-  RTC_DCHECK_LE(kRtpHeaderSize + payload_length, src.data.size());
-  RTC_DCHECK_LE(dst_offset + payload_length, dst->data.capacity());
-  if (dst_offset + payload_length > dst->data.size()) {
-    size_t old_size = dst->data.size();
-    size_t new_size = dst_offset + payload_length;
-    dst->data.SetSize(new_size);
-    memset(dst->data.MutableData() + old_size, 0, new_size - old_size);
-  }
-  uint8_t* dst_data = dst->data.MutableData();
-  const uint8_t* src_data = src.data.cdata();
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst_data[dst_offset + i] ^= src_data[kRtpHeaderSize + i];
+void ForwardErrorCorrection::XorPackets(rtc::ArrayView<const Packet*> src,
+                                        size_t dst_offset,
+                                        Packet* dst) {
+  size_t max_payload_length = 0;
+  xor_payloads_.clear();
+  for (const Packet* packet : src) {
+    XorHeaders(*packet, dst);
+    xor_payloads_.emplace_back(packet->data.cdata() + kRtpHeaderSize,
+                               packet->data.size() - kRtpHeaderSize);
+    max_payload_length =
+        std::max(max_payload_length, xor_payloads_.back().size());
   }
+  RTC_DCHECK_LE(dst_offset + max_payload_length, dst->data.size());
+  XorInto(xor_payloads_,
+          rtc::ArrayView<uint8_t>(dst->data.MutableData() + dst_offset,
+                                  max_payload_length));
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
@@ -647,18 +652,29 @@ bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
   if (!StartPacketRecovery(fec_packet, recovered_packet)) {
     return false;
   }
+  xor_packets_.clear();
+  size_t max_payload_length = 0;
   for (const auto& protected_packet : fec_packet.protected_packets) {
     if (protected_packet->pkt == nullptr) {
       // This is the packet we're recovering.
       recovered_packet->seq_num = protected_packet->seq_num;
       recovered_packet->ssrc = protected_packet->ssrc;
     } else {
-      XorHeaders(*protected_packet->pkt, recovered_packet->pkt.get());
-      XorPayloads(*protected_packet->pkt,
-                  protected_packet->pkt->data.size() - kRtpHeaderSize,
-                  kRtpHeaderSize, recovered_packet->pkt.get());
+      xor_packets_.push_back(protected_packet->pkt.get());
+      max_payload_length =
+          std::max(max_payload_length,
+                   protected_packet->pkt->data.size() - kRtpHeaderSize);
     }
   }
+  Packet* const dst = recovered_packet->pkt.get();
+  if (kRtpHeaderSize + max_payload_length > dst->data.size()) {
+    size_t old_size = dst->data.size();
+    size_t new_size = kRtpHeaderSize + max_payload_length;
+    RTC_DCHECK_LE(new_size, dst->data.capacity());
+    dst->data.SetSize(new_size);
+    memset(dst->data.MutableData() + old_size, 0, new_size - old_size);
+  }
+  XorPackets(xor_packets_, kRtpHeaderSize, dst);
   if (!FinishPacketRecovery(fec_packet, recovered_packet)) {
     return false;
   }
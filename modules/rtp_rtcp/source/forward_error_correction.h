@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "absl/container/inlined_vector.h"
+#include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "api/units/timestamp.h"
 #include "modules/include/module_fec_types.h"
@@ -319,13 +320,12 @@ class ForwardErrorCorrection {
   // the length recovery field.
   static void XorHeaders(const Packet& src, Packet* dst);
 
-  // Performs XOR between the payloads of `src` and `dst` and stores the result
-  // in `dst`. The parameter `dst_offset` determines at  what byte the
-  // XOR operation starts in `dst`. In total, `payload_length` bytes are XORed.
-  static void XorPayloads(const Packet& src,
-                          size_t payload_length,
-                          size_t dst_offset,
-                          Packet* dst);
+  // Performs XOR of the headers and payloads of all packets in `src` into
+  // `dst`, with the payloads starting at byte `dst_offset` in `dst`. `dst`
+  // must already be large enough to hold the longest payload.
+  void XorPackets(rtc::ArrayView<const Packet*> src,
+                  size_t dst_offset,
+                  Packet* dst);
 
   // Finalizes recovery of packet by setting RTP header fields.
   // This is not specific to the FEC scheme used.
@@ -333,8 +333,8 @@ class ForwardErrorCorrection {
                                    RecoveredPacket* recovered_packet);
 
   // Recover a missing packet.
-  static bool RecoverPacket(const ReceivedFecPacket& fec_packet,
-                            RecoveredPacket* recovered_packet);
+  bool RecoverPacket(const ReceivedFecPacket& fec_packet,
+                     RecoveredPacket* recovered_packet);
 
   // Get the number of missing media packets which are covered by `fec_packet`.
   // An FEC packet can recover at most one packet, and if zero packets are
@@ -367,6 +367,11 @@ class ForwardErrorCorrection {
   uint8_t packet_masks_[kUlpfecMaxMediaPackets * kUlpfecMaxPacketMaskSize];
   uint8_t tmp_packet_masks_[kUlpfecMaxMediaPackets * kUlpfecMaxPacketMaskSize];
   size_t packet_mask_size_;
+
+  // Scratch storage reused between calls to collect the packets, and their
+  // payloads, that are XORed into a single FEC or recovered packet.
+  std::vector<const Packet*> xor_packets_;
+  std::vector<rtc::ArrayView<const uint8_t>> xor_payloads_;
 };
 
 // Classes derived from FecHeader{Reader,Writer} encapsulate the
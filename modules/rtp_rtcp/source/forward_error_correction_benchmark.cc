@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/fec_test_helper.h"
+#include "modules/rtp_rtcp/source/forward_error_correction.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kMediaSsrc = 83542;
+constexpr size_t kPayloadSize = 1200;
+// Roughly 50% protection.
+constexpr uint8_t kProtectionFactor = 128;
+
+ForwardErrorCorrection::PacketList GenerateMediaPackets(int num_packets) {
+  Random random(0x1234);
+  test::fec::MediaPacketGenerator generator(kRtpHeaderSize + kPayloadSize,
+                                            kRtpHeaderSize + kPayloadSize,
+                                            kMediaSsrc, &random);
+  return generator.ConstructMediaPackets(num_packets, /*start_seq_num=*/1000);
+}
+
+void BM_UlpfecEncode(benchmark::State& state) {
+  const int num_media_packets = state.range(0);
+  ForwardErrorCorrection::PacketList media_packets =
+      GenerateMediaPackets(num_media_packets);
+  std::unique_ptr<ForwardErrorCorrection> fec =
+      ForwardErrorCorrection::CreateUlpfec(kMediaSsrc);
+  std::list<ForwardErrorCorrection::Packet*> fec_packets;
+  for (auto s : state) {
+    fec_packets.clear();
+    fec->EncodeFec(media_packets, kProtectionFactor,
+                   /*num_important_packets=*/0,
+                   /*use_unequal_protection=*/false, kFecMaskRandom,
+                   &fec_packets);
+    benchmark::DoNotOptimize(fec_packets);
+  }
+  state.SetBytesProcessed(state.iterations() * num_media_packets *
+                          kPayloadSize);
+  state.counters["fec_packets"] = fec_packets.size();
+}
+
+// Decodes a frame where the middle media packet was lost. Each iteration
+// starts from a fresh decoder, so that the same packets can be recovered
+// again.
+void BM_UlpfecRecover(benchmark::State& state) {
+  const int num_media_packets = state.range(0);
+  ForwardErrorCorrection::PacketList media_packets =
+      GenerateMediaPackets(num_media_packets);
+  std::unique_ptr<ForwardErrorCorrection> encoder =
+      ForwardErrorCorrection::CreateUlpfec(kMediaSsrc);
+  std::list<ForwardErrorCorrection::Packet*> fec_packets;
+  encoder->EncodeFec(media_packets, kProtectionFactor,
+                     /*num_important_packets=*/0,
+                     /*use_unequal_protection=*/false, kFecMaskRandom,
+                     &fec_packets);
+
+  std::vector<std::unique_ptr<ForwardErrorCorrection::ReceivedPacket>>
+      received_packets;
+  size_t media_index = 0;
+  uint16_t next_seq_num = 0;
+  for (const auto& media_packet : media_packets) {
+    next_seq_num =
+        ByteReader<uint16_t>::ReadBigEndian(media_packet->data.data() + 2) + 1;
+    if (media_index++ == media_packets.size() / 2) {
+      continue;
+    }
+    auto received_packet =
+        std::make_unique<ForwardErrorCorrection::ReceivedPacket>();
+    received_packet->pkt = new ForwardErrorCorrection::Packet();
+    received_packet->pkt->data = media_packet->data;
+    received_packet->is_fec = false;
+    received_packet->ssrc = kMediaSsrc;
+    received_packet->seq_num = next_seq_num - 1;
+    received_packets.push_back(std::move(received_packet));
+  }
+  for (const ForwardErrorCorrection::Packet* fec_packet : fec_packets) {
+    auto received_packet =
+        std::make_unique<ForwardErrorCorrection::ReceivedPacket>();
+    received_packet->pkt = new ForwardErrorCorrection::Packet();
+    received_packet->pkt->data = fec_packet->data;
+    received_packet->is_fec = true;
+    received_packet->ssrc = kMediaSsrc;
+    received_packet->seq_num = next_seq_num++;
+    received_packets.push_back(std::move(received_packet));
+  }
+
+  size_t num_recovered_packets = 0;
+  for (auto s : state) {
+    std::unique_ptr<ForwardErrorCorrection> decoder =
+        ForwardErrorCorrection::CreateUlpfec(kMediaSsrc);
+    ForwardErrorCorrection::RecoveredPacketList recovered_packets;
+    num_recovered_packets = 0;
+    for (const auto& received_packet : received_packets) {
+      // DecodeFec() rewrites FEC headers in place, so hand it a copy.
+      ForwardErrorCorrection::ReceivedPacket packet;
+      packet.is_fec = received_packet->is_fec;
+      packet.ssrc = received_packet->ssrc;
+      packet.seq_num = received_packet->seq_num;
+      packet.pkt = new ForwardErrorCorrection::Packet();
+      packet.pkt->data = received_packet->pkt->data;
+      num_recovered_packets +=
+          decoder->DecodeFec(packet, &recovered_packets).num_recovered_packets;
+    }
+    benchmark::DoNotOptimize(recovered_packets);
+  }
+  state.SetBytesProcessed(state.iterations() * num_recovered_packets *
+                          kPayloadSize);
+  state.counters["recovered_packets"] = num_recovered_packets;
+}
+
+BENCHMARK(BM_UlpfecEncode)->Arg(4)->Arg(12)->Arg(24)->Arg(48);
+BENCHMARK(BM_UlpfecRecover)->Arg(4)->Arg(12)->Arg(24)->Arg(48);
+
+}  // namespace
+}  // namespace webrtc
@@ -42,7 +42,7 @@ RtpFrameObject::RtpFrameObject(
         absl::variant<FrameInstrumentationSyncData, FrameInstrumentationData>>&
         frame_instrumentation_data,
     RtpPacketInfos packet_infos,
-    rtc::scoped_refptr<EncodedImageBuffer> image_buffer)
+    rtc::scoped_refptr<EncodedImageBufferInterface> image_buffer)
     : image_buffer_(image_buffer),
       first_seq_num_(first_seq_num),
       last_seq_num_(last_seq_num),
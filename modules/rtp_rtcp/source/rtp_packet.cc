@@ -73,6 +73,15 @@ RtpPacket::RtpPacket(const ExtensionManager* extensions, size_t capacity)
   Clear();
 }
 
+RtpPacket::RtpPacket(const ExtensionManager* extensions,
+                     rtc::CopyOnWriteBuffer buffer)
+    : extensions_(extensions ? *extensions : ExtensionManager()),
+      buffer_(std::move(buffer)) {
+  RTC_DCHECK_GE(buffer_.capacity(), kFixedHeaderSize);
+  buffer_.SetSize(kFixedHeaderSize);
+  Clear();
+}
+
 RtpPacket::RtpPacket(const RtpPacket&) = default;
 RtpPacket::RtpPacket(RtpPacket&&) = default;
 RtpPacket& RtpPacket::operator=(const RtpPacket&) = default;
@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "api/array_view.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -36,6 +37,9 @@ class RtpPacket {
   RtpPacket();
   explicit RtpPacket(const ExtensionManager* extensions);
   RtpPacket(const ExtensionManager* extensions, size_t capacity);
+  // Builds the packet in the storage of `buffer`, which is cleared first. Used
+  // with buffers from a rtc::CopyOnWriteBufferPool to avoid allocating.
+  RtpPacket(const ExtensionManager* extensions, rtc::CopyOnWriteBuffer buffer);
 
   RtpPacket(const RtpPacket&);
   RtpPacket(RtpPacket&&);
@@ -215,8 +219,13 @@ class RtpPacket {
   size_t payload_offset_;  // Match header size with csrcs and extensions.
   size_t payload_size_;
 
+  // Enough entries for the extensions commonly sent on a video stream without
+  // allocating.
+  static constexpr size_t kInlinedExtensionEntries = 12;
+
   ExtensionManager extensions_;
-  std::vector<ExtensionInfo> extension_entries_;
+  absl::InlinedVector<ExtensionInfo, kInlinedExtensionEntries>
+      extension_entries_;
   size_t extensions_size_ = 0;  // Unaligned.
   rtc::CopyOnWriteBuffer buffer_;
 };
@@ -11,8 +11,10 @@
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 
 #include <cstdint>
+#include <utility>
 
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "rtc_base/copy_on_write_buffer.h"
 
 namespace webrtc {
 
@@ -21,6 +23,9 @@ RtpPacketToSend::RtpPacketToSend(const ExtensionManager* extensions)
 RtpPacketToSend::RtpPacketToSend(const ExtensionManager* extensions,
                                  size_t capacity)
     : RtpPacket(extensions, capacity) {}
+RtpPacketToSend::RtpPacketToSend(const ExtensionManager* extensions,
+                                 rtc::CopyOnWriteBuffer buffer)
+    : RtpPacket(extensions, std::move(buffer)) {}
 RtpPacketToSend::RtpPacketToSend(const RtpPacketToSend& packet) = default;
 RtpPacketToSend::RtpPacketToSend(RtpPacketToSend&& packet) = default;
 
@@ -25,6 +25,7 @@
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet.h"
+#include "rtc_base/copy_on_write_buffer.h"
 
 namespace webrtc {
 // Class to hold rtp packet with metadata for sender side.
@@ -37,6 +38,8 @@ class RtpPacketToSend : public RtpPacket {
 
   explicit RtpPacketToSend(const ExtensionManager* extensions);
   RtpPacketToSend(const ExtensionManager* extensions, size_t capacity);
+  RtpPacketToSend(const ExtensionManager* extensions,
+                  rtc::CopyOnWriteBuffer buffer);
   RtpPacketToSend(const RtpPacketToSend& packet);
   RtpPacketToSend(RtpPacketToSend&& packet);
 
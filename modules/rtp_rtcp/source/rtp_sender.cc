@@ -166,6 +166,7 @@ RTPSender::RTPSender(const Environment& env,
                                          : std::nullopt),
       packet_history_(packet_history),
       paced_sender_(packet_sender),
+      packet_buffer_pool_(rtc::CopyOnWriteBufferPool::Create(IP_PACKET_SIZE)),
       sending_media_(true),                   // Default to sending media.
       max_packet_size_(IP_PACKET_SIZE - 28),  // Default is IP-v4/UDP.
       rtp_header_extension_map_(config.extmap_allow_mixed),
@@ -432,8 +433,9 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
   }
 
   while (bytes_left > 0) {
-    auto padding_packet =
-        std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
+    auto padding_packet = std::make_unique<RtpPacketToSend>(
+        &rtp_header_extension_map_,
+        packet_buffer_pool_->Allocate(IP_PACKET_SIZE));
     padding_packet->set_packet_type(RtpPacketMediaType::kPadding);
     padding_packet->SetMarker(false);
     if (rtx_ == kRtxOff) {
@@ -524,8 +526,9 @@ std::unique_ptr<RtpPacketToSend> RTPSender::AllocatePacket(
     max_num_csrcs_ = csrcs.size();
     UpdateHeaderSizes();
   }
-  auto packet = std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_,
-                                                  max_packet_size_);
+  auto packet = std::make_unique<RtpPacketToSend>(
+      &rtp_header_extension_map_,
+      packet_buffer_pool_->Allocate(max_packet_size_));
   packet->SetSsrc(ssrc_);
   packet->SetCsrcs(csrcs);
 
@@ -594,6 +597,9 @@ size_t RTPSender::RtxPacketOverhead() const {
 void RTPSender::SetSendingMediaStatus(bool enabled) {
   MutexLock lock(&send_mutex_);
   sending_media_ = enabled;
+  if (!enabled) {
+    packet_buffer_pool_->Trim();
+  }
 }
 
 bool RTPSender::SendingMedia() const {
@@ -687,8 +693,9 @@ std::unique_ptr<RtpPacketToSend> RTPSender::BuildRtxPacket(
     if (kv == rtx_payload_type_map_.end())
       return nullptr;
 
-    rtx_packet = std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_,
-                                                   max_packet_size_);
+    rtx_packet = std::make_unique<RtpPacketToSend>(
+        &rtp_header_extension_map_,
+        packet_buffer_pool_->Allocate(max_packet_size_));
 
     rtx_packet->SetPayloadType(kv->second);
 
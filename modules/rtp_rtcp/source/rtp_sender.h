@@ -29,6 +29,7 @@
 #include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
 #include "modules/rtp_rtcp/source/rtp_packet_history.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_interface.h"
+#include "rtc_base/copy_on_write_buffer_pool.h"
 #include "rtc_base/random.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread_annotations.h"
@@ -179,6 +180,10 @@ class RTPSender {
   RtpPacketHistory* const packet_history_;
   RtpPacketSender* const paced_sender_;
 
+  // Recycles the storage of sent packets once they have left the pacer and
+  // the packet history. Trimmed when media sending stops.
+  const rtc::scoped_refptr<rtc::CopyOnWriteBufferPool> packet_buffer_pool_;
+
   mutable Mutex send_mutex_;
 
   bool sending_media_ RTC_GUARDED_BY(send_mutex_);
@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/rtp_packet_sender.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_history.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "modules/rtp_rtcp/source/rtp_rtcp_interface.h"
+#include "modules/rtp_rtcp/source/rtp_sender.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/heap_allocation_counter.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kSsrc = 725242;
+
+class NullPacketSender : public RtpPacketSender {
+ public:
+  void EnqueuePackets(
+      std::vector<std::unique_ptr<RtpPacketToSend>> /* packets */) override {}
+  void RemovePacketsForSsrc(uint32_t /* ssrc */) override {}
+};
+
+class RtpSenderAllocationTest : public ::testing::Test {
+ protected:
+  RtpSenderAllocationTest()
+      : clock_(/*initial_time_us=*/123456789),
+        env_(CreateEnvironment(&clock_)),
+        packet_history_(env_, RtpPacketHistory::PaddingMode::kDefault),
+        rtp_sender_(env_, GetConfig(), &packet_history_, &packet_sender_) {}
+
+  static RtpRtcpInterface::Configuration GetConfig() {
+    RtpRtcpInterface::Configuration config;
+    config.local_media_ssrc = kSsrc;
+    return config;
+  }
+
+  SimulatedClock clock_;
+  const Environment env_;
+  NullPacketSender packet_sender_;
+  RtpPacketHistory packet_history_;
+  RTPSender rtp_sender_;
+};
+
+TEST_F(RtpSenderAllocationTest, AllocatesOnlyThePacketObjectsInSteadyState) {
+  // Packets are allocated by the sender and copied by the packetizer, which
+  // unshares the copy when it is modified.
+  auto allocate_and_copy = [&] {
+    std::unique_ptr<RtpPacketToSend> packet = rtp_sender_.AllocatePacket();
+    auto copy = std::make_unique<RtpPacketToSend>(*packet);
+    copy->SetMarker(true);
+    copy->AllocatePayload(1000);
+  };
+  allocate_and_copy();
+
+  for (int i = 0; i < 10; ++i) {
+    test::ScopedHeapAllocationCounter allocations;
+    allocate_and_copy();
+    // The two RtpPacketToSend objects are allocated, their storage is not.
+    EXPECT_EQ(allocations.count(), 2);
+  }
+}
+
+TEST_F(RtpSenderAllocationTest, FreesUnusedPacketStorageWhenMediaIsStopped) {
+  { std::unique_ptr<RtpPacketToSend> packet = rtp_sender_.AllocatePacket(); }
+  rtp_sender_.SetSendingMediaStatus(false);
+  rtp_sender_.SetSendingMediaStatus(true);
+
+  test::ScopedHeapAllocationCounter allocations;
+  std::unique_ptr<RtpPacketToSend> packet = rtp_sender_.AllocatePacket();
+  // The packet object, and its storage which has to be allocated again.
+  EXPECT_GT(allocations.count(), 1);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -11,6 +11,7 @@
 #include "modules/rtp_rtcp/source/rtp_sender.h"
 
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -304,6 +305,27 @@ TEST_F(RtpSenderTest, AllocatePacketReserveExtensions) {
   EXPECT_FALSE(packet->HasExtension<VideoOrientation>());
 }
 
+TEST_F(RtpSenderTest, AllocatedPacketsReuseStorageInSteadyState) {
+  // Packets are allocated by the sender and copied by the packetizer, which
+  // unshares the copy when it is modified.
+  std::set<const uint8_t*> storage;
+  {
+    std::unique_ptr<RtpPacketToSend> packet = rtp_sender_->AllocatePacket();
+    auto copy = std::make_unique<RtpPacketToSend>(*packet);
+    copy->SetMarker(true);
+    storage = {packet->data(), copy->data()};
+  }
+  ASSERT_EQ(storage.size(), 2u);
+
+  for (int i = 0; i < 10; ++i) {
+    std::unique_ptr<RtpPacketToSend> packet = rtp_sender_->AllocatePacket();
+    auto copy = std::make_unique<RtpPacketToSend>(*packet);
+    copy->SetMarker(true);
+    EXPECT_THAT(storage, Contains(packet->data()));
+    EXPECT_THAT(storage, Contains(copy->data()));
+  }
+}
+
 TEST_F(RtpSenderTest, PaddingAlwaysAllowedOnAudio) {
   RtpRtcpInterface::Configuration config = GetDefaultConfig();
   config.audio = true;
@@ -16,6 +16,8 @@
 #include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "api/video/encoded_image.h"
+#include "api/video/fragmented_encoded_image_buffer.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -39,4 +41,10 @@ rtc::scoped_refptr<EncodedImageBuffer> VideoRtpDepacketizer::AssembleFrame(
   return bitstream;
 }
 
+rtc::scoped_refptr<EncodedImageBufferInterface>
+VideoRtpDepacketizer::AssembleFragmentedFrame(
+    rtc::ArrayView<const rtc::CopyOnWriteBuffer> rtp_payloads) {
+  return FragmentedEncodedImageBuffer::Create(rtp_payloads);
+}
+
 }  // namespace webrtc
@@ -35,6 +35,13 @@ class VideoRtpDepacketizer {
       rtc::CopyOnWriteBuffer rtp_payload) = 0;
   virtual rtc::scoped_refptr<EncodedImageBuffer> AssembleFrame(
       rtc::ArrayView<const rtc::ArrayView<const uint8_t>> rtp_payloads);
+  // Same as AssembleFrame(), but the returned buffer may refer to the
+  // payloads instead of copying them. By default it is a
+  // FragmentedEncodedImageBuffer of the payloads. Depacketizers that override
+  // AssembleFrame() must override this as well.
+  virtual rtc::scoped_refptr<EncodedImageBufferInterface>
+  AssembleFragmentedFrame(
+      rtc::ArrayView<const rtc::CopyOnWriteBuffer> rtp_payloads);
 };
 
 }  // namespace webrtc
@@ -15,6 +15,7 @@
 
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "modules/rtp_rtcp/source/leb128.h"
 #include "modules/rtp_rtcp/source/rtp_video_header.h"
@@ -356,6 +357,17 @@ rtc::scoped_refptr<EncodedImageBuffer> VideoRtpDepacketizerAv1::AssembleFrame(
   return bitstream;
 }
 
+rtc::scoped_refptr<EncodedImageBufferInterface>
+VideoRtpDepacketizerAv1::AssembleFragmentedFrame(
+    rtc::ArrayView<const rtc::CopyOnWriteBuffer> rtp_payloads) {
+  std::vector<rtc::ArrayView<const uint8_t>> payloads;
+  payloads.reserve(rtp_payloads.size());
+  for (const rtc::CopyOnWriteBuffer& payload : rtp_payloads) {
+    payloads.emplace_back(payload.cdata(), payload.size());
+  }
+  return AssembleFrame(payloads);
+}
+
 std::optional<VideoRtpDepacketizer::ParsedRtpPayload>
 VideoRtpDepacketizerAv1::Parse(rtc::CopyOnWriteBuffer rtp_payload) {
   if (rtp_payload.size() == 0) {
@@ -34,6 +34,9 @@ class VideoRtpDepacketizerAv1 : public VideoRtpDepacketizer {
   rtc::scoped_refptr<EncodedImageBuffer> AssembleFrame(
       rtc::ArrayView<const rtc::ArrayView<const uint8_t>> rtp_payloads)
       override;
+  // Rewrites the OBU headers, so always copies.
+  rtc::scoped_refptr<EncodedImageBufferInterface> AssembleFragmentedFrame(
+      rtc::ArrayView<const rtc::CopyOnWriteBuffer> rtp_payloads) override;
 
   std::optional<ParsedRtpPayload> Parse(
       rtc::CopyOnWriteBuffer rtp_payload) override;
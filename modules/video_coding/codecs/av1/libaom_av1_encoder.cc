@@ -831,6 +831,7 @@ VideoEncoder::EncoderInfo LibaomAv1Encoder::GetEncoderInfo() const {
   info.implementation_name = "libaom";
   info.has_trusted_rate_controller = true;
   info.is_hardware_accelerated = false;
+  info.supports_encode_from_any_thread = true;
   info.scaling_settings =
       (inited_ && !encoder_settings_.AV1().automatic_resize_on)
           ? VideoEncoder::ScalingSettings::kOff
@@ -71,6 +71,11 @@ ABSL_FLAG(int,
           std::numeric_limits<int>::max(),
           "Keyframe interval in frames.");
 ABSL_FLAG(int, num_frames, 300, "Number of frames to encode and/or decode.");
+ABSL_FLAG(int, num_cores, 1, "Number of CPU cores the encoder may use.");
+ABSL_FLAG(bool,
+          parallel_simulcast_encoding,
+          false,
+          "Encode the simulcast streams of a frame concurrently.");
 ABSL_FLAG(std::string, field_trials, "", "Field trials to apply.");
 ABSL_FLAG(std::string, test_name, "", "Test name.");
 ABSL_FLAG(bool, dump_decoder_input, false, "Dump decoder input.");
@@ -228,6 +233,9 @@ std::unique_ptr<VideoCodecStats> RunEncodeDecodeTest(
   VideoCodecTester::EncoderSettings encoder_settings;
   encoder_settings.pacing_settings.mode =
       encoder_impl == "builtin" ? PacingMode::kNoPacing : PacingMode::kRealTime;
+  encoder_settings.number_of_cores = absl::GetFlag(FLAGS_num_cores);
+  encoder_settings.parallel_simulcast_encoding =
+      absl::GetFlag(FLAGS_parallel_simulcast_encoding);
   if (absl::GetFlag(FLAGS_dump_encoder_input)) {
     encoder_settings.encoder_input_base_path = output_path + "_enc_input";
   }
@@ -273,6 +281,9 @@ std::unique_ptr<VideoCodecStats> RunEncodeTest(
   VideoCodecTester::EncoderSettings encoder_settings;
   encoder_settings.pacing_settings.mode =
       encoder_impl == "builtin" ? PacingMode::kNoPacing : PacingMode::kRealTime;
+  encoder_settings.number_of_cores = absl::GetFlag(FLAGS_num_cores);
+  encoder_settings.parallel_simulcast_encoding =
+      absl::GetFlag(FLAGS_parallel_simulcast_encoding);
   if (absl::GetFlag(FLAGS_dump_encoder_input)) {
     encoder_settings.encoder_input_base_path = output_path + "_enc_input";
   }
@@ -16,7 +16,9 @@
 
 #include "absl/base/nullability.h"
 #include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
 #include "api/video_codecs/video_encoder.h"
+#include "common_video/include/shared_video_frame_buffer_pool.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 
 namespace webrtc {
@@ -30,7 +32,15 @@ absl::Nonnull<std::unique_ptr<VideoEncoder>> CreateVp8Encoder(
     const Environment& env,
     Vp8EncoderSettings settings = {});
 
-std::unique_ptr<VideoDecoder> CreateVp8Decoder(const Environment& env);
+struct Vp8DecoderSettings {
+  // Pool to take the decoded frame buffers from, which may be shared with
+  // other decoders. If null, the decoder keeps its own buffers and frees them
+  // when it is released.
+  scoped_refptr<SharedVideoFrameBufferPool> shared_frame_buffer_pool;
+};
+std::unique_ptr<VideoDecoder> CreateVp8Decoder(
+    const Environment& env,
+    Vp8DecoderSettings settings = {});
 
 }  // namespace webrtc
 
@@ -17,6 +17,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 #include "api/environment/environment.h"
 #include "api/field_trials_view.h"
@@ -86,8 +87,9 @@ GetPostProcParamsFromFieldTrialGroup(const FieldTrialsView& field_trials) {
 
 }  // namespace
 
-std::unique_ptr<VideoDecoder> CreateVp8Decoder(const Environment& env) {
-  return std::make_unique<LibvpxVp8Decoder>(env);
+std::unique_ptr<VideoDecoder> CreateVp8Decoder(const Environment& env,
+                                               Vp8DecoderSettings settings) {
+  return std::make_unique<LibvpxVp8Decoder>(env, std::move(settings));
 }
 
 class LibvpxVp8Decoder::QpSmoother {
@@ -114,11 +116,14 @@ class LibvpxVp8Decoder::QpSmoother {
   rtc::ExpFilter smoother_;
 };
 
-LibvpxVp8Decoder::LibvpxVp8Decoder(const Environment& env)
+LibvpxVp8Decoder::LibvpxVp8Decoder(const Environment& env,
+                                   Vp8DecoderSettings settings)
     : use_postproc_(
           kIsArm ? env.field_trials().IsEnabled(kVp8PostProcArmFieldTrial)
                  : true),
-      buffer_pool_(false, 300 /* max_number_of_buffers*/),
+      buffer_pool_(false,
+                   300 /* max_number_of_buffers*/,
+                   std::move(settings.shared_frame_buffer_pool)),
       decode_complete_callback_(NULL),
       inited_(false),
       decoder_(NULL),
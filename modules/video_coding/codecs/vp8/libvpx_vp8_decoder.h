@@ -28,7 +28,8 @@ namespace webrtc {
 
 class LibvpxVp8Decoder : public VideoDecoder {
  public:
-  explicit LibvpxVp8Decoder(const Environment& env);
+  explicit LibvpxVp8Decoder(const Environment& env,
+                            Vp8DecoderSettings settings = {});
   ~LibvpxVp8Decoder() override;
 
   bool Configure(const Settings& settings) override;
@@ -21,6 +21,7 @@
 #include "api/test/mock_video_encoder.h"
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/vp8_temporal_layers.h"
+#include "common_video/include/shared_video_frame_buffer_pool.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "common_video/test/utilities.h"
 #include "modules/video_coding/codecs/interface/mock_libvpx_interface.h"
@@ -298,6 +299,36 @@ TEST_F(TestVp8Impl, DecodedQpEqualsEncodedQp) {
   EXPECT_EQ(encoded_frame.qp_, *decoded_qp);
 }
 
+class TestVp8ImplWithSharedFrameBufferPool : public TestVp8Impl {
+ protected:
+  std::unique_ptr<VideoDecoder> CreateDecoder() override {
+    return CreateVp8Decoder(env_, {.shared_frame_buffer_pool = pool_});
+  }
+
+  const scoped_refptr<SharedVideoFrameBufferPool> pool_ =
+      SharedVideoFrameBufferPool::Create();
+};
+
+TEST_F(TestVp8ImplWithSharedFrameBufferPool, DecodesIntoSharedPool) {
+  VideoFrame input_frame = NextInputFrame();
+  EncodedImage encoded_frame;
+  CodecSpecificInfo codec_specific_info;
+  EncodeAndWaitForFrame(input_frame, &encoded_frame, &codec_specific_info);
+
+  encoded_frame._frameType = VideoFrameType::kVideoFrameKey;
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder_->Decode(encoded_frame, -1));
+  std::unique_ptr<VideoFrame> decoded_frame;
+  std::optional<uint8_t> decoded_qp;
+  ASSERT_TRUE(WaitForDecodedFrame(&decoded_frame, &decoded_qp));
+  ASSERT_TRUE(decoded_frame);
+  EXPECT_GT(I420PSNR(&input_frame, decoded_frame.get()), 36);
+  EXPECT_EQ(1, pool_->GetStats().num_allocated);
+
+  // The buffer is handed back to the shared pool when the frame is dropped.
+  decoded_frame.reset();
+  EXPECT_EQ(1u, pool_->GetStats().num_retained_buffers);
+}
+
 TEST_F(TestVp8Impl, ChecksSimulcastSettings) {
   codec_settings_.numberOfSimulcastStreams = 2;
   // Resolutions are not in ascending order, temporal layers do not match.
@@ -1814,6 +1814,7 @@ VideoEncoder::EncoderInfo LibvpxVp9Encoder::GetEncoderInfo() const {
   }
   info.has_trusted_rate_controller = trusted_rate_controller_;
   info.is_hardware_accelerated = false;
+  info.supports_encode_from_any_thread = true;
   if (inited_) {
     // Find the max configured fps of any active spatial layer.
     float max_fps = 0.0;
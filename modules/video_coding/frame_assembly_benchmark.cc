@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/container/inlined_vector.h"
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_frame.h"
+#include "api/video/encoded_image.h"
+#include "api/video/fragmented_encoded_image_buffer.h"
+#include "api/video/video_codec_type.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/source/create_video_rtp_depacketizer.h"
+#include "modules/rtp_rtcp/source/video_rtp_depacketizer.h"
+#include "modules/video_coding/frame_helpers.h"
+#include "rtc_base/copy_on_write_buffer.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kMaxPayloadSize = 1200;
+
+// The RTP payloads of one spatial layer of `layer_size` bytes.
+std::vector<rtc::CopyOnWriteBuffer> CreateLayerPayloads(size_t layer_size) {
+  std::vector<rtc::CopyOnWriteBuffer> payloads;
+  uint8_t value = 0;
+  for (size_t offset = 0; offset < layer_size; offset += kMaxPayloadSize) {
+    rtc::CopyOnWriteBuffer payload(
+        std::min(kMaxPayloadSize, layer_size - offset));
+    for (uint8_t& byte : rtc::MakeArrayView(payload.MutableData(),
+                                            payload.size())) {
+      byte = value++;
+    }
+    payloads.push_back(std::move(payload));
+  }
+  return payloads;
+}
+
+uint32_t Sum(rtc::ArrayView<const uint8_t> data) {
+  uint32_t sum = 0;
+  for (uint8_t byte : data) {
+    sum += byte;
+  }
+  return sum;
+}
+
+// Stands in for a decoder that reads every byte of its input, either as one
+// contiguous buffer or fragment by fragment.
+uint32_t Decode(const EncodedImage& image, bool fragmented_input) {
+  const EncodedImageBufferInterface& buffer = *image.GetEncodedData();
+  if (!fragmented_input || buffer.fragments().empty()) {
+    return Sum(rtc::MakeArrayView(image.data(), image.size()));
+  }
+  uint32_t sum = 0;
+  for (rtc::ArrayView<const uint8_t> fragment : buffer.fragments()) {
+    sum += Sum(fragment);
+  }
+  return sum;
+}
+
+// The receive path before fragmented frames: every layer is assembled into
+// its own buffer, and the layers of a superframe are copied once more into
+// the combined buffer.
+scoped_refptr<EncodedImageBufferInterface> AssembleAndCombineByCopy(
+    VideoRtpDepacketizer& depacketizer,
+    const std::vector<std::vector<rtc::CopyOnWriteBuffer>>& layers,
+    size_t& bytes_copied) {
+  std::vector<scoped_refptr<EncodedImageBuffer>> layer_buffers;
+  size_t frame_size = 0;
+  for (const std::vector<rtc::CopyOnWriteBuffer>& payloads : layers) {
+    std::vector<rtc::ArrayView<const uint8_t>> views;
+    for (const rtc::CopyOnWriteBuffer& payload : payloads) {
+      views.emplace_back(payload.cdata(), payload.size());
+    }
+    layer_buffers.push_back(depacketizer.AssembleFrame(views));
+    frame_size += layer_buffers.back()->size();
+  }
+  bytes_copied += frame_size;
+  if (layer_buffers.size() == 1) {
+    return layer_buffers[0];
+  }
+  auto combined = EncodedImageBuffer::Create(frame_size);
+  uint8_t* write_at = combined->data();
+  for (const scoped_refptr<EncodedImageBuffer>& layer : layer_buffers) {
+    memcpy(write_at, layer->data(), layer->size());
+    write_at += layer->size();
+  }
+  bytes_copied += frame_size;
+  return combined;
+}
+
+// The receive path of RtpVideoStreamReceiver2 and the frame buffer: the
+// layers refer to the RTP payloads, and so does the combined frame.
+scoped_refptr<EncodedImageBufferInterface> AssembleAndCombineFragmented(
+    VideoRtpDepacketizer& depacketizer,
+    const std::vector<std::vector<rtc::CopyOnWriteBuffer>>& layers) {
+  absl::InlinedVector<std::unique_ptr<EncodedFrame>, 4> frames;
+  for (size_t i = 0; i < layers.size(); ++i) {
+    auto frame = std::make_unique<EncodedFrame>();
+    frame->SetEncodedData(depacketizer.AssembleFragmentedFrame(layers[i]));
+    frame->SetSpatialIndex(static_cast<int>(i));
+    frames.push_back(std::move(frame));
+  }
+  return CombineAndDeleteFrames(std::move(frames))->GetEncodedData();
+}
+
+// Assembles a frame of `frame_size` bytes in `spatial_layers` layers from
+// its RTP payloads and decodes it. Reports the bytes that were copied on the
+// way from the payloads to the decoder, per frame.
+void BM_AssembleFrame(benchmark::State& state) {
+  const size_t frame_size = state.range(0);
+  const int num_layers = state.range(1);
+  const bool fragmented = state.range(2) != 0;
+  const bool fragmented_decoder = state.range(3) != 0;
+  std::unique_ptr<VideoRtpDepacketizer> depacketizer =
+      CreateVideoRtpDepacketizer(kVideoCodecGeneric);
+  std::vector<std::vector<rtc::CopyOnWriteBuffer>> layers;
+  for (int i = 0; i < num_layers; ++i) {
+    layers.push_back(CreateLayerPayloads(frame_size / num_layers));
+  }
+
+  size_t bytes_copied = 0;
+  uint32_t checksum = 0;
+  for (auto s : state) {
+    EncodedImage image;
+    if (fragmented) {
+      image.SetEncodedData(AssembleAndCombineFragmented(*depacketizer, layers));
+    } else {
+      image.SetEncodedData(
+          AssembleAndCombineByCopy(*depacketizer, layers, bytes_copied));
+    }
+    checksum += Decode(image, fragmented_decoder);
+    if (fragmented) {
+      const auto& buffer = static_cast<const FragmentedEncodedImageBuffer&>(
+          *image.GetEncodedData());
+      if (buffer.is_flattened()) {
+        bytes_copied += buffer.size();
+      }
+    }
+  }
+  benchmark::DoNotOptimize(checksum);
+
+  state.SetBytesProcessed(state.iterations() * frame_size);
+  state.counters["bytes_copied_per_frame"] =
+      static_cast<double>(bytes_copied) / state.iterations();
+}
+
+void AssembleFrameArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames(
+      {"frame_size", "layers", "fragmented", "fragmented_decoder"});
+  for (int frame_size : {10'000, 100'000}) {
+    for (int num_layers : {1, 3}) {
+      benchmark->Args({frame_size, num_layers, 0, 0});
+      benchmark->Args({frame_size, num_layers, 1, 0});
+      benchmark->Args({frame_size, num_layers, 1, 1});
+    }
+  }
+}
+
+BENCHMARK(BM_AssembleFrame)->Apply(AssembleFrameArgs);
+
+}  // namespace
+}  // namespace webrtc
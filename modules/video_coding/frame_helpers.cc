@@ -12,6 +12,7 @@
 
 #include <utility>
 
+#include "api/video/fragmented_encoded_image_buffer.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -58,18 +59,15 @@ std::unique_ptr<EncodedFrame> CombineAndDeleteFrames(
     return std::move(frames[0]);
   }
 
-  size_t total_length = 0;
-  for (const auto& frame : frames) {
-    total_length += frame->size();
-  }
   const EncodedFrame& last_frame = *frames.back();
   std::unique_ptr<EncodedFrame> first_frame = std::move(frames[0]);
-  auto encoded_image_buffer = EncodedImageBuffer::Create(total_length);
-  uint8_t* buffer = encoded_image_buffer->data();
+  // The combined frame refers to the data of the layers instead of copying
+  // it.
+  auto encoded_image_buffer = FragmentedEncodedImageBuffer::Create();
   first_frame->SetSpatialLayerFrameSize(first_frame->SpatialIndex().value_or(0),
                                         first_frame->size());
-  memcpy(buffer, first_frame->data(), first_frame->size());
-  buffer += first_frame->size();
+  encoded_image_buffer->Append(first_frame->GetEncodedData(),
+                               first_frame->size());
 
   // Spatial index of combined frame is set equal to spatial index of its top
   // spatial layer.
@@ -91,12 +89,12 @@ std::unique_ptr<EncodedFrame> CombineAndDeleteFrames(
 
   // Append all remaining frames to the first one.
   for (size_t i = 1; i < frames.size(); ++i) {
-    // Let |next_frame| fall out of scope so it is deleted after copying.
+    // The combined buffer keeps the data of `next_frame` alive.
     std::unique_ptr<EncodedFrame> next_frame = std::move(frames[i]);
     first_frame->SetSpatialLayerFrameSize(
         next_frame->SpatialIndex().value_or(0), next_frame->size());
-    memcpy(buffer, next_frame->data(), next_frame->size());
-    buffer += next_frame->size();
+    encoded_image_buffer->Append(next_frame->GetEncodedData(),
+                                 next_frame->size());
   }
   first_frame->SetEncodedData(encoded_image_buffer);
   return first_frame;
@@ -12,6 +12,7 @@
 
 #include <utility>
 
+#include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_frame.h"
@@ -24,6 +25,7 @@ namespace webrtc {
 namespace {
 
 using ::testing::ElementsAre;
+using ::testing::SizeIs;
 
 constexpr uint32_t kRtpTimestamp = 123456710;
 
@@ -109,5 +111,25 @@ TEST(FrameInstrumentationDataTest,
               ElementsAre(0.1, 0.3, 2.1));
 }
 
+TEST(CombineAndDeleteFramesTest, CombinedFrameRefersToTheLayerData) {
+  EncodedFrame spatial_layer_1 = CreateEncodedImageOfSizeN(/*n=*/3, /*x=*/1);
+  spatial_layer_1.SetSpatialIndex(0);
+  EncodedFrame spatial_layer_2 = CreateEncodedImageOfSizeN(/*n=*/2, /*x=*/4);
+  spatial_layer_2.SetSpatialIndex(1);
+  const uint8_t* layer_1_data = spatial_layer_1.data();
+
+  absl::InlinedVector<std::unique_ptr<EncodedFrame>, 4> frames;
+  frames.push_back(std::make_unique<EncodedFrame>(spatial_layer_1));
+  frames.push_back(std::make_unique<EncodedFrame>(spatial_layer_2));
+  std::unique_ptr<EncodedFrame> combined =
+      CombineAndDeleteFrames(std::move(frames));
+
+  ASSERT_THAT(combined->GetEncodedData()->fragments(), SizeIs(2));
+  EXPECT_EQ(combined->GetEncodedData()->fragments()[0].data(), layer_1_data);
+  EXPECT_THAT(rtc::MakeArrayView(combined->data(), combined->size()),
+              ElementsAre(1, 2, 3, 4, 5));
+  EXPECT_EQ(combined->SpatialIndex(), 1);
+}
+
 }  // namespace
 }  // namespace webrtc
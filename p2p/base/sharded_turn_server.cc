@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/sharded_turn_server.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/port_interface.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/crypto_random.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_server.h"
+
+namespace cricket {
+namespace {
+
+constexpr size_t kNonceKeySize = 16;
+
+}  // namespace
+
+struct ShardedTurnServer::Shard {
+  std::unique_ptr<rtc::Thread> thread;
+  std::unique_ptr<TurnServer> server;
+};
+
+// static
+std::unique_ptr<ShardedTurnServer> ShardedTurnServer::Create(
+    const Config& config) {
+  RTC_DCHECK_GE(config.num_shards, 1);
+  std::unique_ptr<ShardedTurnServer> server(new ShardedTurnServer());
+  server->internal_address_ = config.internal_address;
+  const std::string nonce_key = rtc::CreateRandomString(kNonceKeySize);
+  for (int i = 0; i < config.num_shards; ++i) {
+    if (!server->AddShard(config, nonce_key)) {
+      return nullptr;
+    }
+  }
+  RTC_LOG(LS_INFO) << "Started " << config.num_shards
+                   << " TURN server shards at "
+                   << server->internal_address_.ToString();
+  return server;
+}
+
+ShardedTurnServer::ShardedTurnServer() = default;
+
+ShardedTurnServer::~ShardedTurnServer() {
+  for (std::unique_ptr<Shard>& shard : shards_) {
+    if (shard->server) {
+      shard->thread->BlockingCall([&] { shard->server = nullptr; });
+    }
+    shard->thread->Stop();
+  }
+}
+
+bool ShardedTurnServer::AddShard(const Config& config,
+                                 absl::string_view nonce_key) {
+  auto shard = std::make_unique<Shard>();
+  shard->thread = rtc::Thread::CreateWithSocketServer();
+  shard->thread->SetName("TurnShard", shard.get());
+  shard->thread->Start();
+  // The first shard takes over the address the others should bind to, which
+  // resolves a requested port of 0.
+  bool bound = shard->thread->BlockingCall([&] {
+    rtc::SocketServer* socket_server = shard->thread->socketserver();
+    std::unique_ptr<rtc::Socket> socket(
+        socket_server->CreateSocket(internal_address_.family(), SOCK_DGRAM));
+    if (!socket) {
+      return false;
+    }
+    if (socket->SetOption(rtc::Socket::OPT_REUSEPORT, 1) != 0 &&
+        config.num_shards > 1) {
+      RTC_LOG(LS_ERROR) << "SO_REUSEPORT is required for sharding.";
+      return false;
+    }
+    if (socket->Bind(internal_address_) != 0) {
+      RTC_LOG(LS_ERROR) << "Failed to bind TURN shard to "
+                        << internal_address_.ToString()
+                        << ", error=" << socket->GetError();
+      return false;
+    }
+    internal_address_ = socket->GetLocalAddress();
+
+    shard->server =
+        std::make_unique<TurnServer>(shard->thread.get(), nonce_key);
+    shard->server->set_realm(config.realm);
+    shard->server->set_software(config.software);
+    shard->server->set_auth_hook(config.auth_hook);
+    shard->server->AddInternalSocket(new rtc::AsyncUDPSocket(socket.release()),
+                                     PROTO_UDP);
+    shard->server->SetExternalSocketFactory(
+        new rtc::BasicPacketSocketFactory(socket_server),
+        rtc::SocketAddress(config.external_ip, 0));
+    return true;
+  });
+  shards_.push_back(std::move(shard));
+  return bound;
+}
+
+void ShardedTurnServer::ForEachShard(absl::FunctionRef<void(TurnServer&)> fn) {
+  for (std::unique_ptr<Shard>& shard : shards_) {
+    shard->thread->BlockingCall([&] { fn(*shard->server); });
+  }
+}
+
+size_t ShardedTurnServer::num_allocations() {
+  size_t num_allocations = 0;
+  ForEachShard([&](TurnServer& server) {
+    num_allocations += server.allocations().size();
+  });
+  return num_allocations;
+}
+
+}  // namespace cricket
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef P2P_BASE_SHARDED_TURN_SERVER_H_
+#define P2P_BASE_SHARDED_TURN_SERVER_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "p2p/base/turn_server.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+
+namespace cricket {
+
+// Runs one TurnServer per worker thread so that UDP relaying scales with the
+// number of cores. Every shard owns a UDP socket bound to the same internal
+// address with SO_REUSEPORT; the kernel hashes each client's 4-tuple to one of
+// these sockets, so all packets of an allocation are handled by the same
+// shard, which owns the allocation together with its permissions, channels
+// and external socket. Shards share nothing but the nonce key.
+//
+// Only UDP is supported. Where SO_REUSEPORT is not available only a single
+// shard can be created.
+class ShardedTurnServer {
+ public:
+  struct Config {
+    // Number of worker threads, each running one TurnServer.
+    int num_shards = 1;
+    // Address to listen on for clients. If the port is 0, a port is picked
+    // when the first shard binds and reused by the others.
+    rtc::SocketAddress internal_address;
+    // Address relayed (external) sockets are bound to.
+    rtc::IPAddress external_ip;
+    std::string realm;
+    std::string software;
+    // Used from all shards at once; must be thread safe and outlive the
+    // server.
+    TurnAuthInterface* auth_hook = nullptr;
+  };
+
+  // Returns nullptr if the internal sockets could not be bound.
+  static std::unique_ptr<ShardedTurnServer> Create(const Config& config);
+
+  ShardedTurnServer(const ShardedTurnServer&) = delete;
+  ShardedTurnServer& operator=(const ShardedTurnServer&) = delete;
+
+  ~ShardedTurnServer();
+
+  // The address all shards listen on.
+  const rtc::SocketAddress& internal_address() const {
+    return internal_address_;
+  }
+  int num_shards() const { return static_cast<int>(shards_.size()); }
+
+  // Runs `fn` on the worker thread of every shard in turn, blocking until it
+  // has returned.
+  void ForEachShard(absl::FunctionRef<void(TurnServer&)> fn);
+
+  // Number of allocations over all shards.
+  size_t num_allocations();
+
+ private:
+  struct Shard;
+
+  ShardedTurnServer();
+
+  bool AddShard(const Config& config, absl::string_view nonce_key);
+
+  rtc::SocketAddress internal_address_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace cricket
+
+#endif  // P2P_BASE_SHARDED_TURN_SERVER_H_
@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/sharded_turn_server.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/test/rtc_error_matchers.h"
+#include "api/transport/stun.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/physical_socket_server.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/wait_until.h"
+
+namespace cricket {
+namespace {
+
+using ::testing::Eq;
+using ::testing::Ge;
+
+constexpr char kRealm[] = "realm";
+constexpr char kUsername[] = "user";
+
+// Accepts any user whose password equals the user name.
+class TestAuth : public TurnAuthInterface {
+ public:
+  bool GetKey(absl::string_view username,
+              absl::string_view realm,
+              std::string* key) override {
+    return ComputeStunCredentialHash(std::string(username), std::string(realm),
+                                     std::string(username), key);
+  }
+};
+
+// Requests an allocation, answering the server's authentication challenge.
+class AllocatingClient {
+ public:
+  AllocatingClient(rtc::SocketFactory* factory,
+                   const rtc::SocketAddress& server_address)
+      : server_address_(server_address),
+        socket_(rtc::AsyncUDPSocket::Create(
+            factory,
+            rtc::SocketAddress(server_address.ipaddr(), 0))) {
+    socket_->RegisterReceivedPacketCallback(
+        [this](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket& packet) {
+          OnPacket(packet);
+        });
+  }
+
+  void Allocate() { SendAllocateRequest(/*realm=*/"", /*nonce=*/""); }
+  bool allocated() const { return allocated_; }
+
+ private:
+  void SendAllocateRequest(absl::string_view realm, absl::string_view nonce) {
+    TurnMessage request(STUN_ALLOCATE_REQUEST,
+                        StunMessage::GenerateTransactionId());
+    request.AddAttribute(std::make_unique<StunUInt32Attribute>(
+        STUN_ATTR_REQUESTED_TRANSPORT, IPPROTO_UDP << 24));
+    if (!nonce.empty()) {
+      std::string key;
+      ComputeStunCredentialHash(kUsername, std::string(realm), kUsername,
+                                &key);
+      request.AddAttribute(std::make_unique<StunByteStringAttribute>(
+          STUN_ATTR_USERNAME, kUsername));
+      request.AddAttribute(
+          std::make_unique<StunByteStringAttribute>(STUN_ATTR_REALM, realm));
+      request.AddAttribute(
+          std::make_unique<StunByteStringAttribute>(STUN_ATTR_NONCE, nonce));
+      request.AddMessageIntegrity(key);
+    }
+    rtc::ByteBufferWriter buf;
+    request.Write(&buf);
+    socket_->SendTo(buf.Data(), buf.Length(), server_address_,
+                    rtc::PacketOptions());
+  }
+
+  void OnPacket(const rtc::ReceivedPacket& packet) {
+    TurnMessage response;
+    rtc::ByteBufferReader buf(packet.payload());
+    if (!response.Read(&buf)) {
+      return;
+    }
+    if (response.type() == STUN_ALLOCATE_RESPONSE) {
+      allocated_ = true;
+    } else if (response.type() == STUN_ALLOCATE_ERROR_RESPONSE &&
+               response.GetErrorCodeValue() == STUN_ERROR_UNAUTHORIZED) {
+      SendAllocateRequest(
+          response.GetByteString(STUN_ATTR_REALM)->string_view(),
+          response.GetByteString(STUN_ATTR_NONCE)->string_view());
+    }
+  }
+
+  const rtc::SocketAddress server_address_;
+  const std::unique_ptr<rtc::AsyncUDPSocket> socket_;
+  bool allocated_ = false;
+};
+
+class ShardedTurnServerTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<ShardedTurnServer> CreateServer(int num_shards) {
+    return ShardedTurnServer::Create(
+        {.num_shards = num_shards,
+         .internal_address = rtc::SocketAddress("127.0.0.1", 0),
+         .external_ip = rtc::IPAddress(INADDR_LOOPBACK),
+         .realm = kRealm,
+         .auth_hook = &auth_});
+  }
+
+  TestAuth auth_;
+  rtc::PhysicalSocketServer socket_server_;
+  rtc::AutoSocketServerThread main_thread_{&socket_server_};
+};
+
+TEST_F(ShardedTurnServerTest, ShardsShareOneAddress) {
+  std::unique_ptr<ShardedTurnServer> server = CreateServer(4);
+  ASSERT_TRUE(server);
+  EXPECT_EQ(server->num_shards(), 4);
+  EXPECT_NE(server->internal_address().port(), 0);
+  EXPECT_EQ(server->num_allocations(), 0u);
+}
+
+TEST_F(ShardedTurnServerTest, SpreadsAllocationsOverShards) {
+  constexpr int kNumClients = 32;
+  std::unique_ptr<ShardedTurnServer> server = CreateServer(4);
+  ASSERT_TRUE(server);
+
+  std::vector<std::unique_ptr<AllocatingClient>> clients;
+  for (int i = 0; i < kNumClients; ++i) {
+    clients.push_back(std::make_unique<AllocatingClient>(
+        &socket_server_, server->internal_address()));
+    clients.back()->Allocate();
+  }
+  EXPECT_THAT(webrtc::WaitUntil(
+                  [&] {
+                    int num_allocated = 0;
+                    for (const auto& client : clients) {
+                      num_allocated += client->allocated();
+                    }
+                    return num_allocated;
+                  },
+                  Eq(kNumClients)),
+              webrtc::IsRtcOk());
+  EXPECT_EQ(server->num_allocations(), static_cast<size_t>(kNumClients));
+
+  // The kernel picks the shard from a hash of the client address, so with
+  // this many clients more than one shard gets allocations.
+  int num_busy_shards = 0;
+  server->ForEachShard([&](TurnServer& shard) {
+    num_busy_shards += !shard.allocations().empty();
+  });
+  EXPECT_THAT(num_busy_shards, Ge(2));
+}
+
+TEST_F(ShardedTurnServerTest, FailsIfAddressIsInUse) {
+  std::unique_ptr<rtc::Socket> socket(
+      socket_server_.CreateSocket(AF_INET, SOCK_DGRAM));
+  ASSERT_EQ(socket->Bind(rtc::SocketAddress("127.0.0.1", 0)), 0);
+
+  EXPECT_FALSE(ShardedTurnServer::Create(
+      {.num_shards = 2, .internal_address = socket->GetLocalAddress()}));
+}
+
+}  // namespace
+}  // namespace cricket
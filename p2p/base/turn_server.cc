@@ -15,7 +15,6 @@
 #include <tuple>  // for std::tie
 #include <utility>
 
-#include "absl/algorithm/container.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
@@ -74,8 +73,12 @@ static void InitErrorResponse(int code,
 }
 
 TurnServer::TurnServer(webrtc::TaskQueueBase* thread)
+    : TurnServer(thread, rtc::CreateRandomString(kNonceKeySize)) {}
+
+TurnServer::TurnServer(webrtc::TaskQueueBase* thread,
+                       absl::string_view nonce_key)
     : thread_(thread),
-      nonce_key_(rtc::CreateRandomString(kNonceKeySize)),
+      nonce_key_(nonce_key),
       auth_hook_(NULL),
       redirect_hook_(NULL),
       enable_otu_nonce_(false) {}
@@ -568,7 +571,10 @@ TurnServerAllocation::TurnServerAllocation(TurnServer* server,
 }
 
 TurnServerAllocation::~TurnServerAllocation() {
+  channels_by_id_.clear();
+  channels_by_peer_.clear();
   channels_.clear();
+  perms_by_peer_.clear();
   perms_.clear();
   RTC_LOG(LS_INFO) << ToString() << ": Allocation destroyed";
 }
@@ -750,12 +756,14 @@ void TurnServerAllocation::HandleChannelBindRequest(const TurnMessage* msg) {
   if (channel1 == channels_.end()) {
     channel1 = channels_.insert(
         channels_.end(), {.id = channel_id, .peer = peer_attr->GetAddress()});
+    channels_by_id_[channel_id] = channel1;
+    channels_by_peer_[channel1->peer] = channel1;
   } else {
     channel1->pending_delete.reset();
   }
   thread_->PostDelayedTask(
       SafeTask(channel1->pending_delete.flag(),
-               [this, channel1] { channels_.erase(channel1); }),
+               [this, channel1] { EraseChannel(channel1); }),
       kChannelTimeout);
 
   // Channel binds also refresh permissions.
@@ -829,30 +837,42 @@ void TurnServerAllocation::AddPermission(const rtc::IPAddress& addr) {
   auto perm = FindPermission(addr);
   if (perm == perms_.end()) {
     perm = perms_.insert(perms_.end(), {.peer = addr});
+    perms_by_peer_[addr] = perm;
   } else {
     perm->pending_delete.reset();
   }
   thread_->PostDelayedTask(SafeTask(perm->pending_delete.flag(),
-                                    [this, perm] { perms_.erase(perm); }),
+                                    [this, perm] { ErasePermission(perm); }),
                            kPermissionTimeout);
 }
 
 TurnServerAllocation::PermissionList::iterator
 TurnServerAllocation::FindPermission(const rtc::IPAddress& addr) {
-  return absl::c_find_if(perms_,
-                         [&](const Permission& p) { return p.peer == addr; });
+  auto it = perms_by_peer_.find(addr);
+  return it != perms_by_peer_.end() ? it->second : perms_.end();
 }
 
 TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
     int channel_id) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.id == channel_id; });
+  auto it = channels_by_id_.find(static_cast<uint16_t>(channel_id));
+  return it != channels_by_id_.end() ? it->second : channels_.end();
 }
 
 TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
     const rtc::SocketAddress& addr) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.peer == addr; });
+  auto it = channels_by_peer_.find(addr);
+  return it != channels_by_peer_.end() ? it->second : channels_.end();
+}
+
+void TurnServerAllocation::ErasePermission(PermissionList::iterator perm) {
+  perms_by_peer_.erase(perm->peer);
+  perms_.erase(perm);
+}
+
+void TurnServerAllocation::EraseChannel(ChannelList::iterator channel) {
+  channels_by_id_.erase(channel->id);
+  channels_by_peer_.erase(channel->peer);
+  channels_.erase(channel);
 }
 
 void TurnServerAllocation::SendResponse(TurnMessage* msg) {
@@ -19,6 +19,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/strings/string_view.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
@@ -26,6 +28,7 @@
 #include "api/units/time_delta.h"
 #include "p2p/base/port_interface.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/ip_address.h"
 #include "rtc_base/network/received_packet.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/ssl_adapter.h"
@@ -61,6 +64,11 @@ class TurnServerConnection {
   bool operator<(const TurnServerConnection& t) const;
   std::string ToString() const;
 
+  template <typename H>
+  friend H AbslHashValue(H h, const TurnServerConnection& c) {
+    return H::combine(std::move(h), c.src_.Hash(), c.dst_.Hash(), c.proto_);
+  }
+
  private:
   rtc::SocketAddress src_;
   rtc::SocketAddress dst_;
@@ -108,6 +116,16 @@ class TurnServerAllocation final {
   };
   using PermissionList = std::list<Permission>;
   using ChannelList = std::list<Channel>;
+  struct IPAddressHash {
+    size_t operator()(const rtc::IPAddress& ip) const {
+      return absl::HashOf(rtc::HashIP(ip));
+    }
+  };
+  struct SocketAddressHash {
+    size_t operator()(const rtc::SocketAddress& addr) const {
+      return absl::HashOf(addr.Hash());
+    }
+  };
 
   void PostDeleteSelf(webrtc::TimeDelta delay);
 
@@ -126,6 +144,8 @@ class TurnServerAllocation final {
   PermissionList::iterator FindPermission(const rtc::IPAddress& addr);
   ChannelList::iterator FindChannel(int channel_id);
   ChannelList::iterator FindChannel(const rtc::SocketAddress& addr);
+  void ErasePermission(PermissionList::iterator perm);
+  void EraseChannel(ChannelList::iterator channel);
 
   void SendResponse(TurnMessage* msg);
   void SendBadRequestResponse(const TurnMessage* req);
@@ -146,6 +166,15 @@ class TurnServerAllocation final {
   std::string last_nonce_;
   PermissionList perms_;
   ChannelList channels_;
+  // Indexes into `perms_` and `channels_`, looked up for every relayed
+  // packet.
+  absl::flat_hash_map<rtc::IPAddress, PermissionList::iterator, IPAddressHash>
+      perms_by_peer_;
+  absl::flat_hash_map<uint16_t, ChannelList::iterator> channels_by_id_;
+  absl::flat_hash_map<rtc::SocketAddress,
+                      ChannelList::iterator,
+                      SocketAddressHash>
+      channels_by_peer_;
   webrtc::ScopedTaskSafety safety_;
 };
 
@@ -182,10 +211,13 @@ class StunMessageObserver {
 // Not yet wired up: TCP support.
 class TurnServer : public sigslot::has_slots<> {
  public:
-  typedef std::map<TurnServerConnection, std::unique_ptr<TurnServerAllocation>>
+  typedef absl::flat_hash_map<TurnServerConnection,
+                              std::unique_ptr<TurnServerAllocation>>
       AllocationMap;
 
   explicit TurnServer(webrtc::TaskQueueBase* thread);
+  // Servers that share `nonce_key` accept each other's nonces.
+  TurnServer(webrtc::TaskQueueBase* thread, absl::string_view nonce_key);
   ~TurnServer() override;
 
   // Gets/sets the realm value to use for the server.
@@ -12,6 +12,7 @@
 
 #include <memory>
 
+#include "absl/hash/hash.h"
 #include "p2p/base/basic_packet_socket_factory.h"
 #include "p2p/base/port_interface.h"
 #include "rtc_base/async_packet_socket.h"
@@ -34,6 +35,7 @@ class TurnServerConnectionTest : public ::testing::Test {
     EXPECT_TRUE(a == b);
     EXPECT_FALSE(a < b);
     EXPECT_FALSE(b < a);
+    EXPECT_EQ(absl::HashOf(a), absl::HashOf(b));
   }
 
   void ExpectNotEqual(const TurnServerConnection& a,
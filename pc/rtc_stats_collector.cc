@@ -13,6 +13,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -2056,21 +2057,6 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
   RTC_DCHECK_RUN_ON(signaling_thread_);
 
   transceiver_stats_infos_.clear();
-  // These are used to invoke GetStats for all the media channels together in
-  // one worker thread hop.
-  std::map<cricket::VoiceMediaSendChannelInterface*,
-           cricket::VoiceMediaSendInfo>
-      voice_send_stats;
-  std::map<cricket::VideoMediaSendChannelInterface*,
-           cricket::VideoMediaSendInfo>
-      video_send_stats;
-  std::map<cricket::VoiceMediaReceiveChannelInterface*,
-           cricket::VoiceMediaReceiveInfo>
-      voice_receive_stats;
-  std::map<cricket::VideoMediaReceiveChannelInterface*,
-           cricket::VideoMediaReceiveInfo>
-      video_receive_stats;
-
   auto transceivers = pc_->GetTransceiversInternal();
 
   // TODO(tommi): See if we can avoid synchronously blocking the signaling
@@ -2080,14 +2066,13 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
 
     for (const auto& transceiver_proxy : transceivers) {
       RtpTransceiver* transceiver = transceiver_proxy->internal();
-      cricket::MediaType media_type = transceiver->media_type();
 
       // Prepare stats entry. The TrackMediaInfoMap will be filled in after the
       // stats have been fetched on the worker thread.
       transceiver_stats_infos_.emplace_back();
       RtpTransceiverStatsInfo& stats = transceiver_stats_infos_.back();
       stats.transceiver = transceiver;
-      stats.media_type = media_type;
+      stats.media_type = transceiver->media_type();
 
       cricket::ChannelInterface* channel = transceiver->channel();
       if (!channel) {
@@ -2097,115 +2082,93 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
 
       stats.mid = channel->mid();
       stats.transport_name = std::string(channel->transport_name());
-
-      if (media_type == cricket::MEDIA_TYPE_AUDIO) {
-        auto voice_send_channel = channel->voice_media_send_channel();
-        RTC_DCHECK(voice_send_stats.find(voice_send_channel) ==
-                   voice_send_stats.end());
-        voice_send_stats.insert(
-            std::make_pair(voice_send_channel, cricket::VoiceMediaSendInfo()));
-
-        auto voice_receive_channel = channel->voice_media_receive_channel();
-        RTC_DCHECK(voice_receive_stats.find(voice_receive_channel) ==
-                   voice_receive_stats.end());
-        voice_receive_stats.insert(std::make_pair(
-            voice_receive_channel, cricket::VoiceMediaReceiveInfo()));
-      } else if (media_type == cricket::MEDIA_TYPE_VIDEO) {
-        auto video_send_channel = channel->video_media_send_channel();
-        RTC_DCHECK(video_send_stats.find(video_send_channel) ==
-                   video_send_stats.end());
-        video_send_stats.insert(
-            std::make_pair(video_send_channel, cricket::VideoMediaSendInfo()));
-        auto video_receive_channel = channel->video_media_receive_channel();
-        RTC_DCHECK(video_receive_stats.find(video_receive_channel) ==
-                   video_receive_stats.end());
-        video_receive_stats.insert(std::make_pair(
-            video_receive_channel, cricket::VideoMediaReceiveInfo()));
-      } else {
-        RTC_DCHECK_NOTREACHED();
-      }
     }
   });
 
   // We jump to the worker thread and call GetStats() on each media channel as
   // well as GetCallStats(). At the same time we construct the
-  // TrackMediaInfoMaps, which also needs info from the worker thread. This
-  // minimizes the number of thread jumps.
-  worker_thread_->BlockingCall([&] {
-    rtc::Thread::ScopedDisallowBlockingCalls no_blocking_calls;
+  // TrackMediaInfoMaps, which also needs info from the worker thread. The
+  // transceivers are handled in shards of `kMaxTransceiversPerWorkerHop`, one
+  // worker thread hop per shard, so that with thousands of transceivers the
+  // worker thread is only ever blocked for one shard at a time and tasks
+  // posted by the media engine run in between the hops.
+  bool has_audio_receiver = false;
+  size_t begin = 0;
+  do {
+    const size_t end = std::min(begin + kMaxTransceiversPerWorkerHop,
+                                transceiver_stats_infos_.size());
+    const bool last_hop = end == transceiver_stats_infos_.size();
+    worker_thread_->BlockingCall([&] {
+      rtc::Thread::ScopedDisallowBlockingCalls no_blocking_calls;
+
+      for (size_t i = begin; i < end; ++i) {
+        has_audio_receiver |=
+            InitializeTrackMediaInfoMap_w(transceiver_stats_infos_[i]);
+      }
+      if (last_hop) {
+        call_stats_ = pc_->GetCallStats();
+        audio_device_stats_ =
+            has_audio_receiver ? pc_->GetAudioDeviceStats() : std::nullopt;
+      }
+    });
+    begin = end;
+  } while (begin < transceiver_stats_infos_.size());
+
+  for (auto& stats : transceiver_stats_infos_) {
+    stats.current_direction = stats.transceiver->current_direction();
+  }
+}
+
+bool RTCStatsCollector::InitializeTrackMediaInfoMap_w(
+    RtpTransceiverStatsInfo& stats) {
+  RTC_DCHECK_RUN_ON(worker_thread_);
 
-    for (auto& pair : voice_send_stats) {
-      if (!pair.first->GetStats(&pair.second)) {
+  RtpTransceiver* transceiver = stats.transceiver.get();
+  std::optional<cricket::VoiceMediaInfo> voice_media_info;
+  std::optional<cricket::VideoMediaInfo> video_media_info;
+  cricket::ChannelInterface* channel = transceiver->channel();
+  if (channel) {
+    if (stats.media_type == cricket::MEDIA_TYPE_AUDIO) {
+      cricket::VoiceMediaSendInfo send_info;
+      if (!channel->voice_media_send_channel()->GetStats(&send_info)) {
         RTC_LOG(LS_WARNING) << "Failed to get voice send stats.";
       }
-    }
-    for (auto& pair : voice_receive_stats) {
-      if (!pair.first->GetStats(&pair.second,
-                                /*get_and_clear_legacy_stats=*/false)) {
+      cricket::VoiceMediaReceiveInfo receive_info;
+      if (!channel->voice_media_receive_channel()->GetStats(
+              &receive_info, /*get_and_clear_legacy_stats=*/false)) {
         RTC_LOG(LS_WARNING) << "Failed to get voice receive stats.";
       }
-    }
-    for (auto& pair : video_send_stats) {
-      if (!pair.first->GetStats(&pair.second)) {
+      voice_media_info = cricket::VoiceMediaInfo(std::move(send_info),
+                                                 std::move(receive_info));
+    } else if (stats.media_type == cricket::MEDIA_TYPE_VIDEO) {
+      cricket::VideoMediaSendInfo send_info;
+      if (!channel->video_media_send_channel()->GetStats(&send_info)) {
         RTC_LOG(LS_WARNING) << "Failed to get video send stats.";
       }
-    }
-    for (auto& pair : video_receive_stats) {
-      if (!pair.first->GetStats(&pair.second)) {
+      cricket::VideoMediaReceiveInfo receive_info;
+      if (!channel->video_media_receive_channel()->GetStats(&receive_info)) {
         RTC_LOG(LS_WARNING) << "Failed to get video receive stats.";
       }
+      video_media_info = cricket::VideoMediaInfo(std::move(send_info),
+                                                 std::move(receive_info));
+    } else {
+      RTC_DCHECK_NOTREACHED();
     }
-
-    // Create the TrackMediaInfoMap for each transceiver stats object
-    // and keep track of whether we have at least one audio receiver.
-    bool has_audio_receiver = false;
-    for (auto& stats : transceiver_stats_infos_) {
-      auto transceiver = stats.transceiver;
-      std::optional<cricket::VoiceMediaInfo> voice_media_info;
-      std::optional<cricket::VideoMediaInfo> video_media_info;
-      auto channel = transceiver->channel();
-      if (channel) {
-        cricket::MediaType media_type = transceiver->media_type();
-        if (media_type == cricket::MEDIA_TYPE_AUDIO) {
-          auto voice_send_channel = channel->voice_media_send_channel();
-          auto voice_receive_channel = channel->voice_media_receive_channel();
-          voice_media_info = cricket::VoiceMediaInfo(
-              std::move(voice_send_stats[voice_send_channel]),
-              std::move(voice_receive_stats[voice_receive_channel]));
-        } else if (media_type == cricket::MEDIA_TYPE_VIDEO) {
-          auto video_send_channel = channel->video_media_send_channel();
-          auto video_receive_channel = channel->video_media_receive_channel();
-          video_media_info = cricket::VideoMediaInfo(
-              std::move(video_send_stats[video_send_channel]),
-              std::move(video_receive_stats[video_receive_channel]));
-        }
-      }
-      std::vector<rtc::scoped_refptr<RtpSenderInternal>> senders;
-      for (const auto& sender : transceiver->senders()) {
-        senders.push_back(
-            rtc::scoped_refptr<RtpSenderInternal>(sender->internal()));
-      }
-      std::vector<rtc::scoped_refptr<RtpReceiverInternal>> receivers;
-      for (const auto& receiver : transceiver->receivers()) {
-        receivers.push_back(
-            rtc::scoped_refptr<RtpReceiverInternal>(receiver->internal()));
-      }
-      stats.track_media_info_map.Initialize(std::move(voice_media_info),
-                                            std::move(video_media_info),
-                                            senders, receivers);
-      if (transceiver->media_type() == cricket::MEDIA_TYPE_AUDIO) {
-        has_audio_receiver |= !receivers.empty();
-      }
-    }
-
-    call_stats_ = pc_->GetCallStats();
-    audio_device_stats_ =
-        has_audio_receiver ? pc_->GetAudioDeviceStats() : std::nullopt;
-  });
-
-  for (auto& stats : transceiver_stats_infos_) {
-    stats.current_direction = stats.transceiver->current_direction();
   }
+  std::vector<rtc::scoped_refptr<RtpSenderInternal>> senders;
+  for (const auto& sender : transceiver->senders()) {
+    senders.push_back(
+        rtc::scoped_refptr<RtpSenderInternal>(sender->internal()));
+  }
+  std::vector<rtc::scoped_refptr<RtpReceiverInternal>> receivers;
+  for (const auto& receiver : transceiver->receivers()) {
+    receivers.push_back(
+        rtc::scoped_refptr<RtpReceiverInternal>(receiver->internal()));
+  }
+  stats.track_media_info_map.Initialize(std::move(voice_media_info),
+                                        std::move(video_media_info), senders,
+                                        receivers);
+  return stats.media_type == cricket::MEDIA_TYPE_AUDIO && !receivers.empty();
 }
 
 void RTCStatsCollector::OnSctpDataChannelStateChanged(
@@ -11,6 +11,7 @@
 #ifndef PC_RTC_STATS_COLLECTOR_H_
 #define PC_RTC_STATS_COLLECTOR_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <cstdint>
@@ -58,6 +59,10 @@ class RtpReceiverInternal;
 // reports are cached for `cache_lifetime_` ms.
 class RTCStatsCollector : public RefCountInterface {
  public:
+  // The media stats of at most this many transceivers are fetched per worker
+  // thread hop, bounding how long a stats request blocks the worker thread.
+  static constexpr size_t kMaxTransceiversPerWorkerHop = 32;
+
   static rtc::scoped_refptr<RTCStatsCollector> Create(
       PeerConnectionInternal* pc,
       const Environment& env,
@@ -238,6 +243,10 @@ class RTCStatsCollector : public RefCountInterface {
           transport_stats_by_name);
   // The results are stored in `transceiver_stats_infos_` and `call_stats_`.
   void PrepareTransceiverStatsInfosAndCallStats_s_w_n();
+  // Fetches the media channel stats of `stats.transceiver` and initializes
+  // `stats.track_media_info_map`. Returns true if it is an audio transceiver
+  // with receivers.
+  bool InitializeTrackMediaInfoMap_w(RtpTransceiverStatsInfo& stats);
 
   // Stats gathering on a particular thread.
   void ProducePartialResultsOnSignalingThread(Timestamp timestamp);
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats_collector_callback.h"
+#include "api/stats/rtc_stats_report.h"
+#include "benchmark/benchmark.h"
+#include "media/base/media_channel.h"
+#include "pc/rtc_stats_collector.h"
+#include "pc/test/fake_peer_connection_for_stats.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/string_encode.h"
+#include "rtc_base/thread.h"
+
+namespace webrtc {
+namespace {
+
+class StatsCallback : public RTCStatsCollectorCallback {
+ public:
+  void OnStatsDelivered(
+      const rtc::scoped_refptr<const RTCStatsReport>& report) override {
+    report_ = report;
+  }
+
+  rtc::scoped_refptr<const RTCStatsReport> report() const { return report_; }
+
+ private:
+  rtc::scoped_refptr<const RTCStatsReport> report_;
+};
+
+cricket::VoiceMediaInfo VoiceMediaInfoWithSsrc(uint32_t ssrc) {
+  cricket::VoiceMediaInfo info;
+  info.senders.emplace_back();
+  info.senders[0].local_stats.emplace_back();
+  info.senders[0].local_stats[0].ssrc = ssrc;
+  info.receivers.emplace_back();
+  info.receivers[0].local_stats.emplace_back();
+  info.receivers[0].local_stats[0].ssrc = ssrc + 1;
+  return info;
+}
+
+cricket::VideoMediaInfo VideoMediaInfoWithSsrc(uint32_t ssrc) {
+  cricket::VideoMediaInfo info;
+  info.senders.emplace_back();
+  info.senders[0].local_stats.emplace_back();
+  info.senders[0].local_stats[0].ssrc = ssrc;
+  info.aggregated_senders.push_back(info.senders[0]);
+  info.receivers.emplace_back();
+  info.receivers[0].local_stats.emplace_back();
+  info.receivers[0].local_stats[0].ssrc = ssrc + 1;
+  return info;
+}
+
+// Measures the latency of a fresh getStats() with half audio and half video
+// transceivers, each with one sending and one receiving stream.
+void BM_GetStatsReport(benchmark::State& state) {
+  const int num_transceivers = state.range(0);
+  rtc::AutoThread main_thread;
+  auto pc = rtc::make_ref_counted<FakePeerConnectionForStats>();
+  for (int i = 0; i < num_transceivers; ++i) {
+    const std::string mid = rtc::ToString(i);
+    const uint32_t ssrc = 2 * i + 1;
+    if (i % 2 == 0) {
+      pc->AddVoiceChannel(mid, "Transport", VoiceMediaInfoWithSsrc(ssrc));
+    } else {
+      pc->AddVideoChannel(mid, "Transport", VideoMediaInfoWithSsrc(ssrc));
+    }
+  }
+  rtc::scoped_refptr<RTCStatsCollector> collector =
+      RTCStatsCollector::Create(pc.get(), CreateEnvironment());
+
+  size_t num_stats = 0;
+  for (auto s : state) {
+    auto callback = rtc::make_ref_counted<StatsCallback>();
+    collector->ClearCachedStatsReport();
+    collector->GetStatsReport(callback);
+    collector->WaitForPendingRequest();
+    RTC_CHECK(callback->report());
+    num_stats = callback->report()->size();
+  }
+  state.counters["stats"] = num_stats;
+  state.counters["worker_hops"] =
+      (num_transceivers + RTCStatsCollector::kMaxTransceiversPerWorkerHop -
+       1) /
+      RTCStatsCollector::kMaxTransceiversPerWorkerHop;
+}
+
+BENCHMARK(BM_GetStatsReport)
+    ->ArgName("transceivers")
+    ->Arg(50)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
@@ -2508,6 +2508,31 @@ TEST_F(RTCStatsCollectorTest, CollectRTCAudioPlayoutStats) {
             expected_stats);
 }
 
+TEST_F(RTCStatsCollectorTest, CollectsStatsOfTransceiversInAllWorkerHops) {
+  // Enough transceivers to need three worker thread hops.
+  const size_t kNumTransceivers =
+      2 * RTCStatsCollector::kMaxTransceiversPerWorkerHop + 1;
+  for (size_t i = 0; i < kNumTransceivers; ++i) {
+    cricket::VoiceMediaInfo voice_media_info;
+    voice_media_info.receivers.push_back(cricket::VoiceReceiverInfo());
+    voice_media_info.receivers[0].local_stats.push_back(
+        cricket::SsrcReceiverInfo());
+    voice_media_info.receivers[0].local_stats[0].ssrc = i + 1;
+    pc_->AddVoiceChannel("AudioMid" + rtc::ToString(i), "TransportName",
+                         voice_media_info);
+  }
+  // The audio receiver is on the first transceiver, the audio device stats
+  // are fetched in the last hop.
+  pc_->SetAudioDeviceStats(AudioDeviceModule::Stats());
+  stats_->SetupRemoteTrackAndReceiver(
+      cricket::MEDIA_TYPE_AUDIO, "RemoteAudioTrackID", "RemoteStreamId", 1);
+
+  rtc::scoped_refptr<const RTCStatsReport> report = stats_->GetStatsReport();
+  EXPECT_EQ(report->GetStatsOfType<RTCInboundRtpStreamStats>().size(),
+            kNumTransceivers);
+  EXPECT_EQ(report->GetStatsOfType<RTCAudioPlayoutStats>().size(), 1u);
+}
+
 TEST_F(RTCStatsCollectorTest, CollectGoogTimingFrameInfo) {
   cricket::VideoMediaInfo video_media_info;
 
@@ -202,7 +202,29 @@ bool SrtpSession::ProtectRtp(void* p, int in_len, int max_len, int* out_len) {
     RTC_LOG(LS_WARNING) << "Failed to protect SRTP packet: no SRTP Session";
     return false;
   }
+  return DoProtectRtp(p, in_len, max_len, out_len);
+}
+
+size_t SrtpSession::ProtectRtp(rtc::ArrayView<RtpPacketView> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (!session_) {
+    RTC_LOG(LS_WARNING) << "Failed to protect " << packets.size()
+                        << " SRTP packets: no SRTP Session";
+    for (RtpPacketView& packet : packets) {
+      packet.ok = false;
+    }
+    return 0;
+  }
+  size_t num_protected = 0;
+  for (RtpPacketView& packet : packets) {
+    packet.ok =
+        DoProtectRtp(packet.data, packet.len, packet.max_len, &packet.len);
+    num_protected += packet.ok;
+  }
+  return num_protected;
+}
 
+bool SrtpSession::DoProtectRtp(void* p, int in_len, int max_len, int* out_len) {
   // Note: the need_len differs from the libsrtp recommendatіon to ensure
   // SRTP_MAX_TRAILER_LEN bytes of free space after the data. WebRTC
   // never includes a MKI, therefore the amount of bytes added by the
@@ -278,7 +300,28 @@ bool SrtpSession::UnprotectRtp(void* p, int in_len, int* out_len) {
     RTC_LOG(LS_WARNING) << "Failed to unprotect SRTP packet: no SRTP Session";
     return false;
   }
+  return DoUnprotectRtp(p, in_len, out_len);
+}
+
+size_t SrtpSession::UnprotectRtp(rtc::ArrayView<RtpPacketView> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (!session_) {
+    RTC_LOG(LS_WARNING) << "Failed to unprotect " << packets.size()
+                        << " SRTP packets: no SRTP Session";
+    for (RtpPacketView& packet : packets) {
+      packet.ok = false;
+    }
+    return 0;
+  }
+  size_t num_unprotected = 0;
+  for (RtpPacketView& packet : packets) {
+    packet.ok = DoUnprotectRtp(packet.data, packet.len, &packet.len);
+    num_unprotected += packet.ok;
+  }
+  return num_unprotected;
+}
 
+bool SrtpSession::DoUnprotectRtp(void* p, int in_len, int* out_len) {
   *out_len = in_len;
   int err = srtp_unprotect(session_, p, out_len);
   if (err != srtp_err_status_ok) {
@@ -16,6 +16,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/field_trials_view.h"
 #include "api/scoped_refptr.h"
 #include "api/sequence_checker.h"
@@ -75,6 +76,22 @@ class SrtpSession {
   bool UnprotectRtp(void* data, int in_len, int* out_len);
   bool UnprotectRtcp(void* data, int in_len, int* out_len);
 
+  // An RTP packet that is protected or unprotected in-place as part of a
+  // batch. `len` is updated to the resulting packet length and `ok` tells
+  // whether the packet was processed successfully.
+  struct RtpPacketView {
+    void* data = nullptr;
+    int len = 0;
+    // Size of the buffer at `data`. Only used when protecting.
+    int max_len = 0;
+    bool ok = false;
+  };
+  // Encrypts/decrypts a batch of RTP packets, in order. Each packet gets the
+  // same treatment as by the single packet methods above, but the session is
+  // checked once per batch. Returns the number of successful packets.
+  size_t ProtectRtp(rtc::ArrayView<RtpPacketView> packets);
+  size_t UnprotectRtp(rtc::ArrayView<RtpPacketView> packets);
+
   // Helper method to get authentication params.
   bool GetRtpAuthParams(uint8_t** key, int* key_len, int* tag_len);
 
@@ -114,6 +131,8 @@ class SrtpSession {
                  int crypto_suite,
                  const rtc::ZeroOnFreeBuffer<uint8_t>& key,
                  const std::vector<int>& extension_ids);
+  bool DoProtectRtp(void* data, int in_len, int max_len, int* out_len);
+  bool DoUnprotectRtp(void* data, int in_len, int* out_len);
   // Returns send stream current packet index from srtp db.
   bool GetSendStreamPacketIndex(void* data, int in_len, int64_t* index);
 
@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "pc/srtp_session.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/ssl_stream_adapter.h"
+
+namespace cricket {
+namespace {
+
+constexpr int kPacketSize = 1200;
+// Room for the largest auth tag.
+constexpr int kBufferSize = kPacketSize + 16;
+constexpr int kBatchSize = 16;
+// Number of protected packets replayed by the unprotect benchmarks before the
+// receive session is recreated. Must be a multiple of `kBatchSize`.
+constexpr int kNumProtectedPackets = 1024;
+
+rtc::ZeroOnFreeBuffer<uint8_t> MakeKey(int crypto_suite) {
+  int key_len = 0;
+  int salt_len = 0;
+  RTC_CHECK(rtc::GetSrtpKeyAndSaltLengths(crypto_suite, &key_len, &salt_len));
+  rtc::ZeroOnFreeBuffer<uint8_t> key(key_len + salt_len);
+  for (size_t i = 0; i < key.size(); ++i) {
+    key[i] = static_cast<uint8_t>(i * 7 + 1);
+  }
+  return key;
+}
+
+// A plain RTP packet with a PCMU-like header and `seq_num`.
+void WriteRtpPacket(uint16_t seq_num, uint8_t* packet) {
+  memset(packet, 0xab, kPacketSize);
+  packet[0] = 0x80;
+  packet[1] = 0x00;
+  rtc::SetBE16(packet + 2, seq_num);
+  rtc::SetBE32(packet + 4, seq_num * 960u);
+  rtc::SetBE32(packet + 8, 0x12345678);
+}
+
+class Packets {
+ public:
+  explicit Packets(int num_packets)
+      : buffer_(num_packets * kBufferSize), views_(num_packets) {
+    for (int i = 0; i < num_packets; ++i) {
+      views_[i].data = data(i);
+      views_[i].max_len = kBufferSize;
+    }
+  }
+
+  uint8_t* data(int i) { return buffer_.data() + i * kBufferSize; }
+  SrtpSession::RtpPacketView& view(int i) { return views_[i]; }
+  rtc::ArrayView<SrtpSession::RtpPacketView> views() { return views_; }
+
+ private:
+  rtc::Buffer buffer_;
+  std::vector<SrtpSession::RtpPacketView> views_;
+};
+
+void SetCounters(benchmark::State& state) {
+  const double bytes = static_cast<double>(state.iterations()) * kBatchSize *
+                       kPacketSize;
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  // Rates are relative to CPU time, i.e. per core.
+  state.counters["Gbit/s"] =
+      benchmark::Counter(bytes * 8 / 1e9, benchmark::Counter::kIsRate);
+}
+
+void BM_SrtpProtect(benchmark::State& state) {
+  const int crypto_suite = state.range(0);
+  const bool batched = state.range(1);
+  SrtpSession session;
+  RTC_CHECK(session.SetSend(crypto_suite, MakeKey(crypto_suite), {}));
+  Packets packets(kBatchSize);
+  uint16_t seq_num = 0;
+  for (auto s : state) {
+    for (int i = 0; i < kBatchSize; ++i) {
+      WriteRtpPacket(seq_num++, packets.data(i));
+      packets.view(i).len = kPacketSize;
+    }
+    if (batched) {
+      RTC_CHECK_EQ(session.ProtectRtp(packets.views()), size_t{kBatchSize});
+    } else {
+      for (int i = 0; i < kBatchSize; ++i) {
+        SrtpSession::RtpPacketView& view = packets.view(i);
+        RTC_CHECK(
+            session.ProtectRtp(view.data, view.len, view.max_len, &view.len));
+      }
+    }
+    benchmark::DoNotOptimize(packets.data(0));
+  }
+  SetCounters(state);
+}
+
+void BM_SrtpUnprotect(benchmark::State& state) {
+  const int crypto_suite = state.range(0);
+  const bool batched = state.range(1);
+  const rtc::ZeroOnFreeBuffer<uint8_t> key = MakeKey(crypto_suite);
+
+  // libsrtp rejects replayed packets, so protect enough packets up front and
+  // start over with a fresh receive session once all have been unprotected.
+  Packets protected_packets(kNumProtectedPackets);
+  SrtpSession send_session;
+  RTC_CHECK(send_session.SetSend(crypto_suite, key, {}));
+  for (int i = 0; i < kNumProtectedPackets; ++i) {
+    WriteRtpPacket(i, protected_packets.data(i));
+    protected_packets.view(i).len = kPacketSize;
+  }
+  RTC_CHECK_EQ(send_session.ProtectRtp(protected_packets.views()),
+               size_t{kNumProtectedPackets});
+
+  std::unique_ptr<SrtpSession> session;
+  Packets packets(kBatchSize);
+  int next = kNumProtectedPackets;
+  for (auto s : state) {
+    if (next == kNumProtectedPackets) {
+      state.PauseTiming();
+      session = std::make_unique<SrtpSession>();
+      RTC_CHECK(session->SetReceive(crypto_suite, key, {}));
+      next = 0;
+      state.ResumeTiming();
+    }
+    for (int i = 0; i < kBatchSize; ++i, ++next) {
+      const SrtpSession::RtpPacketView& source = protected_packets.view(next);
+      memcpy(packets.data(i), source.data, source.len);
+      packets.view(i).len = source.len;
+    }
+    if (batched) {
+      RTC_CHECK_EQ(session->UnprotectRtp(packets.views()), size_t{kBatchSize});
+    } else {
+      for (int i = 0; i < kBatchSize; ++i) {
+        SrtpSession::RtpPacketView& view = packets.view(i);
+        RTC_CHECK(session->UnprotectRtp(view.data, view.len, &view.len));
+      }
+    }
+    benchmark::DoNotOptimize(packets.data(0));
+  }
+  SetCounters(state);
+}
+
+// Arguments are the crypto suite and whether the batch API is used.
+void SrtpArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"suite", "batched"});
+  for (int suite : {rtc::kSrtpAes128CmSha1_80, rtc::kSrtpAeadAes128Gcm,
+                    rtc::kSrtpAeadAes256Gcm}) {
+    b->Args({suite, 0});
+    b->Args({suite, 1});
+  }
+}
+
+BENCHMARK(BM_SrtpProtect)->Apply(SrtpArguments);
+BENCHMARK(BM_SrtpUnprotect)->Apply(SrtpArguments);
+
+}  // namespace
+}  // namespace cricket
@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 
 #include "media/base/fake_rtp.h"
 #include "pc/test/srtp_test_util.h"
@@ -286,6 +287,47 @@ TEST_F(SrtpSessionTest, RemoveSsrc) {
   EXPECT_TRUE(s2_.RemoveSsrcFromSession(1));
 }
 
+// Test that a batch of packets is protected and unprotected in-place and that
+// a failing packet does not affect the rest of the batch.
+TEST_F(SrtpSessionTest, ProtectAndUnprotectRtpBatch) {
+  constexpr int kNumPackets = 4;
+  EXPECT_TRUE(s1_.SetSend(kSrtpAes128CmSha1_80, kTestKey1,
+                          kEncryptedHeaderExtensionIds));
+  EXPECT_TRUE(s2_.SetReceive(kSrtpAes128CmSha1_80, kTestKey1,
+                             kEncryptedHeaderExtensionIds));
+  char packets[kNumPackets][sizeof(rtp_packet_)];
+  std::vector<cricket::SrtpSession::RtpPacketView> views(kNumPackets);
+  for (int i = 0; i < kNumPackets; ++i) {
+    memcpy(packets[i], kPcmuFrame, rtp_len_);
+    SetBE16(reinterpret_cast<uint8_t*>(packets[i]) + 2, i + 1);
+    views[i] = {.data = packets[i],
+                .len = rtp_len_,
+                .max_len = static_cast<int>(sizeof(packets[i]))};
+  }
+  // Leave no room for the auth tag of the last packet.
+  views.back().max_len = rtp_len_;
+
+  EXPECT_EQ(s1_.ProtectRtp(views), kNumPackets - 1u);
+  EXPECT_FALSE(views.back().ok);
+  views.pop_back();
+  for (const cricket::SrtpSession::RtpPacketView& view : views) {
+    EXPECT_TRUE(view.ok);
+    EXPECT_EQ(view.len, rtp_len_ + rtp_auth_tag_len(kSrtpAes128CmSha1_80));
+  }
+
+  // Tamper with the payload of the second packet.
+  packets[1][rtp_len_ - 1] ^= 0xff;
+  EXPECT_EQ(s2_.UnprotectRtp(views), kNumPackets - 2u);
+  EXPECT_FALSE(views[1].ok);
+  for (int i : {0, 2}) {
+    EXPECT_TRUE(views[i].ok);
+    EXPECT_EQ(views[i].len, rtp_len_);
+    // Everything but the sequence number matches the original packet.
+    EXPECT_EQ(0, memcmp(packets[i], kPcmuFrame, 2));
+    EXPECT_EQ(0, memcmp(packets[i] + 4, kPcmuFrame + 4, rtp_len_ - 4));
+  }
+}
+
 TEST_F(SrtpSessionTest, ProtectUnprotectWrapAroundRocMismatch) {
   // This unit tests demonstrates why you should be careful when
   // choosing the initial RTP sequence number as there can be decryption
@@ -17,6 +17,8 @@
 #include <vector>
 
 #include "absl/strings/match.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/task_queue/task_queue_base.h"
 #include "media/base/rtp_utils.h"
 #include "modules/rtp_rtcp/source/rtp_util.h"
 #include "pc/rtp_transport.h"
@@ -45,6 +47,26 @@ bool SrtpTransport::SendRtpPacket(rtc::CopyOnWriteBuffer* packet,
         << "Failed to send the packet because SRTP transport is inactive.";
     return false;
   }
+  if (options.batchable && !IsExternalAuthActive()) {
+    pending_rtp_packets_.push_back({std::move(*packet), options, flags});
+    if (options.last_packet_in_batch ||
+        pending_rtp_packets_.size() >= kMaxRtpBatchSize) {
+      return SendPendingRtpPackets();
+    }
+    if (pending_rtp_packets_.size() == 1) {
+      // Make sure the batch is sent even if the packet ending it never comes.
+      TaskQueueBase* current = TaskQueueBase::Current();
+      if (!current) {
+        return SendPendingRtpPackets();
+      }
+      current->PostTask(
+          SafeTask(task_safety_.flag(), [this] { SendPendingRtpPackets(); }));
+    }
+    return true;
+  }
+  // Keep packets in order.
+  SendPendingRtpPackets();
+
   rtc::PacketOptions updated_options = options;
   TRACE_EVENT0("webrtc", "SRTP Encode");
   bool res;
@@ -93,6 +115,55 @@ bool SrtpTransport::SendRtpPacket(rtc::CopyOnWriteBuffer* packet,
   return SendPacket(/*rtcp=*/false, packet, updated_options, flags);
 }
 
+bool SrtpTransport::SendPendingRtpPackets() {
+  if (pending_rtp_packets_.empty()) {
+    return true;
+  }
+  // Sending may re-enter this transport, so work on a batch of our own.
+  std::vector<PendingRtpPacket> packets;
+  packets.swap(pending_rtp_packets_);
+  std::vector<cricket::SrtpSession::RtpPacketView> views;
+  views.swap(rtp_packet_views_);
+  // The batch ends here even if the packet marked as its end did not come, so
+  // that the socket below does not hold the packets back again.
+  packets.back().options.last_packet_in_batch = true;
+
+  TRACE_EVENT1("webrtc", "SRTP Encode", "packets", packets.size());
+  RTC_DCHECK(IsSrtpActive());
+  views.clear();
+  for (PendingRtpPacket& pending : packets) {
+    views.push_back(
+        {.data = pending.packet.MutableData(),
+         .len = rtc::checked_cast<int>(pending.packet.size()),
+         .max_len = rtc::checked_cast<int>(pending.packet.capacity())});
+  }
+  send_session_->ProtectRtp(views);
+
+  bool sent = false;
+  for (size_t i = 0; i < packets.size(); ++i) {
+    rtc::CopyOnWriteBuffer& packet = packets[i].packet;
+    if (!views[i].ok) {
+      RTC_LOG(LS_ERROR) << "Failed to protect RTP packet: size="
+                        << packet.size()
+                        << ", seqnum=" << ParseRtpSequenceNumber(packet)
+                        << ", SSRC=" << ParseRtpSsrc(packet);
+      sent = false;
+      continue;
+    }
+    packet.SetSize(views[i].len);
+    sent = SendPacket(/*rtcp=*/false, &packet, packets[i].options,
+                      packets[i].flags);
+  }
+
+  // Keep the allocations for the next batch.
+  packets.clear();
+  if (pending_rtp_packets_.empty()) {
+    packets.swap(pending_rtp_packets_);
+  }
+  views.swap(rtp_packet_views_);
+  return sent;
+}
+
 bool SrtpTransport::SendRtcpPacket(rtc::CopyOnWriteBuffer* packet,
                                    const rtc::PacketOptions& options,
                                    int flags) {
@@ -101,6 +172,8 @@ bool SrtpTransport::SendRtcpPacket(rtc::CopyOnWriteBuffer* packet,
         << "Failed to send the packet because SRTP transport is inactive.";
     return false;
   }
+  // Keep packets in order.
+  SendPendingRtpPackets();
 
   TRACE_EVENT0("webrtc", "SRTP Encode");
   uint8_t* data = packet->MutableData();
@@ -126,27 +199,74 @@ void SrtpTransport::OnRtpPacketReceived(const rtc::ReceivedPacket& packet) {
     return;
   }
 
-  rtc::CopyOnWriteBuffer payload(packet.payload());
-  char* data = payload.MutableData<char>();
-  int len = rtc::checked_cast<int>(payload.size());
-  if (!UnprotectRtp(data, len, &len)) {
-    // Limit the error logging to avoid excessive logs when there are lots of
-    // bad packets.
-    const int kFailureLogThrottleCount = 100;
-    if (decryption_failure_count_ % kFailureLogThrottleCount == 0) {
-      RTC_LOG(LS_ERROR) << "Failed to unprotect RTP packet: size=" << len
-                        << ", seqnum=" << ParseRtpSequenceNumber(payload)
-                        << ", SSRC=" << ParseRtpSsrc(payload)
-                        << ", previous failure count: "
-                        << decryption_failure_count_;
+  received_rtp_packets_.push_back(
+      {rtc::CopyOnWriteBuffer(packet.payload()),
+       packet.arrival_time().value_or(Timestamp::MinusInfinity()),
+       packet.ecn()});
+  if (packet.more_packets_follow() &&
+      received_rtp_packets_.size() < kMaxRtpBatchSize) {
+    if (received_rtp_packets_.size() == 1) {
+      // Make sure the packets are delivered even if the rest of the socket
+      // read does not reach this transport.
+      TaskQueueBase* current = TaskQueueBase::Current();
+      if (!current) {
+        DemuxPendingRtpPackets();
+        return;
+      }
+      current->PostTask(
+          SafeTask(task_safety_.flag(), [this] { DemuxPendingRtpPackets(); }));
     }
-    ++decryption_failure_count_;
     return;
   }
-  payload.SetSize(len);
-  DemuxPacket(std::move(payload),
-              packet.arrival_time().value_or(Timestamp::MinusInfinity()),
-              packet.ecn());
+  DemuxPendingRtpPackets();
+}
+
+void SrtpTransport::DemuxPendingRtpPackets() {
+  if (received_rtp_packets_.empty()) {
+    return;
+  }
+  // Demuxing may re-enter this transport, so work on a batch of our own.
+  std::vector<ReceivedRtpPacket> packets;
+  packets.swap(received_rtp_packets_);
+  std::vector<cricket::SrtpSession::RtpPacketView> views;
+  views.swap(rtp_packet_views_);
+
+  TRACE_EVENT1("webrtc", "SRTP Decode", "packets", packets.size());
+  RTC_DCHECK(IsSrtpActive());
+  views.clear();
+  for (ReceivedRtpPacket& received : packets) {
+    views.push_back({.data = received.packet.MutableData(),
+                     .len = rtc::checked_cast<int>(received.packet.size())});
+  }
+  recv_session_->UnprotectRtp(views);
+
+  for (size_t i = 0; i < packets.size(); ++i) {
+    rtc::CopyOnWriteBuffer& payload = packets[i].packet;
+    if (!views[i].ok) {
+      // Limit the error logging to avoid excessive logs when there are lots
+      // of bad packets.
+      const int kFailureLogThrottleCount = 100;
+      if (decryption_failure_count_ % kFailureLogThrottleCount == 0) {
+        RTC_LOG(LS_ERROR) << "Failed to unprotect RTP packet: size="
+                          << payload.size()
+                          << ", seqnum=" << ParseRtpSequenceNumber(payload)
+                          << ", SSRC=" << ParseRtpSsrc(payload)
+                          << ", previous failure count: "
+                          << decryption_failure_count_;
+      }
+      ++decryption_failure_count_;
+      continue;
+    }
+    payload.SetSize(views[i].len);
+    DemuxPacket(std::move(payload), packets[i].arrival_time, packets[i].ecn);
+  }
+
+  // Keep the allocations for the next batch.
+  packets.clear();
+  if (received_rtp_packets_.empty()) {
+    packets.swap(received_rtp_packets_);
+  }
+  views.swap(rtp_packet_views_);
 }
 
 void SrtpTransport::OnRtcpPacketReceived(const rtc::ReceivedPacket& packet) {
@@ -156,6 +276,9 @@ void SrtpTransport::OnRtcpPacketReceived(const rtc::ReceivedPacket& packet) {
         << "Inactive SRTP transport received an RTCP packet. Drop it.";
     return;
   }
+  // Keep packets in order.
+  DemuxPendingRtpPackets();
+
   rtc::CopyOnWriteBuffer payload(packet.payload());
   char* data = payload.MutableData<char>();
   int len = rtc::checked_cast<int>(payload.size());
@@ -195,6 +318,10 @@ bool SrtpTransport::SetRtpParams(int send_crypto_suite,
                                  int recv_crypto_suite,
                                  const rtc::ZeroOnFreeBuffer<uint8_t>& recv_key,
                                  const std::vector<int>& recv_extension_ids) {
+  // Packets held back are processed with the parameters they came with.
+  SendPendingRtpPackets();
+  DemuxPendingRtpPackets();
+
   // If parameters are being set for the first time, we should create new SRTP
   // sessions and call "SetSend/SetReceive". Otherwise we should call
   // "UpdateSend"/"UpdateReceive" on the existing sessions, which will
@@ -275,6 +402,8 @@ bool SrtpTransport::IsWritable(bool rtcp) const {
 }
 
 void SrtpTransport::ResetParams() {
+  SendPendingRtpPackets();
+  DemuxPendingRtpPackets();
   send_session_ = nullptr;
   recv_session_ = nullptr;
   send_rtcp_session_ = nullptr;
@@ -404,6 +533,8 @@ void SrtpTransport::MaybeUpdateWritableState() {
 }
 
 bool SrtpTransport::UnregisterRtpDemuxerSink(RtpPacketSinkInterface* sink) {
+  // Deliver packets held back while the sink can still take them.
+  DemuxPendingRtpPackets();
   if (recv_session_ &&
       field_trials_.IsEnabled("WebRTC-SrtpRemoveReceiveStream")) {
     // Remove the SSRCs explicitly registered with the demuxer
@@ -21,12 +21,16 @@
 
 #include "api/field_trials_view.h"
 #include "api/rtc_error.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/transport/ecn_marking.h"
+#include "api/units/timestamp.h"
 #include "p2p/base/packet_transport_internal.h"
 #include "pc/rtp_transport.h"
 #include "pc/srtp_session.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/network/received_packet.h"
 #include "rtc_base/network_route.h"
 
 namespace webrtc {
@@ -34,6 +38,16 @@ namespace webrtc {
 // This subclass of the RtpTransport is used for SRTP which is reponsible for
 // protecting/unprotecting the packets. It provides interfaces to set the crypto
 // parameters for the SrtpSession underneath.
+//
+// RTP packets sent with PacketOptions::batchable, as the pacer does for the
+// packets of a burst, are held back until the packet marked
+// last_packet_in_batch is sent, and are then protected with one call to the
+// SrtpSession. They keep their options, so that the UDP socket can send the
+// burst in one call. Likewise, received RTP packets marked with
+// ReceivedPacket::more_packets_follow() are held back and unprotected together
+// with the rest of the socket read. A batch that is not completed is processed
+// from a task posted to the current task queue. Packets still held back when
+// the transport is destroyed are dropped.
 class SrtpTransport : public RtpTransport {
  public:
   SrtpTransport(bool rtcp_mux_enabled, const FieldTrialsView& field_trials);
@@ -137,6 +151,26 @@ class SrtpTransport : public RtpTransport {
 
   bool UnprotectRtcp(void* data, int in_len, int* out_len);
 
+  // Protects and sends the batchable RTP packets held back so far. Failures
+  // are logged. Returns whether the last of the packets was sent.
+  bool SendPendingRtpPackets();
+  // Unprotects the received RTP packets held back so far and demuxes them.
+  void DemuxPendingRtpPackets();
+
+  // Maximum number of RTP packets held back in each direction.
+  static constexpr size_t kMaxRtpBatchSize = 64;
+
+  struct PendingRtpPacket {
+    rtc::CopyOnWriteBuffer packet;
+    rtc::PacketOptions options;
+    int flags = 0;
+  };
+  struct ReceivedRtpPacket {
+    rtc::CopyOnWriteBuffer packet;
+    Timestamp arrival_time;
+    EcnMarking ecn;
+  };
+
   const std::string content_name_;
 
   std::unique_ptr<cricket::SrtpSession> send_session_;
@@ -157,7 +191,15 @@ class SrtpTransport : public RtpTransport {
 
   int decryption_failure_count_ = 0;
 
+  std::vector<PendingRtpPacket> pending_rtp_packets_;
+  std::vector<ReceivedRtpPacket> received_rtp_packets_;
+  // Views of the packets of the batch being processed, kept to reuse their
+  // allocation.
+  std::vector<cricket::SrtpSession::RtpPacketView> rtp_packet_views_;
+
   const FieldTrialsView& field_trials_;
+
+  ScopedTaskSafety task_safety_;
 };
 
 }  // namespace webrtc
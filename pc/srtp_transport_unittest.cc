@@ -16,6 +16,7 @@
 #include <memory>
 #include <vector>
 
+#include "api/units/timestamp.h"
 #include "call/rtp_demuxer.h"
 #include "media/base/fake_rtp.h"
 #include "p2p/base/fake_packet_transport.h"
@@ -28,8 +29,11 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/containers/flat_set.h"
 #include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket_address.h"
 #include "rtc_base/ssl_stream_adapter.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
+#include "rtc_base/thread.h"
 #include "test/gtest.h"
 #include "test/scoped_key_value_config.h"
 
@@ -482,4 +486,99 @@ TEST_F(SrtpTransportTest, RemoveSrtpReceiveStream) {
   srtp_transport->UnregisterRtpDemuxerSink(&rtp_sink);
 }
 
+class SrtpTransportBatchTest : public SrtpTransportTest {
+ protected:
+  ~SrtpTransportBatchTest() override {
+    // Forget `unconnected_transport_` before it is destroyed.
+    rtp_packet_transport1_->SetDestination(nullptr, /*asymmetric=*/true);
+  }
+
+  void SetUp() override {
+    std::vector<int> extension_ids;
+    EXPECT_TRUE(srtp_transport1_->SetRtpParams(
+        rtc::kSrtpAeadAes128Gcm, kTestKeyGcm128_1, extension_ids,
+        rtc::kSrtpAeadAes128Gcm, kTestKeyGcm128_2, extension_ids));
+    EXPECT_TRUE(srtp_transport2_->SetRtpParams(
+        rtc::kSrtpAeadAes128Gcm, kTestKeyGcm128_2, extension_ids,
+        rtc::kSrtpAeadAes128Gcm, kTestKeyGcm128_1, extension_ids));
+  }
+
+  bool SendRtpPacket(bool batchable, bool last_packet_in_batch) {
+    size_t rtp_len = sizeof(kPcmuFrame);
+    rtc::CopyOnWriteBuffer packet(
+        kPcmuFrame, rtp_len,
+        rtp_len + rtc::rtp_auth_tag_len(rtc::kSrtpAeadAes128Gcm));
+    rtc::SetBE16(packet.MutableData() + 2, ++sequence_number_);
+    rtc::PacketOptions options;
+    options.batchable = batchable;
+    options.last_packet_in_batch = last_packet_in_batch;
+    return srtp_transport1_->SendRtpPacket(&packet, options,
+                                           cricket::PF_SRTP_BYPASS);
+  }
+
+  // Protects a packet with `srtp_transport1_` and delivers it to
+  // `srtp_transport2_` as part of a socket read.
+  void ReceiveRtpPacket(bool more_packets_follow) {
+    rtp_packet_transport1_->SetDestination(&unconnected_transport_,
+                                           /*asymmetric=*/true);
+    ASSERT_TRUE(SendRtpPacket(/*batchable=*/false, /*last=*/false));
+    rtc::CopyOnWriteBuffer protected_packet =
+        *rtp_packet_transport1_->last_sent_packet();
+    rtc::ReceivedPacket packet(protected_packet, rtc::SocketAddress(),
+                               Timestamp::Millis(1));
+    packet.set_more_packets_follow(more_packets_follow);
+    rtp_packet_transport2_->NotifyPacketReceived(packet);
+  }
+
+  rtc::AutoThread main_thread_;
+  rtc::FakePacketTransport unconnected_transport_{"unconnected_transport"};
+};
+
+TEST_F(SrtpTransportBatchTest, SendsBatchWhenLastPacketIsSent) {
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/false));
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/false));
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 0);
+
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/true));
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 3);
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().SequenceNumber(),
+            sequence_number_);
+}
+
+TEST_F(SrtpTransportBatchTest, SendsUnfinishedBatchFromPostedTask) {
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/false));
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 0);
+
+  main_thread_.ProcessMessages(0);
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 1);
+}
+
+TEST_F(SrtpTransportBatchTest, SendsBatchBeforeUnbatchedPacket) {
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/false));
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/true, /*last=*/false));
+  EXPECT_TRUE(SendRtpPacket(/*batchable=*/false, /*last=*/false));
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 3);
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().SequenceNumber(),
+            sequence_number_);
+}
+
+TEST_F(SrtpTransportBatchTest, DemuxesReceivedPacketsAfterLastOfRead) {
+  ReceiveRtpPacket(/*more_packets_follow=*/true);
+  ReceiveRtpPacket(/*more_packets_follow=*/true);
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 0);
+
+  ReceiveRtpPacket(/*more_packets_follow=*/false);
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 3);
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().SequenceNumber(),
+            sequence_number_);
+}
+
+TEST_F(SrtpTransportBatchTest, DemuxesUnfinishedReadFromPostedTask) {
+  ReceiveRtpPacket(/*more_packets_follow=*/true);
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 0);
+
+  main_thread_.ProcessMessages(0);
+  EXPECT_EQ(rtp_sink2_.rtp_count(), 1);
+}
+
 }  // namespace webrtc
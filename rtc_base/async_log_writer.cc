@@ -0,0 +1,37 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/async_log_writer.h"
+
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace rtc {
+
+AsyncLogWriter::AsyncLogWriter(webrtc::TimeDelta drain_interval,
+                               size_t lines_per_thread) {
+  RTC_DCHECK(!LogMessage::IsAsyncLogging());
+  LogMessage::SetAsyncLogging(true, lines_per_thread);
+  thread_ = PlatformThread::SpawnJoinable(
+      [this, drain_interval] {
+        while (!stop_.Wait(drain_interval, /*warn_after=*/Event::kForever)) {
+          LogMessage::DrainAsyncLogs();
+        }
+      },
+      "AsyncLogWriter", ThreadAttributes().SetPriority(ThreadPriority::kLow));
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  stop_.Set();
+  thread_.Finalize();
+  LogMessage::SetAsyncLogging(false);
+}
+
+}  // namespace rtc
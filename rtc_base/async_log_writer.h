@@ -0,0 +1,45 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_ASYNC_LOG_WRITER_H_
+#define RTC_BASE_ASYNC_LOG_WRITER_H_
+
+#include <stddef.h>
+
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+
+namespace rtc {
+
+// Enables async logging (see LogMessage::SetAsyncLogging) for its lifetime
+// and runs a background thread that delivers the buffered log lines to the
+// log streams every `drain_interval`. The rings of the logging threads must
+// be large enough to hold the lines logged during one interval. On
+// destruction async logging is disabled and the pending lines are delivered.
+// Only one AsyncLogWriter may exist at a time.
+class AsyncLogWriter {
+ public:
+  explicit AsyncLogWriter(
+      webrtc::TimeDelta drain_interval = webrtc::TimeDelta::Millis(10),
+      size_t lines_per_thread = 1024);
+  ~AsyncLogWriter();
+
+  AsyncLogWriter(const AsyncLogWriter&) = delete;
+  AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+ private:
+  Event stop_;
+  PlatformThread thread_;
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_ASYNC_LOG_WRITER_H_
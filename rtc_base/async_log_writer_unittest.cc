@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/async_log_writer.h"
+
+#include <string>
+
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "rtc_base/logging.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace {
+
+using ::webrtc::TimeDelta;
+
+// Signals `logged()` once a line containing `text` has been delivered.
+class WaitingLogSink : public LogSink {
+ public:
+  explicit WaitingLogSink(absl::string_view text) : text_(text) {}
+
+  void OnLogMessage(const std::string& message) override {
+    if (absl::StrContains(message, text_)) {
+      logged_.Set();
+    }
+  }
+  void OnLogMessage(const LogLineRef& line) override {
+    OnLogMessage(std::string(line.message()));
+  }
+
+  Event& logged() { return logged_; }
+
+ private:
+  const std::string text_;
+  Event logged_;
+};
+
+TEST(AsyncLogWriterTest, DeliversLinesInTheBackground) {
+  WaitingLogSink sink("in the background");
+  LogMessage::AddLogToStream(&sink, LS_INFO);
+  {
+    AsyncLogWriter writer(TimeDelta::Millis(1));
+    EXPECT_TRUE(LogMessage::IsAsyncLogging());
+    RTC_LOG(LS_INFO) << "in the background";
+    EXPECT_TRUE(sink.logged().Wait(TimeDelta::Seconds(5)));
+  }
+  EXPECT_FALSE(LogMessage::IsAsyncLogging());
+  LogMessage::RemoveLogToStream(&sink);
+}
+
+TEST(AsyncLogWriterTest, DeliversPendingLinesWhenDestroyed) {
+  WaitingLogSink sink("pending");
+  LogMessage::AddLogToStream(&sink, LS_INFO);
+  {
+    AsyncLogWriter writer(TimeDelta::Seconds(1000));
+    RTC_LOG(LS_INFO) << "pending";
+  }
+  EXPECT_TRUE(sink.logged().Wait(TimeDelta::Zero()));
+  LogMessage::RemoveLogToStream(&sink);
+}
+
+}  // namespace
+}  // namespace rtc
@@ -68,9 +68,8 @@ struct RTC_EXPORT PacketOptions {
   PacketTimeUpdateParams packet_time_params;
   // PacketInfo is passed to SentPacket when signaling this packet is sent.
   PacketInfo info_signaled_after_sent;
-  // True if this is a batchable packet. Batchable packets are collected at low
-  // levels and sent first when their AsyncPacketSocket receives a
-  // OnSendBatchComplete call.
+  // True if this is a batchable packet. Batchable packets may be collected at
+  // low levels and sent together once the last packet of the batch is sent.
   bool batchable = false;
   // True if this is the last packet of a batch.
   bool last_packet_in_batch = false;
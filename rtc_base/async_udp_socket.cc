@@ -10,11 +10,15 @@
 
 #include "rtc_base/async_udp_socket.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <optional>
 
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "rtc_base/async_packet_socket.h"
@@ -49,6 +53,7 @@ AsyncUDPSocket* AsyncUDPSocket::Create(SocketFactory* factory,
 
 AsyncUDPSocket::AsyncUDPSocket(Socket* socket) : socket_(socket) {
   sequence_checker_.Detach();
+  send_sequence_checker_.Detach();
   // The socket should start out readable but not writable.
   socket_->SignalReadEvent.connect(this, &AsyncUDPSocket::OnReadEvent);
   socket_->SignalWriteEvent.connect(this, &AsyncUDPSocket::OnWriteEvent);
@@ -65,9 +70,16 @@ SocketAddress AsyncUDPSocket::GetRemoteAddress() const {
 int AsyncUDPSocket::Send(const void* pv,
                          size_t cb,
                          const rtc::PacketOptions& options) {
+  RTC_DCHECK_RUN_ON(&send_sequence_checker_);
+  if (num_pending_packets_ > 0 && !write_blocked_) {
+    SendPendingBatch();
+  }
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, &sent_packet.info);
+  if (write_blocked_) {
+    return RejectWhileWriteBlocked(sent_packet);
+  }
   int ret = socket_->Send(pv, cb);
   SignalSentPacket(this, sent_packet);
   return ret;
@@ -77,6 +89,59 @@ int AsyncUDPSocket::SendTo(const void* pv,
                            size_t cb,
                            const SocketAddress& addr,
                            const rtc::PacketOptions& options) {
+  RTC_DCHECK_RUN_ON(&send_sequence_checker_);
+  if (num_pending_packets_ > 0 && !write_blocked_ &&
+      (!options.batchable || addr != pending_destination_ ||
+       options.ecn_1 != pending_ecn_1_)) {
+    // Keep packets in order.
+    SendPendingBatch();
+  }
+  if (write_blocked_) {
+    rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
+                                options.info_signaled_after_sent);
+    CopySocketInformationToPacketInfo(cb, *this, &sent_packet.info);
+    return RejectWhileWriteBlocked(sent_packet);
+  }
+  if (options.batchable) {
+    AddToPendingBatch(pv, cb, addr, options);
+    bool send_now = options.last_packet_in_batch ||
+                    num_pending_packets_ >= kMaxPendingBatchSize;
+    if (!send_now && num_pending_packets_ == 1) {
+      // Make sure the batch is sent even if the packet ending it never makes
+      // it to this socket.
+      if (webrtc::TaskQueueBase* current = webrtc::TaskQueueBase::Current()) {
+        current->PostTask(webrtc::SafeTask(task_safety_.flag(), [this] {
+          RTC_DCHECK_RUN_ON(&send_sequence_checker_);
+          if (num_pending_packets_ > 0 && !write_blocked_) {
+            SendPendingBatch();
+          }
+        }));
+      } else {
+        send_now = true;
+      }
+    }
+    if (!send_now) {
+      return static_cast<int>(cb);
+    }
+    int error = SendPendingBatch();
+    if (write_blocked_) {
+      // This packet is the last one queued, so it was not sent. Only the
+      // packets already reported as sent are kept for the next write event.
+      --num_pending_packets_;
+      write_blocked_ = num_pending_packets_ > 0;
+      rtc::SentPacket& sent_packet =
+          pending_sent_packets_[num_pending_packets_];
+      sent_packet.send_time_ms = rtc::TimeMillis();
+      return RejectWhileWriteBlocked(sent_packet);
+    }
+    if (error != 0) {
+      // A send error drops all queued packets, this one included.
+      SetError(error);
+      return -1;
+    }
+    return static_cast<int>(cb);
+  }
+
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, &sent_packet.info);
@@ -94,6 +159,93 @@ int AsyncUDPSocket::SendTo(const void* pv,
   return ret;
 }
 
+int AsyncUDPSocket::RejectWhileWriteBlocked(
+    const rtc::SentPacket& sent_packet) {
+  // As for an unbatched packet that would block, SentPacket is signaled even
+  // though the packet is not sent.
+  SignalSentPacket(this, sent_packet);
+  SetError(EWOULDBLOCK);
+  return -1;
+}
+
+void AsyncUDPSocket::AddToPendingBatch(const void* pv,
+                                       size_t cb,
+                                       const SocketAddress& addr,
+                                       const rtc::PacketOptions& options) {
+  if (num_pending_packets_ == 0) {
+    pending_destination_ = addr;
+    pending_ecn_1_ = options.ecn_1;
+  }
+  if (num_pending_packets_ == pending_payloads_.size()) {
+    pending_payloads_.emplace_back();
+    pending_sent_packets_.emplace_back();
+  }
+  pending_payloads_[num_pending_packets_].SetData(
+      static_cast<const uint8_t*>(pv), cb);
+  rtc::SentPacket& sent_packet = pending_sent_packets_[num_pending_packets_];
+  sent_packet = rtc::SentPacket(options.packet_id, /*send_time_ms=*/-1,
+                                options.info_signaled_after_sent);
+  CopySocketInformationToPacketInfo(cb, *this, &sent_packet.info);
+  ++num_pending_packets_;
+}
+
+int AsyncUDPSocket::SendPendingBatch() {
+  RTC_DCHECK_GT(num_pending_packets_, 0);
+  if (has_set_ect1_options_ != pending_ecn_1_) {
+    if (socket_->SetOption(Socket::Option::OPT_SEND_ECN,
+                           pending_ecn_1_ ? 1 : 0) == 0) {
+      has_set_ect1_options_ = pending_ecn_1_;
+    }
+  }
+  write_blocked_ = false;
+  int send_error = 0;
+  rtc::ArrayView<const uint8_t> packets[kMaxPendingBatchSize];
+  while (num_pending_packets_ > 0) {
+    for (size_t i = 0; i < num_pending_packets_; ++i) {
+      packets[i] = pending_payloads_[i];
+    }
+    int ret = socket_->SendToBatch(
+        rtc::ArrayView<const rtc::ArrayView<const uint8_t>>(
+            packets, num_pending_packets_),
+        pending_destination_);
+    size_t num_sent = ret > 0 ? static_cast<size_t>(ret) : 0;
+    if (num_sent == 0) {
+      int error = socket_->GetError();
+      if (IsBlockingError(error)) {
+        write_blocked_ = true;
+        return 0;
+      }
+      // As for unbatched packets, SentPacket is signaled even though the send
+      // failed.
+      RTC_LOG(LS_WARNING) << "AsyncUDPSocket["
+                          << GetLocalAddress().ToSensitiveString()
+                          << "] dropped " << num_pending_packets_
+                          << " batched packets, send failed with error "
+                          << error;
+      send_error = error;
+      num_sent = num_pending_packets_;
+    }
+    const int64_t send_time_ms = rtc::TimeMillis();
+    for (size_t i = 0; i < num_sent; ++i) {
+      pending_sent_packets_[i].send_time_ms = send_time_ms;
+      SignalSentPacket(this, pending_sent_packets_[i]);
+    }
+    RemovePendingPackets(num_sent);
+  }
+  return send_error;
+}
+
+void AsyncUDPSocket::RemovePendingPackets(size_t count) {
+  RTC_DCHECK_LE(count, num_pending_packets_);
+  // Rotate rather than erase, so that the buffers are kept for reuse.
+  std::rotate(pending_payloads_.begin(), pending_payloads_.begin() + count,
+              pending_payloads_.begin() + num_pending_packets_);
+  std::rotate(pending_sent_packets_.begin(),
+              pending_sent_packets_.begin() + count,
+              pending_sent_packets_.begin() + num_pending_packets_);
+  num_pending_packets_ -= count;
+}
+
 int AsyncUDPSocket::Close() {
   return socket_->Close();
 }
@@ -122,6 +274,11 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
   RTC_DCHECK(socket_.get() == socket);
   RTC_DCHECK_RUN_ON(&sequence_checker_);
 
+  if (!batch_receive_buffers_.empty()) {
+    OnReadEventBatched();
+    return;
+  }
+
   Socket::ReceiveBuffer receive_buffer(buffer_);
   int len = socket_->RecvFrom(receive_buffer);
   if (len < 0) {
@@ -139,6 +296,55 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
     return;
   }
 
+  DeliverPacket(receive_buffer, /*more_packets_follow=*/false);
+}
+
+void AsyncUDPSocket::SetMaxReceiveBatchSize(size_t batch_size) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  batch_receive_buffers_.clear();
+  batch_buffers_.clear();
+  if (batch_size <= 1) {
+    return;
+  }
+  // `batch_receive_buffers_` refers to the elements of `batch_buffers_`, which
+  // therefore must not be reallocated after this point.
+  batch_buffers_.resize(batch_size);
+  batch_receive_buffers_.reserve(batch_size);
+  for (rtc::Buffer& buffer : batch_buffers_) {
+    batch_receive_buffers_.emplace_back(buffer);
+  }
+}
+
+void AsyncUDPSocket::OnReadEventBatched() {
+  for (Socket::ReceiveBuffer& receive_buffer : batch_receive_buffers_) {
+    receive_buffer.arrival_time = std::nullopt;
+    receive_buffer.ecn = EcnMarking::kNotEct;
+    receive_buffer.segment_size = 0;
+  }
+  int count = socket_->RecvFromBatch(batch_receive_buffers_);
+  if (count < 0) {
+    SocketAddress local_addr = socket_->GetLocalAddress();
+    RTC_LOG(LS_INFO) << "AsyncUDPSocket[" << local_addr.ToSensitiveString()
+                     << "] batched receive failed with error "
+                     << socket_->GetError();
+    return;
+  }
+  // Empty buffers come from spurious wakeups.
+  int last = count - 1;
+  while (last >= 0 && batch_receive_buffers_[last].payload.empty()) {
+    --last;
+  }
+  for (int i = 0; i <= last; ++i) {
+    if (batch_receive_buffers_[i].payload.empty()) {
+      continue;
+    }
+    DeliverPacket(batch_receive_buffers_[i],
+                  /*more_packets_follow=*/i < last);
+  }
+}
+
+void AsyncUDPSocket::DeliverPacket(Socket::ReceiveBuffer& receive_buffer,
+                                   bool more_packets_follow) {
   if (!receive_buffer.arrival_time) {
     // Timestamp from socket is not available.
     receive_buffer.arrival_time = webrtc::Timestamp::Micros(rtc::TimeMicros());
@@ -150,12 +356,36 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
     }
     *receive_buffer.arrival_time += *socket_time_offset_;
   }
-  NotifyPacketReceived(
-      ReceivedPacket(receive_buffer.payload, receive_buffer.source_address,
-                     receive_buffer.arrival_time, receive_buffer.ecn));
+  if (receive_buffer.segment_size == 0 ||
+      receive_buffer.segment_size >= receive_buffer.payload.size()) {
+    ReceivedPacket packet(receive_buffer.payload,
+                          receive_buffer.source_address,
+                          receive_buffer.arrival_time, receive_buffer.ecn);
+    packet.set_more_packets_follow(more_packets_follow);
+    NotifyPacketReceived(packet);
+    return;
+  }
+  // The payload holds several datagrams coalesced by UDP GRO.
+  rtc::ArrayView<const uint8_t> remaining(receive_buffer.payload);
+  while (!remaining.empty()) {
+    size_t size = std::min(receive_buffer.segment_size, remaining.size());
+    ReceivedPacket packet(remaining.subview(0, size),
+                          receive_buffer.source_address,
+                          receive_buffer.arrival_time, receive_buffer.ecn);
+    remaining = remaining.subview(size);
+    packet.set_more_packets_follow(more_packets_follow || !remaining.empty());
+    NotifyPacketReceived(packet);
+  }
 }
 
 void AsyncUDPSocket::OnWriteEvent(Socket* socket) {
+  RTC_DCHECK_RUN_ON(&send_sequence_checker_);
+  if (write_blocked_) {
+    SendPendingBatch();
+    if (write_blocked_) {
+      return;
+    }
+  }
   SignalReadyToSend(this);
 }
 
@@ -15,11 +15,14 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "api/sequence_checker.h"
+#include "api/task_queue/pending_task_safety_flag.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/buffer.h"
+#include "rtc_base/network/sent_packet.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/socket_factory.h"
@@ -29,7 +32,16 @@
 namespace rtc {
 
 // Provides the ability to receive packets asynchronously.  Sends are not
-// buffered since it is acceptable to drop packets under high load.
+// buffered since it is acceptable to drop packets under high load, except for
+// packets marked as batchable in PacketOptions. Those are held back until the
+// last packet of the batch is sent and then handed to the socket together, so
+// that a burst costs a single system call where supported.
+//
+// A batchable packet that is held back is reported as sent. If the socket
+// later fails to send it, it is dropped and the error is logged. Like for any
+// packet that fails to send, SignalSentPacket is still emitted for it. Packets
+// the socket would block on stay queued until it is writable again; until
+// then new packets are rejected with EWOULDBLOCK.
 class AsyncUDPSocket : public AsyncPacketSocket {
  public:
   // Binds `socket` and creates AsyncUDPSocket for it. Takes ownership
@@ -61,16 +73,65 @@ class AsyncUDPSocket : public AsyncPacketSocket {
   int GetError() const override;
   void SetError(int error) override;
 
+  // Sets the maximum number of datagrams read from the underlying socket on
+  // each read event. With a value larger than one, the socket is drained with
+  // Socket::RecvFromBatch, which uses a single system call where supported.
+  // Each batch slot holds its own 64 KiB receive buffer. Default is one.
+  void SetMaxReceiveBatchSize(size_t batch_size);
+
  private:
+  // Maximum number of batchable packets held back before they are sent.
+  static constexpr size_t kMaxPendingBatchSize = 64;
+
   // Called when the underlying socket is ready to be read from.
   void OnReadEvent(Socket* socket);
+  void OnReadEventBatched();
+  // Adjusts the arrival time of a received datagram and notifies the packet
+  // received callback, splitting GRO coalesced datagrams if needed.
+  // `more_packets_follow` tells whether more datagrams of the same read are
+  // delivered after these.
+  void DeliverPacket(Socket::ReceiveBuffer& receive_buffer,
+                     bool more_packets_follow);
   // Called when the underlying socket is ready to send.
   void OnWriteEvent(Socket* socket);
+  // Queues a batchable packet, to be sent by SendPendingBatch().
+  void AddToPendingBatch(const void* pv,
+                         size_t cb,
+                         const SocketAddress& addr,
+                         const rtc::PacketOptions& options);
+  // Sends queued batchable packets until the queue is empty or the socket
+  // would block, and signals SentPacket for each packet that leaves the queue.
+  // On a blocking error the unsent packets stay queued and are retried on the
+  // next write event. On any other error they are dropped, like unbatched
+  // packets that fail to send, and the error is returned. Returns 0 otherwise.
+  int SendPendingBatch();
+  // Removes the first `count` queued packets.
+  void RemovePendingPackets(size_t count);
+  // Signals SentPacket for a packet that is not sent because queued packets
+  // wait for the socket to become writable. Returns -1 with EWOULDBLOCK.
+  int RejectWhileWriteBlocked(const rtc::SentPacket& sent_packet);
 
   RTC_NO_UNIQUE_ADDRESS webrtc::SequenceChecker sequence_checker_;
+  RTC_NO_UNIQUE_ADDRESS webrtc::SequenceChecker send_sequence_checker_;
   std::unique_ptr<Socket> socket_;
   bool has_set_ect1_options_ = false;
+  // Batchable packets waiting to be sent. All have the same destination and
+  // ECN marking. Buffers are reused between batches, only the first
+  // `num_pending_packets_` entries are in use.
+  std::vector<rtc::Buffer> pending_payloads_
+      RTC_GUARDED_BY(send_sequence_checker_);
+  std::vector<rtc::SentPacket> pending_sent_packets_
+      RTC_GUARDED_BY(send_sequence_checker_);
+  size_t num_pending_packets_ RTC_GUARDED_BY(send_sequence_checker_) = 0;
+  SocketAddress pending_destination_ RTC_GUARDED_BY(send_sequence_checker_);
+  bool pending_ecn_1_ RTC_GUARDED_BY(send_sequence_checker_) = false;
+  // Set while queued packets wait for the socket to become writable.
+  bool write_blocked_ RTC_GUARDED_BY(send_sequence_checker_) = false;
+  webrtc::ScopedTaskSafetyDetached task_safety_;
   rtc::Buffer buffer_ RTC_GUARDED_BY(sequence_checker_);
+  std::vector<rtc::Buffer> batch_buffers_ RTC_GUARDED_BY(sequence_checker_);
+  std::vector<Socket::ReceiveBuffer> batch_receive_buffers_
+      RTC_GUARDED_BY(sequence_checker_);
   std::optional<webrtc::TimeDelta> socket_time_offset_
       RTC_GUARDED_BY(sequence_checker_);
 };
@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_socket.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/virtual_socket_server.h"
+#include "test/gtest.h"
+#include "test/heap_allocation_counter.h"
+
+namespace rtc {
+namespace {
+
+const SocketAddress kAddr("22.22.22.22", 0);
+
+// Accepts every batch without sending it anywhere.
+class CountingBatchSocket : public AsyncSocketAdapter {
+ public:
+  explicit CountingBatchSocket(Socket* socket) : AsyncSocketAdapter(socket) {}
+
+  int SendToBatch(ArrayView<const ArrayView<const uint8_t>> packets,
+                  const SocketAddress& /* addr */) override {
+    packets_sent += packets.size();
+    return static_cast<int>(packets.size());
+  }
+
+  size_t packets_sent = 0;
+};
+
+TEST(AsyncUDPSocketAllocationTest, BatchesOnlyAllocateTheFlushTask) {
+  constexpr int kBursts = 20;
+  constexpr int kPacketsPerBurst = 10;
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  auto* socket = new CountingBatchSocket(
+      socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM));
+  AsyncUDPSocket udp_socket(socket);
+
+  uint8_t payload[1200] = {};
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  // The first burst sizes the queue of pending packets.
+  for (int burst = 0; burst <= kBursts; ++burst) {
+    for (int i = 0; i < kPacketsPerBurst; ++i) {
+      packet_options.last_packet_in_batch = i == kPacketsPerBurst - 1;
+      webrtc::test::ScopedHeapAllocationCounter allocations;
+      EXPECT_EQ(
+          udp_socket.SendTo(payload, sizeof(payload), kAddr, packet_options),
+          static_cast<int>(sizeof(payload)));
+      if (burst == 0) {
+        continue;
+      }
+      if (i == 0) {
+        // Posting the task that flushes an incomplete batch may allocate the
+        // task and storage in the thread's task queue.
+        EXPECT_LE(allocations.count(), 2);
+      } else {
+        EXPECT_EQ(allocations.count(), 0);
+      }
+    }
+    thread.ProcessMessages(0);
+  }
+  EXPECT_EQ(socket->packets_sent,
+            static_cast<size_t>((kBursts + 1) * kPacketsPerBurst));
+}
+
+}  // namespace
+}  // namespace rtc
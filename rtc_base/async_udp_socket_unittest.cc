@@ -10,14 +10,25 @@
 
 #include "rtc_base/async_udp_socket.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "absl/memory/memory.h"
+#include "api/array_view.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_socket.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/network/sent_packet.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
+#include "rtc_base/third_party/sigslot/sigslot.h"
+#include "rtc_base/thread.h"
 #include "rtc_base/virtual_socket_server.h"
+#include "test/gmock.h"
 #include "test/gtest.h"
 
 namespace rtc {
@@ -52,4 +63,274 @@ TEST(AsyncUDPSocketTest, SetSocketOptionIfEctChange) {
   EXPECT_EQ(ect, 0);
 }
 
+class SentPacketRecorder : public sigslot::has_slots<> {
+ public:
+  void OnSentPacket(AsyncPacketSocket* socket, const SentPacket& sent_packet) {
+    packet_ids.push_back(sent_packet.packet_id);
+  }
+
+  std::vector<int64_t> packet_ids;
+};
+
+// Sends at most `packets_to_accept` datagrams, then fails with
+// `error_to_return`, like a socket with a full send buffer.
+class PartialBatchSocket : public AsyncSocketAdapter {
+ public:
+  explicit PartialBatchSocket(Socket* socket) : AsyncSocketAdapter(socket) {}
+
+  int SendToBatch(ArrayView<const ArrayView<const uint8_t>> packets,
+                  const SocketAddress& addr) override {
+    size_t count = std::min(packets.size(), packets_to_accept);
+    if (count == 0) {
+      error_ = error_to_return;
+      return -1;
+    }
+    packets_to_accept -= count;
+    for (size_t i = 0; i < count; ++i) {
+      sent_payloads.push_back(packets[i][0]);
+    }
+    return static_cast<int>(count);
+  }
+  int GetError() const override { return error_; }
+  void SetError(int error) override { error_ = error; }
+
+  // Signals that the socket is writable again.
+  void BecomeWritable(size_t packets) {
+    packets_to_accept = packets;
+    SignalWriteEvent(this);
+  }
+
+  size_t packets_to_accept = 0;
+  int error_to_return = EWOULDBLOCK;
+  // First byte of each datagram sent.
+  std::vector<uint8_t> sent_payloads;
+
+ private:
+  int error_ = 0;
+};
+
+class ReadyToSendRecorder : public sigslot::has_slots<> {
+ public:
+  void OnReadyToSend(AsyncPacketSocket* socket) { ++count; }
+
+  int count = 0;
+};
+
+TEST(AsyncUDPSocketTest, SendsBatchablePacketsWithLastPacketInBatch) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  Socket* socket = socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM);
+  std::unique_ptr<AsyncUDPSocket> udp_socket =
+      absl::WrapUnique(AsyncUDPSocket::Create(socket, kAddr));
+  SentPacketRecorder recorder;
+  udp_socket->SignalSentPacket.connect(&recorder,
+                                       &SentPacketRecorder::OnSentPacket);
+
+  uint8_t buffer[] = "hello";
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  packet_options.packet_id = 1;
+  EXPECT_EQ(udp_socket->SendTo(buffer, 5, kAddr, packet_options), 5);
+  packet_options.packet_id = 2;
+  EXPECT_EQ(udp_socket->SendTo(buffer, 5, kAddr, packet_options), 5);
+  EXPECT_THAT(recorder.packet_ids, ::testing::IsEmpty());
+
+  packet_options.packet_id = 3;
+  packet_options.last_packet_in_batch = true;
+  EXPECT_EQ(udp_socket->SendTo(buffer, 5, kAddr, packet_options), 5);
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(AsyncUDPSocketTest, SendsPendingBatchBeforeUnbatchedPacket) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  Socket* socket = socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM);
+  std::unique_ptr<AsyncUDPSocket> udp_socket =
+      absl::WrapUnique(AsyncUDPSocket::Create(socket, kAddr));
+  SentPacketRecorder recorder;
+  udp_socket->SignalSentPacket.connect(&recorder,
+                                       &SentPacketRecorder::OnSentPacket);
+
+  uint8_t buffer[] = "hello";
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  packet_options.packet_id = 1;
+  udp_socket->SendTo(buffer, 5, kAddr, packet_options);
+  packet_options.batchable = false;
+  packet_options.packet_id = 2;
+  udp_socket->SendTo(buffer, 5, kAddr, packet_options);
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1, 2));
+}
+
+TEST(AsyncUDPSocketTest, SendsIncompleteBatchWhenCurrentTaskIsDone) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  Socket* socket = socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM);
+  std::unique_ptr<AsyncUDPSocket> udp_socket =
+      absl::WrapUnique(AsyncUDPSocket::Create(socket, kAddr));
+  SentPacketRecorder recorder;
+  udp_socket->SignalSentPacket.connect(&recorder,
+                                       &SentPacketRecorder::OnSentPacket);
+
+  uint8_t buffer[] = "hello";
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  packet_options.packet_id = 1;
+  udp_socket->SendTo(buffer, 5, kAddr, packet_options);
+  EXPECT_THAT(recorder.packet_ids, ::testing::IsEmpty());
+
+  thread.ProcessMessages(0);
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1));
+}
+
+TEST(AsyncUDPSocketTest, RetriesUnsentBatchablePacketsWhenWritable) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  auto* socket = new PartialBatchSocket(
+      socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM));
+  AsyncUDPSocket udp_socket(socket);
+  SentPacketRecorder sent_recorder;
+  udp_socket.SignalSentPacket.connect(&sent_recorder,
+                                      &SentPacketRecorder::OnSentPacket);
+  ReadyToSendRecorder ready_recorder;
+  udp_socket.SignalReadyToSend.connect(&ready_recorder,
+                                       &ReadyToSendRecorder::OnReadyToSend);
+
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  for (uint8_t id = 1; id <= 3; ++id) {
+    uint8_t payload[] = {id};
+    packet_options.packet_id = id;
+    packet_options.last_packet_in_batch = id == 3;
+    socket->packets_to_accept = id == 3 ? 1 : 0;
+    int expected = id == 3 ? -1 : 1;
+    EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), expected);
+  }
+  // The packet ending the batch is rejected, the one before it is kept.
+  // Like an unbatched packet that would block, the rejected packet is
+  // signaled.
+  EXPECT_EQ(udp_socket.GetError(), EWOULDBLOCK);
+  EXPECT_THAT(socket->sent_payloads, ::testing::ElementsAre(1));
+  EXPECT_THAT(sent_recorder.packet_ids, ::testing::ElementsAre(1, 3));
+
+  // New packets are rejected until the socket is writable.
+  uint8_t payload[] = {4};
+  packet_options.packet_id = 4;
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), -1);
+  EXPECT_EQ(udp_socket.GetError(), EWOULDBLOCK);
+  EXPECT_THAT(sent_recorder.packet_ids, ::testing::ElementsAre(1, 3, 4));
+
+  socket->BecomeWritable(/*packets=*/0);
+  EXPECT_EQ(ready_recorder.count, 0);
+  socket->BecomeWritable(/*packets=*/10);
+  EXPECT_EQ(ready_recorder.count, 1);
+  EXPECT_THAT(socket->sent_payloads, ::testing::ElementsAre(1, 2));
+  EXPECT_THAT(sent_recorder.packet_ids, ::testing::ElementsAre(1, 3, 4, 2));
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), 1);
+  EXPECT_THAT(socket->sent_payloads, ::testing::ElementsAre(1, 2, 4));
+}
+
+TEST(AsyncUDPSocketTest, EarlierBatchSendErrorDoesNotFailNextSend) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  auto* socket = new PartialBatchSocket(
+      socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM));
+  AsyncUDPSocket udp_socket(socket);
+  SentPacketRecorder recorder;
+  udp_socket.SignalSentPacket.connect(&recorder,
+                                      &SentPacketRecorder::OnSentPacket);
+
+  uint8_t payload[] = {1};
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  packet_options.packet_id = 1;
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), 1);
+  socket->error_to_return = EHOSTUNREACH;
+  thread.ProcessMessages(0);
+  // The failed packet is dropped, and signaled like an unbatched packet.
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1));
+  EXPECT_THAT(socket->sent_payloads, ::testing::IsEmpty());
+
+  socket->packets_to_accept = 1;
+  payload[0] = 2;
+  packet_options.packet_id = 2;
+  packet_options.last_packet_in_batch = true;
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), 1);
+  EXPECT_THAT(socket->sent_payloads, ::testing::ElementsAre(2));
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1, 2));
+}
+
+TEST(AsyncUDPSocketTest, ReturnsErrorForLastPacketOfFailedBatch) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  auto* socket = new PartialBatchSocket(
+      socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM));
+  socket->error_to_return = EHOSTUNREACH;
+  AsyncUDPSocket udp_socket(socket);
+  SentPacketRecorder recorder;
+  udp_socket.SignalSentPacket.connect(&recorder,
+                                      &SentPacketRecorder::OnSentPacket);
+
+  uint8_t payload[] = {1};
+  rtc::PacketOptions packet_options;
+  packet_options.batchable = true;
+  packet_options.packet_id = 1;
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), 1);
+  packet_options.packet_id = 2;
+  packet_options.last_packet_in_batch = true;
+  EXPECT_EQ(udp_socket.SendTo(payload, 1, kAddr, packet_options), -1);
+  EXPECT_EQ(udp_socket.GetError(), EHOSTUNREACH);
+  EXPECT_THAT(recorder.packet_ids, ::testing::ElementsAre(1, 2));
+}
+
+// Returns a fixed set of datagrams from each batched read.
+class FakeBatchReadSocket : public AsyncSocketAdapter {
+ public:
+  explicit FakeBatchReadSocket(Socket* socket) : AsyncSocketAdapter(socket) {}
+
+  int RecvFromBatch(ArrayView<ReceiveBuffer> buffers) override {
+    size_t count = std::min(buffers.size(), reads.size());
+    for (size_t i = 0; i < count; ++i) {
+      buffers[i].payload.SetData(reads[i].first);
+      buffers[i].segment_size = reads[i].second;
+    }
+    return static_cast<int>(count);
+  }
+
+  void Read() { SignalReadEvent(this); }
+
+  // Payload and GRO segment size of each datagram read.
+  std::vector<std::pair<std::vector<uint8_t>, size_t>> reads;
+};
+
+TEST(AsyncUDPSocketTest, MarksPacketsFollowedByMoreOfTheSameRead) {
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  auto* socket = new FakeBatchReadSocket(
+      socket_server.CreateSocket(kAddr.family(), SOCK_DGRAM));
+  AsyncUDPSocket udp_socket(socket);
+  udp_socket.SetMaxReceiveBatchSize(4);
+  std::vector<std::pair<uint8_t, bool>> received;
+  udp_socket.RegisterReceivedPacketCallback(
+      [&](AsyncPacketSocket* /* socket */, const ReceivedPacket& packet) {
+        received.emplace_back(packet.payload()[0],
+                              packet.more_packets_follow());
+      });
+
+  // The second datagram holds two segments coalesced by GRO.
+  socket->reads = {{{1}, 0}, {{2, 2, 3, 3}, 2}, {{4}, 0}};
+  socket->Read();
+  EXPECT_THAT(received,
+              ::testing::ElementsAre(::testing::Pair(1, true),
+                                     ::testing::Pair(2, true),
+                                     ::testing::Pair(3, true),
+                                     ::testing::Pair(4, false)));
+
+  received.clear();
+  socket->reads = {{{5, 5, 6}, 2}};
+  socket->Read();
+  EXPECT_THAT(received, ::testing::ElementsAre(::testing::Pair(5, true),
+                                               ::testing::Pair(6, false)));
+}
+
 }  // namespace rtc
@@ -12,7 +12,10 @@
 
 #include <stddef.h>
 
+#include <utility>
+
 #include "absl/strings/string_view.h"
+#include "rtc_base/copy_on_write_buffer_pool.h"
 
 namespace rtc {
 
@@ -48,6 +51,11 @@ CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size, size_t capacity)
   RTC_DCHECK(IsConsistent());
 }
 
+CopyOnWriteBuffer::CopyOnWriteBuffer(scoped_refptr<RefCountedBuffer> buffer)
+    : buffer_(std::move(buffer)), offset_(0), size_(buffer_->size()) {
+  RTC_DCHECK(IsConsistent());
+}
+
 CopyOnWriteBuffer::~CopyOnWriteBuffer() = default;
 
 bool CopyOnWriteBuffer::operator==(const CopyOnWriteBuffer& buf) const {
@@ -106,7 +114,7 @@ void CopyOnWriteBuffer::Clear() {
   if (buffer_->HasOneRef()) {
     buffer_->Clear();
   } else {
-    buffer_ = new RefCountedBuffer(0, capacity());
+    buffer_ = CloneStorage(nullptr, 0, capacity());
   }
   offset_ = 0;
   size_ = 0;
@@ -118,10 +126,35 @@ void CopyOnWriteBuffer::UnshareAndEnsureCapacity(size_t new_capacity) {
     return;
   }
 
-  buffer_ =
-      new RefCountedBuffer(buffer_->data() + offset_, size_, new_capacity);
+  buffer_ = CloneStorage(buffer_->data() + offset_, size_, new_capacity);
   offset_ = 0;
   RTC_DCHECK(IsConsistent());
 }
 
+CopyOnWriteBuffer::RefCountedBuffer* CopyOnWriteBuffer::CloneStorage(
+    const uint8_t* data,
+    size_t size,
+    size_t capacity) const {
+  if (buffer_ && buffer_->pool_) {
+    if (RefCountedBuffer* storage =
+            buffer_->pool_->TakeStorage(data, size, capacity)) {
+      return storage;
+    }
+  }
+  return new RefCountedBuffer(data, size, capacity);
+}
+
+webrtc::RefCountReleaseStatus CopyOnWriteBuffer::RefCountedBuffer::Release()
+    const {
+  const auto status = ref_count_.DecRef();
+  if (status == webrtc::RefCountReleaseStatus::kDroppedLastRef) {
+    if (pool_) {
+      pool_->ReturnStorage(const_cast<RefCountedBuffer*>(this));
+    } else {
+      delete this;
+    }
+  }
+  return status;
+}
+
 }  // namespace rtc
@@ -20,15 +20,19 @@
 #include <utility>
 
 #include "absl/strings/string_view.h"
+#include "api/ref_count.h"
 #include "api/scoped_refptr.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/ref_counted_object.h"
+#include "rtc_base/ref_counter.h"
 #include "rtc_base/system/rtc_export.h"
 #include "rtc_base/type_traits.h"
 
 namespace rtc {
 
+class CopyOnWriteBufferPool;
+
 class RTC_EXPORT CopyOnWriteBuffer {
  public:
   // An empty buffer.
@@ -190,7 +194,7 @@ class RTC_EXPORT CopyOnWriteBuffer {
     if (!buffer_) {
       buffer_ = size > 0 ? new RefCountedBuffer(data, size) : nullptr;
     } else if (!buffer_->HasOneRef()) {
-      buffer_ = new RefCountedBuffer(data, size, capacity());
+      buffer_ = CloneStorage(data, size, capacity());
     } else {
       buffer_->SetData(data, size);
     }
@@ -292,7 +296,37 @@ class RTC_EXPORT CopyOnWriteBuffer {
   }
 
  private:
-  using RefCountedBuffer = FinalRefCountedObject<Buffer>;
+  friend class CopyOnWriteBufferPool;
+
+  // Storage shared by buffers. Storage that was taken from a
+  // CopyOnWriteBufferPool is handed back to it instead of being deleted when
+  // the last reference is dropped.
+  class RefCountedBuffer final : public Buffer {
+   public:
+    using Buffer::Buffer;
+
+    void AddRef() const { ref_count_.IncRef(); }
+    webrtc::RefCountReleaseStatus Release() const;
+    bool HasOneRef() const { return ref_count_.HasOneRef(); }
+
+   private:
+    friend class CopyOnWriteBuffer;
+    friend class CopyOnWriteBufferPool;
+
+    mutable webrtc::webrtc_impl::RefCounter ref_count_{0};
+    CopyOnWriteBufferPool* pool_ = nullptr;
+  };
+
+  // Takes a scoped_refptr rather than a raw pointer, so that
+  // CopyOnWriteBuffer(0) still picks the size constructor.
+  explicit CopyOnWriteBuffer(scoped_refptr<RefCountedBuffer> buffer);
+
+  // Returns new storage holding a copy of `data`, taken from the same pool as
+  // the current storage if it has one.
+  RefCountedBuffer* CloneStorage(const uint8_t* data,
+                                 size_t size,
+                                 size_t capacity) const;
+
   // Create a copy of the underlying data if it is referenced from other Buffer
   // objects or there is not enough capacity.
   void UnshareAndEnsureCapacity(size_t new_capacity);
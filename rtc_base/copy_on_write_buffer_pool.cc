@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/copy_on_write_buffer_pool.h"
+
+#include <vector>
+
+#include "api/make_ref_counted.h"
+#include "rtc_base/checks.h"
+
+namespace rtc {
+
+// static
+scoped_refptr<CopyOnWriteBufferPool> CopyOnWriteBufferPool::Create(
+    size_t buffer_capacity,
+    size_t max_free_buffers) {
+  return webrtc::make_ref_counted<CopyOnWriteBufferPool>(buffer_capacity,
+                                                         max_free_buffers);
+}
+
+CopyOnWriteBufferPool::CopyOnWriteBufferPool(size_t buffer_capacity,
+                                             size_t max_free_buffers)
+    : buffer_capacity_(buffer_capacity), max_free_buffers_(max_free_buffers) {
+  RTC_DCHECK_GT(buffer_capacity_, 0);
+}
+
+CopyOnWriteBufferPool::~CopyOnWriteBufferPool() {
+  for (Storage* storage : free_storage_) {
+    delete storage;
+  }
+}
+
+CopyOnWriteBuffer CopyOnWriteBufferPool::Allocate(size_t capacity) {
+  if (Storage* storage = TakeStorage(nullptr, 0, capacity)) {
+    return CopyOnWriteBuffer(scoped_refptr<Storage>(storage));
+  }
+  return CopyOnWriteBuffer(0, capacity);
+}
+
+size_t CopyOnWriteBufferPool::num_free_buffers() const {
+  webrtc::MutexLock lock(&mutex_);
+  return free_storage_.size();
+}
+
+void CopyOnWriteBufferPool::Trim() {
+  std::vector<Storage*> free_storage;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    free_storage.swap(free_storage_);
+  }
+  for (Storage* storage : free_storage) {
+    delete storage;
+  }
+}
+
+CopyOnWriteBufferPool::Storage* CopyOnWriteBufferPool::TakeStorage(
+    const uint8_t* data,
+    size_t size,
+    size_t capacity) {
+  if (capacity > buffer_capacity_) {
+    return nullptr;
+  }
+  RTC_DCHECK_LE(size, capacity);
+  Storage* storage = nullptr;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (!free_storage_.empty()) {
+      storage = free_storage_.back();
+      free_storage_.pop_back();
+    }
+  }
+  if (storage == nullptr) {
+    storage = new Storage(0, buffer_capacity_);
+    storage->pool_ = this;
+  }
+  if (size > 0) {
+    storage->SetData(data, size);
+  }
+  // Each block of storage in use keeps the pool alive.
+  AddRef();
+  return storage;
+}
+
+void CopyOnWriteBufferPool::ReturnStorage(Storage* storage) {
+  RTC_DCHECK_EQ(storage->pool_, this);
+  storage->Clear();
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (free_storage_.size() < max_free_buffers_) {
+      free_storage_.push_back(storage);
+      storage = nullptr;
+    }
+  }
+  delete storage;
+  // May delete the pool.
+  Release();
+}
+
+}  // namespace rtc
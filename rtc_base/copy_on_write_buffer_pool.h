@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_COPY_ON_WRITE_BUFFER_POOL_H_
+#define RTC_BASE_COPY_ON_WRITE_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace rtc {
+
+// Recycles the storage of CopyOnWriteBuffers of up to a fixed capacity, such
+// as the MTU sized buffers on the RTP send path. Buffers allocated from the
+// pool, and copies of them that get unshared by a write, take their storage
+// from the pool and hand it back when the last reference to it is dropped. In
+// steady state creating and dropping such buffers does not allocate.
+//
+// The unused storage is kept until the pool is destroyed or trimmed. By
+// default that is up to kDefaultMaxFreeBuffers blocks, e.g. 256 * 1500 bytes,
+// about 375 KB, for a pool of MTU sized buffers. Owners that stop sending for
+// a while can hand it back with Trim().
+//
+// Thread safe. The pool stays alive until it has been released by its owner
+// and by all buffers using its storage.
+class RTC_EXPORT CopyOnWriteBufferPool : public webrtc::RefCountInterface {
+ public:
+  static constexpr size_t kDefaultMaxFreeBuffers = 256;
+
+  // Storage of `buffer_capacity` bytes is recycled. At most
+  // `max_free_buffers` unused blocks of storage are kept around.
+  static scoped_refptr<CopyOnWriteBufferPool> Create(
+      size_t buffer_capacity,
+      size_t max_free_buffers = kDefaultMaxFreeBuffers);
+
+  // Returns an empty buffer that can grow to `capacity` bytes without
+  // reallocating. Pooled storage is used if `capacity` does not exceed
+  // buffer_capacity().
+  CopyOnWriteBuffer Allocate(size_t capacity);
+
+  size_t buffer_capacity() const { return buffer_capacity_; }
+
+  // Number of unused blocks of storage that are ready to be handed out.
+  size_t num_free_buffers() const;
+
+  // Frees the unused storage. Storage in use is still returned to the pool
+  // when it is dropped.
+  void Trim();
+
+ protected:
+  CopyOnWriteBufferPool(size_t buffer_capacity, size_t max_free_buffers);
+  ~CopyOnWriteBufferPool() override;
+
+ private:
+  friend class CopyOnWriteBuffer;
+  using Storage = CopyOnWriteBuffer::RefCountedBuffer;
+
+  // Returns storage holding a copy of `data`, or nullptr if `capacity` is
+  // larger than buffer_capacity().
+  Storage* TakeStorage(const uint8_t* data, size_t size, size_t capacity);
+  void ReturnStorage(Storage* storage);
+
+  const size_t buffer_capacity_;
+  const size_t max_free_buffers_;
+  mutable webrtc::Mutex mutex_;
+  std::vector<Storage*> free_storage_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_COPY_ON_WRITE_BUFFER_POOL_H_
@@ -0,0 +1,43 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/copy_on_write_buffer_pool.h"
+#include "test/gtest.h"
+#include "test/heap_allocation_counter.h"
+
+namespace rtc {
+namespace {
+
+constexpr size_t kCapacity = 1500;
+constexpr uint8_t kData[] = {1, 2, 3, 4};
+
+TEST(CopyOnWriteBufferPoolAllocationTest, SteadyStateMakesNoHeapAllocations) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  auto allocate_copy_and_drop = [&] {
+    CopyOnWriteBuffer buffer = pool->Allocate(kCapacity);
+    buffer.AppendData(kData);
+    CopyOnWriteBuffer copy = buffer;
+    copy.MutableData()[0] = 5;
+  };
+  allocate_copy_and_drop();
+
+  webrtc::test::ScopedHeapAllocationCounter allocations;
+  for (int i = 0; i < 100; ++i) {
+    allocate_copy_and_drop();
+  }
+  EXPECT_EQ(allocations.count(), 0);
+}
+
+}  // namespace
+}  // namespace rtc
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/copy_on_write_buffer_pool.h"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "rtc_base/copy_on_write_buffer.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace {
+
+using ::testing::Contains;
+
+constexpr size_t kCapacity = 1500;
+constexpr uint8_t kData[] = {1, 2, 3, 4};
+
+TEST(CopyOnWriteBufferPoolTest, AllocatesEmptyBufferWithCapacity) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  CopyOnWriteBuffer buffer = pool->Allocate(1200);
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_GE(buffer.capacity(), 1200u);
+}
+
+TEST(CopyOnWriteBufferPoolTest, ReturnsStorageWhenLastReferenceIsDropped) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  CopyOnWriteBuffer buffer = pool->Allocate(kCapacity);
+  buffer.AppendData(kData);
+  const uint8_t* storage = buffer.cdata();
+  {
+    CopyOnWriteBuffer copy = buffer;
+    buffer = CopyOnWriteBuffer();
+    EXPECT_EQ(pool->num_free_buffers(), 0u);
+  }
+  EXPECT_EQ(pool->num_free_buffers(), 1u);
+
+  CopyOnWriteBuffer reused = pool->Allocate(kCapacity);
+  EXPECT_EQ(reused.cdata(), storage);
+  EXPECT_EQ(reused.size(), 0u);
+  EXPECT_EQ(pool->num_free_buffers(), 0u);
+}
+
+TEST(CopyOnWriteBufferPoolTest, UnsharedCopiesUseStorageFromThePool) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  std::vector<CopyOnWriteBuffer> warm_up = {pool->Allocate(kCapacity),
+                                            pool->Allocate(kCapacity)};
+  std::set<const uint8_t*> storage = {warm_up[0].cdata(), warm_up[1].cdata()};
+  warm_up.clear();
+  ASSERT_EQ(pool->num_free_buffers(), 2u);
+
+  CopyOnWriteBuffer buffer = pool->Allocate(kCapacity);
+  buffer.AppendData(kData);
+  CopyOnWriteBuffer copy = buffer;
+  copy.MutableData()[0] = 5;
+
+  EXPECT_NE(copy.cdata(), buffer.cdata());
+  EXPECT_THAT(storage, Contains(buffer.cdata()));
+  EXPECT_THAT(storage, Contains(copy.cdata()));
+  EXPECT_EQ(buffer.cdata()[0], 1);
+  EXPECT_EQ(copy.cdata()[0], 5);
+  EXPECT_EQ(copy.size(), sizeof(kData));
+}
+
+TEST(CopyOnWriteBufferPoolTest, SteadyStateDoesNotAllocateStorage) {
+  constexpr int kInFlight = 8;
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  std::set<const uint8_t*> storage;
+  {
+    std::vector<CopyOnWriteBuffer> buffers;
+    for (int i = 0; i < kInFlight; ++i) {
+      buffers.push_back(pool->Allocate(kCapacity));
+      storage.insert(buffers.back().cdata());
+    }
+  }
+
+  for (int round = 0; round < 100; ++round) {
+    std::vector<CopyOnWriteBuffer> buffers;
+    for (int i = 0; i < kInFlight; ++i) {
+      buffers.push_back(pool->Allocate(kCapacity));
+      buffers.back().AppendData(kData);
+      EXPECT_THAT(storage, Contains(buffers.back().cdata()));
+    }
+  }
+  EXPECT_EQ(pool->num_free_buffers(), static_cast<size_t>(kInFlight));
+}
+
+TEST(CopyOnWriteBufferPoolTest, LargerCapacityIsNotPooled) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  { CopyOnWriteBuffer buffer = pool->Allocate(kCapacity + 1); }
+  EXPECT_EQ(pool->num_free_buffers(), 0u);
+}
+
+TEST(CopyOnWriteBufferPoolTest, KeepsAtMostMaxFreeBuffers) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity, /*max_free_buffers=*/2);
+  {
+    std::vector<CopyOnWriteBuffer> buffers;
+    for (int i = 0; i < 4; ++i) {
+      buffers.push_back(pool->Allocate(kCapacity));
+    }
+  }
+  EXPECT_EQ(pool->num_free_buffers(), 2u);
+}
+
+TEST(CopyOnWriteBufferPoolTest, TrimFreesUnusedStorage) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  CopyOnWriteBuffer in_use = pool->Allocate(kCapacity);
+  { CopyOnWriteBuffer unused = pool->Allocate(kCapacity); }
+  ASSERT_EQ(pool->num_free_buffers(), 1u);
+
+  pool->Trim();
+  EXPECT_EQ(pool->num_free_buffers(), 0u);
+  in_use = CopyOnWriteBuffer();
+  EXPECT_EQ(pool->num_free_buffers(), 1u);
+}
+
+TEST(CopyOnWriteBufferPoolTest, BuffersMayOutliveThePoolOwner) {
+  scoped_refptr<CopyOnWriteBufferPool> pool =
+      CopyOnWriteBufferPool::Create(kCapacity);
+  CopyOnWriteBuffer buffer = pool->Allocate(kCapacity);
+  buffer.AppendData(kData);
+  pool = nullptr;
+  EXPECT_EQ(buffer.size(), sizeof(kData));
+  buffer = CopyOnWriteBuffer();
+}
+
+}  // namespace
+}  // namespace rtc
@@ -38,7 +38,11 @@ static const int kMaxLogLineSize = 1024 - 60;
 #include <time.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/base/attributes.h"
@@ -83,6 +87,135 @@ webrtc::Mutex& GetLoggingLock() {
   return mutex;
 }
 
+// Minimum severity over all streams, LS_NONE if there are none. Like
+// `g_min_sev`, read without synchronization.
+LoggingSeverity g_min_stream_sev = LS_NONE;
+
+std::atomic<bool> g_async_logging = {false};
+
+struct AsyncLogEntry {
+  LogLineRef line;
+#if defined(WEBRTC_ANDROID)
+  // Owns the tag, which may not outlive the LogMessage.
+  std::string tag;
+#endif
+};
+
+// The log lines of one thread while async logging is enabled. That thread is
+// the only producer and DrainAsyncLogs the only consumer, so no locks are
+// needed.
+class AsyncLogRing {
+ public:
+  explicit AsyncLogRing(size_t lines)
+      : entries_(RoundUpToPowerOfTwo(lines)), mask_(entries_.size() - 1) {}
+
+  // Returns the entry to fill in, followed by EndPush(), or nullptr if the
+  // ring is full, in which case the line is counted as dropped.
+  AsyncLogEntry* BeginPush() {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) > mask_) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &entries_[head & mask_];
+  }
+  void EndPush() {
+    head_.store(head_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+  }
+
+  // Returns the oldest entry, followed by PopFront(), or nullptr if the ring
+  // is empty.
+  AsyncLogEntry* Front() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &entries_[tail & mask_];
+  }
+  void PopFront() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    // Free the message on this thread rather than on the logging thread.
+    entries_[tail & mask_] = AsyncLogEntry();
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+  // Set when the thread owning the ring has ended. The ring is freed once it
+  // is empty.
+  std::atomic<bool> thread_exited = {false};
+  // Number of dropped lines already reported to the streams.
+  uint64_t reported_dropped = 0;
+
+ private:
+  static size_t RoundUpToPowerOfTwo(size_t n) {
+    size_t power = 1;
+    while (power < n) {
+      power <<= 1;
+    }
+    return power;
+  }
+
+  std::vector<AsyncLogEntry> entries_;
+  const uint64_t mask_;
+  // Written by the producer and the consumer respectively.
+  alignas(64) std::atomic<uint64_t> head_ = {0};
+  alignas(64) std::atomic<uint64_t> tail_ = {0};
+  std::atomic<uint64_t> dropped_ = {0};
+};
+
+struct AsyncLogRings {
+  // Serializes DrainAsyncLogs, which is the only place rings are freed.
+  webrtc::Mutex drain_lock;
+  std::vector<AsyncLogRing*> draining RTC_GUARDED_BY(drain_lock);
+
+  webrtc::Mutex lock;
+  std::vector<std::unique_ptr<AsyncLogRing>> rings RTC_GUARDED_BY(lock);
+  size_t lines_per_thread RTC_GUARDED_BY(lock) = 1024;
+  // Lines dropped by rings that have been freed.
+  uint64_t freed_dropped RTC_GUARDED_BY(lock) = 0;
+};
+
+AsyncLogRings& GetAsyncLogRings() {
+  static AsyncLogRings& rings = *new AsyncLogRings();
+  return rings;
+}
+
+// Creates the ring of the current thread on first use and marks it when the
+// thread ends.
+class ThreadAsyncLogRing {
+ public:
+  constexpr ThreadAsyncLogRing() = default;
+  ~ThreadAsyncLogRing() {
+    if (ring_ != nullptr) {
+      ring_->thread_exited.store(true, std::memory_order_release);
+    }
+    destroyed_ = true;
+  }
+
+  // Returns nullptr if called while the thread is ending.
+  AsyncLogRing* Get() {
+    if (destroyed_) {
+      return nullptr;
+    }
+    if (ring_ == nullptr) {
+      AsyncLogRings& rings = GetAsyncLogRings();
+      webrtc::MutexLock lock(&rings.lock);
+      rings.rings.push_back(
+          std::make_unique<AsyncLogRing>(rings.lines_per_thread));
+      ring_ = rings.rings.back().get();
+    }
+    return ring_;
+  }
+
+ private:
+  AsyncLogRing* ring_ = nullptr;
+  bool destroyed_ = false;
+};
+
+ABSL_CONST_INIT thread_local ThreadAsyncLogRing g_thread_async_log_ring;
+
 }  // namespace
 
 std::string LogLineRef::DefaultLogLine() const {
@@ -212,14 +345,42 @@ LogMessage::~LogMessage() {
     OutputToDebug(log_line_);
   }
 
+  if (g_async_logging.load(std::memory_order_relaxed) &&
+      log_line_.severity() >= g_min_stream_sev && PushAsync()) {
+    return;
+  }
+
   webrtc::MutexLock lock(&GetLoggingLock());
+  DeliverToStreams(log_line_);
+}
+
+void LogMessage::DeliverToStreams(const LogLineRef& log_line)
+    RTC_EXCLUSIVE_LOCKS_REQUIRED(GetLoggingLock()) {
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
-    if (log_line_.severity() >= entry->min_severity_) {
-      entry->OnLogMessage(log_line_);
+    if (log_line.severity() >= entry->min_severity_) {
+      entry->OnLogMessage(log_line);
     }
   }
 }
 
+bool LogMessage::PushAsync() {
+  AsyncLogRing* ring = g_thread_async_log_ring.Get();
+  if (ring == nullptr) {
+    return false;
+  }
+  AsyncLogEntry* entry = ring->BeginPush();
+  if (entry == nullptr) {
+    return true;
+  }
+#if defined(WEBRTC_ANDROID)
+  entry->tag = std::string(log_line_.tag());
+  log_line_.set_tag(entry->tag);
+#endif
+  entry->line = std::move(log_line_);
+  ring->EndPush();
+  return true;
+}
+
 void LogMessage::AddTag([[maybe_unused]] const char* tag) {
 #ifdef WEBRTC_ANDROID
   log_line_.set_tag(tag);
@@ -298,6 +459,90 @@ void LogMessage::RemoveLogToStream(LogSink* stream) {
   UpdateMinLogSeverity();
 }
 
+void LogMessage::SetAsyncLogging(bool enabled, size_t lines_per_thread) {
+  RTC_DCHECK_GT(lines_per_thread, 0);
+  {
+    AsyncLogRings& rings = GetAsyncLogRings();
+    webrtc::MutexLock lock(&rings.lock);
+    rings.lines_per_thread = lines_per_thread;
+  }
+  g_async_logging.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    DrainAsyncLogs();
+  }
+}
+
+bool LogMessage::IsAsyncLogging() {
+  return g_async_logging.load(std::memory_order_relaxed);
+}
+
+size_t LogMessage::DrainAsyncLogs() {
+  AsyncLogRings& rings = GetAsyncLogRings();
+  webrtc::MutexLock drain_lock(&rings.drain_lock);
+  {
+    webrtc::MutexLock lock(&rings.lock);
+    rings.draining.clear();
+    for (const std::unique_ptr<AsyncLogRing>& ring : rings.rings) {
+      rings.draining.push_back(ring.get());
+    }
+  }
+
+  size_t num_delivered = 0;
+  bool thread_exited = false;
+  {
+    webrtc::MutexLock lock(&GetLoggingLock());
+    for (AsyncLogRing* ring : rings.draining) {
+      thread_exited |= ring->thread_exited.load(std::memory_order_acquire);
+      while (AsyncLogEntry* entry = ring->Front()) {
+#if defined(WEBRTC_ANDROID)
+        entry->line.set_tag(entry->tag);
+#endif
+        DeliverToStreams(entry->line);
+        ring->PopFront();
+        ++num_delivered;
+      }
+      const uint64_t dropped = ring->dropped();
+      if (dropped != ring->reported_dropped) {
+        LogLineRef warning;
+        warning.set_severity(LS_WARNING);
+        warning.set_message("Dropped " +
+                            std::to_string(dropped - ring->reported_dropped) +
+                            " log lines because the async log buffer of a "
+                            "thread was full.\n");
+        DeliverToStreams(warning);
+        ring->reported_dropped = dropped;
+      }
+    }
+  }
+
+  if (thread_exited) {
+    webrtc::MutexLock lock(&rings.lock);
+    // A ring can't get new lines once its thread has ended.
+    for (size_t i = 0; i < rings.rings.size();) {
+      AsyncLogRing& ring = *rings.rings[i];
+      if (ring.thread_exited.load(std::memory_order_acquire) &&
+          ring.Front() == nullptr && ring.dropped() == ring.reported_dropped) {
+        rings.freed_dropped += ring.dropped();
+        rings.rings[i] = std::move(rings.rings.back());
+        rings.rings.pop_back();
+      } else {
+        ++i;
+      }
+    }
+  }
+  return num_delivered;
+}
+
+uint64_t LogMessage::GetDroppedAsyncLogCount() {
+  AsyncLogRings& rings = GetAsyncLogRings();
+  webrtc::MutexLock lock(&rings.lock);
+  uint64_t dropped = rings.freed_dropped;
+  for (const std::unique_ptr<AsyncLogRing>& ring : rings.rings) {
+    dropped += ring->dropped();
+  }
+  return dropped;
+}
+
 void LogMessage::ConfigureLogging(absl::string_view params) {
   LoggingSeverity current_level = LS_VERBOSE;
   LoggingSeverity debug_level = GetLogToDebug();
@@ -349,11 +594,12 @@ void LogMessage::ConfigureLogging(absl::string_view params) {
 
 void LogMessage::UpdateMinLogSeverity()
     RTC_EXCLUSIVE_LOCKS_REQUIRED(GetLoggingLock()) {
-  LoggingSeverity min_sev = g_dbg_sev;
+  LoggingSeverity min_stream_sev = LS_NONE;
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
-    min_sev = std::min(min_sev, entry->min_severity_);
+    min_stream_sev = std::min(min_stream_sev, entry->min_severity_);
   }
-  g_min_sev = min_sev;
+  g_min_stream_sev = min_stream_sev;
+  g_min_sev = std::min(g_dbg_sev, min_stream_sev);
 }
 
 void LogMessage::OutputToDebug(const LogLineRef& log_line) {
@@ -49,6 +49,8 @@
 #define RTC_BASE_LOGGING_H_
 
 #include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <optional>
@@ -519,6 +521,23 @@ class LogMessage {
   RTC_NO_INLINE static bool IsNoop() {
     return IsNoop(S);
   }
+  // Async logging: while enabled, log lines for the streams added with
+  // AddLogToStream are not delivered under the global logging lock. Instead
+  // every thread appends them to a lock-free ring buffer of its own, and
+  // DrainAsyncLogs delivers them later, typically from the thread of an
+  // AsyncLogWriter. A ring holds `lines_per_thread` lines (rounded up to a
+  // power of two) if it is created, on the first line of its thread, after
+  // this call. Lines logged while the ring of the thread is full are dropped
+  // and counted. The lines of a thread are delivered in order, the lines of
+  // different threads may be reordered. Debug output is not affected.
+  // Disabling delivers the pending lines.
+  static void SetAsyncLogging(bool enabled, size_t lines_per_thread = 1024);
+  static bool IsAsyncLogging();
+  // Delivers the lines buffered by async logging to the streams and returns
+  // their number.
+  static size_t DrainAsyncLogs();
+  // Returns the total number of lines dropped because a ring was full.
+  static uint64_t GetDroppedAsyncLogCount();
 #else
   // Next methods do nothing; no one will call these functions.
   LogMessage(const char* file, int line, LoggingSeverity sev) {}
@@ -554,6 +573,11 @@ class LogMessage {
   static constexpr bool IsNoop() {
     return IsNoop(S);
   }
+  inline static void SetAsyncLogging(bool enabled,
+                                     size_t lines_per_thread = 1024) {}
+  inline static bool IsAsyncLogging() { return false; }
+  inline static size_t DrainAsyncLogs() { return 0; }
+  inline static uint64_t GetDroppedAsyncLogCount() { return 0; }
 #endif  // RTC_LOG_ENABLED()
 
  private:
@@ -566,6 +590,14 @@ class LogMessage {
   // This writes out the actual log messages.
   static void OutputToDebug(const LogLineRef& log_line_ref);
 
+  // Passes the log line to the streams that want it. Must be called with the
+  // global logging lock held.
+  static void DeliverToStreams(const LogLineRef& log_line);
+
+  // Hands the log line to the ring of the current thread. Returns false if
+  // the line must be delivered synchronously instead.
+  bool PushAsync();
+
   // Called from the dtor (or from a test) to append optional extra error
   // information to the log stream and a newline character.
   void FinishPrintStream();
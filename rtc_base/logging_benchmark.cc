@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "rtc_base/async_log_writer.h"
+#include "rtc_base/logging.h"
+
+namespace rtc {
+namespace {
+
+// Does as little as possible per line, so that the benchmark measures the
+// cost of the logging call and of the dispatch to the sink.
+class CountingLogSink : public LogSink {
+ public:
+  void OnLogMessage(const std::string& message) override { ++num_lines_; }
+  void OnLogMessage(const LogLineRef& line) override { ++num_lines_; }
+
+  int64_t num_lines() const { return num_lines_; }
+
+ private:
+  int64_t num_lines_ = 0;
+};
+
+// Set up and torn down by the first benchmark thread, while the others wait
+// at the start and end of the benchmark loop.
+CountingLogSink* g_sink = nullptr;
+AsyncLogWriter* g_writer = nullptr;
+LoggingSeverity g_debug_severity = LS_NONE;
+uint64_t g_dropped_before = 0;
+
+// Logs one line per iteration from `state.threads()` threads, synchronously
+// or with an AsyncLogWriter. Reports the number of lines delivered to the
+// sink and the number that async logging dropped because a ring was full.
+void BM_LogCall(benchmark::State& state) {
+  const bool async = state.range(0);
+  if (state.thread_index() == 0) {
+    // Keep the lines off stderr.
+    g_debug_severity = LogMessage::GetLogToDebug();
+    LogMessage::LogToDebug(LS_NONE);
+    g_sink = new CountingLogSink();
+    LogMessage::AddLogToStream(g_sink, LS_INFO);
+    g_dropped_before = LogMessage::GetDroppedAsyncLogCount();
+    if (async) {
+      g_writer = new AsyncLogWriter();
+    }
+  }
+
+  int line = 0;
+  for (auto _ : state) {
+    RTC_LOG(LS_INFO) << "Benchmark line " << ++line << " of thread "
+                     << state.thread_index();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) {
+    delete g_writer;
+    g_writer = nullptr;
+    state.counters["delivered"] = static_cast<double>(g_sink->num_lines());
+    state.counters["dropped"] = static_cast<double>(
+        LogMessage::GetDroppedAsyncLogCount() - g_dropped_before);
+    LogMessage::RemoveLogToStream(g_sink);
+    delete g_sink;
+    g_sink = nullptr;
+    LogMessage::LogToDebug(g_debug_severity);
+  }
+}
+
+BENCHMARK(BM_LogCall)
+    ->ArgName("async")
+    ->Arg(0)
+    ->Arg(1)
+    ->Threads(1)
+    ->Threads(8)
+    ->Threads(32)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace rtc
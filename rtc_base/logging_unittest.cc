@@ -412,5 +412,57 @@ TEST(LogTest, EnumSupportsAbslStringify) {
   LogMessage::RemoveLogToStream(&stream);
 }
 
+TEST(LogTest, AsyncLoggingDeliversLinesWhenDrained) {
+  std::string str;
+  LogSinkImpl stream(&str);
+  LogMessage::AddLogToStream(&stream, LS_INFO);
+  LogMessage::SetAsyncLogging(true);
+
+  RTC_LOG(LS_INFO) << "first";
+  RTC_LOG(LS_VERBOSE) << "VERBOSE";
+  RTC_LOG(LS_INFO) << "second";
+  EXPECT_EQ(str, "");
+
+  EXPECT_EQ(LogMessage::DrainAsyncLogs(), 2u);
+  EXPECT_THAT(str, HasSubstr("first"));
+  EXPECT_LT(str.find("first"), str.find("second"));
+  EXPECT_THAT(str, Not(HasSubstr("VERBOSE")));
+
+  // Disabling delivers the pending lines.
+  RTC_LOG(LS_INFO) << "third";
+  LogMessage::SetAsyncLogging(false);
+  EXPECT_THAT(str, HasSubstr("third"));
+
+  LogMessage::RemoveLogToStream(&stream);
+}
+
+TEST(LogTest, AsyncLoggingDropsLinesWhenRingIsFull) {
+  std::string str;
+  LogSinkImpl stream(&str);
+  LogMessage::AddLogToStream(&stream, LS_INFO);
+  LogMessage::SetAsyncLogging(true, /*lines_per_thread=*/4);
+  const uint64_t dropped = LogMessage::GetDroppedAsyncLogCount();
+
+  // A new thread gets a ring of the requested size.
+  PlatformThread::SpawnJoinable(
+      [] {
+        for (int i = 0; i < 10; ++i) {
+          RTC_LOG(LS_INFO) << "line " << i;
+        }
+      },
+      "LogThread");
+  EXPECT_EQ(LogMessage::GetDroppedAsyncLogCount(), dropped + 6);
+
+  EXPECT_EQ(LogMessage::DrainAsyncLogs(), 4u);
+  EXPECT_THAT(str, HasSubstr("line 3"));
+  EXPECT_THAT(str, Not(HasSubstr("line 4")));
+  EXPECT_THAT(str, HasSubstr("Dropped 6 log lines"));
+  // The count survives the ring of the ended thread.
+  EXPECT_EQ(LogMessage::GetDroppedAsyncLogCount(), dropped + 6);
+
+  LogMessage::SetAsyncLogging(false);
+  LogMessage::RemoveLogToStream(&stream);
+}
+
 }  // namespace rtc
 #endif  // RTC_LOG_ENABLED()
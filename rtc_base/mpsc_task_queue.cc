@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/mpsc_task_queue.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace webrtc {
+namespace {
+
+// Orders the heap of delayed tasks so that the earliest run time, and for
+// equal run times the earliest posted task, is at the front.
+template <typename Node>
+bool RunsLater(const Node* a, const Node* b) {
+  if (a->run_time != b->run_time) {
+    return a->run_time > b->run_time;
+  }
+  return a->order > b->order;
+}
+
+}  // namespace
+
+MpscTaskQueue::MpscTaskQueue() : head_(&stub_), tail_(&stub_) {}
+
+MpscTaskQueue::~MpscTaskQueue() {
+  Clear();
+}
+
+void MpscTaskQueue::Post(absl::AnyInvocable<void() &&> task) {
+  Node* node = new Node;
+  node->task = std::move(task);
+  size_.fetch_add(1, std::memory_order_relaxed);
+  Push(node);
+}
+
+void MpscTaskQueue::PostDelayed(absl::AnyInvocable<void() &&> task,
+                                Timestamp run_time) {
+  Node* node = new Node;
+  node->task = std::move(task);
+  node->run_time = run_time;
+  size_.fetch_add(1, std::memory_order_relaxed);
+  Push(node);
+}
+
+absl::AnyInvocable<void() &&> MpscTaskQueue::Pop(Timestamp now) {
+  DrainIncoming();
+  while (!delayed_.empty() && delayed_.front()->run_time <= now) {
+    std::pop_heap(delayed_.begin(), delayed_.end(), RunsLater<Node>);
+    PushReady(delayed_.back());
+    delayed_.pop_back();
+  }
+  if (ready_head_ == nullptr) {
+    return nullptr;
+  }
+  Node* node = ready_head_;
+  ready_head_ = node->next.load(std::memory_order_relaxed);
+  if (ready_head_ == nullptr) {
+    ready_tail_ = nullptr;
+  }
+  absl::AnyInvocable<void() &&> task = std::move(node->task);
+  delete node;
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  return task;
+}
+
+Timestamp MpscTaskQueue::NextRunTime() {
+  DrainIncoming();
+  if (ready_head_ != nullptr) {
+    return Timestamp::MinusInfinity();
+  }
+  if (!delayed_.empty()) {
+    return delayed_.front()->run_time;
+  }
+  return Timestamp::PlusInfinity();
+}
+
+void MpscTaskQueue::Clear() {
+  DrainIncoming();
+  // Tasks may post new tasks when destroyed, so unlink everything before
+  // deleting anything.
+  Node* ready = ready_head_;
+  ready_head_ = nullptr;
+  ready_tail_ = nullptr;
+  std::vector<Node*> delayed = std::move(delayed_);
+  delayed_.clear();
+  size_t cleared = delayed.size();
+  while (ready != nullptr) {
+    Node* next = ready->next.load(std::memory_order_relaxed);
+    delete ready;
+    ready = next;
+    ++cleared;
+  }
+  for (Node* node : delayed) {
+    delete node;
+  }
+  size_.fetch_sub(cleared, std::memory_order_relaxed);
+}
+
+void MpscTaskQueue::Push(Node* node) {
+  node->next.store(nullptr, std::memory_order_relaxed);
+  Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+  // Between the exchange and this store the list is temporarily broken;
+  // PopIncoming() treats that as empty and the node is picked up on the next
+  // drain.
+  prev->next.store(node, std::memory_order_release);
+}
+
+MpscTaskQueue::Node* MpscTaskQueue::PopIncoming() {
+  Node* tail = tail_;
+  Node* next = tail->next.load(std::memory_order_acquire);
+  if (tail == &stub_) {
+    if (next == nullptr) {
+      return nullptr;
+    }
+    tail_ = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+  if (next != nullptr) {
+    tail_ = next;
+    return tail;
+  }
+  if (tail != head_.load(std::memory_order_acquire)) {
+    // A producer is in the middle of Push().
+    return nullptr;
+  }
+  // `tail` is the last node. Put the stub back behind it so that it can be
+  // unlinked without racing with producers.
+  Push(&stub_);
+  next = tail->next.load(std::memory_order_acquire);
+  if (next != nullptr) {
+    tail_ = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+void MpscTaskQueue::DrainIncoming() {
+  while (Node* node = PopIncoming()) {
+    node->order = next_order_++;
+    if (node->run_time.IsFinite()) {
+      delayed_.push_back(node);
+      std::push_heap(delayed_.begin(), delayed_.end(), RunsLater<Node>);
+    } else {
+      PushReady(node);
+    }
+  }
+}
+
+void MpscTaskQueue::PushReady(Node* node) {
+  node->next.store(nullptr, std::memory_order_relaxed);
+  if (ready_tail_ == nullptr) {
+    ready_head_ = node;
+  } else {
+    ready_tail_->next.store(node, std::memory_order_relaxed);
+  }
+  ready_tail_ = node;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_MPSC_TASK_QUEUE_H_
+#define RTC_BASE_MPSC_TASK_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/units/timestamp.h"
+
+namespace webrtc {
+
+// Queue of tasks that any number of threads can post to without taking a
+// lock, and that is consumed by a single thread at a time.
+//
+// Posted tasks are linked into an intrusive multi-producer single-consumer
+// list (D. Vyukov's design), where posting is a single atomic exchange. The
+// consumer moves them into a FIFO of ready tasks and a timer heap of delayed
+// tasks, neither of which needs synchronization.
+//
+// Ready tasks are returned in posting order. A delayed task is appended to the
+// ready tasks once its run time has been reached; delayed tasks with the same
+// run time become ready in posting order.
+class MpscTaskQueue {
+ public:
+  MpscTaskQueue();
+  MpscTaskQueue(const MpscTaskQueue&) = delete;
+  MpscTaskQueue& operator=(const MpscTaskQueue&) = delete;
+  ~MpscTaskQueue();
+
+  // May be called from any thread.
+  void Post(absl::AnyInvocable<void() &&> task);
+  void PostDelayed(absl::AnyInvocable<void() &&> task, Timestamp run_time);
+
+  // Number of pending tasks, including delayed tasks. May be called from any
+  // thread, but is only a snapshot.
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Returns the next task that is ready at `now`, or an empty task if there is
+  // none. Consumer only.
+  absl::AnyInvocable<void() &&> Pop(Timestamp now);
+
+  // Returns Timestamp::MinusInfinity() if a task is ready, the earliest run
+  // time of the delayed tasks if there are only delayed tasks and
+  // Timestamp::PlusInfinity() if the queue is empty. Consumer only.
+  Timestamp NextRunTime();
+
+  // Destroys all pending tasks. Consumer only.
+  void Clear();
+
+ private:
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    absl::AnyInvocable<void() &&> task;
+    Timestamp run_time = Timestamp::MinusInfinity();
+    uint64_t order = 0;
+  };
+
+  void Push(Node* node);
+  // Returns the oldest node posted by producers, or nullptr if there is none,
+  // or if the producer posting it has not yet finished doing so.
+  Node* PopIncoming();
+  // Moves all posted nodes to `ready_head_` or `delayed_`.
+  void DrainIncoming();
+  void PushReady(Node* node);
+
+  // Producers exchange `head_`, the consumer pops from `tail_`. `stub_` is a
+  // placeholder node that keeps the list non-empty.
+  std::atomic<Node*> head_;
+  Node* tail_;
+  Node stub_;
+
+  std::atomic<size_t> size_{0};
+
+  // Consumer side state.
+  Node* ready_head_ = nullptr;
+  Node* ready_tail_ = nullptr;
+  // Min-heap on (run_time, order).
+  std::vector<Node*> delayed_;
+  uint64_t next_order_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_MPSC_TASK_QUEUE_H_
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/mpsc_task_queue.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/platform_thread.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+constexpr Timestamp kNow = Timestamp::Seconds(100);
+
+std::vector<int> RunReady(MpscTaskQueue& queue,
+                          Timestamp now,
+                          std::vector<int>& log) {
+  while (absl::AnyInvocable<void() &&> task = queue.Pop(now)) {
+    std::move(task)();
+  }
+  return log;
+}
+
+TEST(MpscTaskQueueTest, EmptyQueue) {
+  MpscTaskQueue queue;
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_FALSE(queue.Pop(kNow));
+  EXPECT_EQ(queue.NextRunTime(), Timestamp::PlusInfinity());
+}
+
+TEST(MpscTaskQueueTest, RunsPostedTasksInOrder) {
+  MpscTaskQueue queue;
+  std::vector<int> log;
+  for (int i = 0; i < 5; ++i) {
+    queue.Post([&log, i] { log.push_back(i); });
+  }
+  EXPECT_EQ(queue.size(), 5u);
+  EXPECT_EQ(queue.NextRunTime(), Timestamp::MinusInfinity());
+  EXPECT_THAT(RunReady(queue, kNow, log), ElementsAre(0, 1, 2, 3, 4));
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(MpscTaskQueueTest, HoldsDelayedTasksUntilRunTime) {
+  MpscTaskQueue queue;
+  std::vector<int> log;
+  queue.PostDelayed([&log] { log.push_back(2); }, kNow + TimeDelta::Millis(20));
+  queue.PostDelayed([&log] { log.push_back(1); }, kNow + TimeDelta::Millis(10));
+  queue.PostDelayed([&log] { log.push_back(3); }, kNow + TimeDelta::Millis(20));
+
+  EXPECT_EQ(queue.NextRunTime(), kNow + TimeDelta::Millis(10));
+  EXPECT_THAT(RunReady(queue, kNow, log), IsEmpty());
+  EXPECT_EQ(queue.size(), 3u);
+
+  EXPECT_THAT(RunReady(queue, kNow + TimeDelta::Millis(10), log),
+              ElementsAre(1));
+  EXPECT_EQ(queue.NextRunTime(), kNow + TimeDelta::Millis(20));
+  // Delayed tasks with the same run time run in posting order.
+  EXPECT_THAT(RunReady(queue, kNow + TimeDelta::Millis(30), log),
+              ElementsAre(1, 2, 3));
+  EXPECT_EQ(queue.NextRunTime(), Timestamp::PlusInfinity());
+}
+
+TEST(MpscTaskQueueTest, TriggeredDelayedTasksRunAfterPostedTasks) {
+  MpscTaskQueue queue;
+  std::vector<int> log;
+  queue.PostDelayed([&log] { log.push_back(2); }, kNow);
+  queue.Post([&log] { log.push_back(1); });
+  EXPECT_THAT(RunReady(queue, kNow, log), ElementsAre(1, 2));
+}
+
+TEST(MpscTaskQueueTest, ClearDestroysPendingTasks) {
+  MpscTaskQueue queue;
+  auto alive = std::make_shared<int>(0);
+  queue.Post([alive] {});
+  queue.PostDelayed([alive] {}, kNow);
+  EXPECT_EQ(alive.use_count(), 3);
+  queue.Clear();
+  EXPECT_EQ(alive.use_count(), 1);
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_FALSE(queue.Pop(Timestamp::PlusInfinity()));
+}
+
+TEST(MpscTaskQueueTest, KeepsPerProducerOrderWithConcurrentProducers) {
+  constexpr int kProducers = 4;
+  constexpr int kTasksPerProducer = 10000;
+  MpscTaskQueue queue;
+  std::vector<int> next(kProducers, 0);
+  bool in_order = true;
+
+  std::vector<rtc::PlatformThread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.push_back(rtc::PlatformThread::SpawnJoinable(
+        [&, p] {
+          for (int i = 0; i < kTasksPerProducer; ++i) {
+            queue.Post([&, p, i] {
+              in_order &= next[p] == i;
+              ++next[p];
+            });
+          }
+        },
+        "producer"));
+  }
+
+  int ran = 0;
+  while (ran < kProducers * kTasksPerProducer) {
+    if (absl::AnyInvocable<void() &&> task = queue.Pop(kNow)) {
+      std::move(task)();
+      ++ran;
+    }
+  }
+  producers.clear();
+
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_EQ(queue.NextRunTime(), Timestamp::PlusInfinity());
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -30,8 +30,10 @@ ReceivedPacket::ReceivedPacket(rtc::ArrayView<const uint8_t> payload,
 
 ReceivedPacket ReceivedPacket::CopyAndSet(
     DecryptionInfo decryption_info) const {
-  return ReceivedPacket(payload_, source_address_, arrival_time_, ecn_,
+  ReceivedPacket packet(payload_, source_address_, arrival_time_, ecn_,
                         decryption_info);
+  packet.set_more_packets_follow(more_packets_follow_);
+  return packet;
 }
 
 // static
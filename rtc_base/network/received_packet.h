@@ -59,6 +59,14 @@ class RTC_EXPORT ReceivedPacket {
 
   const DecryptionInfo& decryption_info() const { return decryption_info_; }
 
+  // True if the socket read that produced this packet also produced further
+  // packets, which are delivered right after this one. Receivers may hold
+  // this packet to process the packets of one read together.
+  bool more_packets_follow() const { return more_packets_follow_; }
+  void set_more_packets_follow(bool more_packets_follow) {
+    more_packets_follow_ = more_packets_follow;
+  }
+
   static ReceivedPacket CreateFromLegacy(
       const char* data,
       size_t size,
@@ -80,6 +88,7 @@ class RTC_EXPORT ReceivedPacket {
   const SocketAddress& source_address_;
   EcnMarking ecn_;
   DecryptionInfo decryption_info_;
+  bool more_packets_follow_ = false;
 };
 
 }  // namespace rtc
@@ -9,6 +9,7 @@
  */
 #include "rtc_base/physical_socket_server.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -57,6 +58,7 @@
 
 #if defined(WEBRTC_LINUX)
 #include <linux/sockios.h>
+#include <netinet/udp.h>
 #endif
 
 #if defined(WEBRTC_WIN)
@@ -107,6 +109,14 @@ typedef char* SockOptArg;
 #if !defined(EPOLLRDHUP)
 #define EPOLLRDHUP 0x2000
 #endif  // !defined(EPOLLRDHUP)
+// UDP_SEGMENT and UDP_GRO are only defined in netinet/udp.h starting with
+// glibc 2.31.
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif  // !defined(UDP_SEGMENT)
+#if !defined(UDP_GRO)
+#define UDP_GRO 104
+#endif  // !defined(UDP_GRO)
 #endif  // defined(WEBRTC_LINUX)
 
 namespace {
@@ -135,6 +145,77 @@ rtc::EcnMarking EcnFromDs(uint8_t ds) {
   return rtc::EcnMarking::kNotEct;
 }
 
+// TODO(bugs.webrtc.org/15368): What size is needed? IPV6_TCLASS is supposed
+// to be an int. Why is a larger size needed?
+constexpr size_t kControlBufferSize =
+    CMSG_SPACE(sizeof(struct timeval) + 5 * sizeof(int)) +
+    CMSG_SPACE(sizeof(int));
+
+// Reads the receive timestamp, ECN marking and UDP GRO segment size from the
+// ancillary data of `msg`. Any of the output parameters may be null.
+void ParseControlMessages(msghdr* msg,
+                          int64_t* timestamp,
+                          rtc::EcnMarking* ecn,
+                          size_t* segment_size) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg;
+       cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (ecn) {
+      if ((cmsg->cmsg_type == IPV6_TCLASS &&
+           cmsg->cmsg_level == IPPROTO_IPV6) ||
+          (cmsg->cmsg_type == IP_TOS && cmsg->cmsg_level == IPPROTO_IP)) {
+        *ecn = EcnFromDs(CMSG_DATA(cmsg)[0]);
+      }
+    }
+#if defined(WEBRTC_LINUX)
+    if (segment_size && cmsg->cmsg_level == IPPROTO_UDP &&
+        cmsg->cmsg_type == UDP_GRO) {
+      int gso_size = 0;
+      std::memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+      *segment_size = gso_size > 0 ? static_cast<size_t>(gso_size) : 0;
+    }
+#endif
+    if (cmsg->cmsg_level != SOL_SOCKET)
+      continue;
+    if (timestamp && cmsg->cmsg_type == SCM_TIMESTAMP) {
+      timeval ts;
+      std::memcpy(static_cast<void*>(&ts), CMSG_DATA(cmsg), sizeof(ts));
+      *timestamp = rtc::kNumMicrosecsPerSec * static_cast<int64_t>(ts.tv_sec) +
+                   static_cast<int64_t>(ts.tv_usec);
+    }
+  }
+}
+
+#endif
+
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+
+// The kernel limits the number of segments of a single GSO send, see
+// UDP_MAX_SEGMENTS in include/linux/udp.h.
+constexpr size_t kMaxGsoSegments = 64;
+// Maximum UDP payload of a single GSO send.
+constexpr size_t kMaxGsoPayloadSize = 65000;
+
+// UDP GSO splits the payload of a single send into datagrams of equal size,
+// where only the last datagram may be shorter. Returns how many of the leading
+// `packets` can be sent with a single GSO send, or zero if GSO does not help.
+size_t GsoBatchLength(
+    rtc::ArrayView<const rtc::ArrayView<const uint8_t>> packets) {
+  if (packets.size() <= 1 || packets[0].empty()) {
+    return 0;
+  }
+  const size_t segment_size = packets[0].size();
+  const size_t max_length =
+      std::min({packets.size(), kMaxGsoSegments,
+                std::max<size_t>(kMaxGsoPayloadSize / segment_size, 1)});
+  size_t length = 1;
+  while (length < max_length && packets[length].size() <= segment_size) {
+    if (packets[length++].size() < segment_size) {
+      break;
+    }
+  }
+  return length > 1 ? length : 0;
+}
+
 #endif
 
 class ScopedSetTrue {
@@ -370,6 +451,8 @@ int PhysicalSocket::SetOption(Option opt, int value) {
   } else if (opt == OPT_SEND_ECN) {
     ecn_ = value;
     value = dscp_ + (ecn_ & kEcnMask);
+  } else if (opt == OPT_UDP_GRO) {
+    gro_enabled_ = value != 0;
   }
 #if defined(WEBRTC_POSIX)
   if (sopt == IPV6_TCLASS) {
@@ -437,6 +520,103 @@ int PhysicalSocket::SendTo(const void* buffer,
   return sent;
 }
 
+int PhysicalSocket::SendToBatch(
+    ArrayView<const ArrayView<const uint8_t>> packets,
+    const SocketAddress& addr) {
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  if (!udp_ || packets.size() <= 1) {
+    return Socket::SendToBatch(packets, addr);
+  }
+  sockaddr_storage saddr;
+  socklen_t saddr_len = addr.ToSockAddrStorage(&saddr);
+  size_t total_sent = 0;
+  while (total_sent < packets.size()) {
+    ArrayView<const ArrayView<const uint8_t>> remaining =
+        packets.subview(total_sent);
+    size_t gso_length = gso_supported_ ? GsoBatchLength(remaining) : 0;
+    ArrayView<const ArrayView<const uint8_t>> chunk = remaining.subview(
+        0, gso_length > 0 ? gso_length
+                          : std::min(remaining.size(), kMaxSendBatchSize));
+    int sent = -1;
+    if (gso_length > 0) {
+      sent = DoSendToWithGso(chunk, saddr, saddr_len);
+      if (sent < 0 && (errno == EIO || errno == EINVAL)) {
+        // GSO is not supported by the kernel or the egress device, fall back
+        // to sendmmsg() from now on.
+        RTC_LOG(LS_INFO) << "UDP GSO send failed, disabling GSO.";
+        gso_supported_ = false;
+        gso_length = 0;
+      }
+    }
+    if (gso_length == 0) {
+      mmsghdr msgs[kMaxSendBatchSize];
+      iovec iovs[kMaxSendBatchSize];
+      std::memset(msgs, 0, chunk.size() * sizeof(msgs[0]));
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        iovs[i] = {.iov_base = const_cast<uint8_t*>(chunk[i].data()),
+                   .iov_len = chunk[i].size()};
+        msgs[i].msg_hdr.msg_name = &saddr;
+        msgs[i].msg_hdr.msg_namelen = saddr_len;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+      }
+      // Suppress SIGPIPE. See PhysicalSocket::Send for explanation.
+      sent = ::sendmmsg(s_, msgs, chunk.size(), MSG_NOSIGNAL);
+    }
+    UpdateLastError();
+    MaybeRemapSendError();
+    if (sent < static_cast<int>(chunk.size())) {
+      if (sent >= 0 || IsBlockingError(GetError())) {
+        EnableEvents(DE_WRITE);
+      }
+      if (sent <= 0) {
+        return total_sent > 0 ? static_cast<int>(total_sent) : -1;
+      }
+      return static_cast<int>(total_sent) + sent;
+    }
+    total_sent += sent;
+  }
+  return static_cast<int>(total_sent);
+#else
+  return Socket::SendToBatch(packets, addr);
+#endif
+}
+
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+int PhysicalSocket::DoSendToWithGso(
+    ArrayView<const ArrayView<const uint8_t>> packets,
+    const sockaddr_storage& addr,
+    socklen_t addr_len) {
+  iovec iovs[kMaxSendBatchSize];
+  size_t total_size = 0;
+  for (size_t i = 0; i < packets.size(); ++i) {
+    iovs[i] = {.iov_base = const_cast<uint8_t*>(packets[i].data()),
+               .iov_len = packets[i].size()};
+    total_size += packets[i].size();
+  }
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+  msghdr msg = {};
+  msg.msg_name = const_cast<sockaddr_storage*>(&addr);
+  msg.msg_namelen = addr_len;
+  msg.msg_iov = iovs;
+  msg.msg_iovlen = packets.size();
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = IPPROTO_UDP;
+  cmsg->cmsg_type = UDP_SEGMENT;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  const uint16_t segment_size = static_cast<uint16_t>(packets[0].size());
+  std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+  int sent = ::sendmsg(s_, &msg, MSG_NOSIGNAL);
+  if (sent < 0) {
+    return sent;
+  }
+  RTC_DCHECK_EQ(static_cast<size_t>(sent), total_size);
+  return static_cast<int>(packets.size());
+}
+#endif
+
 int PhysicalSocket::Recv(void* buffer, size_t length, int64_t* timestamp) {
   int received = DoReadFromSocket(buffer, length, /*out_addr*/ nullptr,
                                   timestamp, /*ecn=*/nullptr);
@@ -489,7 +669,8 @@ int PhysicalSocket::RecvFrom(ReceiveBuffer& buffer) {
 
   int received = DoReadFromSocket(
       buffer.payload.data(), buffer.payload.capacity(), &buffer.source_address,
-      &timestamp, ecn_ ? &buffer.ecn : nullptr);
+      &timestamp, ecn_ ? &buffer.ecn : nullptr,
+      gro_enabled_ ? &buffer.segment_size : nullptr);
   buffer.payload.SetSize(received > 0 ? received : 0);
   if (received > 0 && timestamp != -1) {
     buffer.arrival_time = webrtc::Timestamp::Micros(timestamp);
@@ -506,11 +687,61 @@ int PhysicalSocket::RecvFrom(ReceiveBuffer& buffer) {
   return received;
 }
 
+int PhysicalSocket::RecvFromBatch(ArrayView<ReceiveBuffer> buffers) {
+#if defined(WEBRTC_LINUX)
+  if (!udp_ || buffers.size() <= 1) {
+    return Socket::RecvFromBatch(buffers);
+  }
+  static constexpr size_t BUF_SIZE = 64 * 1024;
+  const size_t count = std::min(buffers.size(), kMaxRecvBatchSize);
+  mmsghdr msgs[kMaxRecvBatchSize];
+  iovec iovs[kMaxRecvBatchSize];
+  sockaddr_storage addrs[kMaxRecvBatchSize];
+  alignas(cmsghdr) char control[kMaxRecvBatchSize][kControlBufferSize];
+  std::memset(msgs, 0, count * sizeof(msgs[0]));
+  for (size_t i = 0; i < count; ++i) {
+    buffers[i].payload.EnsureCapacity(BUF_SIZE);
+    iovs[i] = {.iov_base = buffers[i].payload.data(),
+               .iov_len = buffers[i].payload.capacity()};
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &addrs[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    msgs[i].msg_hdr.msg_control = control[i];
+    msgs[i].msg_hdr.msg_controllen = kControlBufferSize;
+  }
+  int received = ::recvmmsg(s_, msgs, count, MSG_WAITFORONE, nullptr);
+  for (int i = 0; i < received; ++i) {
+    ReceiveBuffer& buffer = buffers[i];
+    int64_t timestamp = -1;
+    buffer.payload.SetSize(msgs[i].msg_len);
+    SocketAddressFromSockAddrStorage(addrs[i], &buffer.source_address);
+    ParseControlMessages(&msgs[i].msg_hdr, &timestamp,
+                         ecn_ ? &buffer.ecn : nullptr,
+                         gro_enabled_ ? &buffer.segment_size : nullptr);
+    if (timestamp != -1) {
+      buffer.arrival_time = webrtc::Timestamp::Micros(timestamp);
+    }
+  }
+  UpdateLastError();
+  int error = GetError();
+  bool success = (received >= 0) || IsBlockingError(error);
+  EnableEvents(DE_READ);
+  if (!success) {
+    RTC_LOG_F(LS_VERBOSE) << "Error = " << error;
+  }
+  return received;
+#else
+  return Socket::RecvFromBatch(buffers);
+#endif
+}
+
 int PhysicalSocket::DoReadFromSocket(void* buffer,
                                      size_t length,
                                      SocketAddress* out_addr,
                                      int64_t* timestamp,
-                                     EcnMarking* ecn) {
+                                     EcnMarking* ecn,
+                                     size_t* segment_size) {
   sockaddr_storage addr_storage;
   socklen_t addr_len = sizeof(addr_storage);
   sockaddr* addr = reinterpret_cast<sockaddr*>(&addr_storage);
@@ -524,11 +755,11 @@ int PhysicalSocket::DoReadFromSocket(void* buffer,
     msg.msg_name = addr;
     msg.msg_namelen = addr_len;
   }
-  // TODO(bugs.webrtc.org/15368): What size is needed? IPV6_TCLASS is supposed
-  // to be an int. Why is a larger size needed?
-  char control[CMSG_SPACE(sizeof(struct timeval) + 5 * sizeof(int))] = {};
-  if (timestamp || ecn) {
-    *timestamp = -1;
+  char control[kControlBufferSize] = {};
+  if (timestamp || ecn || segment_size) {
+    if (timestamp) {
+      *timestamp = -1;
+    }
     msg.msg_control = &control;
     msg.msg_controllen = sizeof(control);
   }
@@ -537,26 +768,8 @@ int PhysicalSocket::DoReadFromSocket(void* buffer,
     // An error occured or shut down.
     return received;
   }
-  if (timestamp || ecn) {
-    struct cmsghdr* cmsg;
-    for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
-      if (ecn) {
-        if ((cmsg->cmsg_type == IPV6_TCLASS &&
-             cmsg->cmsg_level == IPPROTO_IPV6) ||
-            (cmsg->cmsg_type == IP_TOS && cmsg->cmsg_level == IPPROTO_IP)) {
-          *ecn = EcnFromDs(CMSG_DATA(cmsg)[0]);
-        }
-      }
-      if (cmsg->cmsg_level != SOL_SOCKET)
-        continue;
-      if (timestamp && cmsg->cmsg_type == SCM_TIMESTAMP) {
-        timeval ts;
-        std::memcpy(static_cast<void*>(&ts), CMSG_DATA(cmsg), sizeof(ts));
-        *timestamp =
-            rtc::kNumMicrosecsPerSec * static_cast<int64_t>(ts.tv_sec) +
-            static_cast<int64_t>(ts.tv_usec);
-      }
-    }
+  if (timestamp || ecn || segment_size) {
+    ParseControlMessages(&msg, timestamp, ecn, segment_size);
   }
   if (out_addr) {
     SocketAddressFromSockAddrStorage(addr_storage, out_addr);
@@ -760,6 +973,24 @@ int PhysicalSocket::TranslateOption(Option opt, int* slevel, int* sopt) {
 #else
       RTC_LOG(LS_WARNING) << "Socket::OPT_RECV_ECN not supported.";
       return -1;
+#endif
+    case OPT_UDP_GRO:
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+      *slevel = IPPROTO_UDP;
+      *sopt = UDP_GRO;
+      break;
+#else
+      RTC_LOG(LS_WARNING) << "Socket::OPT_UDP_GRO not supported.";
+      return -1;
+#endif
+    case OPT_REUSEPORT:
+#if defined(WEBRTC_POSIX) && defined(SO_REUSEPORT)
+      *slevel = SOL_SOCKET;
+      *sopt = SO_REUSEPORT;
+      break;
+#else
+      RTC_LOG(LS_WARNING) << "Socket::OPT_REUSEPORT not supported.";
+      return -1;
 #endif
     case OPT_RTP_SENDTIME_EXTN_ID:
       return -1;  // No logging is necessary as this not a OS socket option.
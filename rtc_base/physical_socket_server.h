@@ -11,6 +11,7 @@
 #ifndef RTC_BASE_PHYSICAL_SOCKET_SERVER_H_
 #define RTC_BASE_PHYSICAL_SOCKET_SERVER_H_
 
+#include "api/array_view.h"
 #include "api/async_dns_resolver.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/socket.h"
@@ -159,6 +160,11 @@ class RTC_EXPORT PhysicalSocketServer : public SocketServer {
 
 class PhysicalSocket : public Socket, public sigslot::has_slots<> {
  public:
+  // Maximum number of datagrams read by a single RecvFromBatch() call.
+  static constexpr size_t kMaxRecvBatchSize = 64;
+  // Maximum number of datagrams passed to a single sendmmsg() call.
+  static constexpr size_t kMaxSendBatchSize = 64;
+
   PhysicalSocket(PhysicalSocketServer* ss, SOCKET s = INVALID_SOCKET);
   ~PhysicalSocket() override;
 
@@ -183,6 +189,10 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
   int SendTo(const void* buffer,
              size_t length,
              const SocketAddress& addr) override;
+  // On Linux, runs of equally sized datagrams are sent with a single UDP GSO
+  // send each, and other datagrams with sendmmsg().
+  int SendToBatch(ArrayView<const ArrayView<const uint8_t>> packets,
+                  const SocketAddress& addr) override;
 
   int Recv(void* buffer, size_t length, int64_t* timestamp) override;
   // TODO(webrtc:15368): Deprecate and remove.
@@ -191,6 +201,9 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
                SocketAddress* out_addr,
                int64_t* timestamp) override;
   int RecvFrom(ReceiveBuffer& buffer) override;
+  // Uses recvmmsg() on Linux to receive up to `kMaxRecvBatchSize` datagrams
+  // with a single system call.
+  int RecvFromBatch(ArrayView<ReceiveBuffer> buffers) override;
 
   int Listen(int backlog) override;
   Socket* Accept(SocketAddress* out_addr) override;
@@ -218,11 +231,20 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
                        const struct sockaddr* dest_addr,
                        socklen_t addrlen);
 
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  // Sends `packets` as one UDP GSO message. Returns the number of datagrams
+  // sent, or a negative value on error.
+  int DoSendToWithGso(ArrayView<const ArrayView<const uint8_t>> packets,
+                      const sockaddr_storage& addr,
+                      socklen_t addr_len);
+#endif
+
   int DoReadFromSocket(void* buffer,
                        size_t length,
                        SocketAddress* out_addr,
                        int64_t* timestamp,
-                       EcnMarking* ecn);
+                       EcnMarking* ecn,
+                       size_t* segment_size = nullptr);
 
   void OnResolveResult(const webrtc::AsyncDnsResolverResult& resolver);
 
@@ -246,6 +268,9 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
   std::unique_ptr<webrtc::AsyncDnsResolverInterface> resolver_;
   uint8_t dscp_ = 0;  // 6bit.
   uint8_t ecn_ = 0;   // 2bits.
+  bool gro_enabled_ = false;
+  // Cleared if the kernel or the network device rejects UDP GSO sends.
+  bool gso_supported_ = true;
 
 #if !defined(NDEBUG)
   std::string dbg_addr_;
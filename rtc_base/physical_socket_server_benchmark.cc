@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/physical_socket_server.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+
+namespace rtc {
+namespace {
+
+constexpr size_t kPacketSize = 1200;
+constexpr int kPacketsPerBurst = 64;
+
+// Sends bursts of datagrams over loopback and drains them either one datagram
+// per system call (batch size 1, the RecvFrom loop used by AsyncUDPSocket by
+// default) or with RecvFromBatch.
+void BM_UdpReceive(benchmark::State& state) {
+  const size_t batch_size = state.range(0);
+  PhysicalSocketServer socket_server;
+  std::unique_ptr<Socket> receiver(
+      socket_server.CreateSocket(AF_INET, SOCK_DGRAM));
+  std::unique_ptr<Socket> sender(
+      socket_server.CreateSocket(AF_INET, SOCK_DGRAM));
+  if (receiver->Bind(SocketAddress("127.0.0.1", 0)) != 0 ||
+      sender->Bind(SocketAddress("127.0.0.1", 0)) != 0) {
+    state.SkipWithError("Failed to bind loopback sockets.");
+    return;
+  }
+  receiver->SetOption(Socket::OPT_RCVBUF, 4 * 1024 * 1024);
+  const SocketAddress destination = receiver->GetLocalAddress();
+
+  std::vector<Buffer> buffers(batch_size);
+  std::vector<Socket::ReceiveBuffer> receive_buffers;
+  for (Buffer& buffer : buffers) {
+    receive_buffers.emplace_back(buffer);
+  }
+  const uint8_t payload[kPacketSize] = {};
+
+  int64_t packets = 0;
+  int64_t receive_calls = 0;
+  for (auto s : state) {
+    for (int i = 0; i < kPacketsPerBurst; ++i) {
+      sender->SendTo(payload, kPacketSize, destination);
+    }
+    int remaining = kPacketsPerBurst;
+    while (remaining > 0) {
+      int received;
+      if (batch_size == 1) {
+        received = receiver->RecvFrom(receive_buffers[0]) >= 0 ? 1 : -1;
+      } else {
+        received = receiver->RecvFromBatch(receive_buffers);
+      }
+      ++receive_calls;
+      if (received <= 0) {
+        // Remaining datagrams were dropped by the kernel.
+        break;
+      }
+      remaining -= received;
+      packets += received;
+    }
+  }
+
+  state.SetItemsProcessed(packets);
+  state.counters["packets_per_second"] =
+      benchmark::Counter(packets, benchmark::Counter::kIsRate);
+  state.counters["syscalls_per_packet"] =
+      packets > 0 ? static_cast<double>(receive_calls) / packets : 0;
+}
+
+BENCHMARK(BM_UdpReceive)->Arg(1)->Arg(8)->Arg(32)->Arg(64);
+
+// Sends bursts of equally sized datagrams over loopback either one datagram
+// per system call (batch size 1, as AsyncUDPSocket does for packets that are
+// not batchable) or with SendToBatch.
+void BM_UdpSend(benchmark::State& state) {
+  const size_t batch_size = state.range(0);
+  PhysicalSocketServer socket_server;
+  std::unique_ptr<Socket> receiver(
+      socket_server.CreateSocket(AF_INET, SOCK_DGRAM));
+  std::unique_ptr<Socket> sender(
+      socket_server.CreateSocket(AF_INET, SOCK_DGRAM));
+  if (receiver->Bind(SocketAddress("127.0.0.1", 0)) != 0 ||
+      sender->Bind(SocketAddress("127.0.0.1", 0)) != 0) {
+    state.SkipWithError("Failed to bind loopback sockets.");
+    return;
+  }
+  receiver->SetOption(Socket::OPT_RCVBUF, 4 * 1024 * 1024);
+  const SocketAddress destination = receiver->GetLocalAddress();
+
+  const uint8_t payload[kPacketSize] = {};
+  std::vector<ArrayView<const uint8_t>> packets(
+      batch_size, ArrayView<const uint8_t>(payload, kPacketSize));
+  std::vector<Buffer> buffers(PhysicalSocket::kMaxRecvBatchSize);
+  std::vector<Socket::ReceiveBuffer> receive_buffers;
+  for (Buffer& buffer : buffers) {
+    receive_buffers.emplace_back(buffer);
+  }
+
+  int64_t packets_sent = 0;
+  int64_t send_calls = 0;
+  for (auto s : state) {
+    for (int i = 0; i < kPacketsPerBurst; i += batch_size) {
+      int sent;
+      if (batch_size == 1) {
+        sent = sender->SendTo(payload, kPacketSize, destination) > 0 ? 1 : 0;
+      } else {
+        sent = sender->SendToBatch(packets, destination);
+      }
+      ++send_calls;
+      packets_sent += std::max(sent, 0);
+    }
+    state.PauseTiming();
+    while (receiver->RecvFromBatch(receive_buffers) > 0) {
+    }
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(packets_sent);
+  state.counters["packets_per_second"] =
+      benchmark::Counter(packets_sent, benchmark::Counter::kIsRate);
+  // SendToBatch may use more than one system call per call when the batch
+  // does not fit a single GSO send.
+  state.counters["calls_per_packet"] =
+      packets_sent > 0 ? static_cast<double>(send_calls) / packets_sent : 0;
+}
+
+BENCHMARK(BM_UdpSend)->Arg(1)->Arg(8)->Arg(32)->Arg(64);
+
+}  // namespace
+}  // namespace rtc
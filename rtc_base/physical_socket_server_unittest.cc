@@ -492,6 +492,24 @@ TEST_F(PhysicalSocketTest, TestSocketSendRecvWithEcnIPv6) {
   SocketTest::TestSocketSendRecvWithEcnIPV6();
 }
 
+TEST_F(PhysicalSocketTest, TestUdpRecvFromBatchIPv4) {
+  MAYBE_SKIP_IPV4;
+  SocketTest::TestUdpRecvFromBatchIPv4();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpRecvFromBatchIPv6) {
+  SocketTest::TestUdpRecvFromBatchIPv6();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpSendToBatchIPv4) {
+  MAYBE_SKIP_IPV4;
+  SocketTest::TestUdpSendToBatchIPv4();
+}
+
+TEST_F(PhysicalSocketTest, TestUdpSendToBatchIPv6) {
+  SocketTest::TestUdpSendToBatchIPv6();
+}
+
 // Verify that if the socket was unable to be bound to a real network interface
 // (not loopback), Bind will return an error.
 TEST_F(PhysicalSocketTest,
@@ -0,0 +1,410 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/pooled_task_queue_factory.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/numerics/divide_round.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+#include "rtc_base/time_utils.h"
+
+#if defined(WEBRTC_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace webrtc {
+namespace {
+
+using Task = absl::AnyInvocable<void() &&>;
+
+void PinCurrentThreadToCore(int index) {
+#if defined(WEBRTC_LINUX)
+  const long num_cores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (num_cores <= 0) {
+    return;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(index % num_cores, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    RTC_LOG(LS_WARNING) << "Failed to pin task queue worker thread " << index
+                        << " to a core.";
+  }
+#endif
+}
+
+class WorkerPool;
+
+class PooledTaskQueue final : public TaskQueueBase {
+ public:
+  explicit PooledTaskQueue(WorkerPool* pool) : pool_(pool) {}
+  ~PooledTaskQueue() override = default;
+
+  void Delete() override;
+
+  // Runs `task`, and destroys it, with Current() set up to the queue.
+  void RunTask(Task task) {
+    CurrentTaskQueueSetter set_current(this);
+    std::move(task)();
+    task = nullptr;
+  }
+
+  // Destroys the tasks that did not run with Current() set up to the queue,
+  // as a task queue with its own thread would.
+  void DestroyTasks(std::deque<Task> pending, std::vector<Task> delayed) {
+    CurrentTaskQueueSetter set_current(this);
+    pending.clear();
+    delayed.clear();
+  }
+
+ protected:
+  void PostTaskImpl(Task task,
+                    const PostTaskTraits& traits,
+                    const Location& location) override;
+  void PostDelayedTaskImpl(Task task,
+                           TimeDelta delay,
+                           const PostDelayedTaskTraits& traits,
+                           const Location& location) override;
+
+ private:
+  friend class WorkerPool;
+
+  WorkerPool* const pool_;
+
+  // The state below is guarded by the mutex of `pool_`.
+
+  // Tasks that are ready to run, in the order they are to run.
+  std::deque<Task> pending_;
+  // Set while the queue is waiting for a worker thread or is running a task
+  // on one. At most one worker thread runs the tasks of the queue at a time.
+  bool scheduled_ = false;
+  bool running_ = false;
+  bool deleting_ = false;
+  // Set by Delete() when it has to wait for the running task to return.
+  rtc::Event* task_done_ = nullptr;
+};
+
+// The worker threads and the scheduling state of all the task queues of a
+// factory. Task queues with pending tasks wait in `runnable_` for a worker
+// thread, which runs one of their tasks and then puts them back at the end
+// of `runnable_` if they have more, so that a busy queue does not starve the
+// others.
+class WorkerPool {
+ public:
+  explicit WorkerPool(const PooledTaskQueueFactoryConfig& config);
+  ~WorkerPool();
+
+  PooledTaskQueue* CreateQueue();
+  void DeleteQueue(PooledTaskQueue* queue);
+  void PostTask(PooledTaskQueue* queue, Task task);
+  void PostDelayedTask(PooledTaskQueue* queue, Task task, TimeDelta delay);
+
+ private:
+  using OrderId = uint64_t;
+
+  struct Worker {
+    rtc::Event wake_up;
+    rtc::PlatformThread thread;
+  };
+
+  struct DelayedEntryTimeout {
+    int64_t next_fire_at_us{};
+    OrderId order{};
+
+    bool operator<(const DelayedEntryTimeout& o) const {
+      return std::tie(next_fire_at_us, order) <
+             std::tie(o.next_fire_at_us, o.order);
+    }
+  };
+
+  struct DelayedTask {
+    PooledTaskQueue* queue;
+    Task task;
+  };
+
+  void WorkerLoop(Worker* worker);
+  // Puts `queue` in `runnable_` unless it is already there or running.
+  void ScheduleLocked(PooledTaskQueue* queue)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void WakeUpWorkerLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Moves the delayed tasks that are due to the pending tasks of their queues
+  // and returns the time until the next one is due.
+  TimeDelta ScheduleDueDelayedTasksLocked(int64_t now_us)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void FinishTask(PooledTaskQueue* queue);
+
+  Mutex mutex_;
+  bool stopping_ RTC_GUARDED_BY(mutex_) = false;
+  int num_queues_ RTC_GUARDED_BY(mutex_) = 0;
+  std::deque<PooledTaskQueue*> runnable_ RTC_GUARDED_BY(mutex_);
+  std::vector<Worker*> idle_workers_ RTC_GUARDED_BY(mutex_);
+  OrderId next_order_ RTC_GUARDED_BY(mutex_) = 0;
+  std::map<DelayedEntryTimeout, DelayedTask> delayed_ RTC_GUARDED_BY(mutex_);
+
+  // Placed last so that the threads only see initialized members.
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+WorkerPool::WorkerPool(const PooledTaskQueueFactoryConfig& config) {
+  RTC_CHECK_GT(config.num_worker_threads, 0);
+  workers_.reserve(config.num_worker_threads);
+  for (int i = 0; i < config.num_worker_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+    Worker* worker = workers_.back().get();
+    const bool pin = config.pin_worker_threads;
+    worker->thread = rtc::PlatformThread::SpawnJoinable(
+        [this, worker, pin, i] {
+          if (pin) {
+            PinCurrentThreadToCore(i);
+          }
+          WorkerLoop(worker);
+        },
+        std::string(config.thread_name) + "/" + std::to_string(i));
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    MutexLock lock(&mutex_);
+    RTC_DCHECK_EQ(num_queues_, 0) << "Task queues outlive their factory.";
+    stopping_ = true;
+  }
+  for (auto& worker : workers_) {
+    worker->wake_up.Set();
+  }
+  // Joins the threads.
+  workers_.clear();
+}
+
+PooledTaskQueue* WorkerPool::CreateQueue() {
+  MutexLock lock(&mutex_);
+  ++num_queues_;
+  return new PooledTaskQueue(this);
+}
+
+void WorkerPool::DeleteQueue(PooledTaskQueue* queue) {
+  std::deque<Task> pending;
+  std::vector<Task> delayed;
+  rtc::Event task_done;
+  bool wait_for_task;
+  {
+    MutexLock lock(&mutex_);
+    queue->deleting_ = true;
+    queue->pending_.swap(pending);
+    auto it = std::find(runnable_.begin(), runnable_.end(), queue);
+    if (it != runnable_.end()) {
+      runnable_.erase(it);
+    }
+    for (auto it = delayed_.begin(); it != delayed_.end();) {
+      if (it->second.queue == queue) {
+        delayed.push_back(std::move(it->second.task));
+        it = delayed_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    wait_for_task = queue->running_;
+    if (wait_for_task) {
+      queue->task_done_ = &task_done;
+    }
+    --num_queues_;
+  }
+
+  if (wait_for_task) {
+    task_done.Wait(rtc::Event::kForever);
+  }
+
+  queue->DestroyTasks(std::move(pending), std::move(delayed));
+  delete queue;
+}
+
+void WorkerPool::PostTask(PooledTaskQueue* queue, Task task) {
+  {
+    MutexLock lock(&mutex_);
+    if (!queue->deleting_) {
+      queue->pending_.push_back(std::move(task));
+      ScheduleLocked(queue);
+      return;
+    }
+  }
+  // Only the running task of a queue being deleted can post to it. Drop the
+  // task, it is already on the queue.
+}
+
+void WorkerPool::PostDelayedTask(PooledTaskQueue* queue,
+                                 Task task,
+                                 TimeDelta delay) {
+  DelayedEntryTimeout entry;
+  entry.next_fire_at_us = rtc::TimeMicros() + delay.us();
+  MutexLock lock(&mutex_);
+  if (queue->deleting_) {
+    return;
+  }
+  entry.order = ++next_order_;
+  auto it = delayed_.emplace(entry, DelayedTask{queue, std::move(task)}).first;
+  // An idle worker thread may be sleeping until a later task is due.
+  if (it == delayed_.begin()) {
+    WakeUpWorkerLocked();
+  }
+}
+
+void WorkerPool::ScheduleLocked(PooledTaskQueue* queue) {
+  if (queue->scheduled_) {
+    return;
+  }
+  queue->scheduled_ = true;
+  runnable_.push_back(queue);
+  WakeUpWorkerLocked();
+}
+
+void WorkerPool::WakeUpWorkerLocked() {
+  if (idle_workers_.empty()) {
+    return;
+  }
+  idle_workers_.back()->wake_up.Set();
+  idle_workers_.pop_back();
+}
+
+TimeDelta WorkerPool::ScheduleDueDelayedTasksLocked(int64_t now_us) {
+  while (!delayed_.empty()) {
+    auto it = delayed_.begin();
+    if (it->first.next_fire_at_us > now_us) {
+      return TimeDelta::Millis(
+          DivideRoundUp(it->first.next_fire_at_us - now_us, 1'000));
+    }
+    PooledTaskQueue* queue = it->second.queue;
+    queue->pending_.push_back(std::move(it->second.task));
+    delayed_.erase(it);
+    ScheduleLocked(queue);
+  }
+  return rtc::Event::kForever;
+}
+
+void WorkerPool::WorkerLoop(Worker* worker) {
+  while (true) {
+    PooledTaskQueue* queue = nullptr;
+    Task task;
+    TimeDelta sleep_time;
+    {
+      MutexLock lock(&mutex_);
+      if (stopping_) {
+        return;
+      }
+      sleep_time = ScheduleDueDelayedTasksLocked(rtc::TimeMicros());
+      if (!runnable_.empty()) {
+        queue = runnable_.front();
+        runnable_.pop_front();
+        RTC_DCHECK(!queue->pending_.empty());
+        task = std::move(queue->pending_.front());
+        queue->pending_.pop_front();
+        queue->running_ = true;
+      } else {
+        idle_workers_.push_back(worker);
+      }
+    }
+
+    if (queue) {
+      queue->RunTask(std::move(task));
+      FinishTask(queue);
+      continue;
+    }
+
+    worker->wake_up.Wait(sleep_time, sleep_time);
+    MutexLock lock(&mutex_);
+    // Remove the worker if it woke up on a timeout.
+    auto it = std::find(idle_workers_.begin(), idle_workers_.end(), worker);
+    if (it != idle_workers_.end()) {
+      idle_workers_.erase(it);
+    }
+  }
+}
+
+void WorkerPool::FinishTask(PooledTaskQueue* queue) {
+  MutexLock lock(&mutex_);
+  queue->running_ = false;
+  if (queue->deleting_) {
+    // Delete() is waiting and destroys `queue` as soon as this is set.
+    if (queue->task_done_) {
+      queue->task_done_->Set();
+    }
+    return;
+  }
+  if (queue->pending_.empty()) {
+    queue->scheduled_ = false;
+  } else {
+    // Still scheduled. The calling worker thread takes the front of
+    // `runnable_` next, so there is no need to wake up another one.
+    runnable_.push_back(queue);
+  }
+}
+
+void PooledTaskQueue::Delete() {
+  RTC_DCHECK(!IsCurrent());
+  pool_->DeleteQueue(this);
+}
+
+void PooledTaskQueue::PostTaskImpl(Task task,
+                                   const PostTaskTraits& traits,
+                                   const Location& location) {
+  pool_->PostTask(this, std::move(task));
+}
+
+void PooledTaskQueue::PostDelayedTaskImpl(Task task,
+                                          TimeDelta delay,
+                                          const PostDelayedTaskTraits& traits,
+                                          const Location& location) {
+  pool_->PostDelayedTask(this, std::move(task), delay);
+}
+
+class PooledTaskQueueFactory final : public TaskQueueFactory {
+ public:
+  explicit PooledTaskQueueFactory(const PooledTaskQueueFactoryConfig& config)
+      : pool_(std::make_unique<WorkerPool>(config)) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override {
+    return std::unique_ptr<TaskQueueBase, TaskQueueDeleter>(
+        pool_->CreateQueue());
+  }
+
+ private:
+  const std::unique_ptr<WorkerPool> pool_;
+};
+
+}  // namespace
+
+std::unique_ptr<TaskQueueFactory> CreatePooledTaskQueueFactory(
+    const PooledTaskQueueFactoryConfig& config) {
+  return std::make_unique<PooledTaskQueueFactory>(config);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,47 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_POOLED_TASK_QUEUE_FACTORY_H_
+#define RTC_BASE_POOLED_TASK_QUEUE_FACTORY_H_
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+#include "api/task_queue/task_queue_factory.h"
+
+namespace webrtc {
+
+struct PooledTaskQueueFactoryConfig {
+  // Number of threads that run the tasks of all the task queues of the
+  // factory. Must be positive.
+  int num_worker_threads = 1;
+  // Pins worker thread i to CPU core i modulo the number of cores. Only
+  // supported on Linux, ignored elsewhere.
+  bool pin_worker_threads = false;
+  // Name of the worker threads.
+  absl::string_view thread_name = "TaskQueuePool";
+};
+
+// Creates a factory whose task queues share a fixed set of worker threads
+// instead of each owning a thread. Tasks of one task queue still run one at a
+// time and in the order they were posted, but tasks of different task queues
+// run concurrently on the worker threads. This suits hosts that create many
+// task queues for small periodic work, e.g. one audio encoder queue per send
+// stream, where a thread per queue costs more in context switches than the
+// work itself.
+//
+// The priority passed to CreateTaskQueue() is ignored. The factory must
+// outlive the task queues it creates.
+std::unique_ptr<TaskQueueFactory> CreatePooledTaskQueueFactory(
+    const PooledTaskQueueFactoryConfig& config);
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_POOLED_TASK_QUEUE_FACTORY_H_
@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/pooled_task_queue_factory.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/task_queue_factory.h"
+#include "api/task_queue/task_queue_test.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAreArray;
+
+std::unique_ptr<TaskQueueFactory> CreateTaskQueueFactory(
+    const webrtc::FieldTrialsView*) {
+  return CreatePooledTaskQueueFactory({.num_worker_threads = 2});
+}
+
+std::unique_ptr<TaskQueueFactory> CreateSingleThreadTaskQueueFactory(
+    const webrtc::FieldTrialsView*) {
+  return CreatePooledTaskQueueFactory({.num_worker_threads = 1});
+}
+
+INSTANTIATE_TEST_SUITE_P(PooledTaskQueue,
+                         TaskQueueTest,
+                         ::testing::Values(CreateTaskQueueFactory));
+
+INSTANTIATE_TEST_SUITE_P(PooledTaskQueueSingleThread,
+                         TaskQueueTest,
+                         ::testing::Values(CreateSingleThreadTaskQueueFactory));
+
+TEST(PooledTaskQueueFactoryTest, RunsTheTasksOfEachQueueInOrder) {
+  constexpr int kNumQueues = 16;
+  constexpr int kNumTasks = 1000;
+  auto factory = CreatePooledTaskQueueFactory({.num_worker_threads = 4});
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> queues;
+  std::vector<std::vector<int>> executed(kNumQueues);
+  // Set while a task of the queue runs, to catch concurrent tasks.
+  std::vector<std::atomic<bool>> running(kNumQueues);
+  std::atomic<int> num_concurrent_tasks(0);
+  rtc::Event done;
+  std::atomic<int> num_queues_left(kNumQueues);
+  for (int q = 0; q < kNumQueues; ++q) {
+    queues.push_back(
+        factory->CreateTaskQueue("Queue", TaskQueueFactory::Priority::NORMAL));
+  }
+  for (int i = 0; i < kNumTasks; ++i) {
+    for (int q = 0; q < kNumQueues; ++q) {
+      queues[q]->PostTask([&, q, i] {
+        if (running[q].exchange(true)) {
+          ++num_concurrent_tasks;
+        }
+        executed[q].push_back(i);
+        running[q] = false;
+        if (i == kNumTasks - 1 && --num_queues_left == 0) {
+          done.Set();
+        }
+      });
+    }
+  }
+  ASSERT_TRUE(done.Wait(TimeDelta::Seconds(10)));
+
+  std::vector<int> expected(kNumTasks);
+  for (int i = 0; i < kNumTasks; ++i) {
+    expected[i] = i;
+  }
+  for (int q = 0; q < kNumQueues; ++q) {
+    EXPECT_THAT(executed[q], ElementsAreArray(expected));
+  }
+  EXPECT_EQ(num_concurrent_tasks, 0);
+}
+
+TEST(PooledTaskQueueFactoryTest, BlockedQueueDoesNotBlockTheOthers) {
+  auto factory = CreatePooledTaskQueueFactory({.num_worker_threads = 2});
+  auto blocked_queue =
+      factory->CreateTaskQueue("Blocked", TaskQueueFactory::Priority::NORMAL);
+  auto queue =
+      factory->CreateTaskQueue("Queue", TaskQueueFactory::Priority::NORMAL);
+  rtc::Event unblock;
+  rtc::Event ran;
+  blocked_queue->PostTask([&] { unblock.Wait(rtc::Event::kForever); });
+  queue->PostTask([&] { ran.Set(); });
+  EXPECT_TRUE(ran.Wait(TimeDelta::Seconds(1)));
+  unblock.Set();
+}
+
+TEST(PooledTaskQueueFactoryTest, DeleteWaitsForTheRunningTask) {
+  auto factory = CreatePooledTaskQueueFactory({.num_worker_threads = 1});
+  auto queue =
+      factory->CreateTaskQueue("Queue", TaskQueueFactory::Priority::NORMAL);
+  rtc::Event started;
+  std::atomic<bool> finished(false);
+  queue->PostTask([&] {
+    started.Set();
+    rtc::Event().Wait(TimeDelta::Millis(50));
+    finished = true;
+  });
+  ASSERT_TRUE(started.Wait(TimeDelta::Seconds(1)));
+  queue = nullptr;
+  EXPECT_TRUE(finished);
+}
+
+TEST(PooledTaskQueueFactoryTest, PinnedWorkerThreadsRunTasks) {
+  auto factory = CreatePooledTaskQueueFactory(
+      {.num_worker_threads = 2, .pin_worker_threads = true});
+  auto queue =
+      factory->CreateTaskQueue("Queue", TaskQueueFactory::Priority::NORMAL);
+  rtc::Event ran;
+  queue->PostTask([&] { ran.Set(); });
+  EXPECT_TRUE(ran.Wait(TimeDelta::Seconds(1)));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -12,7 +12,9 @@
 
 #include <cstdint>
 
+#include "api/array_view.h"
 #include "rtc_base/buffer.h"
+#include "rtc_base/socket_address.h"
 
 namespace rtc {
 
@@ -30,4 +32,24 @@ int Socket::RecvFrom(ReceiveBuffer& buffer) {
   return len;
 }
 
+int Socket::SendToBatch(ArrayView<const ArrayView<const uint8_t>> packets,
+                        const SocketAddress& addr) {
+  int sent = 0;
+  for (ArrayView<const uint8_t> packet : packets) {
+    if (SendTo(packet.data(), packet.size(), addr) < 0) {
+      return sent > 0 ? sent : -1;
+    }
+    ++sent;
+  }
+  return sent;
+}
+
+int Socket::RecvFromBatch(ArrayView<ReceiveBuffer> buffers) {
+  if (buffers.empty()) {
+    return 0;
+  }
+  int len = RecvFrom(buffers[0]);
+  return len < 0 ? len : 1;
+}
+
 }  // namespace rtc
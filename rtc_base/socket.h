@@ -23,6 +23,7 @@
 #define SOCKET_EACCES EACCES
 #endif
 
+#include "api/array_view.h"
 #include "api/units/timestamp.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
@@ -91,6 +92,10 @@ class RTC_EXPORT Socket {
     std::optional<webrtc::Timestamp> arrival_time;
     SocketAddress source_address;
     EcnMarking ecn = EcnMarking::kNotEct;
+    // Non-zero if the socket has coalesced several datagrams from the same
+    // source into `payload` (UDP GRO). Each datagram is `segment_size` bytes
+    // long, except possibly the last one.
+    size_t segment_size = 0;
     Buffer& payload;
   };
   virtual ~Socket() {}
@@ -110,6 +115,11 @@ class RTC_EXPORT Socket {
   virtual int Connect(const SocketAddress& addr) = 0;
   virtual int Send(const void* pv, size_t cb) = 0;
   virtual int SendTo(const void* pv, size_t cb, const SocketAddress& addr) = 0;
+  // Sends each element of `packets` as a separate datagram to `addr`. Returns
+  // the number of datagrams sent, or a negative value if none could be sent.
+  // Default implementation calls SendTo once per datagram.
+  virtual int SendToBatch(ArrayView<const ArrayView<const uint8_t>> packets,
+                          const SocketAddress& addr);
   // `timestamp` is in units of microseconds.
   virtual int Recv(void* pv, size_t cb, int64_t* timestamp) = 0;
   // TODO(webrtc:15368): Deprecate and remove.
@@ -124,6 +134,10 @@ class RTC_EXPORT Socket {
   // Default implementation calls RecvFrom(void* ...) with 64Kbyte buffer.
   // Returns number of bytes received or a negative value on error.
   virtual int RecvFrom(ReceiveBuffer& buffer);
+  // Receives up to `buffers.size()` datagrams. Returns the number of buffers
+  // filled, or a negative value on error. Default implementation receives a
+  // single datagram using RecvFrom(ReceiveBuffer& buffer).
+  virtual int RecvFromBatch(ArrayView<ReceiveBuffer> buffers);
   virtual int Listen(int backlog) = 0;
   virtual Socket* Accept(SocketAddress* paddr) = 0;
   virtual int Close() = 0;
@@ -151,6 +165,8 @@ class RTC_EXPORT Socket {
     OPT_TCP_KEEPIDLE,      // Set TCP keep alive idle time in seconds
     OPT_TCP_KEEPINTVL,     // Set TCP keep alive interval in seconds
     OPT_TCP_USER_TIMEOUT,  // Set TCP user timeout
+    OPT_UDP_GRO,           // Coalesce received datagrams (UDP GRO)
+    OPT_REUSEPORT,         // Allow binding several sockets to one port
   };
   virtual int GetOption(Option opt, int* value) = 0;
   virtual int SetOption(Option opt, int value) = 0;
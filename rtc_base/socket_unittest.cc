@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
@@ -250,6 +251,24 @@ void SocketTest::TestSocketSendRecvWithEcnIPV6() {
   SocketSendRecvWithEcn(kIPv6Loopback);
 }
 
+void SocketTest::TestUdpRecvFromBatchIPv4() {
+  UdpRecvFromBatch(kIPv4Loopback);
+}
+
+void SocketTest::TestUdpRecvFromBatchIPv6() {
+  MAYBE_SKIP_IPV6;
+  UdpRecvFromBatch(kIPv6Loopback);
+}
+
+void SocketTest::TestUdpSendToBatchIPv4() {
+  UdpSendToBatch(kIPv4Loopback);
+}
+
+void SocketTest::TestUdpSendToBatchIPv6() {
+  MAYBE_SKIP_IPV6;
+  UdpSendToBatch(kIPv6Loopback);
+}
+
 // For unbound sockets, GetLocalAddress / GetRemoteAddress return AF_UNSPEC
 // values on Windows, but an empty address of the same family on Linux/MacOS X.
 bool IsUnspecOrEmptyIP(const IPAddress& address) {
@@ -1349,4 +1368,94 @@ void SocketTest::SocketSendRecvWithEcn(const IPAddress& loopback) {
   EXPECT_EQ(receive_buffer.ecn, EcnMarking::kCe);
 }
 
+void SocketTest::UdpRecvFromBatch(const IPAddress& loopback) {
+  StreamSink sink;
+  std::unique_ptr<Socket> receiver(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  std::unique_ptr<Socket> sender(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  EXPECT_EQ(0, receiver->Bind(SocketAddress(loopback, 0)));
+  EXPECT_EQ(0, sender->Bind(SocketAddress(loopback, 0)));
+  sink.Monitor(receiver.get());
+
+  const std::string kPayloads[] = {"foo", "barbaz", "qux"};
+  for (const std::string& payload : kPayloads) {
+    EXPECT_EQ(static_cast<int>(payload.size()),
+              sender->SendTo(payload.data(), payload.size(),
+                             receiver->GetLocalAddress()));
+  }
+  EXPECT_THAT(
+      webrtc::WaitUntil([&] { return sink.Check(receiver.get(), SSE_READ); },
+                        ::testing::IsTrue()),
+      webrtc::IsRtcOk());
+
+  rtc::Buffer buffers[8];
+  std::vector<Socket::ReceiveBuffer> receive_buffers;
+  for (rtc::Buffer& buffer : buffers) {
+    receive_buffers.emplace_back(buffer);
+  }
+  // Socket implementations without batch support return one datagram per
+  // call, so keep reading until all datagrams have been received.
+  std::vector<std::string> received;
+  while (received.size() < arraysize(kPayloads)) {
+    int count = receiver->RecvFromBatch(receive_buffers);
+    if (count < 0) {
+      ASSERT_TRUE(receiver->IsBlocking());
+      EXPECT_THAT(webrtc::WaitUntil(
+                      [&] { return sink.Check(receiver.get(), SSE_READ); },
+                      ::testing::IsTrue()),
+                  webrtc::IsRtcOk());
+      continue;
+    }
+    ASSERT_GT(count, 0);
+    for (int i = 0; i < count; ++i) {
+      EXPECT_EQ(receive_buffers[i].source_address, sender->GetLocalAddress());
+      received.emplace_back(receive_buffers[i].payload.begin(),
+                            receive_buffers[i].payload.end());
+    }
+  }
+  EXPECT_THAT(received, ::testing::ElementsAreArray(kPayloads));
+}
+
+void SocketTest::UdpSendToBatch(const IPAddress& loopback) {
+  StreamSink sink;
+  std::unique_ptr<Socket> receiver(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  std::unique_ptr<Socket> sender(
+      socket_factory_->CreateSocket(loopback.family(), SOCK_DGRAM));
+  EXPECT_EQ(0, receiver->Bind(SocketAddress(loopback, 0)));
+  EXPECT_EQ(0, sender->Bind(SocketAddress(loopback, 0)));
+  sink.Monitor(receiver.get());
+
+  // Datagrams of different sizes, followed by datagrams that may be sent with
+  // a single segmentation offload send. Datagram boundaries must be kept.
+  const std::string kPayloads[] = {"a",      "bbbbbb", "cc",
+                                   "dddddd", "eeeeee", "fff"};
+  std::vector<ArrayView<const uint8_t>> packets;
+  for (const std::string& payload : kPayloads) {
+    packets.emplace_back(reinterpret_cast<const uint8_t*>(payload.data()),
+                         payload.size());
+  }
+  EXPECT_EQ(3, sender->SendToBatch(ArrayView<const ArrayView<const uint8_t>>(
+                                       packets.data(), 3),
+                                   receiver->GetLocalAddress()));
+  EXPECT_EQ(3, sender->SendToBatch(ArrayView<const ArrayView<const uint8_t>>(
+                                       packets.data() + 3, 3),
+                                   receiver->GetLocalAddress()));
+
+  rtc::Buffer buffer;
+  std::vector<std::string> received;
+  while (received.size() < arraysize(kPayloads)) {
+    EXPECT_THAT(webrtc::WaitUntil(
+                    [&] { return sink.Check(receiver.get(), SSE_READ); },
+                    ::testing::IsTrue()),
+                webrtc::IsRtcOk());
+    Socket::ReceiveBuffer receive_buffer(buffer);
+    while (receiver->RecvFrom(receive_buffer) > 0) {
+      received.emplace_back(buffer.begin(), buffer.end());
+    }
+  }
+  EXPECT_THAT(received, ::testing::ElementsAreArray(kPayloads));
+}
+
 }  // namespace rtc
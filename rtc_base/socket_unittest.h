@@ -69,6 +69,10 @@ class SocketTest : public ::testing::Test {
   void TestUdpSocketRecvTimestampUseRtcEpochIPv6();
   void TestSocketSendRecvWithEcnIPV4();
   void TestSocketSendRecvWithEcnIPV6();
+  void TestUdpRecvFromBatchIPv4();
+  void TestUdpRecvFromBatchIPv6();
+  void TestUdpSendToBatchIPv4();
+  void TestUdpSendToBatchIPv6();
 
   const IPAddress kIPv4Loopback;
   const IPAddress kIPv6Loopback;
@@ -100,6 +104,8 @@ class SocketTest : public ::testing::Test {
   void SocketRecvTimestamp(const IPAddress& loopback);
   void UdpSocketRecvTimestampUseRtcEpoch(const IPAddress& loopback);
   void SocketSendRecvWithEcn(const IPAddress& loopback);
+  void UdpRecvFromBatch(const IPAddress& loopback);
+  void UdpSendToBatch(const IPAddress& loopback);
 
   SocketFactory* socket_factory_;
 };
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/task_queue_stdlib.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kTasksPerProducer = 2000;
+
+// Lets `state.range(0)` producer threads post `kTasksPerProducer` tasks each
+// to `queue` and waits until all of them have run. Reports the task
+// throughput and the average time a producer spends in PostTask().
+void PostFromProducers(TaskQueueBase* queue, benchmark::State& state) {
+  const int num_producers = state.range(0);
+  const int num_tasks = num_producers * kTasksPerProducer;
+  std::atomic<int64_t> post_ns{0};
+  for (auto _ : state) {
+    std::atomic<int> remaining{num_tasks};
+    rtc::Event done;
+    std::vector<rtc::PlatformThread> producers;
+    for (int p = 0; p < num_producers; ++p) {
+      producers.push_back(rtc::PlatformThread::SpawnJoinable(
+          [&] {
+            int64_t start_ns = rtc::TimeNanos();
+            for (int i = 0; i < kTasksPerProducer; ++i) {
+              queue->PostTask([&] {
+                if (remaining.fetch_sub(1, std::memory_order_relaxed) == 1) {
+                  done.Set();
+                }
+              });
+            }
+            post_ns.fetch_add(rtc::TimeNanos() - start_ns,
+                              std::memory_order_relaxed);
+          },
+          "producer"));
+    }
+    done.Wait(rtc::Event::kForever);
+  }
+  state.SetItemsProcessed(state.iterations() * num_tasks);
+  state.counters["post_ns"] =
+      static_cast<double>(post_ns.load()) / (state.iterations() * num_tasks);
+}
+
+void BM_TaskQueueStdlibPost(benchmark::State& state) {
+  std::unique_ptr<TaskQueueFactory> factory = CreateTaskQueueStdlibFactory();
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> queue =
+      factory->CreateTaskQueue("benchmark", TaskQueueFactory::Priority::NORMAL);
+  PostFromProducers(queue.get(), state);
+}
+
+void BM_ThreadPost(benchmark::State& state) {
+  std::unique_ptr<rtc::Thread> thread = rtc::Thread::Create();
+  thread->Start();
+  PostFromProducers(thread.get(), state);
+  thread->Stop();
+}
+
+BENCHMARK(BM_TaskQueueStdlibPost)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+BENCHMARK(BM_ThreadPost)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
+}  // namespace
+}  // namespace webrtc
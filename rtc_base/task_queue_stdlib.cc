@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <queue>
@@ -23,9 +24,11 @@
 #include "absl/strings/string_view.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/event.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/mpsc_task_queue.h"
 #include "rtc_base/numerics/divide_round.h"
 #include "rtc_base/platform_thread.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -96,6 +99,17 @@ class TaskQueueStdlib final : public TaskQueueBase {
   // Signaled whenever a new task is pending.
   rtc::Event flag_notify_;
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  // Indicates if the worker thread needs to shutdown now.
+  std::atomic<bool> thread_should_quit_{false};
+
+  // Set by the worker thread before it waits on `flag_notify_`, cleared by
+  // whoever signals it. Lets posting skip signaling a busy worker thread.
+  std::atomic<bool> thread_waiting_{false};
+
+  // All pending tasks, immediate and delayed.
+  MpscTaskQueue tasks_;
+#else
   Mutex pending_lock_;
 
   // Indicates if the worker thread needs to shutdown now.
@@ -118,6 +132,7 @@ class TaskQueueStdlib final : public TaskQueueBase {
   // move-only value out of the queue without the presence of a hack.
   std::map<DelayedEntryTimeout, absl::AnyInvocable<void() &&>> delayed_queue_
       RTC_GUARDED_BY(pending_lock_);
+#endif
 
   // Contains the active worker thread assigned to processing
   // tasks (including delayed tasks).
@@ -151,10 +166,14 @@ rtc::PlatformThread TaskQueueStdlib::InitializeThread(
 void TaskQueueStdlib::Delete() {
   RTC_DCHECK(!IsCurrent());
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  thread_should_quit_.store(true, std::memory_order_relaxed);
+#else
   {
     MutexLock lock(&pending_lock_);
     thread_should_quit_ = true;
   }
+#endif
 
   NotifyWake();
 
@@ -164,11 +183,15 @@ void TaskQueueStdlib::Delete() {
 void TaskQueueStdlib::PostTaskImpl(absl::AnyInvocable<void() &&> task,
                                    const PostTaskTraits& traits,
                                    const Location& location) {
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.Post(std::move(task));
+#else
   {
     MutexLock lock(&pending_lock_);
     pending_queue_.push(
         std::make_pair(++thread_posting_order_, std::move(task)));
   }
+#endif
 
   NotifyWake();
 }
@@ -177,6 +200,10 @@ void TaskQueueStdlib::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
                                           TimeDelta delay,
                                           const PostDelayedTaskTraits& traits,
                                           const Location& location) {
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.PostDelayed(std::move(task),
+                     Timestamp::Micros(rtc::TimeMicros()) + delay);
+#else
   DelayedEntryTimeout delayed_entry;
   delayed_entry.next_fire_at_us = rtc::TimeMicros() + delay.us();
 
@@ -185,10 +212,49 @@ void TaskQueueStdlib::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
     delayed_entry.order = ++thread_posting_order_;
     delayed_queue_[delayed_entry] = std::move(task);
   }
+#endif
 
   NotifyWake();
 }
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
+  NextTask result;
+
+  const Timestamp now = Timestamp::Micros(rtc::TimeMicros());
+
+  if (thread_should_quit_.load(std::memory_order_relaxed)) {
+    result.final_task = true;
+    return result;
+  }
+
+  result.run_task = tasks_.Pop(now);
+  if (result.run_task) {
+    return result;
+  }
+
+  // Announce the wait before looking at the queue again. Paired with the
+  // fence in NotifyWake(), either the task or shutdown request is seen here or
+  // the poster sees `thread_waiting_` and signals `flag_notify_`.
+  thread_waiting_.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (thread_should_quit_.load(std::memory_order_relaxed)) {
+    result.final_task = true;
+    return result;
+  }
+
+  const Timestamp next_run_time = tasks_.NextRunTime();
+  if (next_run_time.IsMinusInfinity()) {
+    result.sleep_time = TimeDelta::Zero();
+  } else if (next_run_time.IsFinite()) {
+    result.sleep_time = TimeDelta::Millis(
+        DivideRoundUp(std::max<int64_t>(0, (next_run_time - now).us()), 1'000));
+  }
+
+  return result;
+}
+#else
 TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
   NextTask result;
 
@@ -234,6 +300,7 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
 
   return result;
 }
+#endif
 
 void TaskQueueStdlib::ProcessTasks() {
   while (true) {
@@ -251,10 +318,16 @@ void TaskQueueStdlib::ProcessTasks() {
     }
 
     flag_notify_.Wait(task.sleep_time, task.sleep_time);
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+    thread_waiting_.store(false, std::memory_order_relaxed);
+#endif
   }
 
   // Ensure remaining deleted tasks are destroyed with Current() set up to this
   // task queue.
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.Clear();
+#else
   std::queue<std::pair<OrderId, absl::AnyInvocable<void() &&>>> pending_queue;
   {
     MutexLock lock(&pending_lock_);
@@ -265,6 +338,7 @@ void TaskQueueStdlib::ProcessTasks() {
   MutexLock lock(&pending_lock_);
   RTC_DCHECK(pending_queue_.empty());
 #endif
+#endif
 }
 
 void TaskQueueStdlib::NotifyWake() {
@@ -292,6 +366,14 @@ void TaskQueueStdlib::NotifyWake() {
   // thread is notified to wake up but the task queue's thread finds nothing to
   // do so it waits once again to be signaled where such a signal may never
   // happen.
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  // Without the lock the thread may be running tasks while new ones are
+  // posted, so only signal when it announced that it is about to wait.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!thread_waiting_.exchange(false, std::memory_order_relaxed)) {
+    return;
+  }
+#endif
   flag_notify_.Set();
 }
 
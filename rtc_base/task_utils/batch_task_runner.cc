@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_utils/batch_task_runner.h"
+
+#include <algorithm>
+#include <string>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+BatchTaskRunner::BatchTaskRunner(int num_worker_threads,
+                                 absl::string_view thread_name) {
+  RTC_DCHECK_GE(num_worker_threads, 0);
+  for (int i = 0; i < num_worker_threads; ++i) {
+    auto worker = std::make_unique<Worker>();
+    Worker* worker_ptr = worker.get();
+    worker->thread = rtc::PlatformThread::SpawnJoinable(
+        [this, worker_ptr] { WorkerLoop(worker_ptr); },
+        std::string(thread_name) + std::to_string(i),
+        rtc::ThreadAttributes().SetPriority(rtc::ThreadPriority::kHigh));
+    workers_.push_back(std::move(worker));
+  }
+}
+
+BatchTaskRunner::~BatchTaskRunner() {
+  stopping_ = true;
+  for (auto& worker : workers_) {
+    worker->wake_up.Set();
+    worker->thread.Finalize();
+  }
+}
+
+void BatchTaskRunner::Run(size_t num_tasks,
+                          rtc::FunctionView<void(size_t)> task) {
+  RTC_DCHECK_RUNS_SERIALIZED(&run_race_checker_);
+  if (num_tasks == 0) {
+    return;
+  }
+  num_tasks_ = num_tasks;
+  task_ = task;
+  next_task_.store(0, std::memory_order_relaxed);
+
+  // The calling thread takes part too, so there is no point in waking up
+  // more workers than there are tasks beyond the first.
+  const int num_woken_workers =
+      static_cast<int>(std::min(workers_.size(), num_tasks - 1));
+  num_busy_workers_.store(num_woken_workers, std::memory_order_relaxed);
+  for (int i = 0; i < num_woken_workers; ++i) {
+    workers_[i]->wake_up.Set();
+  }
+  RunTasks();
+  if (num_woken_workers > 0) {
+    workers_done_.Wait(rtc::Event::kForever);
+  }
+  task_ = nullptr;
+}
+
+void BatchTaskRunner::WorkerLoop(Worker* worker) {
+  while (true) {
+    worker->wake_up.Wait(rtc::Event::kForever);
+    if (stopping_) {
+      return;
+    }
+    RunTasks();
+    // The last worker to finish releases Run(). The acquire-release makes
+    // the work of all workers visible to the thread that waits in Run().
+    if (num_busy_workers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      workers_done_.Set();
+    }
+  }
+}
+
+void BatchTaskRunner::RunTasks() {
+  while (true) {
+    const size_t index = next_task_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= num_tasks_) {
+      return;
+    }
+    task_(index);
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_TASK_UTILS_BATCH_TASK_RUNNER_H_
+#define RTC_BASE_TASK_UTILS_BATCH_TASK_RUNNER_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/function_view.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/race_checker.h"
+
+namespace webrtc {
+
+// Runs batches of independent tasks on a fixed set of worker threads and the
+// calling thread. It is meant for periodic work that is split into many small
+// pieces and has to finish within a deadline, e.g. pulling audio from all the
+// sources of a mixer every 10 ms. The number of threads, and so the
+// concurrency, is fixed at construction.
+class BatchTaskRunner {
+ public:
+  // With zero `num_worker_threads` all tasks run on the calling thread.
+  BatchTaskRunner(int num_worker_threads, absl::string_view thread_name);
+  ~BatchTaskRunner();
+
+  BatchTaskRunner(const BatchTaskRunner&) = delete;
+  BatchTaskRunner& operator=(const BatchTaskRunner&) = delete;
+
+  int num_worker_threads() const { return static_cast<int>(workers_.size()); }
+
+  // Calls `task(i)` once for every i in [0, `num_tasks`) and returns when all
+  // calls have returned. The calls are spread over the worker threads and the
+  // calling thread, so they may run concurrently and in any order. Everything
+  // done by the tasks happens before Run() returns. Calls to Run() must be
+  // serialized.
+  void Run(size_t num_tasks, rtc::FunctionView<void(size_t)> task);
+
+ private:
+  struct Worker {
+    rtc::Event wake_up;
+    rtc::PlatformThread thread;
+  };
+
+  void WorkerLoop(Worker* worker);
+  // Runs tasks of the current batch until there are none left.
+  void RunTasks();
+
+  rtc::RaceChecker run_race_checker_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Set before the workers are woken up for the last time.
+  bool stopping_ = false;
+
+  // The current batch. Written before the workers are woken up, which orders
+  // the writes before the reads on the worker threads.
+  size_t num_tasks_ = 0;
+  rtc::FunctionView<void(size_t)> task_;
+  std::atomic<size_t> next_task_{0};
+  // Number of woken up workers that have not yet run out of tasks.
+  std::atomic<int> num_busy_workers_{0};
+  rtc::Event workers_done_;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_TASK_UTILS_BATCH_TASK_RUNNER_H_
@@ -0,0 +1,61 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_utils/batch_task_runner.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "rtc_base/platform_thread_types.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::Each;
+using ::testing::Eq;
+
+TEST(BatchTaskRunnerTest, RunsEveryTaskOnce) {
+  BatchTaskRunner runner(/*num_worker_threads=*/3, "Batch");
+  EXPECT_EQ(runner.num_worker_threads(), 3);
+  // Each task only touches its own element, so no synchronization is needed
+  // other than what Run() provides.
+  std::vector<int> calls(1000, 0);
+  for (int batch = 0; batch < 10; ++batch) {
+    runner.Run(calls.size(), [&](size_t i) { ++calls[i]; });
+    EXPECT_THAT(calls, Each(Eq(batch + 1)));
+  }
+}
+
+TEST(BatchTaskRunnerTest, RunsOnCallingThreadWithoutWorkers) {
+  BatchTaskRunner runner(/*num_worker_threads=*/0, "Batch");
+  const rtc::PlatformThreadRef caller = rtc::CurrentThreadRef();
+  std::vector<rtc::PlatformThreadRef> threads(5);
+  runner.Run(threads.size(),
+             [&](size_t i) { threads[i] = rtc::CurrentThreadRef(); });
+  for (const rtc::PlatformThreadRef& thread : threads) {
+    EXPECT_TRUE(rtc::IsThreadRefEqual(thread, caller));
+  }
+}
+
+TEST(BatchTaskRunnerTest, HandlesBatchesSmallerThanTheNumberOfThreads) {
+  BatchTaskRunner runner(/*num_worker_threads=*/4, "Batch");
+  runner.Run(0, [](size_t) { FAIL(); });
+  for (size_t num_tasks = 1; num_tasks <= 6; ++num_tasks) {
+    std::vector<int> calls(num_tasks, 0);
+    runner.Run(num_tasks, [&](size_t i) { ++calls[i]; });
+    EXPECT_THAT(calls, Each(Eq(1)));
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -13,6 +13,7 @@
 #include "absl/strings/string_view.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
 #include "rtc_base/socket_server.h"
 
 #if defined(WEBRTC_WIN)
@@ -316,8 +317,7 @@ Thread::Thread(std::unique_ptr<SocketServer> ss)
     : Thread(std::move(ss), /*do_init=*/true) {}
 
 Thread::Thread(SocketServer* ss, bool do_init)
-    : delayed_next_num_(0),
-      fInitialized_(false),
+    : fInitialized_(false),
       fDestroyed_(false),
       stop_(0),
       ss_(ss) {
@@ -363,8 +363,12 @@ void Thread::DoDestroy() {
   ThreadManager::Remove(this);
   // Clear.
   CurrentTaskQueueSetter set_current(this);
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.Clear();
+#else
   messages_ = {};
   delayed_messages_ = {};
+#endif
 }
 
 SocketServer* Thread::socketserver() {
@@ -375,6 +379,18 @@ void Thread::WakeUpSocketServer() {
   ss_->WakeUp();
 }
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+void Thread::WakeUpIfWaiting() {
+  // A thread that is busy running tasks will find the new one before it waits
+  // again, so only the first post after it announced a wait needs to wake up
+  // the socket server.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiting_for_tasks_.exchange(false, std::memory_order_relaxed)) {
+    WakeUpSocketServer();
+  }
+}
+#endif
+
 void Thread::Quit() {
   stop_.store(1, std::memory_order_release);
   WakeUpSocketServer();
@@ -398,6 +414,29 @@ absl::AnyInvocable<void() &&> Thread::Get(int cmsWait) {
   while (true) {
     // Check for posted events
     int64_t cmsDelayNext = kForever;
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+    {
+      // Announce a possible wait before looking at the queue. Paired with the
+      // fence in WakeUpIfWaiting(), either a concurrently posted task is seen
+      // here or the poster wakes up the socket server.
+      waiting_for_tasks_.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      // Delayed tasks that have been triggered are moved behind the posted
+      // ones, as below.
+      webrtc::Timestamp now = webrtc::Timestamp::Millis(msCurrent);
+      absl::AnyInvocable<void() &&> task = tasks_.Pop(now);
+      if (task) {
+        waiting_for_tasks_.store(false, std::memory_order_relaxed);
+        return task;
+      }
+      webrtc::Timestamp next_run_time = tasks_.NextRunTime();
+      if (next_run_time.IsMinusInfinity()) {
+        cmsDelayNext = 0;
+      } else if (next_run_time.IsFinite()) {
+        cmsDelayNext = std::max<int64_t>(0, (next_run_time - now).ms());
+      }
+    }
+#else
     {
       // All queue operations need to be locked, but nothing else in this loop
       // can happen while holding the `mutex_`.
@@ -420,6 +459,7 @@ absl::AnyInvocable<void() &&> Thread::Get(int cmsWait) {
         return task;
       }
     }
+#endif
 
     if (IsQuitting())
       break;
@@ -466,11 +506,16 @@ void Thread::PostTaskImpl(absl::AnyInvocable<void() &&> task,
   // Add the message to the end of the queue
   // Signal for the multiplexer to return
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.Post(std::move(task));
+  WakeUpIfWaiting();
+#else
   {
     MutexLock lock(&mutex_);
     messages_.push(std::move(task));
   }
   WakeUpSocketServer();
+#endif
 }
 
 void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
@@ -487,6 +532,10 @@ void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
 
   int64_t delay_ms = delay.RoundUpTo(webrtc::TimeDelta::Millis(1)).ms<int>();
   int64_t run_time_ms = TimeAfter(delay_ms);
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  tasks_.PostDelayed(std::move(task), webrtc::Timestamp::Millis(run_time_ms));
+  WakeUpIfWaiting();
+#else
   {
     MutexLock lock(&mutex_);
     delayed_messages_.push({.delay_ms = delay_ms,
@@ -500,9 +549,24 @@ void Thread::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
     RTC_DCHECK_NE(0, delayed_next_num_);
   }
   WakeUpSocketServer();
+#endif
 }
 
 int Thread::GetDelay() {
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  webrtc::Timestamp next_run_time = tasks_.NextRunTime();
+  if (next_run_time.IsMinusInfinity())
+    return 0;
+
+  if (next_run_time.IsFinite()) {
+    int delay = TimeUntil(next_run_time.ms());
+    if (delay < 0)
+      delay = 0;
+    return delay;
+  }
+
+  return kForever;
+#else
   MutexLock lock(&mutex_);
 
   if (!messages_.empty())
@@ -516,6 +580,7 @@ int Thread::GetDelay() {
   }
 
   return kForever;
+#endif
 }
 
 void Thread::Dispatch(absl::AnyInvocable<void() &&> task) {
@@ -13,6 +13,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory>
@@ -35,6 +36,7 @@
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/mpsc_task_queue.h"
 #include "rtc_base/platform_thread_types.h"
 #include "rtc_base/socket_server.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -267,8 +269,12 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
 
   bool empty() const { return size() == 0u; }
   size_t size() const {
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+    return tasks_.size();
+#else
     webrtc::MutexLock lock(&mutex_);
     return messages_.size() + delayed_messages_.size();
+#endif
   }
 
   bool IsCurrent() const;
@@ -435,6 +441,9 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
   void DoDestroy() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
   void WakeUpSocketServer();
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  void WakeUpIfWaiting();
+#endif
 
   // Same as WrapCurrent except that it never fails as it does not try to
   // acquire the synchronization access of the thread. The caller should never
@@ -485,9 +494,18 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
   // Called by the ThreadManager when being unset as the current thread.
   void ClearCurrentTaskQueue();
 
+#if defined(WEBRTC_LOCK_FREE_TASK_QUEUE)
+  // Posted and delayed tasks. Posting does not take `mutex_`; Get(),
+  // GetDelay() and DoDestroy() are the consumer.
+  webrtc::MpscTaskQueue tasks_;
+  // Set by Get() before it looks for tasks and may wait on the socket server,
+  // cleared by the first post that wakes it up.
+  std::atomic<bool> waiting_for_tasks_{false};
+#else
   std::queue<absl::AnyInvocable<void() &&>> messages_ RTC_GUARDED_BY(mutex_);
   std::priority_queue<DelayedMessage> delayed_messages_ RTC_GUARDED_BY(mutex_);
-  uint32_t delayed_next_num_ RTC_GUARDED_BY(mutex_);
+  uint32_t delayed_next_num_ RTC_GUARDED_BY(mutex_) = 0;
+#endif
 #if RTC_DCHECK_IS_ON
   uint32_t blocking_call_count_ RTC_GUARDED_BY(this) = 0;
   uint32_t could_be_blocking_call_count_ RTC_GUARDED_BY(this) = 0;
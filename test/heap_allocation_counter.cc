@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "test/heap_allocation_counter.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <new>
+
+namespace webrtc {
+namespace test {
+namespace {
+
+thread_local ScopedHeapAllocationCounter* current_counter = nullptr;
+
+}  // namespace
+
+ScopedHeapAllocationCounter::ScopedHeapAllocationCounter()
+    : previous_(current_counter) {
+  current_counter = this;
+}
+
+ScopedHeapAllocationCounter::~ScopedHeapAllocationCounter() {
+  current_counter = previous_;
+}
+
+// static
+void ScopedHeapAllocationCounter::CountAllocation() {
+  if (current_counter != nullptr) {
+    ++current_counter->count_;
+  }
+}
+
+}  // namespace test
+}  // namespace webrtc
+
+// The other forms of operator new and delete, except the aligned ones, are
+// implemented by the standard library in terms of these.
+void* operator new(size_t size) {
+  webrtc::test::ScopedHeapAllocationCounter::CountAllocation();
+  void* ptr = malloc(size > 0 ? size : 1);
+  if (ptr == nullptr) {
+    abort();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t /* size */) noexcept {
+  free(ptr);
+}
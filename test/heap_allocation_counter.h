@@ -0,0 +1,46 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef TEST_HEAP_ALLOCATION_COUNTER_H_
+#define TEST_HEAP_ALLOCATION_COUNTER_H_
+
+namespace webrtc {
+namespace test {
+
+// Counts the calls to the global operator new made by the current thread
+// while it is alive, so that tests can check that a code path does not
+// allocate. Allocations made by other threads, and by malloc() directly, are
+// not counted. Counters can be nested; only the innermost one counts.
+//
+// The counting is done by a replacement of the global operator new, which is
+// linked into any test binary that depends on
+// //test:heap_allocation_counter.
+class ScopedHeapAllocationCounter {
+ public:
+  ScopedHeapAllocationCounter();
+  ScopedHeapAllocationCounter(const ScopedHeapAllocationCounter&) = delete;
+  ScopedHeapAllocationCounter& operator=(const ScopedHeapAllocationCounter&) =
+      delete;
+  ~ScopedHeapAllocationCounter();
+
+  int count() const { return count_; }
+
+  // Called by the replacement operator new for every allocation.
+  static void CountAllocation();
+
+ private:
+  ScopedHeapAllocationCounter* const previous_;
+  int count_ = 0;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // TEST_HEAP_ALLOCATION_COUNTER_H_
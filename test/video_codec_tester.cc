@@ -948,7 +948,10 @@ class Encoder : public EncodedImageCallback {
       : env_(env),
         encoder_factory_(encoder_factory),
         analyzer_(analyzer),
-        pacer_(encoder_settings.pacing_settings) {
+        pacer_(encoder_settings.pacing_settings),
+        number_of_cores_(encoder_settings.number_of_cores),
+        parallel_simulcast_encoding_(
+            encoder_settings.parallel_simulcast_encoding) {
     RTC_CHECK(analyzer_) << "Analyzer must be provided";
 
     if (encoder_settings.encoder_input_base_path) {
@@ -1169,8 +1172,9 @@ class Encoder : public EncodedImageCallback {
 
     VideoEncoder::Settings ves(
         VideoEncoder::Capabilities(/*loss_notification=*/false),
-        /*number_of_cores=*/1,
+        number_of_cores_,
         /*max_payload_size=*/1440);
+    ves.parallel_simulcast_encoding = parallel_simulcast_encoding_;
 
     int result = encoder_->InitEncode(&vc, ves);
     RTC_CHECK(result == WEBRTC_VIDEO_CODEC_OK);
@@ -1260,6 +1264,8 @@ class Encoder : public EncodedImageCallback {
   std::unique_ptr<VideoEncoder> encoder_;
   VideoCodecAnalyzer* const analyzer_;
   Pacer pacer_;
+  const int number_of_cores_;
+  const bool parallel_simulcast_encoding_;
   std::optional<EncodingSettings> last_encoding_settings_;
   std::unique_ptr<VideoBitrateAllocator> bitrate_allocator_;
   LimitedTaskQueue task_queue_;
@@ -174,6 +174,10 @@ class VideoCodecTester {
     PacingSettings pacing_settings;
     std::optional<std::string> encoder_input_base_path;
     std::optional<std::string> encoder_output_base_path;
+    // The number of CPU cores the encoder is allowed to use.
+    int number_of_cores = 1;
+    // See VideoEncoder::Settings::parallel_simulcast_encoding.
+    bool parallel_simulcast_encoding = false;
   };
 
   virtual ~VideoCodecTester() = default;
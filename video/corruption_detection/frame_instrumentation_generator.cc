@@ -171,12 +171,28 @@ FrameInstrumentationGenerator::OnEncodedImage(
     return std::nullopt;
   }
 
+  // With a scaling pyramid, sample the downscaled frame that the encoder got
+  // rather than scaling the captured frame once more.
+  scoped_refptr<VideoFrameBuffer> captured_frame_buffer =
+      captured_frame.video_frame_buffer();
+  if (captured_frame.has_scaling_pyramid() &&
+      encoded_image._encodedWidth <=
+          static_cast<uint32_t>(captured_frame.width()) &&
+      encoded_image._encodedHeight <=
+          static_cast<uint32_t>(captured_frame.height())) {
+    scoped_refptr<VideoFrameBuffer> scaled_buffer =
+        captured_frame.ScaledVideoFrameBuffer(encoded_image._encodedWidth,
+                                              encoded_image._encodedHeight);
+    if (scaled_buffer) {
+      captured_frame_buffer = scaled_buffer;
+    }
+  }
   scoped_refptr<I420BufferInterface> captured_frame_buffer_as_i420 =
-      captured_frame.video_frame_buffer()->ToI420();
+      captured_frame_buffer->ToI420();
   if (!captured_frame_buffer_as_i420) {
     RTC_LOG(LS_ERROR) << "Failed to convert "
                       << VideoFrameBufferTypeToString(
-                             captured_frame.video_frame_buffer()->type())
+                             captured_frame_buffer->type())
                       << " image to I420.";
     return std::nullopt;
   }
@@ -181,12 +181,17 @@ std::vector<FilteredSample> GetSampleValuesForFrame(
     return {};
   }
 
-  // Scale the frame to the desired resolution:
+  // Scale the frame to the desired resolution, unless it has it already:
   // 1. Create a new buffer with the desired resolution.
   // 2. Scale the old buffer to the size of the new buffer.
-  scoped_refptr<I420Buffer> scaled_i420_buffer =
-      I420Buffer::Create(scaled_width, scaled_height);
-  scaled_i420_buffer->ScaleFrom(*i420_frame_buffer);
+  scoped_refptr<I420BufferInterface> scaled_i420_buffer = i420_frame_buffer;
+  if (scaled_width != i420_frame_buffer->width() ||
+      scaled_height != i420_frame_buffer->height()) {
+    scoped_refptr<I420Buffer> scaled_buffer =
+        I420Buffer::Create(scaled_width, scaled_height);
+    scaled_buffer->ScaleFrom(*i420_frame_buffer);
+    scaled_i420_buffer = scaled_buffer;
+  }
 
   // Treat the planes as if they would have the following 2-dimensional layout:
   // +------+---+
@@ -47,6 +47,7 @@
 #include "modules/video_coding/nack_requester.h"
 #include "modules/video_coding/packet_buffer.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/strings/string_builder.h"
 #include "system_wrappers/include/metrics.h"
@@ -818,7 +819,7 @@ void RtpVideoStreamReceiver2::OnInsertedPacket(
   int max_nack_count;
   int64_t min_recv_time;
   int64_t max_recv_time;
-  std::vector<rtc::ArrayView<const uint8_t>> payloads;
+  std::vector<rtc::CopyOnWriteBuffer> payloads;
   RtpPacketInfos::vector_type packet_infos;
 
   bool frame_boundary = true;
@@ -848,8 +849,10 @@ void RtpVideoStreamReceiver2::OnInsertedPacket(
       RTC_CHECK(depacketizer_it != payload_type_map_.end());
       RTC_CHECK(depacketizer_it->second);
 
-      rtc::scoped_refptr<EncodedImageBuffer> bitstream =
-          depacketizer_it->second->AssembleFrame(payloads);
+      // Refers to the payloads rather than copying them. The frame is only
+      // made contiguous if something needs it to be, e.g. the decoder.
+      rtc::scoped_refptr<EncodedImageBufferInterface> bitstream =
+          depacketizer_it->second->AssembleFragmentedFrame(payloads);
       if (!bitstream) {
         // Failed to assemble a frame. Discard and continue.
         continue;
@@ -550,6 +550,13 @@ std::optional<int> ParseEncoderThreadLimit(const FieldTrialsView& trials) {
   return encoder_thread_limit.GetOptional();
 }
 
+bool ParseParallelSimulcastEncoding(const FieldTrialsView& trials) {
+  FieldTrialFlag parallel_simulcast_encoding("parallel_simulcast_encoding");
+  ParseFieldTrial({&parallel_simulcast_encoding},
+                  trials.Lookup("WebRTC-VideoEncoderSettings"));
+  return parallel_simulcast_encoding.Get();
+}
+
 }  //  namespace
 
 VideoStreamEncoder::EncoderRateSettings::EncoderRateSettings()
@@ -694,6 +701,8 @@ VideoStreamEncoder::VideoStreamEncoder(
           ParseVp9LowTierCoreCountThreshold(env_.field_trials())),
       experimental_encoder_thread_limit_(
           ParseEncoderThreadLimit(env_.field_trials())),
+      experimental_parallel_simulcast_encoding_(
+          ParseParallelSimulcastEncoding(env_.field_trials())),
       encoder_queue_(std::move(encoder_queue)) {
   TRACE_EVENT0("webrtc", "VideoStreamEncoder::VideoStreamEncoder");
   RTC_DCHECK_RUN_ON(worker_queue_);
@@ -1301,6 +1310,8 @@ void VideoStreamEncoder::ReconfigureEncoder() {
     VideoEncoder::Settings settings = VideoEncoder::Settings(
         settings_.capabilities, number_of_cores_, max_data_payload_length);
     settings.encoder_thread_limit = experimental_encoder_thread_limit_;
+    settings.parallel_simulcast_encoding =
+        experimental_parallel_simulcast_encoding_;
     int error = encoder_->InitEncode(&send_codec_, settings);
     if (error != 0) {
       RTC_LOG(LS_ERROR) << "Failed to initialize the encoder associated with "
@@ -1978,8 +1989,8 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
 
     } else {
       // The difference is large, scale it.
-      cropped_buffer = video_frame.video_frame_buffer()->Scale(cropped_width,
-                                                               cropped_height);
+      cropped_buffer =
+          video_frame.ScaledVideoFrameBuffer(cropped_width, cropped_height);
       if (!update_rect.IsEmpty()) {
         // Since we can't reason about pixels after scaling, we invalidate whole
         // picture, if anything changed.
@@ -2037,6 +2048,8 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
   frame_encode_metadata_writer_.OnEncodeStarted(out_frame);
 
   if (frame_instrumentation_generator_) {
+    // Lets the generator sample the same downscaled frames as the encoder.
+    out_frame.AttachScalingPyramid();
     frame_instrumentation_generator_->OnCapturedFrame(out_frame);
   }
 
@@ -430,6 +430,7 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
 
   const std::optional<int> vp9_low_tier_core_threshold_;
   const std::optional<int> experimental_encoder_thread_limit_;
+  const bool experimental_parallel_simulcast_encoding_;
 
   // This is a copy of restrictions (glorified max_pixel_count) set by
   // OnVideoSourceRestrictionsUpdated. It is used to scale down encoding